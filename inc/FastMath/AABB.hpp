@@ -0,0 +1,248 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+
+namespace FastMath
+{
+
+/// <summary>
+/// An axis-aligned bounding box defined by its minimum and maximum corner.
+/// </summary>
+/// <remarks>
+/// A default-constructed AABB is empty (`min` is \f(+\infty\f) and `max` is \f(-\infty\f))
+/// so that merging any point or box into it produces a valid box.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct AABB
+{
+    /// <summary>
+    /// The AABB value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// An empty AABB. Merging anything with an empty AABB produces the other operand.
+    /// </summary>
+    static const AABB<T> EMPTY;
+
+    /// <summary>
+    /// Default construct an empty AABB.
+    /// </summary>
+    constexpr AABB() noexcept;
+
+    /// <summary>
+    /// Construct an AABB from the minimum and maximum corners.
+    /// </summary>
+    /// <param name="min">The minimum corner of the box.</param>
+    /// <param name="max">The maximum corner of the box.</param>
+    constexpr AABB( const Vector<T, 3>& min, const Vector<T, 3>& max ) noexcept;
+
+    /// <summary>
+    /// Check if two AABBs are equal.
+    /// </summary>
+    /// <param name="rhs">The AABB to compare with this one.</param>
+    /// <returns>`true` if both corners are equal, `false` otherwise.</returns>
+    constexpr bool operator==( const AABB<T>& rhs ) const noexcept;
+
+    Vector<T, 3> min;
+    Vector<T, 3> max;
+};
+
+using AABBf = AABB<float>;
+using AABBd = AABB<double>;
+
+/// <summary>
+/// A structure-of-arrays view over a set of AABBs. This is the layout expected by
+/// the 8-wide batch functions.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct AABBSoA
+{
+    std::span<const T> minX, minY, minZ;
+    std::span<const T> maxX, maxY, maxZ;
+
+    /// <summary>
+    /// Get the number of AABBs in the view.
+    /// </summary>
+    /// <returns>The number of AABBs.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return minX.size();
+    }
+};
+
+template<typename T>
+inline const AABB<T> AABB<T>::EMPTY {};
+
+template<typename T>
+constexpr AABB<T>::AABB() noexcept
+: min { std::numeric_limits<T>::max() }
+, max { std::numeric_limits<T>::lowest() }
+{}
+
+template<typename T>
+constexpr AABB<T>::AABB( const Vector<T, 3>& min, const Vector<T, 3>& max ) noexcept
+: min { min }
+, max { max }
+{}
+
+template<typename T>
+constexpr bool AABB<T>::operator==( const AABB<T>& rhs ) const noexcept
+{
+    return min == rhs.min && max == rhs.max;
+}
+
+/// <summary>
+/// Check to see if the AABB is empty (any component of `min` is greater than `max`).
+/// </summary>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The AABB to check.</param>
+/// <returns>`true` if the AABB does not contain any points, `false` otherwise.</returns>
+template<typename T>
+constexpr bool isEmpty( const AABB<T>& a ) noexcept
+{
+    return a.min.x > a.max.x || a.min.y > a.max.y || a.min.z > a.max.z;
+}
+
+/// <summary>
+/// Compute the center of the AABB.
+/// </summary>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The AABB.</param>
+/// <returns>The center point of the AABB.</returns>
+template<typename T>
+constexpr Vector<T, 3> center( const AABB<T>& a ) noexcept
+{
+    return ( a.min + a.max ) * T( 0.5 );
+}
+
+/// <summary>
+/// Compute the half-extents of the AABB.
+/// </summary>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The AABB.</param>
+/// <returns>The distance from the center to the faces of the AABB along each axis.</returns>
+template<typename T>
+constexpr Vector<T, 3> extents( const AABB<T>& a ) noexcept
+{
+    return ( a.max - a.min ) * T( 0.5 );
+}
+
+/// <summary>
+/// Compute the surface area of the AABB.
+/// </summary>
+/// <remarks>
+/// The surface area of an empty AABB is 0.
+/// </remarks>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The AABB.</param>
+/// <returns>The surface area of the AABB.</returns>
+template<typename T>
+constexpr T surfaceArea( const AABB<T>& a ) noexcept
+{
+    if ( isEmpty( a ) )
+        return T( 0 );
+
+    const Vector<T, 3> d = a.max - a.min;
+    return T( 2 ) * ( d.x * d.y + d.y * d.z + d.z * d.x );
+}
+
+/// <summary>
+/// Compute the smallest AABB that contains both `a` and `b`.
+/// </summary>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The first AABB.</param>
+/// <param name="b">The second AABB.</param>
+/// <returns>The union of `a` and `b`.</returns>
+template<typename T>
+constexpr AABB<T> merge( const AABB<T>& a, const AABB<T>& b ) noexcept
+{
+    return {
+        { std::min( a.min.x, b.min.x ), std::min( a.min.y, b.min.y ), std::min( a.min.z, b.min.z ) },
+        { std::max( a.max.x, b.max.x ), std::max( a.max.y, b.max.y ), std::max( a.max.z, b.max.z ) }
+    };
+}
+
+/// <summary>
+/// Compute the smallest AABB that contains both `a` and the point `p`.
+/// </summary>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The AABB.</param>
+/// <param name="p">The point to add to the AABB.</param>
+/// <returns>The AABB that contains both `a` and `p`.</returns>
+template<typename T>
+constexpr AABB<T> merge( const AABB<T>& a, const Vector<T, 3>& p ) noexcept
+{
+    return merge( a, AABB<T> { p, p } );
+}
+
+/// <summary>
+/// Check to see if a point is inside (or on the boundary of) an AABB.
+/// </summary>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The AABB.</param>
+/// <param name="p">The point to check.</param>
+/// <returns>`true` if `p` is contained in `a`, `false` otherwise.</returns>
+template<typename T>
+constexpr bool contains( const AABB<T>& a, const Vector<T, 3>& p ) noexcept
+{
+    return p.x >= a.min.x && p.x <= a.max.x &&
+           p.y >= a.min.y && p.y <= a.max.y &&
+           p.z >= a.min.z && p.z <= a.max.z;
+}
+
+/// <summary>
+/// Check to see if two AABBs overlap.
+/// </summary>
+/// <remarks>
+/// Boxes that are touching are considered to be overlapping.
+/// </remarks>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="a">The first AABB.</param>
+/// <param name="b">The second AABB.</param>
+/// <returns>`true` if the AABBs overlap, `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const AABB<T>& a, const AABB<T>& b ) noexcept
+{
+    return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+           a.min.y <= b.max.y && a.max.y >= b.min.y &&
+           a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+
+/// <summary>
+/// Transform an AABB by an affine transformation matrix and return the AABB that
+/// bounds the transformed box.
+/// </summary>
+/// <seealso href="https://github.com/erich666/GraphicsGems/blob/master/gems/TransBox.c"/>
+/// <typeparam name="T">The AABB type.</typeparam>
+/// <param name="m">The affine transformation matrix.</param>
+/// <param name="a">The AABB to transform.</param>
+/// <returns>The AABB that contains the transformed box.</returns>
+template<typename T>
+constexpr AABB<T> transform( const Matrix<T, 4, 4>& m, const AABB<T>& a ) noexcept
+{
+    const Vector<T, 3> c = center( a );
+    const Vector<T, 3> e = extents( a );
+
+    Vector<T, 3> tc, te;
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        tc[i] = m[i][0] * c.x + m[i][1] * c.y + m[i][2] * c.z + m[i][3];
+        te[i] = std::abs( m[i][0] ) * e.x + std::abs( m[i][1] ) * e.y + std::abs( m[i][2] ) * e.z;
+    }
+
+    return { tc - te, tc + te };
+}
+
+}  // namespace FastMath
@@ -0,0 +1,1264 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The method used to interpolate between two rotation keys.
+/// </summary>
+enum class RotationInterpolation
+{
+    /// <summary>
+    /// Normalized linear interpolation (see `nlerp`).
+    /// </summary>
+    Nlerp,
+    /// <summary>
+    /// Spherical linear interpolation (see `slerp`).
+    /// </summary>
+    Slerp,
+    /// <summary>
+    /// Fast approximate spherical linear interpolation (see `fastSlerp`). This is
+    /// cheaper than `Slerp` and more accurate than `Nlerp`, with a maximum angular
+    /// error of about 2e-5 radians.
+    /// </summary>
+    FastSlerp,
+};
+
+/// <summary>
+/// Remembers the last key that was used to sample a track.
+/// </summary>
+/// <remarks>
+/// Each instance of an animation should keep one cursor per track. When the track is sampled
+/// with increasing times (normal playback), the key that brackets the sample time is found by
+/// stepping forward from the cursor, which makes sampling O(1) amortized instead of requiring a
+/// binary search for every sample. Jumping backwards or far ahead falls back to a binary search.
+/// </remarks>
+struct TrackCursor
+{
+    /// <summary>
+    /// The index of the first key of the last segment that was sampled.
+    /// </summary>
+    uint32_t key = 0;
+};
+
+/// <summary>
+/// A track of time-sorted rotation keys.
+/// </summary>
+/// <remarks>
+/// The keys are stored in structure-of-arrays layout (one array per quaternion component).
+/// Sampling times before the first key or after the last key are clamped to the first or last key.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct RotationTrack
+{
+    /// <summary>
+    /// The RotationTrack value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty track.
+    /// </summary>
+    RotationTrack() = default;
+
+    /// <summary>
+    /// Construct a track from a set of keys.
+    /// </summary>
+    /// <seealso cref="setKeys"/>
+    /// <param name="times">The time of each key (in increasing order).</param>
+    /// <param name="keys">The rotation at each key.</param>
+    RotationTrack( std::span<const T> times, std::span<const Quaternion<T>> keys );
+
+    /// <summary>
+    /// Replace the keys of the track.
+    /// </summary>
+    /// <param name="times">The time of each key. Must be sorted in non-decreasing order.</param>
+    /// <param name="keys">The rotation at each key. Must have the same size as `times`.</param>
+    void setKeys( std::span<const T> times, std::span<const Quaternion<T>> keys );
+
+    /// <summary>
+    /// Check to see if the track is empty.
+    /// </summary>
+    /// <returns>`true` if the track does not have any keys.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of keys in the track.
+    /// </summary>
+    /// <returns>The number of keys.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the time of the first key.
+    /// </summary>
+    /// <returns>The time of the first key, or 0 if the track is empty.</returns>
+    T getStartTime() const noexcept;
+
+    /// <summary>
+    /// Get the time of the last key.
+    /// </summary>
+    /// <returns>The time of the last key, or 0 if the track is empty.</returns>
+    T getEndTime() const noexcept;
+
+    /// <summary>
+    /// Get the key times.
+    /// </summary>
+    /// <returns>The time of each key.</returns>
+    std::span<const T> getTimes() const noexcept;
+
+    /// <summary>
+    /// Get a key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The rotation at key `i`.</returns>
+    Quaternion<T> getKey( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Find the keys that bracket a time.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor to start the search from. Receives the index of the returned key.</param>
+    /// <param name="u">Receives the interpolation factor (in the range [0..1]) between key `i` and key `i + 1`.</param>
+    /// <returns>The index `i` of the first key. The second key is `min( i + 1, size() - 1 )`.</returns>
+    std::size_t findKey( T time, TrackCursor& cursor, T& u ) const noexcept;
+
+    /// <summary>
+    /// Sample the track.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor of the animation instance that is sampling the track.</param>
+    /// <param name="interpolation">The interpolation method.</param>
+    /// <returns>The interpolated rotation at `time`, or identity if the track is empty.</returns>
+    Quaternion<T> sample( T time, TrackCursor& cursor, RotationInterpolation interpolation = RotationInterpolation::Slerp ) const noexcept;
+
+    /// <summary>
+    /// Sample the track without a cursor (using a binary search).
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="interpolation">The interpolation method.</param>
+    /// <returns>The interpolated rotation at `time`, or identity if the track is empty.</returns>
+    Quaternion<T> sample( T time, RotationInterpolation interpolation = RotationInterpolation::Slerp ) const noexcept;
+
+private:
+    std::vector<T> times;
+    std::vector<T> w, x, y, z;
+};
+
+using RotationTrackf = RotationTrack<float>;
+using RotationTrackd = RotationTrack<double>;
+
+/// <summary>
+/// A track of time-sorted vector keys (for example, translation or scale).
+/// </summary>
+/// <remarks>
+/// The keys are stored in structure-of-arrays layout (one array per vector component) and are
+/// linearly interpolated. Sampling times before the first key or after the last key are clamped
+/// to the first or last key.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N = 3>
+struct VectorTrack
+{
+    /// <summary>
+    /// The VectorTrack value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty track.
+    /// </summary>
+    VectorTrack() = default;
+
+    /// <summary>
+    /// Construct a track from a set of keys.
+    /// </summary>
+    /// <seealso cref="setKeys"/>
+    /// <param name="times">The time of each key (in increasing order).</param>
+    /// <param name="keys">The value at each key.</param>
+    VectorTrack( std::span<const T> times, std::span<const Vector<T, N>> keys );
+
+    /// <summary>
+    /// Replace the keys of the track.
+    /// </summary>
+    /// <param name="times">The time of each key. Must be sorted in non-decreasing order.</param>
+    /// <param name="keys">The value at each key. Must have the same size as `times`.</param>
+    void setKeys( std::span<const T> times, std::span<const Vector<T, N>> keys );
+
+    /// <summary>
+    /// Check to see if the track is empty.
+    /// </summary>
+    /// <returns>`true` if the track does not have any keys.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of keys in the track.
+    /// </summary>
+    /// <returns>The number of keys.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the time of the first key.
+    /// </summary>
+    /// <returns>The time of the first key, or 0 if the track is empty.</returns>
+    T getStartTime() const noexcept;
+
+    /// <summary>
+    /// Get the time of the last key.
+    /// </summary>
+    /// <returns>The time of the last key, or 0 if the track is empty.</returns>
+    T getEndTime() const noexcept;
+
+    /// <summary>
+    /// Get the key times.
+    /// </summary>
+    /// <returns>The time of each key.</returns>
+    std::span<const T> getTimes() const noexcept;
+
+    /// <summary>
+    /// Get a key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The value at key `i`.</returns>
+    Vector<T, N> getKey( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Find the keys that bracket a time.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor to start the search from. Receives the index of the returned key.</param>
+    /// <param name="u">Receives the interpolation factor (in the range [0..1]) between key `i` and key `i + 1`.</param>
+    /// <returns>The index `i` of the first key. The second key is `min( i + 1, size() - 1 )`.</returns>
+    std::size_t findKey( T time, TrackCursor& cursor, T& u ) const noexcept;
+
+    /// <summary>
+    /// Sample the track.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor of the animation instance that is sampling the track.</param>
+    /// <returns>The interpolated value at `time`, or zero if the track is empty.</returns>
+    Vector<T, N> sample( T time, TrackCursor& cursor ) const noexcept;
+
+    /// <summary>
+    /// Sample the track without a cursor (using a binary search).
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <returns>The interpolated value at `time`, or zero if the track is empty.</returns>
+    Vector<T, N> sample( T time ) const noexcept;
+
+private:
+    std::vector<T>                times;
+    std::array<std::vector<T>, N> components;
+};
+
+template<typename T>
+using TranslationTrack = VectorTrack<T, 3>;
+template<typename T>
+using ScaleTrack = VectorTrack<T, 3>;
+
+using VectorTrackf = VectorTrack<float>;
+using VectorTrackd = VectorTrack<double>;
+
+/// <summary>
+/// A smooth rotation spline through a set of keys using spherical quadrangle interpolation (squad).
+/// </summary>
+/// <remarks>
+/// Evaluating `squad` directly requires the intermediate control points (see `intermediate`)
+/// and three slerps for every sample. The spline precomputes the control points and, for each
+/// segment, the angles between the keys and between the control points together with the
+/// reciprocal of their sines. Evaluating a sample then only requires one `acos` (for the final
+/// slerp) and a few `sin` evaluations.
+///
+/// The keys are made hemisphere-consistent (each key is negated if necessary so that it is on
+/// the same side as the previous key) before computing the control points, so the spline always
+/// takes the shortest path between keys. Sampling times before the first key or after the last
+/// key are clamped to the first or last key.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct SquadSpline
+{
+    /// <summary>
+    /// The SquadSpline value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty spline.
+    /// </summary>
+    SquadSpline() = default;
+
+    /// <summary>
+    /// Construct a spline through a set of keys.
+    /// </summary>
+    /// <seealso cref="setKeys"/>
+    /// <param name="times">The time of each key (in increasing order).</param>
+    /// <param name="keys">The rotation at each key.</param>
+    SquadSpline( std::span<const T> times, std::span<const Quaternion<T>> keys );
+
+    /// <summary>
+    /// Replace the keys of the spline and precompute the control points.
+    /// </summary>
+    /// <param name="times">The time of each key. Must be sorted in non-decreasing order.</param>
+    /// <param name="keys">The rotation at each key (should be normalized). Must have the same size as `times`.</param>
+    void setKeys( std::span<const T> times, std::span<const Quaternion<T>> keys );
+
+    /// <summary>
+    /// Check to see if the spline is empty.
+    /// </summary>
+    /// <returns>`true` if the spline does not have any keys.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of keys in the spline.
+    /// </summary>
+    /// <returns>The number of keys.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the key times.
+    /// </summary>
+    /// <returns>The time of each key.</returns>
+    std::span<const T> getTimes() const noexcept;
+
+    /// <summary>
+    /// Get a key.
+    /// </summary>
+    /// <remarks>
+    /// The key may be the negation of the key that was passed to `setKeys` (which represents the same rotation).
+    /// </remarks>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The rotation at key `i`.</returns>
+    Quaternion<T> getKey( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Get the intermediate control point of a key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The control point \f(s_i\f) of key `i`.</returns>
+    Quaternion<T> getControlPoint( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the spline.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor to start the key search from.</param>
+    /// <returns>The rotation at `time`, or identity if the spline is empty.</returns>
+    Quaternion<T> evaluate( T time, TrackCursor& cursor ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the spline without a cursor (using a binary search).
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <returns>The rotation at `time`, or identity if the spline is empty.</returns>
+    Quaternion<T> evaluate( T time ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the spline at many times.
+    /// </summary>
+    /// <remarks>
+    /// The samples are evaluated 8 at a time using AVX2 (when enabled). The keys are found
+    /// using a cursor, so sorting the times in increasing order makes the key search O(1) amortized.
+    /// </remarks>
+    /// <param name="sampleTimes">The sample times.</param>
+    /// <param name="results">Receives the rotation at each time. Must have the same size as `sampleTimes`.</param>
+    void evaluate( std::span<const T> sampleTimes, std::span<Quaternion<T>> results ) const noexcept;
+
+private:
+    // Compute the interpolation weights for a segment with a precomputed angle and 1 / sin( angle ).
+    static void weights( T angle, T invSin, T u, T& w0, T& w1 ) noexcept;
+
+    std::vector<T> times;
+    // The keys.
+    std::vector<T> w, x, y, z;
+    // The intermediate control points.
+    std::vector<T> sw, sx, sy, sz;
+    // The angle between the keys (and control points) of each segment, and 1 / sin( angle ).
+    // If the angle is too small, 1 / sin( angle ) is 0 and the segment is linearly interpolated.
+    std::vector<T> keyAngle, keyInvSin;
+    std::vector<T> controlAngle, controlInvSin;
+};
+
+using SquadSplinef = SquadSpline<float>;
+using SquadSplined = SquadSpline<double>;
+
+namespace detail
+{
+// The number of keys to step forward from the cursor before falling back to a binary search.
+inline constexpr std::size_t TRACK_LINEAR_SEARCH = 4;
+
+// Find the segment [i, i + 1] that contains `time`, starting the search at `cursor`.
+// The key times may be stored with a different type (K) than the sample time (T).
+template<typename K, typename T>
+std::size_t findKey( const std::vector<K>& times, T time, uint32_t& cursor, T& u ) noexcept
+{
+    const std::size_t n = times.size();
+    if ( n < 2 )
+    {
+        cursor = 0;
+        u      = T( 0 );
+        return 0;
+    }
+
+    // The index of the first key of the last segment.
+    const std::size_t last = n - 2;
+
+    // The number of keys in [1..last] that are <= time is the index of the segment.
+    auto search = [&]() {
+        return static_cast<std::size_t>( std::upper_bound( times.begin() + 1, times.begin() + last + 1, time ) - ( times.begin() + 1 ) );
+    };
+
+    std::size_t i = std::min<std::size_t>( cursor, last );
+    if ( i > 0 && time < times[i] )
+    {
+        i = search();
+    }
+    else
+    {
+        for ( std::size_t step = 0; i < last && time >= times[i + 1]; ++step )
+        {
+            if ( step == TRACK_LINEAR_SEARCH )
+            {
+                i = search();
+                break;
+            }
+            ++i;
+        }
+    }
+
+    cursor = static_cast<uint32_t>( i );
+
+    const T t0 = static_cast<T>( times[i] );
+    const T dt = static_cast<T>( times[i + 1] ) - t0;
+    u          = dt > T( 0 ) ? std::clamp( ( time - t0 ) / dt, T( 0 ), T( 1 ) ) : T( 0 );
+
+    // Clamp to the last key.
+    if ( time >= times[last + 1] )
+        u = T( 1 );
+
+    return i;
+}
+
+// Interpolate two quaternions using the given method.
+template<typename T>
+Quaternion<T> interpolate( const Quaternion<T>& q0, const Quaternion<T>& q1, T t, RotationInterpolation interpolation ) noexcept
+{
+    switch ( interpolation )
+    {
+    case RotationInterpolation::Nlerp:
+        return nlerp( q0, q1, t );
+    case RotationInterpolation::FastSlerp:
+        return fastSlerp( q0, q1, t );
+    case RotationInterpolation::Slerp:
+    default:
+        return slerp( q0, q1, t );
+    }
+}
+
+#if defined( LS_AVX2 )
+// sin( x ) for x in [0, pi/2] (Taylor polynomial, |error| < 6e-8).
+inline __m256 sin8( __m256 x ) noexcept
+{
+    const __m256 x2 = _mm256_mul_ps( x, x );
+
+    __m256 p = _mm256_set1_ps( -1.0f / 39916800.0f );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x2 ), _mm256_set1_ps( 1.0f / 362880.0f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x2 ), _mm256_set1_ps( -1.0f / 5040.0f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x2 ), _mm256_set1_ps( 1.0f / 120.0f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x2 ), _mm256_set1_ps( -1.0f / 6.0f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x2 ), _mm256_set1_ps( 1.0f ) );
+
+    return _mm256_mul_ps( p, x );
+}
+
+// acos( x ) for x in [0, 1] (Abramowitz and Stegun 4.4.46, |error| < 2e-8).
+inline __m256 acos8( __m256 x ) noexcept
+{
+    __m256 p = _mm256_set1_ps( -0.0012624911f );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( 0.0066700901f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( -0.0170881256f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( 0.0308918810f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( -0.0501743046f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( 0.0889789874f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( -0.2145988016f ) );
+    p        = _mm256_add_ps( _mm256_mul_ps( p, x ), _mm256_set1_ps( 1.5707963050f ) );
+
+    const __m256 s = _mm256_sqrt_ps( _mm256_max_ps( _mm256_sub_ps( _mm256_set1_ps( 1.0f ), x ), _mm256_setzero_ps() ) );
+    return _mm256_mul_ps( p, s );
+}
+
+// Linear interpolation weights.
+inline void lerpWeights8( __m256 t, __m256& w0, __m256& w1 ) noexcept
+{
+    w0 = _mm256_sub_ps( _mm256_set1_ps( 1.0f ), t );
+    w1 = t;
+}
+
+// Slerp weights given the cosine of the angle between the quaternions (c >= 0).
+inline void slerpWeights8( __m256 c, __m256 t, __m256& w0, __m256& w1 ) noexcept
+{
+    const __m256 one   = _mm256_set1_ps( 1.0f );
+    const __m256 angle = acos8( _mm256_min_ps( c, one ) );
+    const __m256 sinA  = sin8( angle );
+    const __m256 s0    = _mm256_div_ps( sin8( _mm256_mul_ps( _mm256_sub_ps( one, t ), angle ) ), sinA );
+    const __m256 s1    = _mm256_div_ps( sin8( _mm256_mul_ps( t, angle ) ), sinA );
+
+    // Fall back to linear interpolation if the angle is close to 0.
+    const __m256 small = _mm256_cmp_ps( c, _mm256_set1_ps( 1.0f - EPSILON<float> ), _CMP_GT_OQ );
+    lerpWeights8( t, w0, w1 );
+    w0 = _mm256_blendv_ps( s0, w0, small );
+    w1 = _mm256_blendv_ps( s1, w1, small );
+}
+
+// Approximate slerp weights given the cosine of the angle between the quaternions (c >= 0).
+// This is the same polynomial as fastSlerp.
+inline void fastSlerpWeights8( __m256 c, __m256 t, __m256& w0, __m256& w1 ) noexcept
+{
+    constexpr float MU   = 1.85298109240830f;
+    constexpr float u[8] = { 1.0f / 3.0f, 1.0f / 10.0f, 1.0f / 21.0f, 1.0f / 36.0f, 1.0f / 55.0f, 1.0f / 78.0f, 1.0f / 105.0f, MU / 136.0f };
+    constexpr float v[8] = { 1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f, 5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, MU * 8.0f / 17.0f };
+
+    const __m256 one = _mm256_set1_ps( 1.0f );
+    const __m256 cm1 = _mm256_sub_ps( c, one );
+    const __m256 d   = _mm256_sub_ps( one, t );
+    const __m256 tt  = _mm256_mul_ps( t, t );
+    const __m256 dd  = _mm256_mul_ps( d, d );
+
+    __m256 f0 = one;
+    __m256 f1 = one;
+    for ( int i = 7; i >= 0; --i )
+    {
+        const __m256 ui = _mm256_set1_ps( u[i] );
+        const __m256 vi = _mm256_set1_ps( v[i] );
+
+        f0 = _mm256_add_ps( one, _mm256_mul_ps( _mm256_mul_ps( _mm256_sub_ps( _mm256_mul_ps( ui, dd ), vi ), cm1 ), f0 ) );
+        f1 = _mm256_add_ps( one, _mm256_mul_ps( _mm256_mul_ps( _mm256_sub_ps( _mm256_mul_ps( ui, tt ), vi ), cm1 ), f1 ) );
+    }
+
+    w0 = _mm256_mul_ps( d, f0 );
+    w1 = _mm256_mul_ps( t, f1 );
+}
+
+// Interpolate 8 pairs of quaternions stored in SoA (w, x, y, z) order.
+inline void interpolate8( const float ( &q0 )[4][8], const float ( &q1 )[4][8], const float* u, float ( &q )[4][8], RotationInterpolation interpolation ) noexcept
+{
+    __m256 p0[4], p1[4];
+    for ( int k = 0; k < 4; ++k )
+    {
+        p0[k] = _mm256_load_ps( q0[k] );
+        p1[k] = _mm256_load_ps( q1[k] );
+    }
+
+    const __m256 t   = _mm256_load_ps( u );
+    const __m256 one = _mm256_set1_ps( 1.0f );
+
+    __m256 c = _mm256_mul_ps( p0[0], p1[0] );
+    for ( int k = 1; k < 4; ++k )
+        c = _mm256_add_ps( c, _mm256_mul_ps( p0[k], p1[k] ) );
+
+    // Negate q1 to take the shortest path.
+    const __m256 sign = _mm256_and_ps( c, _mm256_set1_ps( -0.0f ) );
+    for ( int k = 0; k < 4; ++k )
+        p1[k] = _mm256_xor_ps( p1[k], sign );
+    c = _mm256_xor_ps( c, sign );
+
+    __m256 w0, w1;
+    switch ( interpolation )
+    {
+    case RotationInterpolation::Nlerp:
+        lerpWeights8( t, w0, w1 );
+        break;
+    case RotationInterpolation::FastSlerp:
+        fastSlerpWeights8( c, t, w0, w1 );
+        break;
+    case RotationInterpolation::Slerp:
+    default:
+        slerpWeights8( c, t, w0, w1 );
+        break;
+    }
+
+    __m256 r[4];
+    for ( int k = 0; k < 4; ++k )
+        r[k] = _mm256_add_ps( _mm256_mul_ps( p0[k], w0 ), _mm256_mul_ps( p1[k], w1 ) );
+
+    if ( interpolation == RotationInterpolation::Nlerp )
+    {
+        __m256 l = _mm256_mul_ps( r[0], r[0] );
+        for ( int k = 1; k < 4; ++k )
+            l = _mm256_add_ps( l, _mm256_mul_ps( r[k], r[k] ) );
+
+        const __m256 invL = _mm256_div_ps( one, _mm256_sqrt_ps( l ) );
+        for ( int k = 0; k < 4; ++k )
+            r[k] = _mm256_mul_ps( r[k], invL );
+    }
+
+    for ( int k = 0; k < 4; ++k )
+        _mm256_store_ps( q[k], r[k] );
+}
+#endif
+}  // namespace detail
+
+template<typename T>
+RotationTrack<T>::RotationTrack( std::span<const T> times, std::span<const Quaternion<T>> keys )
+{
+    setKeys( times, keys );
+}
+
+template<typename T>
+void RotationTrack<T>::setKeys( std::span<const T> _times, std::span<const Quaternion<T>> keys )
+{
+    assert( _times.size() == keys.size() );
+    assert( std::is_sorted( _times.begin(), _times.end() ) );
+
+    times.assign( _times.begin(), _times.end() );
+
+    w.resize( keys.size() );
+    x.resize( keys.size() );
+    y.resize( keys.size() );
+    z.resize( keys.size() );
+
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        w[i] = keys[i].w;
+        x[i] = keys[i].x;
+        y[i] = keys[i].y;
+        z[i] = keys[i].z;
+    }
+}
+
+template<typename T>
+bool RotationTrack<T>::empty() const noexcept
+{
+    return times.empty();
+}
+
+template<typename T>
+std::size_t RotationTrack<T>::size() const noexcept
+{
+    return times.size();
+}
+
+template<typename T>
+T RotationTrack<T>::getStartTime() const noexcept
+{
+    return times.empty() ? T( 0 ) : times.front();
+}
+
+template<typename T>
+T RotationTrack<T>::getEndTime() const noexcept
+{
+    return times.empty() ? T( 0 ) : times.back();
+}
+
+template<typename T>
+std::span<const T> RotationTrack<T>::getTimes() const noexcept
+{
+    return times;
+}
+
+template<typename T>
+Quaternion<T> RotationTrack<T>::getKey( std::size_t i ) const noexcept
+{
+    assert( i < times.size() );
+
+    return { w[i], x[i], y[i], z[i] };
+}
+
+template<typename T>
+std::size_t RotationTrack<T>::findKey( T time, TrackCursor& cursor, T& u ) const noexcept
+{
+    return detail::findKey( times, time, cursor.key, u );
+}
+
+template<typename T>
+Quaternion<T> RotationTrack<T>::sample( T time, TrackCursor& cursor, RotationInterpolation interpolation ) const noexcept
+{
+    if ( times.empty() )
+        return Quaternion<T>::IDENTITY;
+
+    T                 u;
+    const std::size_t i  = findKey( time, cursor, u );
+    const std::size_t j  = std::min( i + 1, times.size() - 1 );
+    const auto        q0 = getKey( i );
+    const auto        q1 = getKey( j );
+
+    return detail::interpolate( q0, q1, u, interpolation );
+}
+
+template<typename T>
+Quaternion<T> RotationTrack<T>::sample( T time, RotationInterpolation interpolation ) const noexcept
+{
+    // Start from the last segment so that any time before the end uses a binary search.
+    TrackCursor cursor { static_cast<uint32_t>( times.size() ) };
+    return sample( time, cursor, interpolation );
+}
+
+template<typename T, std::size_t N>
+VectorTrack<T, N>::VectorTrack( std::span<const T> times, std::span<const Vector<T, N>> keys )
+{
+    setKeys( times, keys );
+}
+
+template<typename T, std::size_t N>
+void VectorTrack<T, N>::setKeys( std::span<const T> _times, std::span<const Vector<T, N>> keys )
+{
+    assert( _times.size() == keys.size() );
+    assert( std::is_sorted( _times.begin(), _times.end() ) );
+
+    times.assign( _times.begin(), _times.end() );
+
+    for ( std::size_t k = 0; k < N; ++k )
+    {
+        components[k].resize( keys.size() );
+
+        for ( std::size_t i = 0; i < keys.size(); ++i )
+            components[k][i] = keys[i][k];
+    }
+}
+
+template<typename T, std::size_t N>
+bool VectorTrack<T, N>::empty() const noexcept
+{
+    return times.empty();
+}
+
+template<typename T, std::size_t N>
+std::size_t VectorTrack<T, N>::size() const noexcept
+{
+    return times.size();
+}
+
+template<typename T, std::size_t N>
+T VectorTrack<T, N>::getStartTime() const noexcept
+{
+    return times.empty() ? T( 0 ) : times.front();
+}
+
+template<typename T, std::size_t N>
+T VectorTrack<T, N>::getEndTime() const noexcept
+{
+    return times.empty() ? T( 0 ) : times.back();
+}
+
+template<typename T, std::size_t N>
+std::span<const T> VectorTrack<T, N>::getTimes() const noexcept
+{
+    return times;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> VectorTrack<T, N>::getKey( std::size_t i ) const noexcept
+{
+    assert( i < times.size() );
+
+    Vector<T, N> v;
+    for ( std::size_t k = 0; k < N; ++k )
+        v[k] = components[k][i];
+
+    return v;
+}
+
+template<typename T, std::size_t N>
+std::size_t VectorTrack<T, N>::findKey( T time, TrackCursor& cursor, T& u ) const noexcept
+{
+    return detail::findKey( times, time, cursor.key, u );
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> VectorTrack<T, N>::sample( T time, TrackCursor& cursor ) const noexcept
+{
+    if ( times.empty() )
+        return Vector<T, N> { T( 0 ) };
+
+    T                 u;
+    const std::size_t i = findKey( time, cursor, u );
+    const std::size_t j = std::min( i + 1, times.size() - 1 );
+
+    Vector<T, N> v;
+    for ( std::size_t k = 0; k < N; ++k )
+        v[k] = components[k][i] + ( components[k][j] - components[k][i] ) * u;
+
+    return v;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> VectorTrack<T, N>::sample( T time ) const noexcept
+{
+    TrackCursor cursor { static_cast<uint32_t>( times.size() ) };
+    return sample( time, cursor );
+}
+
+template<typename T>
+SquadSpline<T>::SquadSpline( std::span<const T> times, std::span<const Quaternion<T>> keys )
+{
+    setKeys( times, keys );
+}
+
+template<typename T>
+void SquadSpline<T>::setKeys( std::span<const T> _times, std::span<const Quaternion<T>> keys )
+{
+    assert( _times.size() == keys.size() );
+    assert( std::is_sorted( _times.begin(), _times.end() ) );
+
+    const std::size_t n = keys.size();
+
+    times.assign( _times.begin(), _times.end() );
+
+    // Make the keys hemisphere-consistent.
+    std::vector<Quaternion<T>> q( keys.begin(), keys.end() );
+    for ( std::size_t i = 1; i < n; ++i )
+    {
+        if ( dot( q[i - 1], q[i] ) < T( 0 ) )
+            q[i] = q[i] * T( -1 );
+    }
+
+    // Intermediate control points. The end points use their own key as the missing neighbor.
+    std::vector<Quaternion<T>> s( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        s[i] = normalize( intermediate( q[i > 0 ? i - 1 : i], q[i], q[i + 1 < n ? i + 1 : i] ) );
+
+        // Negating a control point does not change the rotation, but it makes the angle between
+        // consecutive control points the shortest path (which is what slerp would use).
+        if ( i > 0 && dot( s[i - 1], s[i] ) < T( 0 ) )
+            s[i] = s[i] * T( -1 );
+    }
+
+    w.resize( n );
+    x.resize( n );
+    y.resize( n );
+    z.resize( n );
+    sw.resize( n );
+    sx.resize( n );
+    sy.resize( n );
+    sz.resize( n );
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        w[i]  = q[i].w;
+        x[i]  = q[i].x;
+        y[i]  = q[i].y;
+        z[i]  = q[i].z;
+        sw[i] = s[i].w;
+        sx[i] = s[i].x;
+        sy[i] = s[i].y;
+        sz[i] = s[i].z;
+    }
+
+    auto angle = []( const Quaternion<T>& a, const Quaternion<T>& b, T& theta, T& invSin ) {
+        const T c = std::min( dot( a, b ), T( 1 ) );
+
+        // Same threshold as slerp.
+        if ( c > T( 1 ) - EPSILON<T> )
+        {
+            theta  = T( 0 );
+            invSin = T( 0 );
+        }
+        else
+        {
+            theta  = std::acos( c );
+            invSin = T( 1 ) / std::sin( theta );
+        }
+    };
+
+    const std::size_t segments = n > 0 ? n - 1 : 0;
+    keyAngle.resize( segments );
+    keyInvSin.resize( segments );
+    controlAngle.resize( segments );
+    controlInvSin.resize( segments );
+
+    for ( std::size_t i = 0; i < segments; ++i )
+    {
+        angle( q[i], q[i + 1], keyAngle[i], keyInvSin[i] );
+        angle( s[i], s[i + 1], controlAngle[i], controlInvSin[i] );
+    }
+}
+
+template<typename T>
+bool SquadSpline<T>::empty() const noexcept
+{
+    return times.empty();
+}
+
+template<typename T>
+std::size_t SquadSpline<T>::size() const noexcept
+{
+    return times.size();
+}
+
+template<typename T>
+std::span<const T> SquadSpline<T>::getTimes() const noexcept
+{
+    return times;
+}
+
+template<typename T>
+Quaternion<T> SquadSpline<T>::getKey( std::size_t i ) const noexcept
+{
+    assert( i < times.size() );
+
+    return { w[i], x[i], y[i], z[i] };
+}
+
+template<typename T>
+Quaternion<T> SquadSpline<T>::getControlPoint( std::size_t i ) const noexcept
+{
+    assert( i < times.size() );
+
+    return { sw[i], sx[i], sy[i], sz[i] };
+}
+
+template<typename T>
+void SquadSpline<T>::weights( T angle, T invSin, T u, T& w0, T& w1 ) noexcept
+{
+    if ( invSin == T( 0 ) )
+    {
+        w0 = T( 1 ) - u;
+        w1 = u;
+    }
+    else
+    {
+        w0 = std::sin( ( T( 1 ) - u ) * angle ) * invSin;
+        w1 = std::sin( u * angle ) * invSin;
+    }
+}
+
+template<typename T>
+Quaternion<T> SquadSpline<T>::evaluate( T time, TrackCursor& cursor ) const noexcept
+{
+    if ( times.empty() )
+        return Quaternion<T>::IDENTITY;
+
+    T                 u;
+    const std::size_t i = detail::findKey( times, time, cursor.key, u );
+
+    if ( times.size() == 1 )
+        return getKey( 0 );
+
+    T w0, w1, v0, v1;
+    weights( keyAngle[i], keyInvSin[i], u, w0, w1 );
+    weights( controlAngle[i], controlInvSin[i], u, v0, v1 );
+
+    const Quaternion<T> a = getKey( i ) * w0 + getKey( i + 1 ) * w1;
+    const Quaternion<T> b = getControlPoint( i ) * v0 + getControlPoint( i + 1 ) * v1;
+
+    return slerp( a, b, T( 2 ) * u * ( T( 1 ) - u ) );
+}
+
+template<typename T>
+Quaternion<T> SquadSpline<T>::evaluate( T time ) const noexcept
+{
+    TrackCursor cursor { static_cast<uint32_t>( times.size() ) };
+    return evaluate( time, cursor );
+}
+
+template<typename T>
+void SquadSpline<T>::evaluate( std::span<const T> sampleTimes, std::span<Quaternion<T>> results ) const noexcept
+{
+    assert( results.size() == sampleTimes.size() );
+
+    TrackCursor cursor;
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        if ( times.size() > 1 )
+        {
+            const __m256 one = _mm256_set1_ps( 1.0f );
+
+            for ( ; i + Simd::WIDTH <= sampleTimes.size(); i += Simd::WIDTH )
+            {
+                alignas( 32 ) float u[8];
+                alignas( 32 ) float q0[4][8], q1[4][8], s0[4][8], s1[4][8];
+                alignas( 32 ) float qa[8], qs[8], sa[8], ss[8];
+
+                for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                {
+                    const std::size_t k = detail::findKey( times, sampleTimes[i + j], cursor.key, u[j] );
+
+                    q0[0][j] = w[k];
+                    q0[1][j] = x[k];
+                    q0[2][j] = y[k];
+                    q0[3][j] = z[k];
+                    q1[0][j] = w[k + 1];
+                    q1[1][j] = x[k + 1];
+                    q1[2][j] = y[k + 1];
+                    q1[3][j] = z[k + 1];
+                    s0[0][j] = sw[k];
+                    s0[1][j] = sx[k];
+                    s0[2][j] = sy[k];
+                    s0[3][j] = sz[k];
+                    s1[0][j] = sw[k + 1];
+                    s1[1][j] = sx[k + 1];
+                    s1[2][j] = sy[k + 1];
+                    s1[3][j] = sz[k + 1];
+                    qa[j]    = keyAngle[k];
+                    qs[j]    = keyInvSin[k];
+                    sa[j]    = controlAngle[k];
+                    ss[j]    = controlInvSin[k];
+                }
+
+                const __m256 t    = _mm256_load_ps( u );
+                const __m256 tInv = _mm256_sub_ps( one, t );
+                const __m256 zero = _mm256_setzero_ps();
+
+                // The inner slerps use the precomputed angles (or lerp if the angle is too small).
+                auto inner = [&]( const float* angle, const float* invSin, __m256& w0, __m256& w1 ) {
+                    const __m256 a = _mm256_load_ps( angle );
+                    const __m256 s = _mm256_load_ps( invSin );
+                    const __m256 l = _mm256_cmp_ps( s, zero, _CMP_EQ_OQ );
+
+                    w0 = _mm256_blendv_ps( _mm256_mul_ps( detail::sin8( _mm256_mul_ps( tInv, a ) ), s ), tInv, l );
+                    w1 = _mm256_blendv_ps( _mm256_mul_ps( detail::sin8( _mm256_mul_ps( t, a ) ), s ), t, l );
+                };
+
+                __m256 w0, w1, v0, v1;
+                inner( qa, qs, w0, w1 );
+                inner( sa, ss, v0, v1 );
+
+                __m256 a[4], b[4];
+                __m256 c = zero;
+                for ( int k = 0; k < 4; ++k )
+                {
+                    a[k] = _mm256_add_ps( _mm256_mul_ps( _mm256_load_ps( q0[k] ), w0 ), _mm256_mul_ps( _mm256_load_ps( q1[k] ), w1 ) );
+                    b[k] = _mm256_add_ps( _mm256_mul_ps( _mm256_load_ps( s0[k] ), v0 ), _mm256_mul_ps( _mm256_load_ps( s1[k] ), v1 ) );
+                    c    = _mm256_add_ps( c, _mm256_mul_ps( a[k], b[k] ) );
+                }
+
+                // The outer slerp takes the shortest path.
+                const __m256 sign = _mm256_and_ps( c, _mm256_set1_ps( -0.0f ) );
+                c                 = _mm256_xor_ps( c, sign );
+
+                __m256 h0, h1;
+                detail::slerpWeights8( c, _mm256_mul_ps( _mm256_set1_ps( 2.0f ), _mm256_mul_ps( t, tInv ) ), h0, h1 );
+                h1 = _mm256_xor_ps( h1, sign );
+
+                alignas( 32 ) float r[4][8];
+                for ( int k = 0; k < 4; ++k )
+                    _mm256_store_ps( r[k], _mm256_add_ps( _mm256_mul_ps( a[k], h0 ), _mm256_mul_ps( b[k], h1 ) ) );
+
+                for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                    results[i + j] = { r[0][j], r[1][j], r[2][j], r[3][j] };
+            }
+        }
+    }
+#endif
+
+    for ( ; i < sampleTimes.size(); ++i )
+        results[i] = evaluate( sampleTimes[i], cursor );
+}
+
+/// <summary>
+/// Sample many rotation tracks (for example, all bones of an animation clip) at the same time.
+/// </summary>
+/// <remarks>
+/// The keys of each track are found using the track's cursor, and then the rotations are
+/// interpolated 8 tracks at a time using AVX2 (when enabled). The SIMD slerp uses polynomial
+/// approximations of `acos` and `sin` that are accurate to about 1e-7.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="tracks">The tracks to sample.</param>
+/// <param name="time">The sample time.</param>
+/// <param name="cursors">The cursor for each track. Must have the same size as `tracks`.</param>
+/// <param name="results">Receives the sampled rotation of each track. Must have the same size as `tracks`.</param>
+/// <param name="interpolation">The interpolation method.</param>
+template<typename T>
+void sample( std::span<const RotationTrack<std::type_identity_t<T>>> tracks, T time, std::span<TrackCursor> cursors, std::span<Quaternion<std::type_identity_t<T>>> results,
+             RotationInterpolation interpolation = RotationInterpolation::Slerp ) noexcept
+{
+    assert( cursors.size() == tracks.size() );
+    assert( results.size() == tracks.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        alignas( 32 ) float q0[4][8];
+        alignas( 32 ) float q1[4][8];
+        alignas( 32 ) float q[4][8];
+        alignas( 32 ) float u[8];
+
+        for ( ; i + Simd::WIDTH <= tracks.size(); i += Simd::WIDTH )
+        {
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                const RotationTrack<float>& track = tracks[i + j];
+
+                Quaternion<float> a, b;
+                if ( !track.empty() )
+                {
+                    const std::size_t k = track.findKey( time, cursors[i + j], u[j] );
+                    a                   = track.getKey( k );
+                    b                   = track.getKey( std::min( k + 1, track.size() - 1 ) );
+                }
+                else
+                {
+                    u[j] = 0.0f;
+                }
+
+                for ( std::size_t c = 0; c < 4; ++c )
+                {
+                    q0[c][j] = a[c];
+                    q1[c][j] = b[c];
+                }
+            }
+
+            detail::interpolate8( q0, q1, u, q, interpolation );
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                results[i + j] = { q[0][j], q[1][j], q[2][j], q[3][j] };
+        }
+    }
+#endif
+
+    for ( ; i < tracks.size(); ++i )
+        results[i] = tracks[i].sample( time, cursors[i], interpolation );
+}
+
+/// <summary>
+/// Interpolate many pairs of quaternions (for example, to blend two poses).
+/// </summary>
+/// <remarks>
+/// The quaternions are interpolated 8 at a time using AVX2 (when enabled). All interpolation
+/// methods take the shortest path between the quaternions.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="q0">The starting quaternions.</param>
+/// <param name="q1">The ending quaternions. Must have the same size as `q0`.</param>
+/// <param name="t">The interpolation parameter ([0..1]) of each pair. Must have the same size as `q0`.</param>
+/// <param name="results">Receives the interpolated quaternions. Must have the same size as `q0`.</param>
+/// <param name="interpolation">The interpolation method.</param>
+template<typename T>
+void interpolate( std::span<const Quaternion<T>> q0, std::span<const Quaternion<std::type_identity_t<T>>> q1, std::span<const std::type_identity_t<T>> t, std::span<Quaternion<std::type_identity_t<T>>> results,
+                  RotationInterpolation interpolation = RotationInterpolation::Slerp ) noexcept
+{
+    assert( q1.size() == q0.size() );
+    assert( t.size() == q0.size() );
+    assert( results.size() == q0.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        alignas( 32 ) float a[4][8];
+        alignas( 32 ) float b[4][8];
+        alignas( 32 ) float q[4][8];
+        alignas( 32 ) float u[8];
+
+        for ( ; i + Simd::WIDTH <= q0.size(); i += Simd::WIDTH )
+        {
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                for ( std::size_t c = 0; c < 4; ++c )
+                {
+                    a[c][j] = q0[i + j][c];
+                    b[c][j] = q1[i + j][c];
+                }
+                u[j] = t[i + j];
+            }
+
+            detail::interpolate8( a, b, u, q, interpolation );
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                results[i + j] = { q[0][j], q[1][j], q[2][j], q[3][j] };
+        }
+    }
+#endif
+
+    for ( ; i < q0.size(); ++i )
+        results[i] = detail::interpolate( q0[i], q1[i], t[i], interpolation );
+}
+
+/// <summary>
+/// Sample many vector tracks (for example, the translation of all bones of an animation clip) at the same time.
+/// </summary>
+/// <remarks>
+/// The keys of each track are found using the track's cursor, and then the values are
+/// interpolated 8 tracks at a time using AVX2 (when enabled).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+/// <param name="tracks">The tracks to sample.</param>
+/// <param name="time">The sample time.</param>
+/// <param name="cursors">The cursor for each track. Must have the same size as `tracks`.</param>
+/// <param name="results">Receives the sampled value of each track. Must have the same size as `tracks`.</param>
+template<typename T, std::size_t N>
+void sample( std::span<const VectorTrack<std::type_identity_t<T>, N>> tracks, T time, std::span<TrackCursor> cursors, std::span<Vector<std::type_identity_t<T>, N>> results ) noexcept
+{
+    assert( cursors.size() == tracks.size() );
+    assert( results.size() == tracks.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        alignas( 32 ) float v0[N][8];
+        alignas( 32 ) float v1[N][8];
+        alignas( 32 ) float v[N][8];
+        alignas( 32 ) float u[8];
+
+        for ( ; i + Simd::WIDTH <= tracks.size(); i += Simd::WIDTH )
+        {
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                const VectorTrack<float, N>& track = tracks[i + j];
+
+                Vector<float, N> a { 0.0f }, b { 0.0f };
+                if ( !track.empty() )
+                {
+                    const std::size_t k = track.findKey( time, cursors[i + j], u[j] );
+                    a                   = track.getKey( k );
+                    b                   = track.getKey( std::min( k + 1, track.size() - 1 ) );
+                }
+                else
+                {
+                    u[j] = 0.0f;
+                }
+
+                for ( std::size_t c = 0; c < N; ++c )
+                {
+                    v0[c][j] = a[c];
+                    v1[c][j] = b[c];
+                }
+            }
+
+            const __m256 t = _mm256_load_ps( u );
+            for ( std::size_t c = 0; c < N; ++c )
+            {
+                const __m256 a = _mm256_load_ps( v0[c] );
+                const __m256 b = _mm256_load_ps( v1[c] );
+                _mm256_store_ps( v[c], _mm256_add_ps( a, _mm256_mul_ps( _mm256_sub_ps( b, a ), t ) ) );
+            }
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                for ( std::size_t c = 0; c < N; ++c )
+                    results[i + j][c] = v[c][j];
+            }
+        }
+    }
+#endif
+
+    for ( ; i < tracks.size(); ++i )
+        results[i] = tracks[i].sample( time, cursors[i] );
+}
+
+}  // namespace FastMath
@@ -0,0 +1,990 @@
+#pragma once
+
+#include "Animation.hpp"
+#include "Common.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+namespace detail
+{
+// The range of the quantized components of a QuantizedQuaternion is [-ONE_OVER_SQRT_TWO..ONE_OVER_SQRT_TWO].
+template<typename T>
+constexpr T ONE_OVER_SQRT_TWO = T( 0.70710678118654752440084436210485 );
+}  // namespace detail
+
+/// <summary>
+/// A unit quaternion quantized to 48 bits using the "smallest three" encoding.
+/// </summary>
+/// <remarks>
+/// The component with the largest magnitude is dropped (and reconstructed from the
+/// other three using the unit length constraint). The quaternion is negated if necessary
+/// so that the dropped component is positive. The other three components are in the range
+/// \f([-\frac{1}{\sqrt{2}} \ldots \frac{1}{\sqrt{2}}]\f) and are stored with 15 bits each.
+/// The index of the dropped component is stored in the high bits of the first two values.
+/// The maximum error of each component is about 2.2e-5.
+/// </remarks>
+struct QuantizedQuaternion
+{
+    uint16_t values[3];
+};
+
+/// <summary>
+/// Quantize a unit quaternion.
+/// </summary>
+/// <typeparam name="T">The quaternion type.</typeparam>
+/// <param name="q">The quaternion to quantize (should be normalized).</param>
+/// <returns>The quantized quaternion.</returns>
+template<typename T>
+constexpr QuantizedQuaternion quantize( const Quaternion<T>& q ) noexcept
+{
+    std::size_t largest = 0;
+    for ( std::size_t i = 1; i < 4; ++i )
+    {
+        if ( std::abs( q[i] ) > std::abs( q[largest] ) )
+            largest = i;
+    }
+
+    const T sign  = q[largest] < T( 0 ) ? T( -1 ) : T( 1 );
+    const T scale = sign * detail::ONE_OVER_SQRT_TWO<T>;
+
+    QuantizedQuaternion r {};
+    for ( std::size_t i = 0, j = 0; i < 4; ++i )
+    {
+        if ( i == largest )
+            continue;
+
+        // Map [-1/sqrt(2)..1/sqrt(2)] to [0..32767].
+        const T v   = std::clamp( q[i] * scale + T( 0.5 ), T( 0 ), T( 1 ) );
+        r.values[j] = static_cast<uint16_t>( v * T( 32767 ) + T( 0.5 ) );
+        ++j;
+    }
+
+    r.values[0] |= static_cast<uint16_t>( ( largest & 1 ) << 15 );
+    r.values[1] |= static_cast<uint16_t>( ( largest >> 1 ) << 15 );
+
+    return r;
+}
+
+/// <summary>
+/// Reconstruct a quaternion from its quantized representation.
+/// </summary>
+/// <typeparam name="T">The quaternion type.</typeparam>
+/// <param name="q">The quantized quaternion.</param>
+/// <returns>The (unit) quaternion.</returns>
+template<typename T>
+constexpr Quaternion<T> dequantize( const QuantizedQuaternion& q ) noexcept
+{
+    const std::size_t largest = ( q.values[0] >> 15 ) | ( ( q.values[1] >> 15 ) << 1 );
+    const T           offset  = detail::ONE_OVER_SQRT_TWO<T>;
+    const T           scale   = offset * T( 2 ) / T( 32767 );
+
+    Quaternion<T> r;
+    T             sum = T( 0 );
+    for ( std::size_t i = 0, j = 0; i < 4; ++i )
+    {
+        if ( i == largest )
+            continue;
+
+        r[i] = static_cast<T>( q.values[j] & 0x7fff ) * scale - offset;
+        sum += r[i] * r[i];
+        ++j;
+    }
+
+    r[largest] = std::sqrt( std::max( T( 1 ) - sum, T( 0 ) ) );
+
+    return r;
+}
+
+/// <summary>
+/// A compressed track of rotation keys.
+/// </summary>
+/// <remarks>
+/// The track is created from rotations that are sampled at a fixed rate. Keys are removed as
+/// long as the reconstructed rotation at every (original) sample stays within `maxError` radians
+/// of the sample, and the remaining keys are quantized (see `QuantizedQuaternion`). The error is
+/// measured on the quantized keys using the same interpolation that is used for sampling, at every
+/// sample including the keys themselves. The quantization error of a key is up to about 1e-4 radians,
+/// so a smaller `maxError` cannot be guaranteed: the keys are still added where the error exceeds
+/// `maxError`, but the error at the keys themselves remains. `getMaxError` returns the error that was
+/// actually achieved, which should be checked when compressing with a very small `maxError`.
+///
+/// The key times are stored as 16-bit frame indices separately from the key values, so finding the
+/// keys that bracket a sample time only touches a small, contiguous array. Sampling uses a
+/// TrackCursor (in the same way as a RotationTrack) and does not allocate memory.
+///
+/// When the track is compressed for squad interpolation, control points for the remaining keys are
+/// computed when compressing and stored with the keys. Since removing keys leaves them unevenly spaced
+/// in time, each key has separate incoming and outgoing control points (scaled by the duration of the
+/// adjacent segments) so that the angular velocity is continuous across keys. For evenly spaced keys,
+/// both are equal to `intermediate`.
+/// </remarks>
+/// <typeparam name="T">The component type of the decompressed rotations.</typeparam>
+template<typename T>
+struct CompressedRotationTrack
+{
+    /// <summary>
+    /// The CompressedRotationTrack value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty track.
+    /// </summary>
+    CompressedRotationTrack() = default;
+
+    /// <summary>
+    /// Compress a set of rotation samples.
+    /// </summary>
+    /// <seealso cref="compress"/>
+    /// <param name="samples">The rotation samples (should be normalized).</param>
+    /// <param name="sampleRate">The number of samples per second.</param>
+    /// <param name="maxError">The maximum angular error (in radians).</param>
+    /// <param name="interpolation">The interpolation method used to sample the track.</param>
+    /// <param name="squad">Use squad interpolation instead of `interpolation`.</param>
+    CompressedRotationTrack( std::span<const Quaternion<T>> samples, T sampleRate, T maxError = T( 0.001 ),
+                             RotationInterpolation interpolation = RotationInterpolation::Slerp, bool squad = false );
+
+    /// <summary>
+    /// Compress a set of rotation samples.
+    /// </summary>
+    /// <param name="samples">The rotation samples (should be normalized). At most 65536 samples are supported.</param>
+    /// <param name="sampleRate">The number of samples per second. The first sample is at time 0.</param>
+    /// <param name="maxError">The maximum angular error (in radians).</param>
+    /// <param name="interpolation">The interpolation method used to sample the track.</param>
+    /// <param name="squad">Use squad interpolation instead of `interpolation`.</param>
+    void compress( std::span<const Quaternion<T>> samples, T sampleRate, T maxError = T( 0.001 ),
+                   RotationInterpolation interpolation = RotationInterpolation::Slerp, bool squad = false );
+
+    /// <summary>
+    /// Check to see if the track is empty.
+    /// </summary>
+    /// <returns>`true` if the track does not have any keys.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of keys in the track (after compression).
+    /// </summary>
+    /// <returns>The number of keys.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the number of bytes used to store the keys.
+    /// </summary>
+    /// <returns>The size of the compressed keys (in bytes).</returns>
+    std::size_t getMemorySize() const noexcept;
+
+    /// <summary>
+    /// Get the time of the last key.
+    /// </summary>
+    /// <returns>The time of the last key, or 0 if the track is empty.</returns>
+    T getEndTime() const noexcept;
+
+    /// <summary>
+    /// Get the time of a key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The time of key `i`.</returns>
+    T getTime( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Get a (decompressed) key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The rotation at key `i`.</returns>
+    Quaternion<T> getKey( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Get the interpolation method used to sample the track.
+    /// </summary>
+    /// <returns>The interpolation method.</returns>
+    RotationInterpolation getInterpolation() const noexcept;
+
+    /// <summary>
+    /// Check to see if the track is sampled with squad interpolation.
+    /// </summary>
+    /// <returns>`true` if the track stores squad control points.</returns>
+    bool isSquad() const noexcept;
+
+    /// <summary>
+    /// Get the maximum error of the decompressed track at the original samples.
+    /// </summary>
+    /// <returns>The largest angular error (in radians). This can exceed the requested `maxError` when the quantization error alone exceeds it.</returns>
+    T getMaxError() const noexcept;
+
+    /// <summary>
+    /// Find the keys that bracket a time.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor to start the search from. Receives the index of the returned key.</param>
+    /// <param name="u">Receives the interpolation factor (in the range [0..1]) between key `i` and key `i + 1`.</param>
+    /// <returns>The index `i` of the first key. The second key is `min( i + 1, size() - 1 )`.</returns>
+    std::size_t findKey( T time, TrackCursor& cursor, T& u ) const noexcept;
+
+    /// <summary>
+    /// Sample the track.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor of the animation instance that is sampling the track.</param>
+    /// <returns>The interpolated rotation at `time`, or identity if the track is empty.</returns>
+    Quaternion<T> sample( T time, TrackCursor& cursor ) const noexcept;
+
+    /// <summary>
+    /// Sample the track without a cursor (using a binary search).
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <returns>The interpolated rotation at `time`, or identity if the track is empty.</returns>
+    Quaternion<T> sample( T time ) const noexcept;
+
+private:
+    // Replace the keys with the given samples.
+    void assign( std::span<const Quaternion<T>> samples, const std::vector<uint32_t>& indices );
+
+    // Sample the track at a (fractional) frame index.
+    Quaternion<T> sampleFrame( T frame, TrackCursor& cursor ) const noexcept;
+
+    T                     sampleRate    = T( 0 );
+    T                     maxError      = T( 0 );
+    RotationInterpolation interpolation = RotationInterpolation::Slerp;
+    bool                  squad         = false;
+
+    std::vector<uint16_t>            frames;
+    std::vector<QuantizedQuaternion> keys;
+    std::vector<QuantizedQuaternion> controlPoints;  // The incoming and outgoing control points of each key (squad only).
+};
+
+using CompressedRotationTrackf = CompressedRotationTrack<float>;
+using CompressedRotationTrackd = CompressedRotationTrack<double>;
+
+/// <summary>
+/// A compressed track of vector keys (for example, translation or scale).
+/// </summary>
+/// <remarks>
+/// The track is created from values that are sampled at a fixed rate. Keys are removed as long
+/// as the linearly interpolated value at every (original) sample stays within `maxError`
+/// (Euclidean distance) of the sample, and the remaining keys are quantized relative to the bounds of
+/// the track. As with CompressedRotationTrack, the error is measured on the quantized keys at every
+/// sample including the keys themselves.
+///
+/// Keys are quantized to 16 bits per component, unless the 16-bit quantization error alone would use
+/// more than half of `maxError` (for example, a large range with a small error bound), in which case
+/// 32 bits per component are used. The bound then holds down to the precision of `T`; `getMaxError`
+/// returns the error that was actually achieved.
+/// </remarks>
+/// <typeparam name="T">The component type of the decompressed values.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N = 3>
+struct CompressedVectorTrack
+{
+    /// <summary>
+    /// The CompressedVectorTrack value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty track.
+    /// </summary>
+    CompressedVectorTrack() = default;
+
+    /// <summary>
+    /// Compress a set of samples.
+    /// </summary>
+    /// <seealso cref="compress"/>
+    /// <param name="samples">The samples.</param>
+    /// <param name="sampleRate">The number of samples per second.</param>
+    /// <param name="maxError">The maximum (Euclidean) error.</param>
+    CompressedVectorTrack( std::span<const Vector<T, N>> samples, T sampleRate, T maxError );
+
+    /// <summary>
+    /// Compress a set of samples.
+    /// </summary>
+    /// <param name="samples">The samples. At most 65536 samples are supported.</param>
+    /// <param name="sampleRate">The number of samples per second. The first sample is at time 0.</param>
+    /// <param name="maxError">The maximum (Euclidean) error.</param>
+    void compress( std::span<const Vector<T, N>> samples, T sampleRate, T maxError );
+
+    /// <summary>
+    /// Check to see if the track is empty.
+    /// </summary>
+    /// <returns>`true` if the track does not have any keys.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of keys in the track (after compression).
+    /// </summary>
+    /// <returns>The number of keys.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the number of bytes used to store the keys.
+    /// </summary>
+    /// <returns>The size of the compressed keys (in bytes).</returns>
+    std::size_t getMemorySize() const noexcept;
+
+    /// <summary>
+    /// Get the time of the last key.
+    /// </summary>
+    /// <returns>The time of the last key, or 0 if the track is empty.</returns>
+    T getEndTime() const noexcept;
+
+    /// <summary>
+    /// Get the time of a key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The time of key `i`.</returns>
+    T getTime( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Get a (decompressed) key.
+    /// </summary>
+    /// <param name="i">The index of the key.</param>
+    /// <returns>The value at key `i`.</returns>
+    Vector<T, N> getKey( std::size_t i ) const noexcept;
+
+    /// <summary>
+    /// Get the number of bits used to store each key component.
+    /// </summary>
+    /// <returns>16 or 32.</returns>
+    std::size_t getBitsPerComponent() const noexcept;
+
+    /// <summary>
+    /// Get the maximum error of the decompressed track at the original samples.
+    /// </summary>
+    /// <returns>The largest (Euclidean) error.</returns>
+    T getMaxError() const noexcept;
+
+    /// <summary>
+    /// Find the keys that bracket a time.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor to start the search from. Receives the index of the returned key.</param>
+    /// <param name="u">Receives the interpolation factor (in the range [0..1]) between key `i` and key `i + 1`.</param>
+    /// <returns>The index `i` of the first key. The second key is `min( i + 1, size() - 1 )`.</returns>
+    std::size_t findKey( T time, TrackCursor& cursor, T& u ) const noexcept;
+
+    /// <summary>
+    /// Sample the track.
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <param name="cursor">The cursor of the animation instance that is sampling the track.</param>
+    /// <returns>The interpolated value at `time`, or zero if the track is empty.</returns>
+    Vector<T, N> sample( T time, TrackCursor& cursor ) const noexcept;
+
+    /// <summary>
+    /// Sample the track without a cursor (using a binary search).
+    /// </summary>
+    /// <param name="time">The sample time.</param>
+    /// <returns>The interpolated value at `time`, or zero if the track is empty.</returns>
+    Vector<T, N> sample( T time ) const noexcept;
+
+private:
+    // Replace the keys with the given samples.
+    void assign( std::span<const Vector<T, N>> samples, const std::vector<uint32_t>& indices );
+
+    // Sample the track at a (fractional) frame index.
+    Vector<T, N> sampleFrame( T frame, TrackCursor& cursor ) const noexcept;
+
+    T            sampleRate = T( 0 );
+    T            maxError   = T( 0 );
+    Vector<T, N> origin { T( 0 ) };
+    Vector<T, N> scale { T( 0 ) };
+    std::size_t  stride = N;  // The number of 16-bit words per key (N for 16-bit components, 2N for 32-bit components).
+
+    std::vector<uint16_t> frames;
+    std::vector<uint16_t> keys;
+};
+
+using CompressedVectorTrackf = CompressedVectorTrack<float>;
+using CompressedVectorTrackd = CompressedVectorTrack<double>;
+
+namespace detail
+{
+// The angle (in radians) between the rotations represented by two unit quaternions.
+// This is more accurate than 2 * acos( |dot( a, b )| ) for small angles.
+template<typename T>
+T rotationAngle( const Quaternion<T>& a, const Quaternion<T>& b ) noexcept
+{
+    const Quaternion<T> d = dot( a, b ) < T( 0 ) ? a + b : a - b;
+    return T( 4 ) * std::asin( std::min( length( d ) * T( 0.5 ), T( 1 ) ) );
+}
+
+// Remove keys from a track sampled at a fixed rate. `assign( indices )` replaces the keys of
+// the track, and `error( frame, cursor )` returns the error of the reconstruction at a frame.
+// Starting with only the end points, the sample with the largest error in each segment is
+// added as a key until the error of every sample between the keys is within `maxError`.
+// Returns the largest error over all samples (including the keys, whose quantization error
+// can exceed `maxError`).
+template<typename Assign, typename Error>
+double reduceKeys( std::size_t count, double maxError, Assign&& assign, Error&& error )
+{
+    std::vector<uint32_t> indices;
+    if ( count > 0 )
+        indices.push_back( 0 );
+    if ( count > 1 )
+        indices.push_back( static_cast<uint32_t>( count - 1 ) );
+
+    std::vector<uint32_t> insert;
+    std::vector<uint32_t> merged;
+    while ( true )
+    {
+        assign( indices );
+
+        insert.clear();
+        TrackCursor cursor;
+        double      achieved = 0.0;
+        for ( std::size_t s = 0; s < indices.size(); ++s )
+        {
+            achieved = std::max( achieved, error( indices[s], cursor ) );
+            if ( s + 1 == indices.size() )
+                break;
+
+            uint32_t worst      = 0;
+            double   worstError = maxError;
+            for ( uint32_t f = indices[s] + 1; f < indices[s + 1]; ++f )
+            {
+                const double e = error( f, cursor );
+                achieved       = std::max( achieved, e );
+                if ( e > worstError )
+                {
+                    worst      = f;
+                    worstError = e;
+                }
+            }
+
+            if ( worst != 0 )
+                insert.push_back( worst );
+        }
+
+        if ( insert.empty() )
+            return achieved;
+
+        merged.resize( indices.size() + insert.size() );
+        std::merge( indices.begin(), indices.end(), insert.begin(), insert.end(), merged.begin() );
+        std::swap( indices, merged );
+    }
+}
+}  // namespace detail
+
+template<typename T>
+CompressedRotationTrack<T>::CompressedRotationTrack( std::span<const Quaternion<T>> samples, T sampleRate, T maxError, RotationInterpolation interpolation, bool squad )
+{
+    compress( samples, sampleRate, maxError, interpolation, squad );
+}
+
+template<typename T>
+void CompressedRotationTrack<T>::compress( std::span<const Quaternion<T>> samples, T _sampleRate, T _maxError, RotationInterpolation _interpolation, bool _squad )
+{
+    assert( samples.size() <= std::size_t( std::numeric_limits<uint16_t>::max() ) + 1 );
+    assert( _sampleRate > T( 0 ) );
+
+    sampleRate    = _sampleRate;
+    interpolation = _interpolation;
+    squad         = _squad;
+
+    const double error = detail::reduceKeys(
+        samples.size(), static_cast<double>( _maxError ), [&]( const std::vector<uint32_t>& indices ) { assign( samples, indices ); },
+        [&]( uint32_t f, TrackCursor& cursor ) {
+            return static_cast<double>( detail::rotationAngle( normalize( sampleFrame( static_cast<T>( f ), cursor ) ), samples[f] ) );
+        } );
+
+    maxError = static_cast<T>( error );
+
+    frames.shrink_to_fit();
+    keys.shrink_to_fit();
+    controlPoints.shrink_to_fit();
+}
+
+template<typename T>
+void CompressedRotationTrack<T>::assign( std::span<const Quaternion<T>> samples, const std::vector<uint32_t>& indices )
+{
+    const std::size_t n = indices.size();
+
+    frames.resize( n );
+    keys.resize( n );
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        frames[i] = static_cast<uint16_t>( indices[i] );
+        keys[i]   = quantize( normalize( samples[indices[i]] ) );
+    }
+
+    controlPoints.clear();
+    if ( squad )
+    {
+        // Compute the control points from the quantized keys (made hemisphere-consistent).
+        std::vector<Quaternion<T>> q( n );
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            q[i] = dequantize<T>( keys[i] );
+            if ( i > 0 && dot( q[i - 1], q[i] ) < T( 0 ) )
+                q[i] = q[i] * T( -1 );
+        }
+
+        controlPoints.resize( n * 2 );
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            const std::size_t prev = i > 0 ? i - 1 : i;
+            const std::size_t next = i + 1 < n ? i + 1 : i;
+
+            // The durations of the adjacent segments (mirrored at the ends of the track).
+            T h0 = static_cast<T>( indices[i] - indices[prev] );
+            T h1 = static_cast<T>( indices[next] - indices[i] );
+            h0   = h0 > T( 0 ) ? h0 : ( h1 > T( 0 ) ? h1 : T( 1 ) );
+            h1   = h1 > T( 0 ) ? h1 : h0;
+
+            // The tangents in log space, and the angular velocity at the key (central difference).
+            const Quaternion<T> qInv     = inverse( q[i] );
+            const Quaternion<T> l0       = log( q[prev] * qInv );
+            const Quaternion<T> l1       = log( q[next] * qInv );
+            const Quaternion<T> velocity = ( l1 - l0 ) / ( h0 + h1 );
+
+            controlPoints[i * 2]     = quantize( normalize( exp( ( l0 + velocity * h0 ) * T( -0.5 ) ) * q[i] ) );
+            controlPoints[i * 2 + 1] = quantize( normalize( exp( ( velocity * h1 - l1 ) * T( 0.5 ) ) * q[i] ) );
+        }
+    }
+}
+
+template<typename T>
+bool CompressedRotationTrack<T>::empty() const noexcept
+{
+    return frames.empty();
+}
+
+template<typename T>
+std::size_t CompressedRotationTrack<T>::size() const noexcept
+{
+    return frames.size();
+}
+
+template<typename T>
+std::size_t CompressedRotationTrack<T>::getMemorySize() const noexcept
+{
+    return frames.size() * sizeof( uint16_t ) + ( keys.size() + controlPoints.size() ) * sizeof( QuantizedQuaternion );
+}
+
+template<typename T>
+T CompressedRotationTrack<T>::getEndTime() const noexcept
+{
+    return frames.empty() ? T( 0 ) : static_cast<T>( frames.back() ) / sampleRate;
+}
+
+template<typename T>
+T CompressedRotationTrack<T>::getTime( std::size_t i ) const noexcept
+{
+    assert( i < frames.size() );
+
+    return static_cast<T>( frames[i] ) / sampleRate;
+}
+
+template<typename T>
+Quaternion<T> CompressedRotationTrack<T>::getKey( std::size_t i ) const noexcept
+{
+    assert( i < keys.size() );
+
+    return dequantize<T>( keys[i] );
+}
+
+template<typename T>
+RotationInterpolation CompressedRotationTrack<T>::getInterpolation() const noexcept
+{
+    return interpolation;
+}
+
+template<typename T>
+bool CompressedRotationTrack<T>::isSquad() const noexcept
+{
+    return squad;
+}
+
+template<typename T>
+T CompressedRotationTrack<T>::getMaxError() const noexcept
+{
+    return maxError;
+}
+
+template<typename T>
+std::size_t CompressedRotationTrack<T>::findKey( T time, TrackCursor& cursor, T& u ) const noexcept
+{
+    return detail::findKey( frames, time * sampleRate, cursor.key, u );
+}
+
+template<typename T>
+Quaternion<T> CompressedRotationTrack<T>::sampleFrame( T frame, TrackCursor& cursor ) const noexcept
+{
+    if ( frames.empty() )
+        return Quaternion<T>::IDENTITY;
+
+    T                 u;
+    const std::size_t i  = detail::findKey( frames, frame, cursor.key, u );
+    const std::size_t j  = std::min( i + 1, frames.size() - 1 );
+    const auto        q0 = dequantize<T>( keys[i] );
+    const auto        q1 = dequantize<T>( keys[j] );
+
+    if ( squad )
+        return FastMath::squad( q0, q1, dequantize<T>( controlPoints[i * 2 + 1] ), dequantize<T>( controlPoints[j * 2] ), u );
+
+    return detail::interpolate( q0, q1, u, interpolation );
+}
+
+template<typename T>
+Quaternion<T> CompressedRotationTrack<T>::sample( T time, TrackCursor& cursor ) const noexcept
+{
+    return sampleFrame( time * sampleRate, cursor );
+}
+
+template<typename T>
+Quaternion<T> CompressedRotationTrack<T>::sample( T time ) const noexcept
+{
+    TrackCursor cursor { static_cast<uint32_t>( frames.size() ) };
+    return sample( time, cursor );
+}
+
+template<typename T, std::size_t N>
+CompressedVectorTrack<T, N>::CompressedVectorTrack( std::span<const Vector<T, N>> samples, T sampleRate, T maxError )
+{
+    compress( samples, sampleRate, maxError );
+}
+
+template<typename T, std::size_t N>
+void CompressedVectorTrack<T, N>::compress( std::span<const Vector<T, N>> samples, T _sampleRate, T _maxError )
+{
+    assert( samples.size() <= std::size_t( std::numeric_limits<uint16_t>::max() ) + 1 );
+    assert( _sampleRate > T( 0 ) );
+
+    sampleRate = _sampleRate;
+
+    // The quantization range.
+    Vector<T, N> minimum { std::numeric_limits<T>::max() };
+    Vector<T, N> maximum { std::numeric_limits<T>::lowest() };
+    for ( const Vector<T, N>& v: samples )
+    {
+        for ( std::size_t k = 0; k < N; ++k )
+        {
+            minimum[k] = std::min( minimum[k], v[k] );
+            maximum[k] = std::max( maximum[k], v[k] );
+        }
+    }
+
+    // Use 32-bit components if the 16-bit quantization error (half a step per component) would use more than half of the error bound.
+    double quantizationError = 0.0;
+    for ( std::size_t k = 0; k < N; ++k )
+    {
+        const double step = samples.empty() ? 0.0 : ( static_cast<double>( maximum[k] ) - static_cast<double>( minimum[k] ) ) / 65535.0;
+        quantizationError += step * step * 0.25;
+    }
+
+    const bool   wide  = std::sqrt( quantizationError ) > static_cast<double>( _maxError ) * 0.5;
+    const double steps = wide ? 4294967295.0 : 65535.0;
+
+    stride = wide ? N * 2 : N;
+    for ( std::size_t k = 0; k < N; ++k )
+    {
+        origin[k] = samples.empty() ? T( 0 ) : minimum[k];
+        scale[k]  = samples.empty() ? T( 0 ) : static_cast<T>( ( static_cast<double>( maximum[k] ) - static_cast<double>( minimum[k] ) ) / steps );
+    }
+
+    const double error = detail::reduceKeys(
+        samples.size(), static_cast<double>( _maxError ), [&]( const std::vector<uint32_t>& indices ) { assign( samples, indices ); },
+        [&]( uint32_t f, TrackCursor& cursor ) { return static_cast<double>( length( sampleFrame( static_cast<T>( f ), cursor ) - samples[f] ) ); } );
+
+    maxError = static_cast<T>( error );
+
+    frames.shrink_to_fit();
+    keys.shrink_to_fit();
+}
+
+template<typename T, std::size_t N>
+void CompressedVectorTrack<T, N>::assign( std::span<const Vector<T, N>> samples, const std::vector<uint32_t>& indices )
+{
+    frames.resize( indices.size() );
+    keys.resize( indices.size() * stride );
+
+    const double steps = stride == N ? 65535.0 : 4294967295.0;
+    for ( std::size_t i = 0; i < indices.size(); ++i )
+    {
+        frames[i] = static_cast<uint16_t>( indices[i] );
+
+        uint16_t* key = keys.data() + i * stride;
+        for ( std::size_t k = 0; k < N; ++k )
+        {
+            // Quantize in double precision (a float cannot represent every 32-bit value).
+            const double   v = scale[k] > T( 0 ) ? ( static_cast<double>( samples[indices[i]][k] ) - static_cast<double>( origin[k] ) ) / static_cast<double>( scale[k] ) : 0.0;
+            const uint32_t q = static_cast<uint32_t>( std::clamp( v + 0.5, 0.0, steps ) );
+
+            if ( stride == N )
+            {
+                key[k] = static_cast<uint16_t>( q );
+            }
+            else
+            {
+                key[k * 2]     = static_cast<uint16_t>( q );
+                key[k * 2 + 1] = static_cast<uint16_t>( q >> 16 );
+            }
+        }
+    }
+}
+
+template<typename T, std::size_t N>
+bool CompressedVectorTrack<T, N>::empty() const noexcept
+{
+    return frames.empty();
+}
+
+template<typename T, std::size_t N>
+std::size_t CompressedVectorTrack<T, N>::size() const noexcept
+{
+    return frames.size();
+}
+
+template<typename T, std::size_t N>
+std::size_t CompressedVectorTrack<T, N>::getMemorySize() const noexcept
+{
+    return ( frames.size() + keys.size() ) * sizeof( uint16_t );
+}
+
+template<typename T, std::size_t N>
+T CompressedVectorTrack<T, N>::getEndTime() const noexcept
+{
+    return frames.empty() ? T( 0 ) : static_cast<T>( frames.back() ) / sampleRate;
+}
+
+template<typename T, std::size_t N>
+T CompressedVectorTrack<T, N>::getTime( std::size_t i ) const noexcept
+{
+    assert( i < frames.size() );
+
+    return static_cast<T>( frames[i] ) / sampleRate;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CompressedVectorTrack<T, N>::getKey( std::size_t i ) const noexcept
+{
+    assert( i < frames.size() );
+
+    const uint16_t* key = keys.data() + i * stride;
+
+    Vector<T, N> v;
+    for ( std::size_t k = 0; k < N; ++k )
+    {
+        const uint32_t q = stride == N ? key[k] : key[k * 2] | ( static_cast<uint32_t>( key[k * 2 + 1] ) << 16 );
+        v[k]             = origin[k] + static_cast<T>( q ) * scale[k];
+    }
+
+    return v;
+}
+
+template<typename T, std::size_t N>
+std::size_t CompressedVectorTrack<T, N>::getBitsPerComponent() const noexcept
+{
+    return stride == N ? 16 : 32;
+}
+
+template<typename T, std::size_t N>
+T CompressedVectorTrack<T, N>::getMaxError() const noexcept
+{
+    return maxError;
+}
+
+template<typename T, std::size_t N>
+std::size_t CompressedVectorTrack<T, N>::findKey( T time, TrackCursor& cursor, T& u ) const noexcept
+{
+    return detail::findKey( frames, time * sampleRate, cursor.key, u );
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CompressedVectorTrack<T, N>::sampleFrame( T frame, TrackCursor& cursor ) const noexcept
+{
+    if ( frames.empty() )
+        return Vector<T, N> { T( 0 ) };
+
+    T                 u;
+    const std::size_t i = detail::findKey( frames, frame, cursor.key, u );
+    const std::size_t j = std::min( i + 1, frames.size() - 1 );
+
+    const Vector<T, N> a = getKey( i );
+    const Vector<T, N> b = getKey( j );
+
+    return a + ( b - a ) * u;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CompressedVectorTrack<T, N>::sample( T time, TrackCursor& cursor ) const noexcept
+{
+    return sampleFrame( time * sampleRate, cursor );
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CompressedVectorTrack<T, N>::sample( T time ) const noexcept
+{
+    TrackCursor cursor { static_cast<uint32_t>( frames.size() ) };
+    return sample( time, cursor );
+}
+
+/// <summary>
+/// Sample many compressed rotation tracks (for example, all bones of an animation clip) at the same time.
+/// </summary>
+/// <remarks>
+/// The keys of each track are found using the track's cursor and decompressed, and then the
+/// rotations are interpolated 8 tracks at a time using AVX2 (when enabled). Groups of 8 tracks
+/// that do not all use the same interpolation method (or that use squad) are sampled one track at
+/// a time. No memory is allocated.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="tracks">The tracks to sample.</param>
+/// <param name="time">The sample time.</param>
+/// <param name="cursors">The cursor for each track. Must have the same size as `tracks`.</param>
+/// <param name="results">Receives the sampled rotation of each track. Must have the same size as `tracks`.</param>
+template<typename T>
+void sample( std::span<const CompressedRotationTrack<std::type_identity_t<T>>> tracks, T time, std::span<TrackCursor> cursors, std::span<Quaternion<std::type_identity_t<T>>> results ) noexcept
+{
+    assert( cursors.size() == tracks.size() );
+    assert( results.size() == tracks.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        alignas( 32 ) float q0[4][8];
+        alignas( 32 ) float q1[4][8];
+        alignas( 32 ) float q[4][8];
+        alignas( 32 ) float u[8];
+
+        for ( ; i + Simd::WIDTH <= tracks.size(); i += Simd::WIDTH )
+        {
+            const RotationInterpolation interpolation = tracks[i].getInterpolation();
+
+            bool uniform = true;
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                uniform = uniform && !tracks[i + j].isSquad() && tracks[i + j].getInterpolation() == interpolation;
+
+            if ( !uniform )
+            {
+                for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                    results[i + j] = tracks[i + j].sample( time, cursors[i + j] );
+                continue;
+            }
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                const CompressedRotationTrack<float>& track = tracks[i + j];
+
+                Quaternion<float> a, b;
+                if ( !track.empty() )
+                {
+                    const std::size_t k = track.findKey( time, cursors[i + j], u[j] );
+                    a                   = track.getKey( k );
+                    b                   = track.getKey( std::min( k + 1, track.size() - 1 ) );
+                }
+                else
+                {
+                    u[j] = 0.0f;
+                }
+
+                for ( std::size_t c = 0; c < 4; ++c )
+                {
+                    q0[c][j] = a[c];
+                    q1[c][j] = b[c];
+                }
+            }
+
+            detail::interpolate8( q0, q1, u, q, interpolation );
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+                results[i + j] = { q[0][j], q[1][j], q[2][j], q[3][j] };
+        }
+    }
+#endif
+
+    for ( ; i < tracks.size(); ++i )
+        results[i] = tracks[i].sample( time, cursors[i] );
+}
+
+/// <summary>
+/// Sample many compressed vector tracks at the same time.
+/// </summary>
+/// <remarks>
+/// The keys of each track are found using the track's cursor and decompressed, and then the
+/// values are interpolated 8 tracks at a time using AVX2 (when enabled). No memory is allocated.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+/// <param name="tracks">The tracks to sample.</param>
+/// <param name="time">The sample time.</param>
+/// <param name="cursors">The cursor for each track. Must have the same size as `tracks`.</param>
+/// <param name="results">Receives the sampled value of each track. Must have the same size as `tracks`.</param>
+template<typename T, std::size_t N>
+void sample( std::span<const CompressedVectorTrack<std::type_identity_t<T>, N>> tracks, T time, std::span<TrackCursor> cursors, std::span<Vector<std::type_identity_t<T>, N>> results ) noexcept
+{
+    assert( cursors.size() == tracks.size() );
+    assert( results.size() == tracks.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        alignas( 32 ) float v0[N][8];
+        alignas( 32 ) float v1[N][8];
+        alignas( 32 ) float v[N][8];
+        alignas( 32 ) float u[8];
+
+        for ( ; i + Simd::WIDTH <= tracks.size(); i += Simd::WIDTH )
+        {
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                const CompressedVectorTrack<float, N>& track = tracks[i + j];
+
+                Vector<float, N> a { 0.0f }, b { 0.0f };
+                if ( !track.empty() )
+                {
+                    const std::size_t k = track.findKey( time, cursors[i + j], u[j] );
+                    a                   = track.getKey( k );
+                    b                   = track.getKey( std::min( k + 1, track.size() - 1 ) );
+                }
+                else
+                {
+                    u[j] = 0.0f;
+                }
+
+                for ( std::size_t c = 0; c < N; ++c )
+                {
+                    v0[c][j] = a[c];
+                    v1[c][j] = b[c];
+                }
+            }
+
+            const __m256 t = _mm256_load_ps( u );
+            for ( std::size_t c = 0; c < N; ++c )
+            {
+                const __m256 a = _mm256_load_ps( v0[c] );
+                const __m256 b = _mm256_load_ps( v1[c] );
+                _mm256_store_ps( v[c], _mm256_add_ps( a, _mm256_mul_ps( _mm256_sub_ps( b, a ), t ) ) );
+            }
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                for ( std::size_t c = 0; c < N; ++c )
+                    results[i + j][c] = v[c][j];
+            }
+        }
+    }
+#endif
+
+    for ( ; i < tracks.size(); ++i )
+        results[i] = tracks[i].sample( time, cursors[i] );
+}
+
+}  // namespace FastMath
@@ -0,0 +1,770 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Distance.hpp"
+#include "Ray.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A bounding volume hierarchy over a set of primitives that are described by their AABBs.
+/// </summary>
+/// <remarks>
+/// The hierarchy is built top-down using binned SAH (surface area heuristic) splits. Large
+/// nodes are binned in parallel and large subtrees are built concurrently using the
+/// ThreadPool. The result does not depend on the number of threads.
+///
+/// Nodes are stored in depth-first order: the first child of an interior node immediately
+/// follows its parent and the index of the second child is stored in the node. The BVH only
+/// stores primitive indices, so the traversal functions take a callback that performs the
+/// exact primitive test.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct BVH
+{
+    /// <summary>
+    /// The BVH value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// A node of the BVH. For single-precision BVHs this is 32 bytes.
+    /// </summary>
+    struct Node
+    {
+        AABB<T> bounds;
+        // For interior nodes, the index of the second child. For leaf nodes, the index of
+        // the first primitive in the primitive index array.
+        uint32_t offset = 0;
+        // The number of primitives in a leaf node (0 for interior nodes).
+        uint32_t count = 0;
+
+        constexpr bool isLeaf() const noexcept
+        {
+            return count > 0;
+        }
+    };
+
+    /// <summary>
+    /// Returned by queries that don't find a primitive.
+    /// </summary>
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// <summary>
+    /// The number of bins per axis that are used to evaluate the SAH.
+    /// </summary>
+    static constexpr std::size_t NUM_BINS = 16;
+
+    /// <summary>
+    /// The maximum depth of the hierarchy (and the size of the traversal stack).
+    /// </summary>
+    static constexpr std::size_t MAX_DEPTH = 64;
+
+    /// <summary>
+    /// Construct an empty BVH.
+    /// </summary>
+    BVH() = default;
+
+    /// <summary>
+    /// Build a BVH over a set of primitives.
+    /// </summary>
+    /// <seealso cref="build"/>
+    /// <param name="bounds">The bounds of the primitives.</param>
+    /// <param name="maxLeafSize">The maximum number of primitives in a leaf node.</param>
+    /// <param name="pool">The thread pool to use to build the BVH.</param>
+    explicit BVH( std::span<const AABB<T>> bounds, std::size_t maxLeafSize = 4, ThreadPool& pool = ThreadPool::getDefault() );
+
+    /// <summary>
+    /// Build (or rebuild) the BVH over a set of primitives.
+    /// </summary>
+    /// <param name="bounds">The bounds of the primitives. The index of a primitive in this array is the index that is passed to the query callbacks.</param>
+    /// <param name="maxLeafSize">The maximum number of primitives in a leaf node.</param>
+    /// <param name="pool">The thread pool to use to build the BVH.</param>
+    void build( std::span<const AABB<T>> bounds, std::size_t maxLeafSize = 4, ThreadPool& pool = ThreadPool::getDefault() );
+
+    /// <summary>
+    /// Update the bounds of the nodes without changing the structure of the hierarchy.
+    /// </summary>
+    /// <remarks>
+    /// This is much faster than rebuilding the BVH, but the quality of the hierarchy degrades
+    /// as the primitives move away from their original positions.
+    /// </remarks>
+    /// <param name="bounds">The new bounds of the primitives. Must have the same size as the array that was used to build the BVH.</param>
+    /// <param name="pool">The thread pool to use to update the leaf nodes.</param>
+    void refit( std::span<const AABB<T>> bounds, ThreadPool& pool = ThreadPool::getDefault() );
+
+    /// <summary>
+    /// Check to see if the BVH is empty.
+    /// </summary>
+    /// <returns>`true` if the BVH does not contain any primitives.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the bounds of all of the primitives in the BVH.
+    /// </summary>
+    /// <returns>The bounds of the root node, or an empty AABB if the BVH is empty.</returns>
+    AABB<T> getBounds() const noexcept;
+
+    /// <summary>
+    /// Get the nodes of the BVH in depth-first order. The first node is the root.
+    /// </summary>
+    /// <returns>The nodes of the BVH.</returns>
+    std::span<const Node> getNodes() const noexcept;
+
+    /// <summary>
+    /// Get the primitive indices that are referenced by the leaf nodes.
+    /// </summary>
+    /// <returns>The primitive indices.</returns>
+    std::span<const uint32_t> getIndices() const noexcept;
+
+    /// <summary>
+    /// Find the closest primitive that is hit by a ray. Nodes are visited front-to-back
+    /// and nodes that are further than the closest hit are skipped.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `bool( uint32_t primitive, T&amp; tMax )`.</typeparam>
+    /// <param name="ray">The ray.</param>
+    /// <param name="tMax">The maximum distance along the ray. The callback should reduce this value when it finds a closer hit.</param>
+    /// <param name="intersect">Invoked for each primitive in the leaf nodes that are hit by the ray. Returns `true` if the primitive was hit.</param>
+    /// <returns>`true` if the callback reported a hit for any primitive.</returns>
+    template<typename F>
+    bool raycast( const Ray<T>& ray, T& tMax, F&& intersect ) const;
+
+    /// <summary>
+    /// Find all primitives whose leaf node overlaps an AABB.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `void( uint32_t primitive )`.</typeparam>
+    /// <param name="box">The AABB to test.</param>
+    /// <param name="f">Invoked for each primitive in the leaf nodes that overlap the box.</param>
+    template<typename F>
+    void query( const AABB<T>& box, F&& f ) const;
+
+    /// <summary>
+    /// Find the primitive that is closest to a point. Nodes are visited closest first
+    /// and nodes that are further than the closest primitive are skipped.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `T( uint32_t primitive )`.</typeparam>
+    /// <param name="p">The query point.</param>
+    /// <param name="maxDistanceSqr">The maximum squared distance to search. Receives the squared distance to the closest primitive.</param>
+    /// <param name="distanceSqr">Returns the squared distance from `p` to a primitive.</param>
+    /// <returns>The index of the closest primitive, or `INVALID_INDEX` if no primitive is closer than `maxDistanceSqr`.</returns>
+    template<typename F>
+    uint32_t nearest( const Vector<T, 3>& p, T& maxDistanceSqr, F&& distanceSqr ) const;
+
+private:
+    struct Bin
+    {
+        AABB<T>  bounds;
+        uint32_t count = 0;
+    };
+
+    using Bins = std::array<std::array<Bin, NUM_BINS>, 3>;
+
+    struct BuildContext
+    {
+        std::span<const AABB<T>>  bounds;
+        std::vector<Vector<T, 3>> centroids;
+        std::size_t               maxLeafSize;
+        ThreadPool&               pool;
+    };
+
+    // Ranges with more primitives than this are reduced and binned in parallel.
+    static constexpr std::size_t PARALLEL_BIN_THRESHOLD = 1 << 14;
+    // Subtrees with more primitives than this are built concurrently.
+    static constexpr std::size_t PARALLEL_BUILD_THRESHOLD = 1 << 12;
+    // Below this depth, binned SAH splits are used. Deeper nodes are split at the object
+    // median so that the depth of the hierarchy is bounded.
+    static constexpr std::size_t SAH_MAX_DEPTH = 24;
+
+    void buildRecursive( BuildContext& ctx, std::vector<Node>& out, uint32_t begin, uint32_t end, std::size_t depth );
+
+    std::vector<Node>     nodes;
+    std::vector<uint32_t> indices;
+};
+
+using BVHf = BVH<float>;
+using BVHd = BVH<double>;
+
+static_assert( sizeof( BVHf::Node ) == 32 );
+
+/// <summary>
+/// The result of a ray query against a triangle mesh.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct RayHit
+{
+    // The index of the triangle that was hit.
+    uint32_t primitive = std::numeric_limits<uint32_t>::max();
+    // The distance along the ray.
+    T t = T( 0 );
+    // The barycentric coordinates of the hit point.
+    T u = T( 0 ), v = T( 0 );
+};
+
+template<typename T>
+BVH<T>::BVH( std::span<const AABB<T>> bounds, std::size_t maxLeafSize, ThreadPool& pool )
+{
+    build( bounds, maxLeafSize, pool );
+}
+
+template<typename T>
+void BVH<T>::build( std::span<const AABB<T>> bounds, std::size_t maxLeafSize, ThreadPool& pool )
+{
+    assert( bounds.size() < INVALID_INDEX );
+
+    nodes.clear();
+    indices.resize( bounds.size() );
+
+    if ( bounds.empty() )
+        return;
+
+    BuildContext ctx { bounds, std::vector<Vector<T, 3>>( bounds.size() ), std::max<std::size_t>( maxLeafSize, 1 ), pool };
+
+    pool.parallelFor( 0, bounds.size(), PARALLEL_BIN_THRESHOLD, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+        {
+            ctx.centroids[i] = center( bounds[i] );
+            indices[i]       = static_cast<uint32_t>( i );
+        }
+    } );
+
+    nodes.reserve( 2 * bounds.size() / ctx.maxLeafSize + 1 );
+    buildRecursive( ctx, nodes, 0, static_cast<uint32_t>( bounds.size() ), 0 );
+}
+
+template<typename T>
+void BVH<T>::buildRecursive( BuildContext& ctx, std::vector<Node>& out, uint32_t begin, uint32_t end, std::size_t depth )
+{
+    const std::size_t count = end - begin;
+
+    // Compute the bounds of the primitives and of their centroids.
+    AABB<T> nodeBounds, centroidBounds;
+    {
+        auto reduce = [&]( std::size_t b, std::size_t e, AABB<T>& nb, AABB<T>& cb ) {
+            for ( std::size_t i = b; i < e; ++i )
+            {
+                const uint32_t prim = indices[i];
+                nb                  = merge( nb, ctx.bounds[prim] );
+                cb                  = merge( cb, ctx.centroids[prim] );
+            }
+        };
+
+        if ( count > PARALLEL_BIN_THRESHOLD )
+        {
+            const std::size_t    numChunks = ( count + PARALLEL_BIN_THRESHOLD - 1 ) / PARALLEL_BIN_THRESHOLD;
+            std::vector<AABB<T>> chunkBounds( numChunks ), chunkCentroids( numChunks );
+
+            ctx.pool.parallelFor( begin, end, PARALLEL_BIN_THRESHOLD, [&]( std::size_t b, std::size_t e ) {
+                const std::size_t chunk = ( b - begin ) / PARALLEL_BIN_THRESHOLD;
+                reduce( b, e, chunkBounds[chunk], chunkCentroids[chunk] );
+            } );
+
+            for ( std::size_t i = 0; i < numChunks; ++i )
+            {
+                nodeBounds     = merge( nodeBounds, chunkBounds[i] );
+                centroidBounds = merge( centroidBounds, chunkCentroids[i] );
+            }
+        }
+        else
+        {
+            reduce( begin, end, nodeBounds, centroidBounds );
+        }
+    }
+
+    const std::size_t nodeIndex = out.size();
+    out.push_back( { nodeBounds, begin, static_cast<uint32_t>( count ) } );
+
+    if ( count <= 1 )
+        return;
+
+    const Vector<T, 3> extent = centroidBounds.max - centroidBounds.min;
+
+    // Find the best split using binned SAH.
+    std::size_t bestAxis = 0;
+    std::size_t bestBin  = NUM_BINS;
+    T           bestCost = std::numeric_limits<T>::max();
+
+    Vector<T, 3> binScale;
+    for ( std::size_t axis = 0; axis < 3; ++axis )
+        binScale[axis] = extent[axis] > T( 0 ) ? T( NUM_BINS ) / extent[axis] : T( 0 );
+
+    auto binIndex = [&]( const Vector<T, 3>& c, std::size_t axis ) {
+        const auto b = static_cast<std::size_t>( ( c[axis] - centroidBounds.min[axis] ) * binScale[axis] );
+        return std::min( b, NUM_BINS - 1 );
+    };
+
+    if ( depth < SAH_MAX_DEPTH )
+    {
+        Bins bins {};
+
+        auto binRange = [&]( std::size_t b, std::size_t e, Bins& result ) {
+            for ( std::size_t i = b; i < e; ++i )
+            {
+                const uint32_t prim = indices[i];
+                for ( std::size_t axis = 0; axis < 3; ++axis )
+                {
+                    Bin& bin   = result[axis][binIndex( ctx.centroids[prim], axis )];
+                    bin.bounds = merge( bin.bounds, ctx.bounds[prim] );
+                    ++bin.count;
+                }
+            }
+        };
+
+        if ( count > PARALLEL_BIN_THRESHOLD )
+        {
+            const std::size_t numChunks = ( count + PARALLEL_BIN_THRESHOLD - 1 ) / PARALLEL_BIN_THRESHOLD;
+            std::vector<Bins> chunkBins( numChunks );
+
+            ctx.pool.parallelFor( begin, end, PARALLEL_BIN_THRESHOLD, [&]( std::size_t b, std::size_t e ) {
+                binRange( b, e, chunkBins[( b - begin ) / PARALLEL_BIN_THRESHOLD] );
+            } );
+
+            for ( const Bins& cb: chunkBins )
+            {
+                for ( std::size_t axis = 0; axis < 3; ++axis )
+                {
+                    for ( std::size_t i = 0; i < NUM_BINS; ++i )
+                    {
+                        bins[axis][i].bounds = merge( bins[axis][i].bounds, cb[axis][i].bounds );
+                        bins[axis][i].count += cb[axis][i].count;
+                    }
+                }
+            }
+        }
+        else
+        {
+            binRange( begin, end, bins );
+        }
+
+        for ( std::size_t axis = 0; axis < 3; ++axis )
+        {
+            if ( extent[axis] <= T( 0 ) )
+                continue;
+
+            // Sweep from the right to compute the cost of the right side of each split plane.
+            std::array<T, NUM_BINS> rightCost {};
+            AABB<T>                 rightBounds;
+            uint32_t                rightCount = 0;
+            for ( std::size_t i = NUM_BINS - 1; i > 0; --i )
+            {
+                rightBounds = merge( rightBounds, bins[axis][i].bounds );
+                rightCount += bins[axis][i].count;
+                rightCost[i] = surfaceArea( rightBounds ) * T( rightCount );
+            }
+
+            // Sweep from the left. Splitting after bin i puts bins [0..i] on the left.
+            AABB<T>  leftBounds;
+            uint32_t leftCount = 0;
+            for ( std::size_t i = 0; i < NUM_BINS - 1; ++i )
+            {
+                leftBounds = merge( leftBounds, bins[axis][i].bounds );
+                leftCount += bins[axis][i].count;
+
+                if ( leftCount == 0 || leftCount == count )
+                    continue;
+
+                const T cost = surfaceArea( leftBounds ) * T( leftCount ) + rightCost[i + 1];
+                if ( cost < bestCost )
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin  = i;
+                }
+            }
+        }
+
+        // The cost of a split is the cost of traversing this node plus the cost of the children.
+        const T area     = surfaceArea( nodeBounds );
+        const T leafCost = area * T( count );
+        if ( count <= ctx.maxLeafSize && ( bestBin == NUM_BINS || area + bestCost >= leafCost ) )
+            return;
+    }
+    else if ( count <= ctx.maxLeafSize )
+    {
+        return;
+    }
+
+    uint32_t* first = indices.data() + begin;
+    uint32_t* last  = indices.data() + end;
+    uint32_t* mid   = first;
+
+    if ( bestBin < NUM_BINS )
+    {
+        mid = std::partition( first, last, [&]( uint32_t prim ) {
+            return binIndex( ctx.centroids[prim], bestAxis ) <= bestBin;
+        } );
+    }
+
+    if ( mid == first || mid == last )
+    {
+        // Fall back to an object median split along the largest axis.
+        const std::size_t axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : ( extent.y >= extent.z ? 1 : 2 );
+
+        mid = first + count / 2;
+        std::nth_element( first, mid, last, [&]( uint32_t a, uint32_t b ) {
+            const T ca = ctx.centroids[a][axis];
+            const T cb = ctx.centroids[b][axis];
+            return ca < cb || ( ca == cb && a < b );
+        } );
+    }
+
+    const uint32_t split = static_cast<uint32_t>( mid - indices.data() );
+
+    // Turn the node into an interior node.
+    out[nodeIndex].count = 0;
+
+    if ( count > PARALLEL_BUILD_THRESHOLD && ctx.pool.getConcurrency() > 1 )
+    {
+        // Build both subtrees concurrently into separate arrays and append them in order.
+        std::vector<Node> children[2];
+        ctx.pool.parallelFor( 0, 2, 1, [&]( std::size_t b, std::size_t ) {
+            if ( b == 0 )
+                buildRecursive( ctx, children[0], begin, split, depth + 1 );
+            else
+                buildRecursive( ctx, children[1], split, end, depth + 1 );
+        } );
+
+        for ( std::size_t c = 0; c < 2; ++c )
+        {
+            const auto base = static_cast<uint32_t>( out.size() );
+            if ( c == 1 )
+                out[nodeIndex].offset = base;
+
+            for ( Node node: children[c] )
+            {
+                if ( !node.isLeaf() )
+                    node.offset += base;
+
+                out.push_back( node );
+            }
+        }
+    }
+    else
+    {
+        buildRecursive( ctx, out, begin, split, depth + 1 );
+        out[nodeIndex].offset = static_cast<uint32_t>( out.size() );
+        buildRecursive( ctx, out, split, end, depth + 1 );
+    }
+}
+
+template<typename T>
+void BVH<T>::refit( std::span<const AABB<T>> bounds, ThreadPool& pool )
+{
+    assert( bounds.size() == indices.size() );
+
+    // Leaves are independent.
+    pool.parallelFor( 0, nodes.size(), PARALLEL_BIN_THRESHOLD, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+        {
+            Node& node = nodes[i];
+            if ( !node.isLeaf() )
+                continue;
+
+            AABB<T> nodeBounds;
+            for ( uint32_t j = 0; j < node.count; ++j )
+                nodeBounds = merge( nodeBounds, bounds[indices[node.offset + j]] );
+
+            node.bounds = nodeBounds;
+        }
+    } );
+
+    // Children always have a larger index than their parent.
+    for ( std::size_t i = nodes.size(); i-- > 0; )
+    {
+        Node& node = nodes[i];
+        if ( !node.isLeaf() )
+            node.bounds = merge( nodes[i + 1].bounds, nodes[node.offset].bounds );
+    }
+}
+
+template<typename T>
+bool BVH<T>::empty() const noexcept
+{
+    return nodes.empty();
+}
+
+template<typename T>
+AABB<T> BVH<T>::getBounds() const noexcept
+{
+    return nodes.empty() ? AABB<T> {} : nodes[0].bounds;
+}
+
+template<typename T>
+auto BVH<T>::getNodes() const noexcept -> std::span<const Node>
+{
+    return nodes;
+}
+
+template<typename T>
+std::span<const uint32_t> BVH<T>::getIndices() const noexcept
+{
+    return indices;
+}
+
+template<typename T>
+template<typename F>
+bool BVH<T>::raycast( const Ray<T>& ray, T& tMax, F&& intersect ) const
+{
+    T tEntry;
+    if ( nodes.empty() || !intersects( ray, nodes[0].bounds, tEntry, T( 0 ), tMax ) )
+        return false;
+
+    uint32_t    stack[MAX_DEPTH];
+    T           stackT[MAX_DEPTH];
+    std::size_t sp = 0;
+
+    stack[sp]    = 0;
+    stackT[sp++] = tEntry;
+
+    bool hit = false;
+    while ( sp > 0 )
+    {
+        --sp;
+
+        // The node may be further than a hit that was found after it was pushed.
+        if ( stackT[sp] > tMax )
+            continue;
+
+        const Node& node = nodes[stack[sp]];
+        if ( node.isLeaf() )
+        {
+            for ( uint32_t i = 0; i < node.count; ++i )
+            {
+                if ( intersect( indices[node.offset + i], tMax ) )
+                    hit = true;
+            }
+            continue;
+        }
+
+        uint32_t   nearChild = stack[sp] + 1;
+        uint32_t   farChild  = node.offset;
+        T          tNear, tFar;
+        const bool hitNear = intersects( ray, nodes[nearChild].bounds, tNear, T( 0 ), tMax );
+        const bool hitFar  = intersects( ray, nodes[farChild].bounds, tFar, T( 0 ), tMax );
+
+        if ( hitNear && hitFar )
+        {
+            if ( tFar < tNear )
+            {
+                std::swap( nearChild, farChild );
+                std::swap( tNear, tFar );
+            }
+
+            stack[sp]    = farChild;
+            stackT[sp++] = tFar;
+            stack[sp]    = nearChild;
+            stackT[sp++] = tNear;
+        }
+        else if ( hitNear )
+        {
+            stack[sp]    = nearChild;
+            stackT[sp++] = tNear;
+        }
+        else if ( hitFar )
+        {
+            stack[sp]    = farChild;
+            stackT[sp++] = tFar;
+        }
+    }
+
+    return hit;
+}
+
+template<typename T>
+template<typename F>
+void BVH<T>::query( const AABB<T>& box, F&& f ) const
+{
+    if ( nodes.empty() )
+        return;
+
+    uint32_t    stack[MAX_DEPTH];
+    std::size_t sp = 0;
+
+    stack[sp++] = 0;
+
+    while ( sp > 0 )
+    {
+        const uint32_t index = stack[--sp];
+        const Node&    node  = nodes[index];
+
+        if ( !intersects( node.bounds, box ) )
+            continue;
+
+        if ( node.isLeaf() )
+        {
+            for ( uint32_t i = 0; i < node.count; ++i )
+                f( indices[node.offset + i] );
+        }
+        else
+        {
+            stack[sp++] = node.offset;
+            stack[sp++] = index + 1;
+        }
+    }
+}
+
+template<typename T>
+template<typename F>
+uint32_t BVH<T>::nearest( const Vector<T, 3>& p, T& maxDistanceSqr, F&& distanceSqr ) const
+{
+    if ( nodes.empty() )
+        return INVALID_INDEX;
+
+    uint32_t    stack[MAX_DEPTH];
+    T           stackD[MAX_DEPTH];
+    std::size_t sp = 0;
+
+    stack[sp]    = 0;
+    stackD[sp++] = FastMath::distanceSqr( p, nodes[0].bounds );
+
+    uint32_t best = INVALID_INDEX;
+    while ( sp > 0 )
+    {
+        --sp;
+
+        if ( stackD[sp] > maxDistanceSqr )
+            continue;
+
+        const Node& node = nodes[stack[sp]];
+        if ( node.isLeaf() )
+        {
+            for ( uint32_t i = 0; i < node.count; ++i )
+            {
+                const uint32_t prim = indices[node.offset + i];
+                const T        d    = distanceSqr( prim );
+                if ( d <= maxDistanceSqr && ( d < maxDistanceSqr || best == INVALID_INDEX ) )
+                {
+                    maxDistanceSqr = d;
+                    best           = prim;
+                }
+            }
+            continue;
+        }
+
+        uint32_t nearChild = stack[sp] + 1;
+        uint32_t farChild  = node.offset;
+        T        dNear     = FastMath::distanceSqr( p, nodes[nearChild].bounds );
+        T        dFar      = FastMath::distanceSqr( p, nodes[farChild].bounds );
+
+        if ( dFar < dNear )
+        {
+            std::swap( nearChild, farChild );
+            std::swap( dNear, dFar );
+        }
+
+        if ( dFar <= maxDistanceSqr )
+        {
+            stack[sp]    = farChild;
+            stackD[sp++] = dFar;
+        }
+        if ( dNear <= maxDistanceSqr )
+        {
+            stack[sp]    = nearChild;
+            stackD[sp++] = dNear;
+        }
+    }
+
+    return best;
+}
+
+/// <summary>
+/// Compute the bounds of each triangle of an indexed triangle mesh.
+/// </summary>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="vertices">The vertex positions.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="pool">The thread pool to use.</param>
+/// <returns>The bounds of each triangle.</returns>
+template<typename T>
+std::vector<AABB<T>> triangleBounds( std::span<const Vector<T, 3>> vertices, std::span<const uint32_t> indices, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    std::vector<AABB<T>> bounds( indices.size() / 3 );
+
+    pool.parallelFor( 0, bounds.size(), 1 << 14, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+        {
+            const Vector<T, 3>& v0 = vertices[indices[i * 3 + 0]];
+            const Vector<T, 3>& v1 = vertices[indices[i * 3 + 1]];
+            const Vector<T, 3>& v2 = vertices[indices[i * 3 + 2]];
+
+            bounds[i] = merge( AABB<T> { v0, v0 }, AABB<T> { v1, v1 } );
+            bounds[i] = merge( bounds[i], v2 );
+        }
+    } );
+
+    return bounds;
+}
+
+/// <summary>
+/// Find the closest triangle of an indexed triangle mesh that is hit by a ray.
+/// </summary>
+/// <typeparam name="T">The BVH type.</typeparam>
+/// <param name="bvh">The BVH that was built from the triangle bounds.</param>
+/// <param name="vertices">The vertex positions.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="ray">The ray.</param>
+/// <param name="hit">Receives the closest hit.</param>
+/// <param name="tMax">The maximum distance along the ray.</param>
+/// <returns>`true` if the ray hits a triangle, `false` otherwise.</returns>
+template<typename T>
+bool intersects( const BVH<T>& bvh, std::span<const Vector<std::type_identity_t<T>, 3>> vertices, std::span<const uint32_t> indices,
+                 const Ray<T>& ray, RayHit<T>& hit, T tMax = std::numeric_limits<T>::max() )
+{
+    return bvh.raycast( ray, tMax, [&]( uint32_t prim, T& t ) {
+        T _t, u, v;
+        if ( !intersects( ray, vertices[indices[prim * 3 + 0]], vertices[indices[prim * 3 + 1]], vertices[indices[prim * 3 + 2]], _t, u, v, t ) )
+            return false;
+
+        t   = _t;
+        hit = { prim, _t, u, v };
+
+        return true;
+    } );
+}
+
+/// <summary>
+/// Find the point on an indexed triangle mesh that is closest to a point.
+/// </summary>
+/// <typeparam name="T">The BVH type.</typeparam>
+/// <param name="bvh">The BVH that was built from the triangle bounds.</param>
+/// <param name="vertices">The vertex positions.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="p">The query point.</param>
+/// <param name="closest">Receives the closest point on the mesh.</param>
+/// <param name="maxDistance">The maximum distance to search.</param>
+/// <returns>The index of the closest triangle, or `BVH::INVALID_INDEX` if no triangle is within `maxDistance`.</returns>
+template<typename T>
+uint32_t closestPoint( const BVH<T>& bvh, std::span<const Vector<std::type_identity_t<T>, 3>> vertices, std::span<const uint32_t> indices,
+                       const Vector<T, 3>& p, Vector<T, 3>& closest, T maxDistance = std::numeric_limits<T>::max() )
+{
+    auto closestOnTriangle = [&]( uint32_t prim ) {
+        return closestPoint( p, vertices[indices[prim * 3 + 0]], vertices[indices[prim * 3 + 1]], vertices[indices[prim * 3 + 2]] );
+    };
+
+    T maxDistanceSqr = maxDistance < std::sqrt( std::numeric_limits<T>::max() ) ? maxDistance * maxDistance : std::numeric_limits<T>::max();
+
+    const uint32_t prim = bvh.nearest( p, maxDistanceSqr, [&]( uint32_t i ) {
+        return lengthSqr( closestOnTriangle( i ) - p );
+    } );
+
+    if ( prim != BVH<T>::INVALID_INDEX )
+        closest = closestOnTriangle( prim );
+
+    return prim;
+}
+
+}  // namespace FastMath
@@ -0,0 +1,523 @@
+#pragma once
+
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The local transformations (rotation, translation and scale) of the bones of a skeleton, stored as a
+/// structure of arrays. This is the layout expected by the batch pose blending functions.
+/// </summary>
+/// <remarks>
+/// The rotation of bone `i` is `{ qw[i], qx[i], qy[i], qz[i] }`, its translation is `{ tx[i], ty[i], tz[i] }`
+/// and its scale is `{ sx[i], sy[i], sz[i] }`.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Pose
+{
+    /// <summary>
+    /// The Pose value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty pose.
+    /// </summary>
+    Pose() = default;
+
+    /// <summary>
+    /// Construct a pose where all of the bones have the identity transformation.
+    /// </summary>
+    /// <param name="boneCount">The number of bones.</param>
+    explicit Pose( std::size_t boneCount );
+
+    /// <summary>
+    /// Get the number of bones in the pose.
+    /// </summary>
+    /// <returns>The number of bones.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Change the number of bones in the pose. Added bones have the identity transformation.
+    /// </summary>
+    /// <param name="boneCount">The number of bones.</param>
+    void resize( std::size_t boneCount );
+
+    /// <summary>
+    /// Get the rotation of a bone.
+    /// </summary>
+    /// <param name="bone">The index of the bone.</param>
+    /// <returns>The rotation of the bone.</returns>
+    Quaternion<T> getRotation( std::size_t bone ) const noexcept;
+
+    /// <summary>
+    /// Set the rotation of a bone.
+    /// </summary>
+    /// <param name="bone">The index of the bone.</param>
+    /// <param name="rotation">The rotation of the bone.</param>
+    void setRotation( std::size_t bone, const Quaternion<T>& rotation ) noexcept;
+
+    /// <summary>
+    /// Get the translation of a bone.
+    /// </summary>
+    /// <param name="bone">The index of the bone.</param>
+    /// <returns>The translation of the bone.</returns>
+    Vector<T, 3> getTranslation( std::size_t bone ) const noexcept;
+
+    /// <summary>
+    /// Set the translation of a bone.
+    /// </summary>
+    /// <param name="bone">The index of the bone.</param>
+    /// <param name="translation">The translation of the bone.</param>
+    void setTranslation( std::size_t bone, const Vector<T, 3>& translation ) noexcept;
+
+    /// <summary>
+    /// Get the scale of a bone.
+    /// </summary>
+    /// <param name="bone">The index of the bone.</param>
+    /// <returns>The scale of the bone.</returns>
+    Vector<T, 3> getScale( std::size_t bone ) const noexcept;
+
+    /// <summary>
+    /// Set the scale of a bone.
+    /// </summary>
+    /// <param name="bone">The index of the bone.</param>
+    /// <param name="scale">The scale of the bone.</param>
+    void setScale( std::size_t bone, const Vector<T, 3>& scale ) noexcept;
+
+    std::vector<T> qw, qx, qy, qz;
+    std::vector<T> tx, ty, tz;
+    std::vector<T> sx, sy, sz;
+};
+
+using Posef = Pose<float>;
+using Posed = Pose<double>;
+
+/// <summary>
+/// A tree of weighted blends between animation poses.
+/// </summary>
+/// <remarks>
+/// The leaves of the tree reference input poses (by index) and the inner nodes blend their children with
+/// (non-negative) weights that are normalized when the tree is evaluated, so they can be set directly from
+/// blend parameters. Nodes are added bottom up (children must be added before their parents), and the last
+/// node that was added is the root of the tree.
+/// Since blending is linear, the tree is evaluated by first computing the total weight of each input pose
+/// (the product of the normalized weights from the root to the leaves that reference the pose), and then
+/// blending all of the input poses in a single pass (see `blendPoses`).
+/// The intermediate weights are kept in the tree and reused by later evaluations, so evaluating a tree does not
+/// allocate memory once it has been evaluated (and the tree must not be evaluated by several threads at the same time).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct BlendTree
+{
+    /// <summary>
+    /// The BlendTree value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Add a leaf node that references an input pose.
+    /// </summary>
+    /// <param name="pose">The index of the input pose.</param>
+    /// <returns>The index of the new node.</returns>
+    uint32_t addPose( uint32_t pose );
+
+    /// <summary>
+    /// Add a node that blends other nodes.
+    /// </summary>
+    /// <param name="_children">The nodes to blend (which must already be in the tree).</param>
+    /// <param name="_weights">(optional) The weights of the children. If empty, all of the children have the same weight.</param>
+    /// <returns>The index of the new node.</returns>
+    uint32_t addBlend( std::span<const uint32_t> _children, std::span<const T> _weights = {} );
+
+    /// <summary>
+    /// Set the weights of the children of a blend node.
+    /// </summary>
+    /// <param name="node">The index of the blend node.</param>
+    /// <param name="_weights">The weights of the children.</param>
+    void setWeights( uint32_t node, std::span<const T> _weights ) noexcept;
+
+    /// <summary>
+    /// Set the weight of a child of a blend node.
+    /// </summary>
+    /// <param name="node">The index of the blend node.</param>
+    /// <param name="child">The index of the child in the blend node (not the index of the child node).</param>
+    /// <param name="weight">The weight of the child.</param>
+    void setWeight( uint32_t node, std::size_t child, T weight ) noexcept;
+
+    /// <summary>
+    /// Get the number of nodes in the tree.
+    /// </summary>
+    /// <returns>The number of nodes.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the number of input poses that are required to evaluate the tree (one more than the largest pose index).
+    /// </summary>
+    /// <returns>The number of input poses.</returns>
+    std::size_t getPoseCount() const noexcept;
+
+    /// <summary>
+    /// Compute the total weight of each input pose.
+    /// </summary>
+    /// <remarks>
+    /// The intermediate weights are written to `_nodeWeights` (instead of the storage that `evaluate` reuses), so
+    /// this does not allocate memory and can be called by several threads at the same time.
+    /// </remarks>
+    /// <param name="_poseWeights">Receives the weight of each input pose (at least `getPoseCount()` values).</param>
+    /// <param name="_nodeWeights">Scratch storage for the weight of each node (at least `size()` values).</param>
+    void getPoseWeights( std::span<T> _poseWeights, std::span<T> _nodeWeights ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the tree.
+    /// </summary>
+    /// <param name="poses">The input poses (at least `getPoseCount()` poses with the same number of bones).</param>
+    /// <param name="result">Receives the blended pose.</param>
+    void evaluate( std::span<const Pose<T>> poses, Pose<T>& result ) const;
+
+private:
+    // The pose index of blend nodes.
+    static constexpr uint32_t BLEND = ~0u;
+
+    struct Node
+    {
+        uint32_t pose;   // The input pose (or BLEND for blend nodes).
+        uint32_t first;  // The index of the first child in `children` and `weights`.
+        uint32_t count;  // The number of children.
+    };
+
+    std::vector<Node>     nodes;
+    std::vector<uint32_t> children;
+    std::vector<T>        weights;
+    uint32_t              poseCount = 0;
+
+    // Reused between evaluations.
+    mutable std::vector<T> nodeWeights;
+    mutable std::vector<T> poseWeights;
+};
+
+using BlendTreef = BlendTree<float>;
+using BlendTreed = BlendTree<double>;
+
+template<typename T>
+Pose<T>::Pose( std::size_t boneCount )
+{
+    resize( boneCount );
+}
+
+template<typename T>
+std::size_t Pose<T>::size() const noexcept
+{
+    return qw.size();
+}
+
+template<typename T>
+void Pose<T>::resize( std::size_t boneCount )
+{
+    qw.resize( boneCount, T( 1 ) );
+    qx.resize( boneCount, T( 0 ) );
+    qy.resize( boneCount, T( 0 ) );
+    qz.resize( boneCount, T( 0 ) );
+    tx.resize( boneCount, T( 0 ) );
+    ty.resize( boneCount, T( 0 ) );
+    tz.resize( boneCount, T( 0 ) );
+    sx.resize( boneCount, T( 1 ) );
+    sy.resize( boneCount, T( 1 ) );
+    sz.resize( boneCount, T( 1 ) );
+}
+
+template<typename T>
+Quaternion<T> Pose<T>::getRotation( std::size_t bone ) const noexcept
+{
+    return { qw[bone], qx[bone], qy[bone], qz[bone] };
+}
+
+template<typename T>
+void Pose<T>::setRotation( std::size_t bone, const Quaternion<T>& rotation ) noexcept
+{
+    qw[bone] = rotation.w;
+    qx[bone] = rotation.x;
+    qy[bone] = rotation.y;
+    qz[bone] = rotation.z;
+}
+
+template<typename T>
+Vector<T, 3> Pose<T>::getTranslation( std::size_t bone ) const noexcept
+{
+    return { tx[bone], ty[bone], tz[bone] };
+}
+
+template<typename T>
+void Pose<T>::setTranslation( std::size_t bone, const Vector<T, 3>& translation ) noexcept
+{
+    tx[bone] = translation.x;
+    ty[bone] = translation.y;
+    tz[bone] = translation.z;
+}
+
+template<typename T>
+Vector<T, 3> Pose<T>::getScale( std::size_t bone ) const noexcept
+{
+    return { sx[bone], sy[bone], sz[bone] };
+}
+
+template<typename T>
+void Pose<T>::setScale( std::size_t bone, const Vector<T, 3>& scale ) noexcept
+{
+    sx[bone] = scale.x;
+    sy[bone] = scale.y;
+    sz[bone] = scale.z;
+}
+
+/// <summary>
+/// Blend several poses.
+/// </summary>
+/// <remarks>
+/// The rotations of each bone are averaged with a weighted nlerp (see `QuaternionAccumulator`), and the translations
+/// and scales are linearly blended. The weights are normalized, and poses with a weight of 0 are skipped. If all of the
+/// weights are 0, the result is the identity pose. No memory is allocated (other than resizing `result`).
+/// For single-precision poses, 8 bones are blended at a time with AVX2, in a single pass over all of the poses.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="poses">The poses to blend (with the same number of bones).</param>
+/// <param name="weights">The (non-negative) weight of each pose.</param>
+/// <param name="result">Receives the blended pose.</param>
+template<typename T>
+void blendPoses( std::span<const Pose<T>> poses, std::span<const std::type_identity_t<T>> weights, Pose<T>& result )
+{
+    assert( weights.size() == poses.size() );
+
+    const std::size_t boneCount = poses.empty() ? 0 : poses[0].size();
+    result.resize( boneCount );
+
+    // The weights are normalized as the poses are blended (poses with a weight of 0 are skipped).
+    T total = T( 0 );
+    for ( std::size_t i = 0; i < poses.size(); ++i )
+    {
+        assert( weights[i] >= T( 0 ) );
+        assert( poses[i].size() == boneCount );
+
+        total += weights[i];
+    }
+
+    const bool identity = !( total > T( 0 ) );
+
+    std::size_t b = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 zero     = _mm256_setzero_ps();
+        const __m256 one      = _mm256_set1_ps( 1.0f );
+        const __m256 signMask = _mm256_set1_ps( -0.0f );
+
+        for ( ; b + Simd::WIDTH <= boneCount; b += Simd::WIDTH )
+        {
+            __m256 q[4] = { zero, zero, zero, zero };
+            __m256 t[3] = { zero, zero, zero };
+            __m256 s[3] = { zero, zero, zero };
+
+            for ( std::size_t i = 0; i < poses.size(); ++i )
+            {
+                if ( !( weights[i] > 0.0f ) )
+                    continue;
+
+                const Pose<float>& pose   = poses[i];
+                const __m256       weight = _mm256_set1_ps( weights[i] / total );
+
+                const __m256 qw = _mm256_loadu_ps( pose.qw.data() + b );
+                const __m256 qx = _mm256_loadu_ps( pose.qx.data() + b );
+                const __m256 qy = _mm256_loadu_ps( pose.qy.data() + b );
+                const __m256 qz = _mm256_loadu_ps( pose.qz.data() + b );
+
+                // Stay on the hemisphere of the running sum.
+                const __m256 d  = Simd::fmadd( q[0], qw, Simd::fmadd( q[1], qx, Simd::fmadd( q[2], qy, _mm256_mul_ps( q[3], qz ) ) ) );
+                const __m256 qs = _mm256_xor_ps( weight, _mm256_and_ps( _mm256_cmp_ps( d, zero, _CMP_LT_OQ ), signMask ) );
+
+                q[0] = Simd::fmadd( qs, qw, q[0] );
+                q[1] = Simd::fmadd( qs, qx, q[1] );
+                q[2] = Simd::fmadd( qs, qy, q[2] );
+                q[3] = Simd::fmadd( qs, qz, q[3] );
+
+                t[0] = Simd::fmadd( weight, _mm256_loadu_ps( pose.tx.data() + b ), t[0] );
+                t[1] = Simd::fmadd( weight, _mm256_loadu_ps( pose.ty.data() + b ), t[1] );
+                t[2] = Simd::fmadd( weight, _mm256_loadu_ps( pose.tz.data() + b ), t[2] );
+
+                s[0] = Simd::fmadd( weight, _mm256_loadu_ps( pose.sx.data() + b ), s[0] );
+                s[1] = Simd::fmadd( weight, _mm256_loadu_ps( pose.sy.data() + b ), s[1] );
+                s[2] = Simd::fmadd( weight, _mm256_loadu_ps( pose.sz.data() + b ), s[2] );
+            }
+
+            // Normalize the rotations (bones without any contribution get the identity).
+            const __m256 lengthSqr = Simd::fmadd( q[0], q[0], Simd::fmadd( q[1], q[1], Simd::fmadd( q[2], q[2], _mm256_mul_ps( q[3], q[3] ) ) ) );
+            const __m256 valid     = _mm256_cmp_ps( lengthSqr, zero, _CMP_GT_OQ );
+            const __m256 invLength = _mm256_and_ps( valid, _mm256_div_ps( one, _mm256_sqrt_ps( lengthSqr ) ) );
+
+            _mm256_storeu_ps( result.qw.data() + b, _mm256_blendv_ps( one, _mm256_mul_ps( q[0], invLength ), valid ) );
+            _mm256_storeu_ps( result.qx.data() + b, _mm256_mul_ps( q[1], invLength ) );
+            _mm256_storeu_ps( result.qy.data() + b, _mm256_mul_ps( q[2], invLength ) );
+            _mm256_storeu_ps( result.qz.data() + b, _mm256_mul_ps( q[3], invLength ) );
+
+            // The identity pose if none of the poses contribute.
+            const __m256 scale = identity ? one : zero;
+
+            _mm256_storeu_ps( result.tx.data() + b, t[0] );
+            _mm256_storeu_ps( result.ty.data() + b, t[1] );
+            _mm256_storeu_ps( result.tz.data() + b, t[2] );
+            _mm256_storeu_ps( result.sx.data() + b, _mm256_add_ps( s[0], scale ) );
+            _mm256_storeu_ps( result.sy.data() + b, _mm256_add_ps( s[1], scale ) );
+            _mm256_storeu_ps( result.sz.data() + b, _mm256_add_ps( s[2], scale ) );
+        }
+    }
+#endif
+
+    for ( ; b < boneCount; ++b )
+    {
+        QuaternionAccumulator<T> rotation;
+        Vector<T, 3>             translation { T( 0 ) };
+        Vector<T, 3>             scale { identity ? T( 1 ) : T( 0 ) };
+
+        for ( std::size_t i = 0; i < poses.size(); ++i )
+        {
+            if ( !( weights[i] > T( 0 ) ) )
+                continue;
+
+            const T w = weights[i] / total;
+            rotation.add( poses[i].getRotation( b ), w );
+            translation += poses[i].getTranslation( b ) * w;
+            scale += poses[i].getScale( b ) * w;
+        }
+
+        result.setRotation( b, rotation.getAverage() );
+        result.setTranslation( b, translation );
+        result.setScale( b, scale );
+    }
+}
+
+template<typename T>
+uint32_t BlendTree<T>::addPose( uint32_t pose )
+{
+    assert( pose != BLEND );
+
+    nodes.push_back( { pose, 0, 0 } );
+    poseCount = std::max( poseCount, pose + 1 );
+
+    return static_cast<uint32_t>( nodes.size() - 1 );
+}
+
+template<typename T>
+uint32_t BlendTree<T>::addBlend( std::span<const uint32_t> _children, std::span<const T> _weights )
+{
+    assert( _weights.empty() || _weights.size() == _children.size() );
+
+    nodes.push_back( { BLEND, static_cast<uint32_t>( children.size() ), static_cast<uint32_t>( _children.size() ) } );
+    for ( std::size_t i = 0; i < _children.size(); ++i )
+    {
+        // Children are added before their parents, which also prevents cycles.
+        assert( _children[i] + 1 < nodes.size() );
+
+        children.push_back( _children[i] );
+        weights.push_back( _weights.empty() ? T( 1 ) : _weights[i] );
+    }
+
+    return static_cast<uint32_t>( nodes.size() - 1 );
+}
+
+template<typename T>
+void BlendTree<T>::setWeights( uint32_t node, std::span<const T> _weights ) noexcept
+{
+    assert( nodes[node].pose == BLEND );
+    assert( _weights.size() == nodes[node].count );
+
+    std::copy( _weights.begin(), _weights.end(), weights.begin() + nodes[node].first );
+}
+
+template<typename T>
+void BlendTree<T>::setWeight( uint32_t node, std::size_t child, T weight ) noexcept
+{
+    assert( nodes[node].pose == BLEND );
+    assert( child < nodes[node].count );
+
+    weights[nodes[node].first + child] = weight;
+}
+
+template<typename T>
+std::size_t BlendTree<T>::size() const noexcept
+{
+    return nodes.size();
+}
+
+template<typename T>
+std::size_t BlendTree<T>::getPoseCount() const noexcept
+{
+    return poseCount;
+}
+
+template<typename T>
+void BlendTree<T>::getPoseWeights( std::span<T> _poseWeights, std::span<T> _nodeWeights ) const noexcept
+{
+    assert( _poseWeights.size() >= poseCount );
+    assert( _nodeWeights.size() >= nodes.size() );
+
+    std::fill( _poseWeights.begin(), _poseWeights.end(), T( 0 ) );
+
+    if ( nodes.empty() )
+        return;
+
+    // Children always have a smaller index than their parents, so the weights can be pushed down the tree
+    // by visiting the nodes in reverse order.
+    std::fill_n( _nodeWeights.begin(), nodes.size(), T( 0 ) );
+    _nodeWeights[nodes.size() - 1] = T( 1 );
+
+    for ( std::size_t n = nodes.size(); n-- > 0; )
+    {
+        const Node& node = nodes[n];
+        if ( _nodeWeights[n] <= T( 0 ) )
+            continue;
+
+        if ( node.pose != BLEND )
+        {
+            _poseWeights[node.pose] += _nodeWeights[n];
+            continue;
+        }
+
+        T total = T( 0 );
+        for ( uint32_t c = node.first; c < node.first + node.count; ++c )
+        {
+            assert( weights[c] >= T( 0 ) );
+            total += weights[c];
+        }
+
+        if ( total <= T( 0 ) )
+            continue;
+
+        for ( uint32_t c = node.first; c < node.first + node.count; ++c )
+            _nodeWeights[children[c]] += _nodeWeights[n] * weights[c] / total;
+    }
+}
+
+template<typename T>
+void BlendTree<T>::evaluate( std::span<const Pose<T>> poses, Pose<T>& result ) const
+{
+    assert( poses.size() >= poseCount );
+
+    nodeWeights.resize( nodes.size() );
+    poseWeights.resize( poses.size() );
+    getPoseWeights( poseWeights, nodeWeights );
+
+    blendPoses<T>( poses, poseWeights, result );
+}
+
+}  // namespace FastMath
@@ -0,0 +1,479 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Frustum.hpp"
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Vector.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The type of projection used by a camera.
+/// </summary>
+enum class Projection
+{
+    /// <summary>
+    /// A perspective projection (see `perspectiveFoV`).
+    /// </summary>
+    Perspective,
+    /// <summary>
+    /// An orthographic projection (see `orthographic`).
+    /// </summary>
+    Orthographic,
+};
+
+/// <summary>
+/// A camera that caches its view, projection and view-projection matrices, their inverses and
+/// the world-space view frustum.
+/// </summary>
+/// <remarks>
+/// The camera keeps track of which of the cached terms are invalidated by a change so that only
+/// those terms are recomputed (the first time they are requested). For example, moving the camera
+/// does not rebuild the projection matrix and its inverse, and changing the field of view does not
+/// rebuild the view matrix.
+/// The matrices are built using the default configuration based on the values of `LS_HANDEDNESS`
+/// and `LS_DEPTH_RANGE`. The inverses are built analytically (see `perspectiveFoVInverse`).
+/// The cache is rebuilt lazily by the (const) getters, so a camera must not be read from multiple
+/// threads while it is dirty. Use `update` to rebuild the cache before sharing the camera.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Camera
+{
+    /// <summary>
+    /// The Camera value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct a camera with a 60 degree perspective projection.
+    /// </summary>
+    /// <param name="position">The position of the camera in world space.</param>
+    /// <param name="rotation">The orientation of the camera in world space.</param>
+    explicit constexpr Camera( const Vector<T, 3>&  position = Vector<T, 3> { 0, 0, 0 },
+                               const Quaternion<T>& rotation = Quaternion<T>::IDENTITY ) noexcept;
+
+    const Vector<T, 3>& getPosition() const noexcept;
+
+    void setPosition( const Vector<T, 3>& position ) noexcept;
+
+    const Quaternion<T>& getRotation() const noexcept;
+
+    void setRotation( const Quaternion<T>& rotation ) noexcept;
+
+    /// <summary>
+    /// Orient the camera to look at a target (see `lookAt`).
+    /// </summary>
+    /// <param name="target">The target to look at.</param>
+    /// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+    void lookAt( const Vector<T, 3>& target, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y ) noexcept;
+
+    Projection getProjection() const noexcept;
+
+    /// <summary>
+    /// Use a perspective projection.
+    /// </summary>
+    /// <param name="fovy">The vertical field of view (in radians).</param>
+    /// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+    /// <param name="n">The distance to the near clipping plane in view space.</param>
+    /// <param name="f">The distance to the far clipping plane in view space.</param>
+    void setPerspective( T fovy, T aspectRatio, T n, T f ) noexcept;
+
+    /// <summary>
+    /// Use an orthographic projection.
+    /// </summary>
+    /// <param name="l">The distance to the left clipping plane in view space.</param>
+    /// <param name="r">The distance to the right clipping plane in view space.</param>
+    /// <param name="b">The distance to the bottom clipping plane in view space.</param>
+    /// <param name="t">The distance to the top clipping plane in view space.</param>
+    /// <param name="n">The distance to the near clipping plane in view space.</param>
+    /// <param name="f">The distance to the far clipping plane in view space.</param>
+    void setOrthographic( T l, T r, T b, T t, T n, T f ) noexcept;
+
+    /// <summary>
+    /// Get the vertical field of view (in radians) of a perspective camera.
+    /// </summary>
+    T getFieldOfView() const noexcept;
+
+    void setFieldOfView( T fovy ) noexcept;
+
+    /// <summary>
+    /// Get the aspect ratio (\f(width/height\f)) of a perspective camera.
+    /// </summary>
+    T getAspectRatio() const noexcept;
+
+    void setAspectRatio( T aspectRatio ) noexcept;
+
+    T getNear() const noexcept;
+
+    T getFar() const noexcept;
+
+    void setClipPlanes( T n, T f ) noexcept;
+
+    const Matrix<T, 4>& getViewMatrix() const noexcept;
+
+    const Matrix<T, 4>& getInverseViewMatrix() const noexcept;
+
+    const Matrix<T, 4>& getProjectionMatrix() const noexcept;
+
+    const Matrix<T, 4>& getInverseProjectionMatrix() const noexcept;
+
+    const Matrix<T, 4>& getViewProjectionMatrix() const noexcept;
+
+    const Matrix<T, 4>& getInverseViewProjectionMatrix() const noexcept;
+
+    /// <summary>
+    /// Get the view frustum of the camera in world space.
+    /// </summary>
+    const Frustum<T>& getFrustum() const noexcept;
+
+    /// <summary>
+    /// Check if any of the cached terms need to be rebuilt.
+    /// </summary>
+    bool isDirty() const noexcept;
+
+    /// <summary>
+    /// Rebuild all of the cached terms that were invalidated since the last update.
+    /// </summary>
+    void update() const noexcept;
+
+private:
+    // Cached terms that need to be rebuilt.
+    enum Dirty : uint32_t
+    {
+        VIEW                    = 1u << 0u,
+        INVERSE_VIEW            = 1u << 1u,
+        PROJECTION              = 1u << 2u,
+        INVERSE_PROJECTION      = 1u << 3u,
+        VIEW_PROJECTION         = 1u << 4u,
+        INVERSE_VIEW_PROJECTION = 1u << 5u,
+        FRUSTUM                 = 1u << 6u,
+
+        // Terms that depend on the view matrix.
+        VIEW_CHANGED = VIEW | INVERSE_VIEW | VIEW_PROJECTION | INVERSE_VIEW_PROJECTION | FRUSTUM,
+        // Terms that depend on the projection matrix.
+        PROJECTION_CHANGED = PROJECTION | INVERSE_PROJECTION | VIEW_PROJECTION | INVERSE_VIEW_PROJECTION | FRUSTUM,
+        ALL                = VIEW_CHANGED | PROJECTION_CHANGED,
+    };
+
+    Vector<T, 3>  position;
+    Quaternion<T> rotation;
+
+    Projection projection;
+
+    // Perspective projection parameters.
+    T fovy;
+    T aspectRatio;
+
+    // Orthographic projection parameters.
+    T left;
+    T right;
+    T bottom;
+    T top;
+
+    T nearPlane;
+    T farPlane;
+
+    mutable Matrix<T, 4> viewMatrix;
+    mutable Matrix<T, 4> inverseViewMatrix;
+    mutable Matrix<T, 4> projectionMatrix;
+    mutable Matrix<T, 4> inverseProjectionMatrix;
+    mutable Matrix<T, 4> viewProjectionMatrix;
+    mutable Matrix<T, 4> inverseViewProjectionMatrix;
+    mutable Frustum<T>   frustum;
+
+    // The cached terms that need to be rebuilt (a combination of Dirty flags).
+    mutable uint32_t dirty;
+};
+
+using CameraF = Camera<float>;
+using CameraD = Camera<double>;
+
+template<typename T>
+constexpr Camera<T>::Camera( const Vector<T, 3>& position, const Quaternion<T>& rotation ) noexcept
+: position { position }
+, rotation { rotation }
+, projection { Projection::Perspective }
+, fovy { PI<T> / T( 3 ) }
+, aspectRatio { T( 1 ) }
+, left { T( -1 ) }
+, right { T( 1 ) }
+, bottom { T( -1 ) }
+, top { T( 1 ) }
+, nearPlane { T( 0.1 ) }
+, farPlane { T( 1000 ) }
+, dirty { ALL }
+{}
+
+template<typename T>
+const Vector<T, 3>& Camera<T>::getPosition() const noexcept
+{
+    return position;
+}
+
+template<typename T>
+void Camera<T>::setPosition( const Vector<T, 3>& _position ) noexcept
+{
+    position = _position;
+    dirty |= VIEW_CHANGED;
+}
+
+template<typename T>
+const Quaternion<T>& Camera<T>::getRotation() const noexcept
+{
+    return rotation;
+}
+
+template<typename T>
+void Camera<T>::setRotation( const Quaternion<T>& _rotation ) noexcept
+{
+    rotation = _rotation;
+    dirty |= VIEW_CHANGED;
+}
+
+template<typename T>
+void Camera<T>::lookAt( const Vector<T, 3>& target, const Vector<T, 3>& up ) noexcept
+{
+    // The same basis as lookAtLH and lookAtRH. The columns of the rotation are the camera axes in world space.
+#if LS_HANDEDNESS == LS_LEFT_HANDED
+    const Vector<T, 3> Z( normalize( target - position ) );
+#else
+    const Vector<T, 3> Z( normalize( position - target ) );
+#endif
+    const Vector<T, 3> X( normalize( cross( up, Z ) ) );
+    const Vector<T, 3> Y( cross( Z, X ) );
+
+    setRotation( normalize( fromMat3( Matrix<T, 3> {
+        X.x, Y.x, Z.x,
+        X.y, Y.y, Z.y,
+        X.z, Y.z, Z.z } ) ) );
+}
+
+template<typename T>
+Projection Camera<T>::getProjection() const noexcept
+{
+    return projection;
+}
+
+template<typename T>
+void Camera<T>::setPerspective( T _fovy, T _aspectRatio, T n, T f ) noexcept
+{
+    projection  = Projection::Perspective;
+    fovy        = _fovy;
+    aspectRatio = _aspectRatio;
+    nearPlane   = n;
+    farPlane    = f;
+    dirty |= PROJECTION_CHANGED;
+}
+
+template<typename T>
+void Camera<T>::setOrthographic( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    projection = Projection::Orthographic;
+    left       = l;
+    right      = r;
+    bottom     = b;
+    top        = t;
+    nearPlane  = n;
+    farPlane   = f;
+    dirty |= PROJECTION_CHANGED;
+}
+
+template<typename T>
+T Camera<T>::getFieldOfView() const noexcept
+{
+    return fovy;
+}
+
+template<typename T>
+void Camera<T>::setFieldOfView( T _fovy ) noexcept
+{
+    assert( projection == Projection::Perspective );
+
+    fovy = _fovy;
+    dirty |= PROJECTION_CHANGED;
+}
+
+template<typename T>
+T Camera<T>::getAspectRatio() const noexcept
+{
+    return aspectRatio;
+}
+
+template<typename T>
+void Camera<T>::setAspectRatio( T _aspectRatio ) noexcept
+{
+    assert( projection == Projection::Perspective );
+
+    aspectRatio = _aspectRatio;
+    dirty |= PROJECTION_CHANGED;
+}
+
+template<typename T>
+T Camera<T>::getNear() const noexcept
+{
+    return nearPlane;
+}
+
+template<typename T>
+T Camera<T>::getFar() const noexcept
+{
+    return farPlane;
+}
+
+template<typename T>
+void Camera<T>::setClipPlanes( T n, T f ) noexcept
+{
+    nearPlane = n;
+    farPlane  = f;
+    dirty |= PROJECTION_CHANGED;
+}
+
+template<typename T>
+const Matrix<T, 4>& Camera<T>::getViewMatrix() const noexcept
+{
+    if ( dirty & VIEW )
+    {
+        // The inverse of the camera transformation: the transposed rotation followed by the negated translation.
+        const Matrix<T, 3> r = toMat3( rotation );
+
+        for ( int i = 0; i < 3; ++i )
+        {
+            const Vector<T, 3> axis { r[0][i], r[1][i], r[2][i] };
+
+            viewMatrix[i] = Vector<T, 4> { axis.x, axis.y, axis.z, -dot( axis, position ) };
+        }
+        viewMatrix[3] = Vector<T, 4>::UNIT_W;
+
+        dirty &= ~VIEW;
+    }
+
+    return viewMatrix;
+}
+
+template<typename T>
+const Matrix<T, 4>& Camera<T>::getInverseViewMatrix() const noexcept
+{
+    if ( dirty & INVERSE_VIEW )
+    {
+        const Matrix<T, 3> r = toMat3( rotation );
+
+        for ( int i = 0; i < 3; ++i )
+            inverseViewMatrix[i] = Vector<T, 4> { r[i][0], r[i][1], r[i][2], position[i] };
+        inverseViewMatrix[3] = Vector<T, 4>::UNIT_W;
+
+        dirty &= ~INVERSE_VIEW;
+    }
+
+    return inverseViewMatrix;
+}
+
+template<typename T>
+const Matrix<T, 4>& Camera<T>::getProjectionMatrix() const noexcept
+{
+    if ( dirty & PROJECTION )
+    {
+        if ( projection == Projection::Perspective )
+            projectionMatrix = perspectiveFoV( fovy, aspectRatio, nearPlane, farPlane );
+        else
+            projectionMatrix = orthographic( left, right, bottom, top, nearPlane, farPlane );
+
+        dirty &= ~PROJECTION;
+    }
+
+    return projectionMatrix;
+}
+
+template<typename T>
+const Matrix<T, 4>& Camera<T>::getInverseProjectionMatrix() const noexcept
+{
+    if ( dirty & INVERSE_PROJECTION )
+    {
+        if ( projection == Projection::Perspective )
+            inverseProjectionMatrix = perspectiveFoVInverse( fovy, aspectRatio, nearPlane, farPlane );
+        else
+            inverseProjectionMatrix = orthographicInverse( left, right, bottom, top, nearPlane, farPlane );
+
+        dirty &= ~INVERSE_PROJECTION;
+    }
+
+    return inverseProjectionMatrix;
+}
+
+template<typename T>
+const Matrix<T, 4>& Camera<T>::getViewProjectionMatrix() const noexcept
+{
+    if ( dirty & VIEW_PROJECTION )
+    {
+        viewProjectionMatrix = getProjectionMatrix() * getViewMatrix();
+        dirty &= ~VIEW_PROJECTION;
+    }
+
+    return viewProjectionMatrix;
+}
+
+template<typename T>
+const Matrix<T, 4>& Camera<T>::getInverseViewProjectionMatrix() const noexcept
+{
+    if ( dirty & INVERSE_VIEW_PROJECTION )
+    {
+        inverseViewProjectionMatrix = getInverseViewMatrix() * getInverseProjectionMatrix();
+        dirty &= ~INVERSE_VIEW_PROJECTION;
+    }
+
+    return inverseViewProjectionMatrix;
+}
+
+template<typename T>
+const Frustum<T>& Camera<T>::getFrustum() const noexcept
+{
+    if ( dirty & FRUSTUM )
+    {
+        frustum = extractFrustum( getViewProjectionMatrix() );
+        dirty &= ~FRUSTUM;
+    }
+
+    return frustum;
+}
+
+template<typename T>
+bool Camera<T>::isDirty() const noexcept
+{
+    return dirty != 0;
+}
+
+template<typename T>
+void Camera<T>::update() const noexcept
+{
+    if ( !dirty )
+        return;
+
+    getViewMatrix();
+    getInverseViewMatrix();
+    getProjectionMatrix();
+    getInverseProjectionMatrix();
+    getViewProjectionMatrix();
+    getInverseViewProjectionMatrix();
+    getFrustum();
+}
+
+/// <summary>
+/// Rebuild the cached terms of several cameras (for example, the cameras of each shadow cascade)
+/// so that they can be safely read from multiple threads.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="cameras">The cameras to update.</param>
+template<typename T>
+void update( std::span<const Camera<T>> cameras ) noexcept
+{
+    for ( const Camera<T>& camera: cameras )
+        camera.update();
+}
+
+}  // namespace FastMath
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <concepts>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The handedness of the view space coordinate system.
+/// </summary>
+enum class Handedness
+{
+    /// <summary>
+    /// The camera looks down the positive z-axis.
+    /// </summary>
+    Left,
+    /// <summary>
+    /// The camera looks down the negative z-axis.
+    /// </summary>
+    Right,
+};
+
+/// <summary>
+/// The range of depth values in normalized device coordinates, from the near clipping plane to the far clipping plane.
+/// </summary>
+enum class DepthRange
+{
+    /// <summary>
+    /// \f(0 \le z_{ndc} \le 1\f) (DirectX, Vulkan, and Metal).
+    /// </summary>
+    ZeroToOne,
+    /// <summary>
+    /// \f(-1 \le z_{ndc} \le 1\f) (OpenGL).
+    /// </summary>
+    NegativeOneToOne,
+    /// <summary>
+    /// Reverse-Z: the near clipping plane maps to 1 and the far clipping plane maps to 0.
+    /// Combined with a floating-point depth buffer, this distributes the depth precision much more evenly
+    /// than `ZeroToOne`.
+    /// </summary>
+    OneToZero,
+};
+
+/// <summary>
+/// A clip space policy that selects the handedness and depth range of the projection and view matrices at compile time.
+/// </summary>
+/// <remarks>
+/// The `frustum`, `orthographic`, `perspectiveFoV`, `perspective`, `lookAt`, and `lookTo` functions have overloads
+/// that take a clip space policy as the first template argument. This allows a single binary to build matrices for
+/// several graphics APIs, while the functions without a policy use the configuration of `LS_HANDEDNESS` and
+/// `LS_DEPTH_RANGE`.
+/// \code
+/// using GLClipSpace       = ClipSpace<Handedness::Right, DepthRange::NegativeOneToOne>;
+/// using ReverseZClipSpace = ClipSpace<Handedness::Right, DepthRange::OneToZero>;
+///
+/// auto gl = perspectiveFoV<GLClipSpace>( fovy, aspectRatio, n, f );
+/// auto vk = perspectiveFoVInfinite<ReverseZClipSpace>( fovy, aspectRatio, n );
+/// \endcode
+/// </remarks>
+/// <typeparam name="H">The handedness of the view space.</typeparam>
+/// <typeparam name="D">The range of depth values in normalized device coordinates.</typeparam>
+template<Handedness H, DepthRange D>
+struct ClipSpace
+{
+    static constexpr Handedness handedness = H;
+    static constexpr DepthRange depthRange = D;
+};
+
+/// <summary>
+/// A concept that constrains types to clip space policies (see `ClipSpace`).
+/// </summary>
+template<typename P>
+concept ClipSpacePolicy = requires {
+    { P::handedness } -> std::convertible_to<Handedness>;
+    { P::depthRange } -> std::convertible_to<DepthRange>;
+};
+
+/// <summary>
+/// The clip space policy based on the values of `LS_HANDEDNESS` and `LS_DEPTH_RANGE`.
+/// </summary>
+using DefaultClipSpace = ClipSpace<LS_HANDEDNESS == LS_LEFT_HANDED ? Handedness::Left : Handedness::Right,
+                                   LS_DEPTH_RANGE == LS_ZERO_TO_ONE ? DepthRange::ZeroToOne : DepthRange::NegativeOneToOne>;
+
+namespace detail
+{
+// The direction of the camera along the view space z-axis.
+template<ClipSpacePolicy P, typename T>
+constexpr T viewDirection() noexcept
+{
+    return P::handedness == Handedness::Left ? T( 1 ) : T( -1 );
+}
+
+// The depth value of the near clipping plane in normalized device coordinates.
+template<ClipSpacePolicy P, typename T>
+constexpr T nearDepth() noexcept
+{
+    if constexpr ( P::depthRange == DepthRange::NegativeOneToOne )
+        return T( -1 );
+    else if constexpr ( P::depthRange == DepthRange::OneToZero )
+        return T( 1 );
+    else
+        return T( 0 );
+}
+
+// The depth value of the far clipping plane in normalized device coordinates.
+template<ClipSpacePolicy P, typename T>
+constexpr T farDepth() noexcept
+{
+    return P::depthRange == DepthRange::OneToZero ? T( 0 ) : T( 1 );
+}
+}  // namespace detail
+
+}  // namespace FastMath
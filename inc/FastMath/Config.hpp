@@ -51,6 +51,12 @@
         #include <immintrin.h>
     #endif
 
+    // MSVC does not define __FMA__, but /arch:AVX2 implies FMA3 support.
+    #if ( defined( __FMA__ ) || defined( _MSC_VER ) && defined( __AVX2__ ) ) && !defined( LS_FMA )
+        #define LS_FMA
+        #include <immintrin.h>
+    #endif
+
     #if defined( __AVX__ ) && !defined( LS_AVX )
         #define LS_AVX
         #include <immintrin.h>
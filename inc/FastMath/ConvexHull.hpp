@@ -0,0 +1,841 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Frustum.hpp"
+#include "GJK.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A convex polyhedron.
+/// </summary>
+/// <remarks>
+/// The faces are convex polygons: adjacent triangles that are coplanar (within the build
+/// tolerance) are merged, so a box has 6 faces. The triangles of the faces are also stored
+/// for rendering and mesh export.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct ConvexHull
+{
+    /// <summary>
+    /// The ConvexHull value type.
+    /// </summary>
+    using value_type = T;
+
+    // The vertices of the hull.
+    std::vector<Vector<T, 3>> vertices;
+    // The vertex indices of the triangles (3 per triangle, counter-clockwise when seen from outside).
+    std::vector<uint32_t> indices;
+    // The vertex indices of the faces (counter-clockwise when seen from outside).
+    std::vector<uint32_t> faceIndices;
+    // The offset of the first vertex index of each face in faceIndices, followed by the total count.
+    std::vector<uint32_t> faceOffsets;
+    // The (normalized) plane of each face. The normals point out of the hull, which is the opposite of
+    // the Frustum planes: a point is inside if its distance to every plane is at most 0.
+    std::vector<Vector<T, 4>> planes;
+    // The vertices in structure-of-arrays layout for fast support mapping.
+    std::vector<T> x, y, z;
+
+    /// <summary>
+    /// Check if the hull is empty.
+    /// </summary>
+    /// <returns>`true` if the hull has no faces.</returns>
+    bool empty() const noexcept
+    {
+        return planes.empty();
+    }
+
+    /// <summary>
+    /// Get a structure-of-arrays view over the vertices of the hull.
+    /// </summary>
+    /// <returns>The vertices of the hull.</returns>
+    HullSoA<T> getVertices() const noexcept
+    {
+        return { x, y, z };
+    }
+};
+
+using ConvexHullf = ConvexHull<float>;
+using ConvexHulld = ConvexHull<double>;
+
+/// <summary>
+/// A reusable 3D quickhull builder.
+/// </summary>
+/// <remarks>
+/// The half-edges, faces and outside sets are stored in arrays that are owned by the builder
+/// and reused between builds, so cooking many hulls with the same builder does not allocate
+/// once the arrays have grown to the size of the largest input.
+/// Points that are closer than a tolerance (derived from the extent of the input) to a face
+/// are considered to be on the hull, which prevents nearly coplanar points from creating
+/// slivers.
+/// </remarks>
+/// <seealso href="https://dl.acm.org/doi/10.1145/235815.235821"/>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+class QuickHull
+{
+public:
+    /// <summary>
+    /// The QuickHull value type.
+    /// </summary>
+    using value_type = T;
+
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// <summary>
+    /// Build the convex hull of a point cloud.
+    /// </summary>
+    /// <remarks>
+    /// Each step adds the point that is farthest in front of any face of the current hull (the
+    /// faces with outside points are kept in a max-heap ordered by that distance).
+    /// If `maxVertices` is less than the number of vertices on the hull, the build stops when the
+    /// limit is reached, so the result is a simplified hull that keeps the most significant points
+    /// and is contained in the exact hull.
+    /// If the points are degenerate (fewer than 4 points or all points coplanar), the hull is empty.
+    /// </remarks>
+    /// <param name="points">The input points.</param>
+    /// <param name="hull">The output hull.</param>
+    /// <param name="maxVertices">The maximum number of vertices in the hull (at least 4).</param>
+    /// <returns>`true` if the hull was built, `false` if the input is degenerate.</returns>
+    bool build( std::span<const Vector<T, 3>> points, ConvexHull<T>& hull, uint32_t maxVertices = INVALID_INDEX );
+
+private:
+    struct HalfEdge
+    {
+        uint32_t vertex;  // The origin of the edge.
+        uint32_t twin;
+        uint32_t next;
+        uint32_t face;
+    };
+
+    struct Face
+    {
+        Vector<T, 4> plane;
+        uint32_t     edge;
+        uint32_t     outsideHead;
+        uint32_t     outsideCount;
+        uint32_t     farthest;
+        T            farthestDistance;
+        bool         alive;
+        bool         visible;
+        bool         coplanar;  // The face may be coplanar with one of its neighbors.
+    };
+
+    // An entry in the work heap. Entries are not removed when their face is deleted or
+    // reused, so an entry is stale if it no longer matches the face.
+    struct Candidate
+    {
+        T        distance;
+        uint32_t face;
+
+        bool operator<( const Candidate& other ) const noexcept
+        {
+            return distance < other.distance;
+        }
+    };
+
+    struct Frame
+    {
+        uint32_t face;
+        uint32_t start;
+        uint32_t edge;
+        bool     begun;
+    };
+
+    Vector<T, 3> point( uint32_t i ) const noexcept
+    {
+        return { px[i], py[i], pz[i] };
+    }
+
+    uint32_t allocEdge();
+    uint32_t allocFace();
+    void     computePlane( uint32_t f ) noexcept;
+    uint32_t addVertex( uint32_t p, std::span<const Vector<T, 3>> points, ConvexHull<T>& hull );
+    void     extractFace( uint32_t seed, std::span<const Vector<T, 3>> points, ConvexHull<T>& hull );
+    void     assignOutside( std::span<const uint32_t> faceList );
+    void     pushWork( uint32_t f );
+    void     addPoint( uint32_t face );
+    void     planeDistances( const Vector<T, 4>& plane ) noexcept;
+
+    std::vector<T>         px, py, pz;
+    std::vector<HalfEdge>  edges;
+    std::vector<Face>      faces;
+    std::vector<uint32_t>  freeEdges;
+    std::vector<uint32_t>  freeFaces;
+    std::vector<uint32_t>  nextOutside;
+    std::vector<uint32_t>  orphans;
+    std::vector<T>         distances;
+    std::vector<uint32_t>  horizon;
+    std::vector<uint32_t>  visibleFaces;
+    std::vector<uint32_t>  newFaces;
+    std::vector<Candidate> work;
+    std::vector<Frame>     stack;
+    std::vector<uint32_t>  remap;
+    std::vector<uint32_t>  faceGroup;
+    std::vector<uint32_t>  members;
+
+    T eps = T( 0 );
+};
+
+template<typename T>
+uint32_t QuickHull<T>::allocEdge()
+{
+    if ( !freeEdges.empty() )
+    {
+        const uint32_t e = freeEdges.back();
+        freeEdges.pop_back();
+        return e;
+    }
+
+    edges.emplace_back();
+    return static_cast<uint32_t>( edges.size() - 1 );
+}
+
+template<typename T>
+uint32_t QuickHull<T>::allocFace()
+{
+    uint32_t f;
+    if ( !freeFaces.empty() )
+    {
+        f = freeFaces.back();
+        freeFaces.pop_back();
+    }
+    else
+    {
+        faces.emplace_back();
+        f = static_cast<uint32_t>( faces.size() - 1 );
+    }
+
+    faces[f] = { {}, INVALID_INDEX, INVALID_INDEX, 0, INVALID_INDEX, T( 0 ), true, false, false };
+    return f;
+}
+
+template<typename T>
+void QuickHull<T>::computePlane( uint32_t f ) noexcept
+{
+    const uint32_t e0 = faces[f].edge;
+    const uint32_t e1 = edges[e0].next;
+    const uint32_t e2 = edges[e1].next;
+
+    const Vector<T, 3> a = point( edges[e0].vertex );
+    const Vector<T, 3> b = point( edges[e1].vertex );
+    const Vector<T, 3> c = point( edges[e2].vertex );
+
+    Vector<T, 3> n = cross( b - a, c - a );
+    const T      l = length( n );
+    if ( l > T( 0 ) )
+        n /= l;
+
+    faces[f].plane = { n.x, n.y, n.z, -dot( n, ( a + b + c ) / T( 3 ) ) };
+}
+
+// Compute the signed distance from the plane to each of the orphaned points.
+template<typename T>
+void QuickHull<T>::planeDistances( const Vector<T, 4>& plane ) noexcept
+{
+    const std::size_t count = orphans.size();
+    distances.resize( count );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 nx = _mm256_set1_ps( plane.x );
+        const __m256 ny = _mm256_set1_ps( plane.y );
+        const __m256 nz = _mm256_set1_ps( plane.z );
+        const __m256 nw = _mm256_set1_ps( plane.w );
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            const __m256i idx = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( orphans.data() + i ) );
+
+            __m256 d = _mm256_add_ps( nw, _mm256_mul_ps( nx, _mm256_i32gather_ps( px.data(), idx, 4 ) ) );
+            d        = _mm256_add_ps( d, _mm256_mul_ps( ny, _mm256_i32gather_ps( py.data(), idx, 4 ) ) );
+            d        = _mm256_add_ps( d, _mm256_mul_ps( nz, _mm256_i32gather_ps( pz.data(), idx, 4 ) ) );
+
+            _mm256_storeu_ps( distances.data() + i, d );
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const uint32_t p = orphans[i];
+        distances[i]     = plane.x * px[p] + plane.y * py[p] + plane.z * pz[p] + plane.w;
+    }
+}
+
+// Move each orphaned point to the outside set of the first face that it is in front of.
+// Points that are not in front of any face are inside the hull and are discarded.
+template<typename T>
+void QuickHull<T>::assignOutside( std::span<const uint32_t> faceList )
+{
+    for ( uint32_t f: faceList )
+    {
+        if ( orphans.empty() )
+            break;
+
+        planeDistances( faces[f].plane );
+
+        Face&       face = faces[f];
+        std::size_t n    = 0;
+        for ( std::size_t i = 0; i < orphans.size(); ++i )
+        {
+            const uint32_t p = orphans[i];
+            const T        d = distances[i];
+
+            if ( d > eps )
+            {
+                nextOutside[p]   = face.outsideHead;
+                face.outsideHead = p;
+                ++face.outsideCount;
+
+                if ( d > face.farthestDistance )
+                {
+                    face.farthestDistance = d;
+                    face.farthest         = p;
+                }
+            }
+            else
+            {
+                orphans[n++] = p;
+            }
+        }
+
+        orphans.resize( n );
+    }
+
+    orphans.clear();
+}
+
+template<typename T>
+void QuickHull<T>::pushWork( uint32_t f )
+{
+    if ( faces[f].outsideCount > 0 )
+    {
+        work.push_back( { faces[f].farthestDistance, f } );
+        std::push_heap( work.begin(), work.end() );
+    }
+}
+
+template<typename T>
+void QuickHull<T>::addPoint( uint32_t face )
+{
+    const uint32_t     eye = faces[face].farthest;
+    const Vector<T, 3> p   = point( eye );
+
+    // Find the faces that are visible from the eye point and the horizon (the boundary of the
+    // visible region) using a depth-first search over the half-edges. Starting each face at the
+    // edge after the one it was entered through produces the horizon edges in order.
+    visibleFaces.clear();
+    horizon.clear();
+    stack.clear();
+
+    const uint32_t first = faces[face].edge;
+
+    faces[face].visible = true;
+    visibleFaces.push_back( face );
+    stack.push_back( { face, first, first, false } );
+
+    while ( !stack.empty() )
+    {
+        Frame& frame = stack.back();
+        if ( frame.begun && frame.edge == frame.start )
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        frame.begun      = true;
+        const uint32_t e = frame.edge;
+        frame.edge       = edges[e].next;
+
+        const uint32_t twin     = edges[e].twin;
+        const uint32_t neighbor = edges[twin].face;
+        if ( faces[neighbor].visible )
+            continue;
+
+        if ( distance( faces[neighbor].plane, p ) > eps )
+        {
+            faces[neighbor].visible = true;
+            visibleFaces.push_back( neighbor );
+
+            const uint32_t start = edges[twin].next;
+            stack.push_back( { neighbor, start, start, false } );
+        }
+        else
+        {
+            horizon.push_back( e );
+        }
+    }
+
+    // Collect the outside points of the visible faces.
+    orphans.clear();
+    for ( uint32_t f: visibleFaces )
+    {
+        for ( uint32_t i = faces[f].outsideHead; i != INVALID_INDEX; i = nextOutside[i] )
+        {
+            if ( i != eye )
+                orphans.push_back( i );
+        }
+    }
+
+    // Build a cone of new faces from the horizon to the eye point.
+    newFaces.clear();
+    for ( uint32_t h: horizon )
+    {
+        const uint32_t f  = allocFace();
+        const uint32_t e0 = allocEdge();
+        const uint32_t e1 = allocEdge();
+        const uint32_t e2 = allocEdge();
+
+        const uint32_t outer = edges[h].twin;
+
+        edges[e0]         = { edges[h].vertex, outer, e1, f };
+        edges[e1]         = { edges[edges[h].next].vertex, INVALID_INDEX, e2, f };
+        edges[e2]         = { eye, INVALID_INDEX, e0, f };
+        edges[outer].twin = e0;
+
+        faces[f].edge = e0;
+        computePlane( f );
+        newFaces.push_back( f );
+
+        // Flag the faces that are candidates for merging while their data is still in the cache
+        // (each pair of adjacent faces is tested when the newer one is created).
+        Face& outerFace = faces[edges[outer].face];
+        if ( std::abs( distance( outerFace.plane, p ) ) <= eps )
+            faces[f].coplanar = outerFace.coplanar = true;
+    }
+
+    for ( std::size_t i = 0; i < newFaces.size(); ++i )
+    {
+        Face&          face  = faces[newFaces[i]];
+        Face&          other = faces[newFaces[( i + 1 ) % newFaces.size()]];
+        const uint32_t e1    = edges[face.edge].next;
+        const uint32_t e2    = edges[edges[other.edge].next].next;
+
+        edges[e1].twin = e2;
+        edges[e2].twin = e1;
+
+        if ( std::abs( distance( face.plane, point( edges[edges[other.edge].next].vertex ) ) ) <= eps )
+            face.coplanar = other.coplanar = true;
+    }
+
+    // Release the visible faces.
+    for ( uint32_t f: visibleFaces )
+    {
+        uint32_t e = faces[f].edge;
+        do
+        {
+            freeEdges.push_back( e );
+            e = edges[e].next;
+        } while ( e != faces[f].edge );
+
+        faces[f].alive   = false;
+        faces[f].visible = false;
+        freeFaces.push_back( f );
+    }
+
+    assignOutside( newFaces );
+
+    for ( uint32_t f: newFaces )
+        pushWork( f );
+}
+
+template<typename T>
+bool QuickHull<T>::build( std::span<const Vector<T, 3>> points, ConvexHull<T>& hull, uint32_t maxVertices )
+{
+    hull.vertices.clear();
+    hull.indices.clear();
+    hull.faceIndices.clear();
+    hull.faceOffsets.clear();
+    hull.planes.clear();
+    hull.x.clear();
+    hull.y.clear();
+    hull.z.clear();
+
+    edges.clear();
+    faces.clear();
+    freeEdges.clear();
+    freeFaces.clear();
+    work.clear();
+
+    const auto count = static_cast<uint32_t>( points.size() );
+    if ( count < 4 )
+        return false;
+
+    px.resize( count );
+    py.resize( count );
+    pz.resize( count );
+    nextOutside.assign( count, INVALID_INDEX );
+
+    // Find the extreme points along each axis.
+    uint32_t extremes[6] = {};
+    T        maxAbs[3]   = {};
+    for ( uint32_t i = 0; i < count; ++i )
+    {
+        px[i] = points[i].x;
+        py[i] = points[i].y;
+        pz[i] = points[i].z;
+
+        for ( int a = 0; a < 3; ++a )
+        {
+            if ( points[i][a] < points[extremes[a * 2]][a] )
+                extremes[a * 2] = i;
+            if ( points[i][a] > points[extremes[a * 2 + 1]][a] )
+                extremes[a * 2 + 1] = i;
+
+            maxAbs[a] = std::max( maxAbs[a], std::abs( points[i][a] ) );
+        }
+    }
+
+    eps = T( 3 ) * EPSILON<T> * ( maxAbs[0] + maxAbs[1] + maxAbs[2] );
+
+    // Initial simplex: the most distant pair of extreme points...
+    uint32_t v[4] = {};
+    T        best = T( 0 );
+    for ( int i = 0; i < 6; ++i )
+    {
+        for ( int j = i + 1; j < 6; ++j )
+        {
+            const T d = lengthSqr( point( extremes[i] ) - point( extremes[j] ) );
+            if ( d > best )
+            {
+                best = d;
+                v[0] = extremes[i];
+                v[1] = extremes[j];
+            }
+        }
+    }
+
+    if ( best <= eps * eps )
+        return false;
+
+    // ...the point furthest from the line through them...
+    const Vector<T, 3> dir = point( v[1] ) - point( v[0] );
+    best                   = T( 0 );
+    for ( uint32_t i = 0; i < count; ++i )
+    {
+        const T d = lengthSqr( cross( point( i ) - point( v[0] ), dir ) );
+        if ( d > best )
+        {
+            best = d;
+            v[2] = i;
+        }
+    }
+
+    if ( best <= eps * eps * lengthSqr( dir ) )
+        return false;
+
+    // ...and the point furthest from the plane through all three.
+    const Vector<T, 3> n     = normalize( cross( point( v[1] ) - point( v[0] ), point( v[2] ) - point( v[0] ) ) );
+    const Vector<T, 4> plane = { n.x, n.y, n.z, -dot( n, point( v[0] ) ) };
+
+    orphans.resize( count );
+    for ( uint32_t i = 0; i < count; ++i )
+        orphans[i] = i;
+
+    planeDistances( plane );
+
+    best = T( 0 );
+    for ( uint32_t i = 0; i < count; ++i )
+    {
+        if ( std::abs( distances[i] ) > std::abs( best ) )
+        {
+            best = distances[i];
+            v[3] = i;
+        }
+    }
+
+    if ( std::abs( best ) <= eps )
+        return false;
+
+    // Orient the base so that the apex is behind it.
+    if ( best > T( 0 ) )
+        std::swap( v[1], v[2] );
+
+    static constexpr uint32_t tetrahedron[4][3] = {
+        { 0, 1, 2 },
+        { 0, 3, 1 },
+        { 1, 3, 2 },
+        { 2, 3, 0 },
+    };
+
+    uint32_t initial[4];
+    for ( int i = 0; i < 4; ++i )
+    {
+        const uint32_t f = allocFace();
+        uint32_t       e[3];
+        for ( int k = 0; k < 3; ++k )
+            e[k] = allocEdge();
+
+        for ( int k = 0; k < 3; ++k )
+            edges[e[k]] = { v[tetrahedron[i][k]], INVALID_INDEX, e[( k + 1 ) % 3], f };
+
+        faces[f].edge = e[0];
+        computePlane( f );
+        initial[i] = f;
+    }
+
+    // Link the twins: the twin of a -> b is b -> a.
+    for ( uint32_t e = 0; e < 12; ++e )
+    {
+        for ( uint32_t o = 0; o < 12; ++o )
+        {
+            if ( edges[e].vertex == edges[edges[o].next].vertex && edges[o].vertex == edges[edges[e].next].vertex )
+                edges[e].twin = o;
+        }
+    }
+
+    // Partition the remaining points into the outside sets of the initial faces.
+    std::size_t k = 0;
+    for ( uint32_t i = 0; i < count; ++i )
+    {
+        if ( i != v[0] && i != v[1] && i != v[2] && i != v[3] )
+            orphans[k++] = i;
+    }
+    orphans.resize( k );
+
+    assignOutside( initial );
+
+    for ( uint32_t f: initial )
+        pushWork( f );
+
+    uint32_t vertexCount = 4;
+    while ( !work.empty() && vertexCount < maxVertices )
+    {
+        std::pop_heap( work.begin(), work.end() );
+        const Candidate c = work.back();
+        work.pop_back();
+
+        // Skip the entries of deleted faces (a reused face has its own entry).
+        const Face& face = faces[c.face];
+        if ( !face.alive || face.outsideCount == 0 || face.farthestDistance != c.distance )
+            continue;
+
+        addPoint( c.face );
+        ++vertexCount;
+    }
+
+    // Extract the faces and compact the vertices.
+    remap.assign( count, INVALID_INDEX );
+    faceGroup.assign( faces.size(), INVALID_INDEX );
+    hull.faceOffsets.push_back( 0 );
+
+    for ( uint32_t f = 0; f < faces.size(); ++f )
+    {
+        if ( faces[f].alive && faceGroup[f] == INVALID_INDEX )
+            extractFace( f, points, hull );
+    }
+
+    return true;
+}
+
+template<typename T>
+uint32_t QuickHull<T>::addVertex( uint32_t p, std::span<const Vector<T, 3>> points, ConvexHull<T>& hull )
+{
+    if ( remap[p] == INVALID_INDEX )
+    {
+        remap[p] = static_cast<uint32_t>( hull.vertices.size() );
+        hull.vertices.push_back( points[p] );
+        hull.x.push_back( px[p] );
+        hull.y.push_back( py[p] );
+        hull.z.push_back( pz[p] );
+    }
+
+    return remap[p];
+}
+
+// Output the polygon made of the triangles that are coplanar with the seed triangle and
+// connected to it, and its triangles.
+template<typename T>
+void QuickHull<T>::extractFace( uint32_t seed, std::span<const Vector<T, 3>> points, ConvexHull<T>& hull )
+{
+    const auto         group = static_cast<uint32_t>( hull.planes.size() );
+    const Vector<T, 4> plane = faces[seed].plane;
+
+    members.clear();
+    members.push_back( seed );
+    faceGroup[seed] = group;
+
+    // The vertices of a neighbor that are shared with a member of the group are already known to
+    // be on the plane, so only the opposite vertex is tested.
+    const auto coplanar = [&]( uint32_t twin ) {
+        return std::abs( distance( plane, point( edges[edges[edges[twin].next].next].vertex ) ) ) <= eps;
+    };
+
+    // The neighbors of faces that were not flagged while building the hull are not visited, so
+    // most faces are output as triangles without touching any other face.
+    std::size_t boundary = 0;
+    for ( std::size_t i = 0; faces[seed].coplanar && i < members.size(); ++i )
+    {
+        uint32_t e = faces[members[i]].edge;
+        for ( int k = 0; k < 3; ++k )
+        {
+            const uint32_t neighbor = edges[edges[e].twin].face;
+            if ( faces[neighbor].coplanar && faceGroup[neighbor] == INVALID_INDEX && coplanar( edges[e].twin ) )
+            {
+                faceGroup[neighbor] = group;
+                members.push_back( neighbor );
+            }
+            else if ( faceGroup[neighbor] != group )
+            {
+                ++boundary;
+            }
+
+            e = edges[e].next;
+        }
+    }
+
+    // Walk the boundary of the group: the boundary edge that follows an edge starts at its end
+    // vertex, and is found by turning around that vertex through the faces of the group.
+    const auto first = static_cast<uint32_t>( hull.faceIndices.size() );
+    const auto next  = [&]( uint32_t e ) {
+        uint32_t n = edges[e].next;
+        while ( faceGroup[edges[edges[n].twin].face] == group )
+            n = edges[edges[n].twin].next;
+
+        return n;
+    };
+
+    uint32_t start = INVALID_INDEX;
+    for ( std::size_t i = 0; members.size() > 1 && i < members.size() && start == INVALID_INDEX; ++i )
+    {
+        uint32_t e = faces[members[i]].edge;
+        for ( int k = 0; k < 3; ++k, e = edges[e].next )
+        {
+            if ( faceGroup[edges[edges[e].twin].face] != group )
+            {
+                start = e;
+                break;
+            }
+        }
+    }
+
+    // A group with several boundary loops (a hole or two regions touching at a vertex) is not
+    // a convex polygon, and is split back into triangles.
+    bool        closed = false;
+    std::size_t length = 0;
+    if ( members.size() > 1 && start != INVALID_INDEX )
+    {
+        for ( uint32_t e = start; length <= boundary; e = next( e ) )
+        {
+            if ( length > 0 && e == start )
+            {
+                closed = true;
+                break;
+            }
+
+            hull.faceIndices.push_back( addVertex( edges[e].vertex, points, hull ) );
+            ++length;
+        }
+    }
+
+    if ( !closed || length != boundary )
+    {
+        // Each triangle is a face of its own.
+        hull.faceIndices.resize( first );
+        for ( std::size_t i = 1; i < members.size(); ++i )
+            faceGroup[members[i]] = INVALID_INDEX;
+
+        members.resize( 1 );
+        start = faces[seed].edge;
+        for ( uint32_t e = start; hull.faceIndices.size() < first + 3; e = edges[e].next )
+            hull.faceIndices.push_back( addVertex( edges[e].vertex, points, hull ) );
+    }
+
+    for ( uint32_t f: members )
+    {
+        uint32_t e = faces[f].edge;
+        for ( int k = 0; k < 3; ++k )
+        {
+            hull.indices.push_back( addVertex( edges[e].vertex, points, hull ) );
+            e = edges[e].next;
+        }
+    }
+
+    // The plane of a merged face is fitted to all of its vertices (Newell's method).
+    Vector<T, 4> facePlane = faces[seed].plane;
+    if ( members.size() > 1 )
+    {
+        const auto   size = static_cast<uint32_t>( hull.faceIndices.size() );
+        Vector<T, 3> n { T( 0 ) }, c { T( 0 ) };
+        for ( uint32_t i = first; i < size; ++i )
+        {
+            const Vector<T, 3>& a = hull.vertices[hull.faceIndices[i]];
+            const Vector<T, 3>& b = hull.vertices[hull.faceIndices[i + 1 < size ? i + 1 : first]];
+
+            n += cross( a, b );
+            c += a;
+        }
+
+        n         = normalize( n );
+        c         = c / static_cast<T>( size - first );
+        facePlane = { n.x, n.y, n.z, -dot( n, c ) };
+    }
+
+    hull.planes.push_back( facePlane );
+    hull.faceOffsets.push_back( static_cast<uint32_t>( hull.faceIndices.size() ) );
+}
+
+/// <summary>
+/// Compute the convex hull of a point cloud using the quickhull algorithm.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="points">The input points.</param>
+/// <param name="maxVertices">The maximum number of vertices in the hull.</param>
+/// <returns>The convex hull of the points, or an empty hull if the points are degenerate.</returns>
+/// <seealso cref="QuickHull::build"/>
+template<typename T>
+ConvexHull<T> convexHull( std::span<const Vector<T, 3>> points, uint32_t maxVertices = QuickHull<T>::INVALID_INDEX )
+{
+    QuickHull<T>  builder;
+    ConvexHull<T> hull;
+    builder.build( points, hull, maxVertices );
+
+    return hull;
+}
+
+/// <summary>
+/// Check to see if a point is inside a convex hull.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="hull">The convex hull.</param>
+/// <param name="p">The point.</param>
+/// <param name="epsilon">The distance a point may be in front of a face and still be considered inside.</param>
+/// <returns>`true` if the point is inside the hull, `false` otherwise.</returns>
+template<typename T>
+constexpr bool contains( const ConvexHull<T>& hull, const Vector<T, 3>& p, T epsilon = T( 0 ) ) noexcept
+{
+    for ( const auto& plane: hull.planes )
+    {
+        if ( distance( plane, p ) > epsilon )
+            return false;
+    }
+
+    return !hull.empty();
+}
+
+/// <summary>
+/// Support mapping of a convex hull (see GJK.hpp).
+/// </summary>
+template<typename T>
+Vector<T, 3> support( const ConvexHull<T>& hull, const Vector<T, 3>& d ) noexcept
+{
+    return support( hull.getVertices(), d );
+}
+
+}  // namespace FastMath
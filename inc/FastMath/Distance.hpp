@@ -0,0 +1,774 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Common.hpp"
+#include "OBB.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A structure-of-arrays view over a set of points. This is the layout expected by
+/// the 8-wide batch distance functions.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct PointSoA
+{
+    std::span<const T> x, y, z;
+
+    /// <summary>
+    /// Get the number of points in the view.
+    /// </summary>
+    /// <returns>The number of points.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return x.size();
+    }
+};
+
+/// <summary>
+/// A structure-of-arrays view over a set of triangles. This is the layout expected by
+/// the 8-wide batch distance functions.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size. Triangle `i` has the vertices
+/// `( ax[i], ay[i], az[i] )`, `( bx[i], by[i], bz[i] )` and `( cx[i], cy[i], cz[i] )`.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct TriangleSoA
+{
+    std::span<const T> ax, ay, az;
+    std::span<const T> bx, by, bz;
+    std::span<const T> cx, cy, cz;
+
+    /// <summary>
+    /// Get the number of triangles in the view.
+    /// </summary>
+    /// <returns>The number of triangles.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return ax.size();
+    }
+};
+
+/// <summary>
+/// Compute the point on an AABB that is closest to a point.
+/// </summary>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="a">The AABB.</param>
+/// <returns>The point on (or inside) the AABB that is closest to `p`.</returns>
+template<typename T>
+constexpr Vector<T, 3> closestPoint( const Vector<T, 3>& p, const AABB<T>& a ) noexcept
+{
+    return {
+        std::clamp( p.x, a.min.x, a.max.x ),
+        std::clamp( p.y, a.min.y, a.max.y ),
+        std::clamp( p.z, a.min.z, a.max.z )
+    };
+}
+
+/// <summary>
+/// Compute the squared distance between a point and an AABB.
+/// </summary>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="a">The AABB.</param>
+/// <returns>The squared distance from `p` to the closest point on `a`, or 0 if `p` is inside `a`.</returns>
+template<typename T>
+constexpr T distanceSqr( const Vector<T, 3>& p, const AABB<T>& a ) noexcept
+{
+    T d = T( 0 );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const T v = std::max( { a.min[i] - p[i], T( 0 ), p[i] - a.max[i] } );
+        d += v * v;
+    }
+
+    return d;
+}
+
+/// <summary>
+/// Compute the point on a triangle that is closest to a point.
+/// </summary>
+/// <remarks>
+/// The Voronoi regions of the triangle's vertices and edges are tested before the face region
+/// so that only the barycentric coordinates of the closest feature are computed.
+/// </remarks>
+/// <seealso href="https://realtimecollisiondetection.net/"/>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="a">The first vertex of the triangle.</param>
+/// <param name="b">The second vertex of the triangle.</param>
+/// <param name="c">The third vertex of the triangle.</param>
+/// <returns>The point on the triangle that is closest to `p`.</returns>
+template<typename T>
+constexpr Vector<T, 3> closestPoint( const Vector<T, 3>& p, const Vector<T, 3>& a, const Vector<T, 3>& b, const Vector<T, 3>& c ) noexcept
+{
+    const Vector<T, 3> ab = b - a;
+    const Vector<T, 3> ac = c - a;
+    const Vector<T, 3> ap = p - a;
+
+    // Vertex region A.
+    const T d1 = dot( ab, ap );
+    const T d2 = dot( ac, ap );
+    if ( d1 <= T( 0 ) && d2 <= T( 0 ) )
+        return a;
+
+    // Vertex region B.
+    const Vector<T, 3> bp = p - b;
+    const T            d3 = dot( ab, bp );
+    const T            d4 = dot( ac, bp );
+    if ( d3 >= T( 0 ) && d4 <= d3 )
+        return b;
+
+    // Edge region AB.
+    const T vc = d1 * d4 - d3 * d2;
+    if ( vc <= T( 0 ) && d1 >= T( 0 ) && d3 <= T( 0 ) )
+        return a + ab * ( d1 / ( d1 - d3 ) );
+
+    // Vertex region C.
+    const Vector<T, 3> cp = p - c;
+    const T            d5 = dot( ab, cp );
+    const T            d6 = dot( ac, cp );
+    if ( d6 >= T( 0 ) && d5 <= d6 )
+        return c;
+
+    // Edge region AC.
+    const T vb = d5 * d2 - d1 * d6;
+    if ( vb <= T( 0 ) && d2 >= T( 0 ) && d6 <= T( 0 ) )
+        return a + ac * ( d2 / ( d2 - d6 ) );
+
+    // Edge region BC.
+    const T va = d3 * d6 - d5 * d4;
+    if ( va <= T( 0 ) && ( d4 - d3 ) >= T( 0 ) && ( d5 - d6 ) >= T( 0 ) )
+        return b + ( c - b ) * ( ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) ) );
+
+    // Face region.
+    const T denom = T( 1 ) / ( va + vb + vc );
+    return a + ab * ( vb * denom ) + ac * ( vc * denom );
+}
+
+/// <summary>
+/// Compute the squared distance between a point and a triangle.
+/// </summary>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="a">The first vertex of the triangle.</param>
+/// <param name="b">The second vertex of the triangle.</param>
+/// <param name="c">The third vertex of the triangle.</param>
+/// <returns>The squared distance from `p` to the closest point on the triangle.</returns>
+template<typename T>
+constexpr T distanceSqr( const Vector<T, 3>& p, const Vector<T, 3>& a, const Vector<T, 3>& b, const Vector<T, 3>& c ) noexcept
+{
+    return lengthSqr( closestPoint( p, a, b, c ) - p );
+}
+
+/// <summary>
+/// Compute the point on a line segment that is closest to a point.
+/// </summary>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="a">The start of the segment.</param>
+/// <param name="b">The end of the segment.</param>
+/// <returns>The point on the segment that is closest to `p`. If the segment is degenerate, `a` is returned.</returns>
+template<typename T>
+constexpr Vector<T, 3> closestPoint( const Vector<T, 3>& p, const Vector<T, 3>& a, const Vector<T, 3>& b ) noexcept
+{
+    const Vector<T, 3> ab = b - a;
+    const T            l  = dot( ab, ab );
+    const T            t  = l > T( 0 ) ? std::clamp( dot( p - a, ab ) / l, T( 0 ), T( 1 ) ) : T( 0 );
+
+    return a + ab * t;
+}
+
+/// <summary>
+/// Compute the squared distance between a point and a line segment.
+/// </summary>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="a">The start of the segment.</param>
+/// <param name="b">The end of the segment.</param>
+/// <returns>The squared distance from `p` to the closest point on the segment.</returns>
+template<typename T>
+constexpr T distanceSqr( const Vector<T, 3>& p, const Vector<T, 3>& a, const Vector<T, 3>& b ) noexcept
+{
+    return lengthSqr( closestPoint( p, a, b ) - p );
+}
+
+/// <summary>
+/// Compute the point on an OBB that is closest to a point.
+/// </summary>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="o">The OBB.</param>
+/// <returns>The point on (or inside) the OBB that is closest to `p`.</returns>
+template<typename T>
+constexpr Vector<T, 3> closestPoint( const Vector<T, 3>& p, const OBB<T>& o ) noexcept
+{
+    const Vector<T, 3> d = p - o.center;
+
+    Vector<T, 3> q = o.center;
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const Vector<T, 3> u = axis( o, i );
+        q += u * std::clamp( dot( d, u ), -o.halfExtents[i], o.halfExtents[i] );
+    }
+
+    return q;
+}
+
+/// <summary>
+/// Compute the squared distance between a point and an OBB.
+/// </summary>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="o">The OBB.</param>
+/// <returns>The squared distance from `p` to the closest point on `o`, or 0 if `p` is inside `o`.</returns>
+template<typename T>
+constexpr T distanceSqr( const Vector<T, 3>& p, const OBB<T>& o ) noexcept
+{
+    const Vector<T, 3> d = p - o.center;
+
+    T dist = T( 0 );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const T s = dot( d, axis( o, i ) );
+        const T v = std::max( { -o.halfExtents[i] - s, T( 0 ), s - o.halfExtents[i] } );
+        dist += v * v;
+    }
+
+    return dist;
+}
+
+/// <summary>
+/// Compute the closest points between two line segments.
+/// </summary>
+/// <remarks>
+/// Parallel (and degenerate) segments have infinitely many pairs of closest points, in which
+/// case one of the pairs is returned.
+/// </remarks>
+/// <seealso href="https://realtimecollisiondetection.net/"/>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p1">The start of the first segment.</param>
+/// <param name="q1">The end of the first segment.</param>
+/// <param name="p2">The start of the second segment.</param>
+/// <param name="q2">The end of the second segment.</param>
+/// <param name="c1">Receives the closest point on the first segment.</param>
+/// <param name="c2">Receives the closest point on the second segment.</param>
+/// <returns>The squared distance between the segments.</returns>
+template<typename T>
+constexpr T closestPoints( const Vector<T, 3>& p1, const Vector<T, 3>& q1, const Vector<T, 3>& p2, const Vector<T, 3>& q2, Vector<T, 3>& c1, Vector<T, 3>& c2 ) noexcept
+{
+    const Vector<T, 3> d1 = q1 - p1;
+    const Vector<T, 3> d2 = q2 - p2;
+    const Vector<T, 3> r  = p1 - p2;
+
+    const T a = dot( d1, d1 );
+    const T e = dot( d2, d2 );
+    const T f = dot( d2, r );
+
+    T s = T( 0 );
+    T t = T( 0 );
+
+    if ( a <= EPSILON<T> && e <= EPSILON<T> )
+    {
+        // Both segments are points.
+    }
+    else if ( a <= EPSILON<T> )
+    {
+        // The first segment is a point.
+        t = std::clamp( f / e, T( 0 ), T( 1 ) );
+    }
+    else
+    {
+        const T c = dot( d1, r );
+        if ( e <= EPSILON<T> )
+        {
+            // The second segment is a point.
+            s = std::clamp( -c / a, T( 0 ), T( 1 ) );
+        }
+        else
+        {
+            const T b     = dot( d1, d2 );
+            const T denom = a * e - b * b;
+
+            // For (nearly) parallel segments, any s works: start from the first end point.
+            if ( denom > EPSILON<T> * a * e )
+                s = std::clamp( ( b * f - c * e ) / denom, T( 0 ), T( 1 ) );
+
+            t = ( b * s + f ) / e;
+
+            // If t is outside the second segment, clamp it and recompute s.
+            if ( t < T( 0 ) )
+            {
+                t = T( 0 );
+                s = std::clamp( -c / a, T( 0 ), T( 1 ) );
+            }
+            else if ( t > T( 1 ) )
+            {
+                t = T( 1 );
+                s = std::clamp( ( b - c ) / a, T( 0 ), T( 1 ) );
+            }
+        }
+    }
+
+    c1 = p1 + d1 * s;
+    c2 = p2 + d2 * t;
+
+    return lengthSqr( c1 - c2 );
+}
+
+namespace detail
+{
+// Apply f( p ) -> closest point to points [begin, points.size()) and write the results.
+template<typename T, typename F>
+void closestPoints( const PointSoA<T>& points, std::size_t begin, std::span<T> distancesSqr, std::span<Vector<T, 3>> closest, F&& f ) noexcept
+{
+    for ( std::size_t i = begin; i < points.size(); ++i )
+    {
+        const Vector<T, 3> p { points.x[i], points.y[i], points.z[i] };
+        const Vector<T, 3> q = f( p );
+
+        distancesSqr[i] = lengthSqr( q - p );
+        if ( !closest.empty() )
+            closest[i] = q;
+    }
+}
+
+#if defined( LS_AVX2 )
+inline __m256 dot8( const __m256 a[3], const __m256 b[3] ) noexcept
+{
+    return _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( a[0], b[0] ), _mm256_mul_ps( a[1], b[1] ) ), _mm256_mul_ps( a[2], b[2] ) );
+}
+
+// Store 8 closest points (and their squared distances to p) at index i.
+inline void storeClosest8( std::size_t i, const __m256 p[3], const __m256 q[3], std::span<float> distancesSqr, std::span<Vector<float, 3>> closest ) noexcept
+{
+    const __m256 d[3] = { _mm256_sub_ps( q[0], p[0] ), _mm256_sub_ps( q[1], p[1] ), _mm256_sub_ps( q[2], p[2] ) };
+    _mm256_storeu_ps( distancesSqr.data() + i, dot8( d, d ) );
+
+    if ( !closest.empty() )
+    {
+        alignas( 32 ) float x[Simd::WIDTH], y[Simd::WIDTH], z[Simd::WIDTH];
+        _mm256_store_ps( x, q[0] );
+        _mm256_store_ps( y, q[1] );
+        _mm256_store_ps( z, q[2] );
+
+        for ( std::size_t k = 0; k < Simd::WIDTH; ++k )
+            closest[i + k] = { x[k], y[k], z[k] };
+    }
+}
+
+// Apply f( p, q ) to 8 points at a time. Returns the number of points that were processed.
+template<typename F>
+std::size_t closestPoints8( const PointSoA<float>& points, std::span<float> distancesSqr, std::span<Vector<float, 3>> closest, F&& f ) noexcept
+{
+    const std::size_t count = points.size();
+
+    std::size_t i = 0;
+    for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+    {
+        const __m256 p[3] = { _mm256_loadu_ps( points.x.data() + i ), _mm256_loadu_ps( points.y.data() + i ), _mm256_loadu_ps( points.z.data() + i ) };
+
+        __m256 q[3];
+        f( p, q );
+        storeClosest8( i, p, q, distancesSqr, closest );
+    }
+
+    return i;
+}
+
+// The closest points on 8 triangles to 8 points.
+// The Voronoi regions are evaluated for all lanes and the barycentric coordinates
+// of the closest feature are selected with blends instead of branches.
+inline void closestPointTriangle8( const __m256 p[3], const __m256 a[3], const __m256 b[3], const __m256 c[3], __m256 q[3] ) noexcept
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = _mm256_set1_ps( 1.0f );
+
+    auto sub = []( const __m256 u[3], const __m256 v[3], __m256 r[3] ) {
+        for ( std::size_t k = 0; k < 3; ++k )
+            r[k] = _mm256_sub_ps( u[k], v[k] );
+    };
+    auto le = []( __m256 x, __m256 y ) { return _mm256_cmp_ps( x, y, _CMP_LE_OQ ); };
+    auto ge = []( __m256 x, __m256 y ) { return _mm256_cmp_ps( x, y, _CMP_GE_OQ ); };
+
+    __m256 ab[3], ac[3], ap[3], bp[3], cp[3];
+    sub( b, a, ab );
+    sub( c, a, ac );
+    sub( p, a, ap );
+    sub( p, b, bp );
+    sub( p, c, cp );
+
+    const __m256 d1 = dot8( ab, ap );
+    const __m256 d2 = dot8( ac, ap );
+    const __m256 d3 = dot8( ab, bp );
+    const __m256 d4 = dot8( ac, bp );
+    const __m256 d5 = dot8( ab, cp );
+    const __m256 d6 = dot8( ac, cp );
+
+    const __m256 va = _mm256_sub_ps( _mm256_mul_ps( d3, d6 ), _mm256_mul_ps( d5, d4 ) );
+    const __m256 vb = _mm256_sub_ps( _mm256_mul_ps( d5, d2 ), _mm256_mul_ps( d1, d6 ) );
+    const __m256 vc = _mm256_sub_ps( _mm256_mul_ps( d1, d4 ), _mm256_mul_ps( d3, d2 ) );
+
+    // The closest point is a + ab * v + ac * w. Start with the face region and
+    // overwrite it with the regions that are tested first in the scalar version.
+    const __m256 denom = _mm256_div_ps( one, _mm256_add_ps( _mm256_add_ps( va, vb ), vc ) );
+
+    __m256 v = _mm256_mul_ps( vb, denom );
+    __m256 w = _mm256_mul_ps( vc, denom );
+
+    // Edge region BC.
+    const __m256 d43  = _mm256_sub_ps( d4, d3 );
+    const __m256 d56  = _mm256_sub_ps( d5, d6 );
+    const __m256 inBC = _mm256_and_ps( le( va, zero ), _mm256_and_ps( ge( d43, zero ), ge( d56, zero ) ) );
+    const __m256 wBC  = _mm256_div_ps( d43, _mm256_add_ps( d43, d56 ) );
+    v                 = _mm256_blendv_ps( v, _mm256_sub_ps( one, wBC ), inBC );
+    w                 = _mm256_blendv_ps( w, wBC, inBC );
+
+    // Edge region AC.
+    const __m256 inAC = _mm256_and_ps( le( vb, zero ), _mm256_and_ps( ge( d2, zero ), le( d6, zero ) ) );
+    v                 = _mm256_blendv_ps( v, zero, inAC );
+    w                 = _mm256_blendv_ps( w, _mm256_div_ps( d2, _mm256_sub_ps( d2, d6 ) ), inAC );
+
+    // Vertex region C.
+    const __m256 inC = _mm256_and_ps( ge( d6, zero ), le( d5, d6 ) );
+    v                = _mm256_blendv_ps( v, zero, inC );
+    w                = _mm256_blendv_ps( w, one, inC );
+
+    // Edge region AB.
+    const __m256 inAB = _mm256_and_ps( le( vc, zero ), _mm256_and_ps( ge( d1, zero ), le( d3, zero ) ) );
+    v                 = _mm256_blendv_ps( v, _mm256_div_ps( d1, _mm256_sub_ps( d1, d3 ) ), inAB );
+    w                 = _mm256_blendv_ps( w, zero, inAB );
+
+    // Vertex region B.
+    const __m256 inB = _mm256_and_ps( ge( d3, zero ), le( d4, d3 ) );
+    v                = _mm256_blendv_ps( v, one, inB );
+    w                = _mm256_blendv_ps( w, zero, inB );
+
+    // Vertex region A.
+    const __m256 inA = _mm256_and_ps( le( d1, zero ), le( d2, zero ) );
+    v                = _mm256_blendv_ps( v, zero, inA );
+    w                = _mm256_blendv_ps( w, zero, inA );
+
+    for ( std::size_t k = 0; k < 3; ++k )
+        q[k] = _mm256_add_ps( a[k], _mm256_add_ps( _mm256_mul_ps( ab[k], v ), _mm256_mul_ps( ac[k], w ) ) );
+}
+#endif
+}  // namespace detail
+
+/// <summary>
+/// Compute the squared distances (and optionally the closest points) from a set of points to an AABB.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 points are processed per iteration when AVX2 is enabled.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="points">The points (in SoA layout).</param>
+/// <param name="a">The AABB.</param>
+/// <param name="distancesSqr">Receives the squared distance of each point. Must have room for `points.size()` values.</param>
+/// <param name="closest">If not empty, receives the closest point on the AABB to each point.</param>
+template<typename T>
+void distanceSqr( const PointSoA<T>& points, const AABB<T>& a, std::span<std::type_identity_t<T>> distancesSqr, std::span<Vector<std::type_identity_t<T>, 3>> closest = {} ) noexcept
+{
+    assert( distancesSqr.size() >= points.size() );
+    assert( closest.empty() || closest.size() >= points.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 mn[3] = { _mm256_set1_ps( a.min.x ), _mm256_set1_ps( a.min.y ), _mm256_set1_ps( a.min.z ) };
+        const __m256 mx[3] = { _mm256_set1_ps( a.max.x ), _mm256_set1_ps( a.max.y ), _mm256_set1_ps( a.max.z ) };
+
+        i = detail::closestPoints8( points, distancesSqr, closest, [&]( const __m256 p[3], __m256 q[3] ) {
+            for ( std::size_t k = 0; k < 3; ++k )
+                q[k] = _mm256_min_ps( _mm256_max_ps( p[k], mn[k] ), mx[k] );
+        } );
+    }
+#endif
+
+    detail::closestPoints( points, i, distancesSqr, closest, [&]( const Vector<T, 3>& p ) { return closestPoint( p, a ); } );
+}
+
+/// <summary>
+/// Compute the squared distances (and optionally the closest points) from a set of points to an OBB.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 points are processed per iteration when AVX2 is enabled.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="points">The points (in SoA layout).</param>
+/// <param name="o">The OBB.</param>
+/// <param name="distancesSqr">Receives the squared distance of each point. Must have room for `points.size()` values.</param>
+/// <param name="closest">If not empty, receives the closest point on the OBB to each point.</param>
+template<typename T>
+void distanceSqr( const PointSoA<T>& points, const OBB<T>& o, std::span<std::type_identity_t<T>> distancesSqr, std::span<Vector<std::type_identity_t<T>, 3>> closest = {} ) noexcept
+{
+    assert( distancesSqr.size() >= points.size() );
+    assert( closest.empty() || closest.size() >= points.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 c[3] = { _mm256_set1_ps( o.center.x ), _mm256_set1_ps( o.center.y ), _mm256_set1_ps( o.center.z ) };
+
+        __m256 u[3][3], e[3];
+        for ( std::size_t k = 0; k < 3; ++k )
+        {
+            for ( std::size_t r = 0; r < 3; ++r )
+                u[k][r] = _mm256_set1_ps( o.rotation[r][k] );
+
+            e[k] = _mm256_set1_ps( o.halfExtents[k] );
+        }
+
+        i = detail::closestPoints8( points, distancesSqr, closest, [&]( const __m256 p[3], __m256 q[3] ) {
+            const __m256 d[3] = { _mm256_sub_ps( p[0], c[0] ), _mm256_sub_ps( p[1], c[1] ), _mm256_sub_ps( p[2], c[2] ) };
+
+            q[0] = c[0];
+            q[1] = c[1];
+            q[2] = c[2];
+            for ( std::size_t k = 0; k < 3; ++k )
+            {
+                const __m256 s = _mm256_min_ps( _mm256_max_ps( detail::dot8( d, u[k] ), _mm256_sub_ps( _mm256_setzero_ps(), e[k] ) ), e[k] );
+                for ( std::size_t r = 0; r < 3; ++r )
+                    q[r] = _mm256_add_ps( q[r], _mm256_mul_ps( u[k][r], s ) );
+            }
+        } );
+    }
+#endif
+
+    detail::closestPoints( points, i, distancesSqr, closest, [&]( const Vector<T, 3>& p ) { return closestPoint( p, o ); } );
+}
+
+/// <summary>
+/// Compute the squared distances (and optionally the closest points) from a set of points to a line segment.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 points are processed per iteration when AVX2 is enabled.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="points">The points (in SoA layout).</param>
+/// <param name="a">The start of the segment.</param>
+/// <param name="b">The end of the segment.</param>
+/// <param name="distancesSqr">Receives the squared distance of each point. Must have room for `points.size()` values.</param>
+/// <param name="closest">If not empty, receives the closest point on the segment to each point.</param>
+template<typename T>
+void distanceSqr( const PointSoA<T>& points, const Vector<T, 3>& a, const Vector<T, 3>& b, std::span<std::type_identity_t<T>> distancesSqr, std::span<Vector<std::type_identity_t<T>, 3>> closest = {} ) noexcept
+{
+    assert( distancesSqr.size() >= points.size() );
+    assert( closest.empty() || closest.size() >= points.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const Vector<T, 3> ab = b - a;
+        const T            l  = dot( ab, ab );
+
+        const __m256 va[3]  = { _mm256_set1_ps( a.x ), _mm256_set1_ps( a.y ), _mm256_set1_ps( a.z ) };
+        const __m256 vab[3] = { _mm256_set1_ps( ab.x ), _mm256_set1_ps( ab.y ), _mm256_set1_ps( ab.z ) };
+        const __m256 invL   = _mm256_set1_ps( l > T( 0 ) ? T( 1 ) / l : T( 0 ) );
+
+        i = detail::closestPoints8( points, distancesSqr, closest, [&]( const __m256 p[3], __m256 q[3] ) {
+            const __m256 ap[3] = { _mm256_sub_ps( p[0], va[0] ), _mm256_sub_ps( p[1], va[1] ), _mm256_sub_ps( p[2], va[2] ) };
+            const __m256 t     = _mm256_min_ps( _mm256_max_ps( _mm256_mul_ps( detail::dot8( ap, vab ), invL ), _mm256_setzero_ps() ), _mm256_set1_ps( 1.0f ) );
+
+            for ( std::size_t k = 0; k < 3; ++k )
+                q[k] = _mm256_add_ps( va[k], _mm256_mul_ps( vab[k], t ) );
+        } );
+    }
+#endif
+
+    detail::closestPoints( points, i, distancesSqr, closest, [&]( const Vector<T, 3>& p ) { return closestPoint( p, a, b ); } );
+}
+
+/// <summary>
+/// Compute the squared distances (and optionally the closest points) from a set of points to a triangle.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 points are processed per iteration when AVX2 is enabled.
+/// The Voronoi regions of the triangle are evaluated for all 8 points without branches.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="points">The points (in SoA layout).</param>
+/// <param name="a">The first vertex of the triangle.</param>
+/// <param name="b">The second vertex of the triangle.</param>
+/// <param name="c">The third vertex of the triangle.</param>
+/// <param name="distancesSqr">Receives the squared distance of each point. Must have room for `points.size()` values.</param>
+/// <param name="closest">If not empty, receives the closest point on the triangle to each point.</param>
+template<typename T>
+void distanceSqr( const PointSoA<T>& points, const Vector<T, 3>& a, const Vector<T, 3>& b, const Vector<T, 3>& c, std::span<std::type_identity_t<T>> distancesSqr,
+                  std::span<Vector<std::type_identity_t<T>, 3>> closest = {} ) noexcept
+{
+    assert( distancesSqr.size() >= points.size() );
+    assert( closest.empty() || closest.size() >= points.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 va[3] = { _mm256_set1_ps( a.x ), _mm256_set1_ps( a.y ), _mm256_set1_ps( a.z ) };
+        const __m256 vb[3] = { _mm256_set1_ps( b.x ), _mm256_set1_ps( b.y ), _mm256_set1_ps( b.z ) };
+        const __m256 vc[3] = { _mm256_set1_ps( c.x ), _mm256_set1_ps( c.y ), _mm256_set1_ps( c.z ) };
+
+        i = detail::closestPoints8( points, distancesSqr, closest, [&]( const __m256 p[3], __m256 q[3] ) {
+            detail::closestPointTriangle8( p, va, vb, vc, q );
+        } );
+    }
+#endif
+
+    detail::closestPoints( points, i, distancesSqr, closest, [&]( const Vector<T, 3>& p ) { return closestPoint( p, a, b, c ); } );
+}
+
+/// <summary>
+/// Compute the squared distances from a point to a set of triangles.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 triangles are processed per iteration when AVX2 is enabled.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point.</param>
+/// <param name="triangles">The triangles (in SoA layout).</param>
+/// <param name="distancesSqr">Receives the squared distance to each triangle. Must have room for `triangles.size()` values.</param>
+template<typename T>
+void distanceSqr( const Vector<T, 3>& p, const TriangleSoA<T>& triangles, std::span<std::type_identity_t<T>> distancesSqr ) noexcept
+{
+    const std::size_t count = triangles.size();
+
+    assert( distancesSqr.size() >= count );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 vp[3] = { _mm256_set1_ps( p.x ), _mm256_set1_ps( p.y ), _mm256_set1_ps( p.z ) };
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            const __m256 a[3] = { _mm256_loadu_ps( triangles.ax.data() + i ), _mm256_loadu_ps( triangles.ay.data() + i ), _mm256_loadu_ps( triangles.az.data() + i ) };
+            const __m256 b[3] = { _mm256_loadu_ps( triangles.bx.data() + i ), _mm256_loadu_ps( triangles.by.data() + i ), _mm256_loadu_ps( triangles.bz.data() + i ) };
+            const __m256 c[3] = { _mm256_loadu_ps( triangles.cx.data() + i ), _mm256_loadu_ps( triangles.cy.data() + i ), _mm256_loadu_ps( triangles.cz.data() + i ) };
+
+            __m256 q[3];
+            detail::closestPointTriangle8( vp, a, b, c, q );
+            detail::storeClosest8( i, vp, q, distancesSqr, {} );
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const Vector<T, 3> a { triangles.ax[i], triangles.ay[i], triangles.az[i] };
+        const Vector<T, 3> b { triangles.bx[i], triangles.by[i], triangles.bz[i] };
+        const Vector<T, 3> c { triangles.cx[i], triangles.cy[i], triangles.cz[i] };
+
+        distancesSqr[i] = distanceSqr( p, a, b, c );
+    }
+}
+
+/// <summary>
+/// Find the point on a set of triangles that is closest to a point.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 triangles are processed per iteration when AVX2 is enabled.
+/// If several triangles are equally close, the one with the lowest index is returned.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="triangles">The triangles (in SoA layout).</param>
+/// <param name="p">The query point.</param>
+/// <param name="closest">Receives the closest point on the triangles.</param>
+/// <param name="maxDistance">The maximum distance to search.</param>
+/// <returns>The index of the closest triangle, or `uint32_t( -1 )` if no triangle is within `maxDistance`.</returns>
+template<typename T>
+uint32_t closestPoint( const TriangleSoA<T>& triangles, const Vector<T, 3>& p, Vector<T, 3>& closest, T maxDistance = std::numeric_limits<T>::max() ) noexcept
+{
+    const std::size_t count = triangles.size();
+
+    T        best     = maxDistance < std::sqrt( std::numeric_limits<T>::max() ) ? maxDistance * maxDistance : std::numeric_limits<T>::max();
+    uint32_t bestPrim = std::numeric_limits<uint32_t>::max();
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 vp[3] = { _mm256_set1_ps( p.x ), _mm256_set1_ps( p.y ), _mm256_set1_ps( p.z ) };
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            const __m256 a[3] = { _mm256_loadu_ps( triangles.ax.data() + i ), _mm256_loadu_ps( triangles.ay.data() + i ), _mm256_loadu_ps( triangles.az.data() + i ) };
+            const __m256 b[3] = { _mm256_loadu_ps( triangles.bx.data() + i ), _mm256_loadu_ps( triangles.by.data() + i ), _mm256_loadu_ps( triangles.bz.data() + i ) };
+            const __m256 c[3] = { _mm256_loadu_ps( triangles.cx.data() + i ), _mm256_loadu_ps( triangles.cy.data() + i ), _mm256_loadu_ps( triangles.cz.data() + i ) };
+
+            __m256 q[3];
+            detail::closestPointTriangle8( vp, a, b, c, q );
+
+            const __m256 d[3] = { _mm256_sub_ps( q[0], vp[0] ), _mm256_sub_ps( q[1], vp[1] ), _mm256_sub_ps( q[2], vp[2] ) };
+            const __m256 dist = detail::dot8( d, d );
+
+            // Only reduce the lanes when at least one of them is closer.
+            if ( _mm256_movemask_ps( _mm256_cmp_ps( dist, _mm256_set1_ps( best ), _CMP_LT_OQ ) ) == 0 )
+                continue;
+
+            alignas( 32 ) float dd[Simd::WIDTH], x[Simd::WIDTH], y[Simd::WIDTH], z[Simd::WIDTH];
+            _mm256_store_ps( dd, dist );
+            _mm256_store_ps( x, q[0] );
+            _mm256_store_ps( y, q[1] );
+            _mm256_store_ps( z, q[2] );
+
+            for ( std::size_t k = 0; k < Simd::WIDTH; ++k )
+            {
+                if ( dd[k] < best )
+                {
+                    best     = dd[k];
+                    bestPrim = static_cast<uint32_t>( i + k );
+                    closest  = { x[k], y[k], z[k] };
+                }
+            }
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const Vector<T, 3> a { triangles.ax[i], triangles.ay[i], triangles.az[i] };
+        const Vector<T, 3> b { triangles.bx[i], triangles.by[i], triangles.bz[i] };
+        const Vector<T, 3> c { triangles.cx[i], triangles.cy[i], triangles.cz[i] };
+        const Vector<T, 3> q = closestPoint( p, a, b, c );
+        const T            d = lengthSqr( q - p );
+
+        if ( d < best )
+        {
+            best     = d;
+            bestPrim = static_cast<uint32_t>( i );
+            closest  = q;
+        }
+    }
+
+    return bestPrim;
+}
+
+}  // namespace FastMath
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Vector.hpp"
+
+namespace FastMath
+{
+
+/// <summary>
+/// A unit dual quaternion that represents a rigid transformation (a rotation followed by a translation).
+/// </summary>
+/// <remarks>
+/// The real part is the rotation \f( \mathbf{r} \f) and the dual part is \f( \frac{1}{2} \mathbf{t} \mathbf{r} \f),
+/// where \f( \mathbf{t} \f) is the translation as a pure quaternion. Unlike matrices, dual quaternions can be
+/// blended without introducing scale or shear, which is used for dual quaternion skinning.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct DualQuaternion
+{
+    /// <summary>
+    /// The DualQuaternion value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// The identity transformation.
+    /// </summary>
+    static const DualQuaternion IDENTITY;
+
+    /// <summary>
+    /// Default construct the identity transformation.
+    /// </summary>
+    constexpr DualQuaternion() noexcept;
+
+    /// <summary>
+    /// Construct a dual quaternion from its real and dual parts.
+    /// </summary>
+    /// <param name="real">The real part.</param>
+    /// <param name="dual">The dual part.</param>
+    constexpr DualQuaternion( const Quaternion<T>& real, const Quaternion<T>& dual ) noexcept;
+
+    /// <summary>
+    /// Construct a rigid transformation from a rotation and a translation.
+    /// </summary>
+    /// <param name="rotation">The rotation (must be normalized).</param>
+    /// <param name="translation">The translation (applied after the rotation).</param>
+    constexpr DualQuaternion( const Quaternion<T>& rotation, const Vector<T, 3>& translation ) noexcept;
+
+    /// <summary>
+    /// Construct a rigid transformation from a 4x4 matrix.
+    /// </summary>
+    /// <remarks>
+    /// The upper 3x3 part of the matrix must be a rotation (without scale or shear).
+    /// </remarks>
+    /// <param name="m">The transformation matrix.</param>
+    constexpr explicit DualQuaternion( const Matrix<T, 4>& m ) noexcept;
+
+    /// <summary>
+    /// Convert the dual quaternion to a 4x4 transformation matrix.
+    /// </summary>
+    constexpr explicit operator Matrix<T, 4>() const noexcept;
+
+    /// <summary>
+    /// Get the translation of the transformation.
+    /// </summary>
+    /// <returns>The translation.</returns>
+    constexpr Vector<T, 3> getTranslation() const noexcept;
+
+    /// <summary>
+    /// Concatenate two transformations. The result applies `rhs` first, then this transformation.
+    /// </summary>
+    /// <param name="rhs">The transformation to apply first.</param>
+    /// <returns>The concatenated transformation.</returns>
+    constexpr DualQuaternion operator*( const DualQuaternion& rhs ) const noexcept;
+
+    Quaternion<T> real;
+    Quaternion<T> dual;
+};
+
+using DualQuaternionF = DualQuaternion<float>;
+using DualQuaternionD = DualQuaternion<double>;
+
+template<typename T>
+inline const DualQuaternion<T> DualQuaternion<T>::IDENTITY {};
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion() noexcept
+: real { Quaternion<T>::IDENTITY }
+, dual { T( 0 ), T( 0 ), T( 0 ), T( 0 ) }
+{}
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion( const Quaternion<T>& real, const Quaternion<T>& dual ) noexcept
+: real { real }
+, dual { dual }
+{}
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion( const Quaternion<T>& rotation, const Vector<T, 3>& translation ) noexcept
+: real { rotation }
+, dual { Quaternion<T> { T( 0 ), translation } * rotation * T( 0.5 ) }
+{}
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion( const Matrix<T, 4>& m ) noexcept
+: DualQuaternion( normalize( Quaternion<T> { m } ), Vector<T, 3> { m[0][3], m[1][3], m[2][3] } )
+{}
+
+template<typename T>
+constexpr DualQuaternion<T>::operator Matrix<T, 4>() const noexcept
+{
+    Matrix<T, 4>       m = toMat4( real );
+    const Vector<T, 3> t = getTranslation();
+
+    m[0][3] = t.x;
+    m[1][3] = t.y;
+    m[2][3] = t.z;
+
+    return m;
+}
+
+template<typename T>
+constexpr Vector<T, 3> DualQuaternion<T>::getTranslation() const noexcept
+{
+    // t = 2 d r*
+    const Vector<T, 3> r { real.x, real.y, real.z };
+    const Vector<T, 3> d { dual.x, dual.y, dual.z };
+
+    return ( d * real.w - r * dual.w + cross( r, d ) ) * T( 2 );
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::operator*( const DualQuaternion& rhs ) const noexcept
+{
+    return { real * rhs.real, real * rhs.dual + dual * rhs.real };
+}
+
+/// <summary>
+/// Normalize a dual quaternion, for example after blending several transformations.
+/// </summary>
+/// <remarks>
+/// Both parts are divided by the length of the real part and the dual part is made orthogonal to the real part.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="dq">The dual quaternion to normalize.</param>
+/// <returns>The normalized dual quaternion.</returns>
+template<typename T>
+constexpr DualQuaternion<T> normalize( const DualQuaternion<T>& dq ) noexcept
+{
+    const T             invLength = T( 1 ) / length( dq.real );
+    const Quaternion<T> real      = dq.real * invLength;
+    const Quaternion<T> dual      = dq.dual * invLength;
+
+    return { real, dual - real * dot( real, dual ) };
+}
+
+/// <summary>
+/// Transform a point by a (normalized) dual quaternion.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="dq">The transformation.</param>
+/// <param name="p">The point to transform.</param>
+/// <returns>The transformed point.</returns>
+template<typename T>
+constexpr Vector<T, 3> transformPoint( const DualQuaternion<T>& dq, const Vector<T, 3>& p ) noexcept
+{
+    return dq.real * p + dq.getTranslation();
+}
+
+/// <summary>
+/// Transform a direction (or a normal) by a (normalized) dual quaternion. Only the rotation is applied.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="dq">The transformation.</param>
+/// <param name="v">The direction to transform.</param>
+/// <returns>The transformed direction.</returns>
+template<typename T>
+constexpr Vector<T, 3> transformDirection( const DualQuaternion<T>& dq, const Vector<T, 3>& v ) noexcept
+{
+    return dq.real * v;
+}
+
+}  // namespace FastMath
@@ -0,0 +1,447 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Matrix.hpp"
+#include "Simd.hpp"
+#include "Sphere.hpp"
+#include "Vector.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A view frustum described by 6 planes.
+/// </summary>
+/// <remarks>
+/// Each plane is stored as a 4-component vector \f((n_x, n_y, n_z, d)\f) where the
+/// normal \f(\mathbf{n}\f) is normalized and points towards the inside of the frustum.
+/// A point \f(\mathbf{p}\f) is on the inside of a plane if
+/// \f(\mathbf{n} \cdot \mathbf{p} + d \ge 0\f).
+/// The planes are in the same space as the input to the matrix the frustum was
+/// extracted from. Extracting the frustum from a view-projection matrix results in
+/// world-space planes.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Frustum
+{
+    /// <summary>
+    /// The Frustum value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// The index of each plane of the frustum.
+    /// </summary>
+    enum Side
+    {
+        Left = 0,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        NumPlanes
+    };
+
+    /// <summary>
+    /// Default construct a frustum. All planes are initialized to 0 which means
+    /// that everything is considered to be inside the frustum.
+    /// </summary>
+    constexpr Frustum() noexcept = default;
+
+    /// <summary>
+    /// Extract the frustum planes from a projection (or view-projection) matrix
+    /// using the default configuration based on the value of `LS_DEPTH_RANGE`.
+    /// </summary>
+    /// <seealso cref="extractFrustum"/>
+    /// <param name="m">The projection or view-projection matrix.</param>
+    explicit constexpr Frustum( const Matrix<T, 4, 4>& m ) noexcept;
+
+    Vector<T, 4> planes[NumPlanes];
+};
+
+using FrustumF = Frustum<float>;
+using FrustumD = Frustum<double>;
+
+/// <summary>
+/// Normalize a plane so that the normal has unit length.
+/// </summary>
+/// <typeparam name="T">The plane type.</typeparam>
+/// <param name="p">The plane \f((n_x, n_y, n_z, d)\f) to normalize.</param>
+/// <returns>The normalized plane.</returns>
+template<typename T>
+constexpr Vector<T, 4> normalizePlane( const Vector<T, 4>& p ) noexcept
+{
+    const T l = std::sqrt( p.x * p.x + p.y * p.y + p.z * p.z );
+
+    if ( l > T( 0 ) )
+        return p / l;
+
+    return p;
+}
+
+/// <summary>
+/// Compute the signed distance from a (normalized) plane to a point.
+/// </summary>
+/// <typeparam name="T">The plane type.</typeparam>
+/// <param name="plane">The normalized plane.</param>
+/// <param name="p">The point.</param>
+/// <returns>The signed distance from the plane to the point. Positive values are in front of the plane.</returns>
+template<typename T>
+constexpr T distance( const Vector<T, 4>& plane, const Vector<T, 3>& p ) noexcept
+{
+    return plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w;
+}
+
+/// <summary>
+/// Extract the frustum planes from a projection matrix that maps depth values to
+/// the range \f([0 \ldots 1]\f).
+/// </summary>
+/// <remarks>
+/// The planes are extracted directly from the rows of the matrix
+/// (Gribb &amp; Hartmann). Handedness is encoded in the matrix itself so the same
+/// function is used for both left-handed and right-handed matrices.
+/// </remarks>
+/// <seealso href="https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="m">The projection or view-projection matrix.</param>
+/// <returns>The frustum.</returns>
+template<typename T>
+constexpr Frustum<T> extractFrustum01( const Matrix<T, 4, 4>& m ) noexcept
+{
+    Frustum<T> f;
+
+    f.planes[Frustum<T>::Left]   = normalizePlane( m[3] + m[0] );
+    f.planes[Frustum<T>::Right]  = normalizePlane( m[3] - m[0] );
+    f.planes[Frustum<T>::Bottom] = normalizePlane( m[3] + m[1] );
+    f.planes[Frustum<T>::Top]    = normalizePlane( m[3] - m[1] );
+    f.planes[Frustum<T>::Near]   = normalizePlane( m[2] );
+    f.planes[Frustum<T>::Far]    = normalizePlane( m[3] - m[2] );
+
+    return f;
+}
+
+/// <summary>
+/// Extract the frustum planes from a projection matrix that maps depth values to
+/// the range \f([-1 \ldots 1]\f).
+/// </summary>
+/// <remarks>
+/// The planes are extracted directly from the rows of the matrix
+/// (Gribb &amp; Hartmann). Handedness is encoded in the matrix itself so the same
+/// function is used for both left-handed and right-handed matrices.
+/// </remarks>
+/// <seealso href="https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="m">The projection or view-projection matrix.</param>
+/// <returns>The frustum.</returns>
+template<typename T>
+constexpr Frustum<T> extractFrustum11( const Matrix<T, 4, 4>& m ) noexcept
+{
+    Frustum<T> f;
+
+    f.planes[Frustum<T>::Left]   = normalizePlane( m[3] + m[0] );
+    f.planes[Frustum<T>::Right]  = normalizePlane( m[3] - m[0] );
+    f.planes[Frustum<T>::Bottom] = normalizePlane( m[3] + m[1] );
+    f.planes[Frustum<T>::Top]    = normalizePlane( m[3] - m[1] );
+    f.planes[Frustum<T>::Near]   = normalizePlane( m[3] + m[2] );
+    f.planes[Frustum<T>::Far]    = normalizePlane( m[3] - m[2] );
+
+    return f;
+}
+
+/// <summary>
+/// Extract the frustum planes from a projection matrix using the default configuration
+/// based on the value of `LS_DEPTH_RANGE`.
+/// </summary>
+/// <remarks>
+/// `LS_HANDEDNESS` does not affect the extracted planes since the handedness is already
+/// encoded in the matrix.
+/// </remarks>
+/// <seealso cref="extractFrustum01"/>
+/// <seealso cref="extractFrustum11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="m">The projection or view-projection matrix.</param>
+/// <returns>The frustum.</returns>
+template<typename T>
+constexpr Frustum<T> extractFrustum( const Matrix<T, 4, 4>& m ) noexcept
+{
+#if LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return extractFrustum01( m );
+#elif LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return extractFrustum11( m );
+#endif
+}
+
+/// <summary>
+/// Extract the frustum planes from a projection (or view-projection) matrix using the depth range
+/// of a clip space policy.
+/// </summary>
+/// <remarks>
+/// With `DepthRange::OneToZero` (reverse-Z), the near plane is \f(z_{ndc} \le 1\f) and the far plane is
+/// \f(z_{ndc} \ge 0\f). If the far clipping plane is at infinity, the far plane is degenerate and
+/// does not reject any points.
+/// </remarks>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="m">The projection or view-projection matrix.</param>
+/// <returns>The frustum.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Frustum<T> extractFrustum( const Matrix<T, 4, 4>& m ) noexcept
+{
+    if constexpr ( P::depthRange == DepthRange::ZeroToOne )
+        return extractFrustum01( m );
+    else if constexpr ( P::depthRange == DepthRange::NegativeOneToOne )
+        return extractFrustum11( m );
+    else
+    {
+        Frustum<T> f = extractFrustum01( m );
+
+        f.planes[Frustum<T>::Near] = normalizePlane( m[3] - m[2] );
+        f.planes[Frustum<T>::Far]  = normalizePlane( m[2] );
+
+        return f;
+    }
+}
+
+template<typename T>
+constexpr Frustum<T>::Frustum( const Matrix<T, 4, 4>& m ) noexcept
+: Frustum( extractFrustum( m ) )
+{}
+
+/// <summary>
+/// Check to see if a point is inside the frustum.
+/// </summary>
+/// <typeparam name="T">The frustum type.</typeparam>
+/// <param name="f">The frustum.</param>
+/// <param name="p">The point to check.</param>
+/// <returns>`true` if the point is inside (or on the boundary of) the frustum, `false` otherwise.</returns>
+template<typename T>
+constexpr bool contains( const Frustum<T>& f, const Vector<T, 3>& p ) noexcept
+{
+    for ( const auto& plane: f.planes )
+    {
+        if ( distance( plane, p ) < T( 0 ) )
+            return false;
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Check to see if a sphere intersects the frustum.
+/// </summary>
+/// <remarks>
+/// This test is conservative: spheres that are outside of the frustum, but close
+/// to one of its corners, may be reported as intersecting.
+/// </remarks>
+/// <typeparam name="T">The frustum type.</typeparam>
+/// <param name="f">The frustum.</param>
+/// <param name="s">The sphere to check.</param>
+/// <returns>`true` if the sphere is (potentially) visible, `false` if it is definitely outside of the frustum.</returns>
+template<typename T>
+constexpr bool intersects( const Frustum<T>& f, const Sphere<T>& s ) noexcept
+{
+    for ( const auto& plane: f.planes )
+    {
+        if ( distance( plane, s.center ) < -s.radius )
+            return false;
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Check to see if an AABB intersects the frustum.
+/// </summary>
+/// <remarks>
+/// For each plane, only the corner of the box that is furthest along the plane
+/// normal (the "positive vertex") is tested. This test is conservative: boxes that
+/// are outside of the frustum, but close to one of its corners, may be reported as intersecting.
+/// </remarks>
+/// <typeparam name="T">The frustum type.</typeparam>
+/// <param name="f">The frustum.</param>
+/// <param name="a">The AABB to check.</param>
+/// <returns>`true` if the box is (potentially) visible, `false` if it is definitely outside of the frustum.</returns>
+template<typename T>
+constexpr bool intersects( const Frustum<T>& f, const AABB<T>& a ) noexcept
+{
+    for ( const auto& plane: f.planes )
+    {
+        const Vector<T, 3> p {
+            plane.x >= T( 0 ) ? a.max.x : a.min.x,
+            plane.y >= T( 0 ) ? a.max.y : a.min.y,
+            plane.z >= T( 0 ) ? a.max.z : a.min.z
+        };
+
+        if ( distance( plane, p ) < T( 0 ) )
+            return false;
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Cull a set of spheres against the frustum and output the indices of the
+/// (potentially) visible spheres.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 spheres are tested against all 6 planes per iteration
+/// when AVX2 is enabled.
+/// The indices are written in increasing order. `visible` must have room for at least
+/// `spheres.size()` indices.
+/// </remarks>
+/// <typeparam name="T">The frustum type.</typeparam>
+/// <param name="f">The frustum.</param>
+/// <param name="spheres">The spheres to cull (in SoA layout).</param>
+/// <param name="visible">Receives the indices of the visible spheres.</param>
+/// <returns>The number of visible spheres written to `visible`.</returns>
+template<typename T>
+std::size_t cullSpheres( const Frustum<T>& f, const SphereSoA<T>& spheres, std::span<uint32_t> visible ) noexcept
+{
+    const std::size_t count = spheres.size();
+
+    assert( spheres.y.size() >= count && spheres.z.size() >= count && spheres.radius.size() >= count );
+    assert( visible.size() >= count );
+
+    std::size_t i = 0;
+    std::size_t n = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        __m256 nx[6], ny[6], nz[6], d[6];
+        for ( std::size_t p = 0; p < 6; ++p )
+        {
+            nx[p] = _mm256_set1_ps( f.planes[p].x );
+            ny[p] = _mm256_set1_ps( f.planes[p].y );
+            nz[p] = _mm256_set1_ps( f.planes[p].z );
+            d[p]  = _mm256_set1_ps( f.planes[p].w );
+        }
+
+        const __m256 signBit = _mm256_set1_ps( -0.0f );
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            const __m256 x    = _mm256_loadu_ps( spheres.x.data() + i );
+            const __m256 y    = _mm256_loadu_ps( spheres.y.data() + i );
+            const __m256 z    = _mm256_loadu_ps( spheres.z.data() + i );
+            const __m256 negR = _mm256_xor_ps( _mm256_loadu_ps( spheres.radius.data() + i ), signBit );
+
+            __m256 outside = _mm256_setzero_ps();
+            for ( std::size_t p = 0; p < 6; ++p )
+            {
+                __m256 dist = _mm256_add_ps( _mm256_mul_ps( nx[p], x ), d[p] );
+                dist        = _mm256_add_ps( _mm256_mul_ps( ny[p], y ), dist );
+                dist        = _mm256_add_ps( _mm256_mul_ps( nz[p], z ), dist );
+                outside     = _mm256_or_ps( outside, _mm256_cmp_ps( dist, negR, _CMP_LT_OQ ) );
+            }
+
+            const uint32_t mask = ~static_cast<uint32_t>( _mm256_movemask_ps( outside ) ) & 0xffu;
+            n += Simd::compressIndices8( static_cast<uint32_t>( i ), mask, visible.data() + n );
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const Sphere<T> s { { spheres.x[i], spheres.y[i], spheres.z[i] }, spheres.radius[i] };
+        if ( intersects( f, s ) )
+            visible[n++] = static_cast<uint32_t>( i );
+    }
+
+    return n;
+}
+
+/// <summary>
+/// Cull a set of AABBs against the frustum and output the indices of the
+/// (potentially) visible boxes.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 boxes are tested against all 6 planes per iteration
+/// when AVX2 is enabled.
+/// The indices are written in increasing order. `visible` must have room for at least
+/// `boxes.size()` indices.
+/// </remarks>
+/// <typeparam name="T">The frustum type.</typeparam>
+/// <param name="f">The frustum.</param>
+/// <param name="boxes">The boxes to cull (in SoA layout).</param>
+/// <param name="visible">Receives the indices of the visible boxes.</param>
+/// <returns>The number of visible boxes written to `visible`.</returns>
+template<typename T>
+std::size_t cullAABBs( const Frustum<T>& f, const AABBSoA<T>& boxes, std::span<uint32_t> visible ) noexcept
+{
+    const std::size_t count = boxes.size();
+
+    assert( boxes.minY.size() >= count && boxes.minZ.size() >= count );
+    assert( boxes.maxX.size() >= count && boxes.maxY.size() >= count && boxes.maxZ.size() >= count );
+    assert( visible.size() >= count );
+
+    std::size_t i = 0;
+    std::size_t n = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        // The sign of each plane normal component selects the positive vertex of the box.
+        __m256 nx[6], ny[6], nz[6], d[6], sx[6], sy[6], sz[6];
+        for ( std::size_t p = 0; p < 6; ++p )
+        {
+            nx[p] = _mm256_set1_ps( f.planes[p].x );
+            ny[p] = _mm256_set1_ps( f.planes[p].y );
+            nz[p] = _mm256_set1_ps( f.planes[p].z );
+            d[p]  = _mm256_set1_ps( f.planes[p].w );
+            sx[p] = _mm256_cmp_ps( nx[p], _mm256_setzero_ps(), _CMP_GE_OQ );
+            sy[p] = _mm256_cmp_ps( ny[p], _mm256_setzero_ps(), _CMP_GE_OQ );
+            sz[p] = _mm256_cmp_ps( nz[p], _mm256_setzero_ps(), _CMP_GE_OQ );
+        }
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            const __m256 minX = _mm256_loadu_ps( boxes.minX.data() + i );
+            const __m256 minY = _mm256_loadu_ps( boxes.minY.data() + i );
+            const __m256 minZ = _mm256_loadu_ps( boxes.minZ.data() + i );
+            const __m256 maxX = _mm256_loadu_ps( boxes.maxX.data() + i );
+            const __m256 maxY = _mm256_loadu_ps( boxes.maxY.data() + i );
+            const __m256 maxZ = _mm256_loadu_ps( boxes.maxZ.data() + i );
+
+            __m256 outside = _mm256_setzero_ps();
+            for ( std::size_t p = 0; p < 6; ++p )
+            {
+                const __m256 x = _mm256_blendv_ps( minX, maxX, sx[p] );
+                const __m256 y = _mm256_blendv_ps( minY, maxY, sy[p] );
+                const __m256 z = _mm256_blendv_ps( minZ, maxZ, sz[p] );
+
+                __m256 dist = _mm256_add_ps( _mm256_mul_ps( nx[p], x ), d[p] );
+                dist        = _mm256_add_ps( _mm256_mul_ps( ny[p], y ), dist );
+                dist        = _mm256_add_ps( _mm256_mul_ps( nz[p], z ), dist );
+                outside     = _mm256_or_ps( outside, _mm256_cmp_ps( dist, _mm256_setzero_ps(), _CMP_LT_OQ ) );
+            }
+
+            const uint32_t mask = ~static_cast<uint32_t>( _mm256_movemask_ps( outside ) ) & 0xffu;
+            n += Simd::compressIndices8( static_cast<uint32_t>( i ), mask, visible.data() + n );
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const AABB<T> a {
+            { boxes.minX[i], boxes.minY[i], boxes.minZ[i] },
+            { boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i] }
+        };
+
+        if ( intersects( f, a ) )
+            visible[n++] = static_cast<uint32_t>( i );
+    }
+
+    return n;
+}
+
+}  // namespace FastMath
@@ -0,0 +1,912 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Common.hpp"
+#include "OBB.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Sphere.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A capsule defined by a line segment and a radius.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Capsule
+{
+    /// <summary>
+    /// The Capsule value type.
+    /// </summary>
+    using value_type = T;
+
+    Vector<T, 3> a;
+    Vector<T, 3> b;
+    T            radius = T( 0 );
+};
+
+/// <summary>
+/// A structure-of-arrays view over the vertices of a convex polyhedron.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size. Only the vertices are required for support
+/// mapping; the vertices do not need to be on the hull (interior points are ignored).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct HullSoA
+{
+    std::span<const T> x, y, z;
+
+    /// <summary>
+    /// Get the number of vertices in the view.
+    /// </summary>
+    /// <returns>The number of vertices.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return x.size();
+    }
+};
+
+/// <summary>
+/// A shape placed in the world with a rotation and a translation.
+/// </summary>
+/// <typeparam name="S">The shape type.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename S, typename T = float>
+struct Transformed
+{
+    const S&      shape;
+    Quaternion<T> rotation    = Quaternion<T>::IDENTITY;
+    Vector<T, 3>  translation = Vector<T, 3> { T( 0 ) };
+};
+
+/// <summary>
+/// Per-pair state that is carried from one frame to the next to warm-start GJK.
+/// </summary>
+/// <remarks>
+/// The cache stores the search directions that produced the vertices of the final simplex.
+/// On the next query, the simplex is rebuilt from those directions using the (moved) shapes,
+/// which usually puts GJK within one or two iterations of the solution for coherent motion.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct GJKCache
+{
+    Vector<T, 3> directions[4];
+    uint32_t     count = 0;
+};
+
+/// <summary>
+/// The result of a GJK distance query.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct GJKResult
+{
+    // The distance between the shapes (0 if they intersect).
+    T distance = T( 0 );
+    // The closest point on the first shape.
+    Vector<T, 3> pointA;
+    // The closest point on the second shape.
+    Vector<T, 3> pointB;
+    // `true` if the shapes intersect.
+    bool intersecting = false;
+    // The number of iterations that were required.
+    uint32_t iterations = 0;
+};
+
+/// <summary>
+/// The result of an EPA penetration query.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct PenetrationResult
+{
+    // The direction from the first shape to the second shape. Translating the second shape
+    // by `normal * depth` separates the shapes.
+    Vector<T, 3> normal;
+    // The penetration depth.
+    T depth = T( 0 );
+    // The deepest point of the first shape inside the second shape.
+    Vector<T, 3> pointA;
+    // The deepest point of the second shape inside the first shape.
+    Vector<T, 3> pointB;
+    // `true` if the shapes intersect.
+    bool intersecting = false;
+};
+
+/// <summary>
+/// Support mapping of a point.
+/// </summary>
+template<typename T>
+constexpr Vector<T, 3> support( const Vector<T, 3>& p, const Vector<T, 3>& ) noexcept
+{
+    return p;
+}
+
+/// <summary>
+/// Support mapping of a sphere: the point on the sphere that is furthest in direction `d`.
+/// </summary>
+template<typename T>
+constexpr Vector<T, 3> support( const Sphere<T>& s, const Vector<T, 3>& d ) noexcept
+{
+    const T l = length( d );
+    return l > T( 0 ) ? s.center + d * ( s.radius / l ) : s.center;
+}
+
+/// <summary>
+/// Support mapping of an AABB: the corner of the box that is furthest in direction `d`.
+/// </summary>
+template<typename T>
+constexpr Vector<T, 3> support( const AABB<T>& a, const Vector<T, 3>& d ) noexcept
+{
+    return {
+        d.x >= T( 0 ) ? a.max.x : a.min.x,
+        d.y >= T( 0 ) ? a.max.y : a.min.y,
+        d.z >= T( 0 ) ? a.max.z : a.min.z
+    };
+}
+
+/// <summary>
+/// Support mapping of an OBB: the corner of the box that is furthest in direction `d`.
+/// </summary>
+template<typename T>
+constexpr Vector<T, 3> support( const OBB<T>& o, const Vector<T, 3>& d ) noexcept
+{
+    const Vector<T, 3> l = transpose( o.rotation ) * d;
+    const Vector<T, 3> c {
+        l.x >= T( 0 ) ? o.halfExtents.x : -o.halfExtents.x,
+        l.y >= T( 0 ) ? o.halfExtents.y : -o.halfExtents.y,
+        l.z >= T( 0 ) ? o.halfExtents.z : -o.halfExtents.z
+    };
+
+    return o.center + o.rotation * c;
+}
+
+/// <summary>
+/// Support mapping of a capsule.
+/// </summary>
+template<typename T>
+constexpr Vector<T, 3> support( const Capsule<T>& c, const Vector<T, 3>& d ) noexcept
+{
+    const Vector<T, 3>& p = dot( c.b - c.a, d ) > T( 0 ) ? c.b : c.a;
+    const T             l = length( d );
+
+    return l > T( 0 ) ? p + d * ( c.radius / l ) : p;
+}
+
+/// <summary>
+/// Find the index of the vertex with the largest projection onto direction `d`.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 vertices are tested per iteration when AVX2 is enabled.
+/// If several vertices have the same projection, the one with the lowest index is returned.
+/// </remarks>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="hull">The vertices.</param>
+/// <param name="d">The direction.</param>
+/// <returns>The index of the support vertex, or 0 if the hull is empty.</returns>
+template<typename T>
+std::size_t supportIndex( const HullSoA<T>& hull, const Vector<T, 3>& d ) noexcept
+{
+    assert( hull.y.size() == hull.x.size() && hull.z.size() == hull.x.size() );
+
+    const std::size_t count = hull.size();
+
+    std::size_t i         = 0;
+    std::size_t bestIndex = 0;
+    T           best      = std::numeric_limits<T>::lowest();
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        if ( count >= Simd::WIDTH )
+        {
+            const __m256 dx = _mm256_set1_ps( d.x );
+            const __m256 dy = _mm256_set1_ps( d.y );
+            const __m256 dz = _mm256_set1_ps( d.z );
+
+            __m256  bestV   = _mm256_set1_ps( std::numeric_limits<float>::lowest() );
+            __m256i bestI   = _mm256_setzero_si256();
+            __m256i indices = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+            const __m256i step = _mm256_set1_epi32( static_cast<int>( Simd::WIDTH ) );
+
+            for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+            {
+                __m256 p = _mm256_mul_ps( _mm256_loadu_ps( hull.x.data() + i ), dx );
+                p        = _mm256_add_ps( p, _mm256_mul_ps( _mm256_loadu_ps( hull.y.data() + i ), dy ) );
+                p        = _mm256_add_ps( p, _mm256_mul_ps( _mm256_loadu_ps( hull.z.data() + i ), dz ) );
+
+                const __m256 greater = _mm256_cmp_ps( p, bestV, _CMP_GT_OQ );
+                bestV                = _mm256_blendv_ps( bestV, p, greater );
+                bestI                = _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( bestI ), _mm256_castsi256_ps( indices ), greater ) );
+                indices              = _mm256_add_epi32( indices, step );
+            }
+
+            alignas( 32 ) float    values[Simd::WIDTH];
+            alignas( 32 ) uint32_t lanes[Simd::WIDTH];
+            _mm256_store_ps( values, bestV );
+            _mm256_store_si256( reinterpret_cast<__m256i*>( lanes ), bestI );
+
+            for ( std::size_t k = 0; k < Simd::WIDTH; ++k )
+            {
+                if ( values[k] > best || ( values[k] == best && lanes[k] < bestIndex ) )
+                {
+                    best      = values[k];
+                    bestIndex = lanes[k];
+                }
+            }
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const T p = hull.x[i] * d.x + hull.y[i] * d.y + hull.z[i] * d.z;
+        if ( p > best )
+        {
+            best      = p;
+            bestIndex = i;
+        }
+    }
+
+    return bestIndex;
+}
+
+/// <summary>
+/// Support mapping of a convex polyhedron given by its vertices.
+/// </summary>
+template<typename T>
+Vector<T, 3> support( const HullSoA<T>& hull, const Vector<T, 3>& d ) noexcept
+{
+    assert( hull.size() > 0 );
+    assert( hull.y.size() == hull.x.size() && hull.z.size() == hull.x.size() );
+
+    const std::size_t i = supportIndex( hull, d );
+    return { hull.x[i], hull.y[i], hull.z[i] };
+}
+
+namespace detail
+{
+template<typename T, typename S>
+constexpr Vector<T, 3> supportOf( const S& shape, const Vector<T, 3>& d )
+{
+    if constexpr ( std::is_invocable_v<const S&, const Vector<T, 3>&> )
+        return shape( d );
+    else
+        return support( shape, d );
+}
+}  // namespace detail
+
+/// <summary>
+/// Support mapping of a transformed shape.
+/// </summary>
+template<typename S, typename T>
+constexpr Vector<T, 3> support( const Transformed<S, T>& s, const Vector<T, 3>& d )
+{
+    return s.translation + s.rotation * detail::supportOf<T>( s.shape, conjugate( s.rotation ) * d );
+}
+
+namespace detail
+{
+template<typename T>
+struct SimplexVertex
+{
+    Vector<T, 3> w;  // a - b
+    Vector<T, 3> a;
+    Vector<T, 3> b;
+    Vector<T, 3> d;  // The search direction that produced this vertex.
+};
+
+template<typename T>
+struct Simplex
+{
+    SimplexVertex<T> v[4];
+    T                bary[4] = {};
+    uint32_t         count   = 0;
+
+    void keep( std::initializer_list<uint32_t> indices, std::initializer_list<T> weights ) noexcept
+    {
+        SimplexVertex<T> tmp[4];
+        uint32_t         n = 0;
+        for ( uint32_t i: indices )
+            tmp[n++] = v[i];
+
+        n = 0;
+        for ( T w: weights )
+        {
+            v[n]    = tmp[n];
+            bary[n] = w;
+            ++n;
+        }
+        count = n;
+    }
+};
+
+template<typename T, typename SA, typename SB>
+SimplexVertex<T> supportVertex( const SA& a, const SB& b, const Vector<T, 3>& d )
+{
+    SimplexVertex<T> v;
+    v.a = supportOf<T>( a, d );
+    v.b = supportOf<T>( b, -d );
+    v.w = v.a - v.b;
+    v.d = d;
+
+    return v;
+}
+
+// Reduce a triangle simplex to the feature that is closest to the origin.
+template<typename T>
+void solveTriangle( Simplex<T>& s ) noexcept
+{
+    const Vector<T, 3>& a = s.v[0].w;
+    const Vector<T, 3>& b = s.v[1].w;
+    const Vector<T, 3>& c = s.v[2].w;
+
+    const Vector<T, 3> ab = b - a;
+    const Vector<T, 3> ac = c - a;
+
+    const T d1 = -dot( ab, a );
+    const T d2 = -dot( ac, a );
+    if ( d1 <= T( 0 ) && d2 <= T( 0 ) )
+        return s.keep( { 0 }, { T( 1 ) } );
+
+    const T d3 = -dot( ab, b );
+    const T d4 = -dot( ac, b );
+    if ( d3 >= T( 0 ) && d4 <= d3 )
+        return s.keep( { 1 }, { T( 1 ) } );
+
+    const T vc = d1 * d4 - d3 * d2;
+    if ( vc <= T( 0 ) && d1 >= T( 0 ) && d3 <= T( 0 ) )
+    {
+        const T t = d1 / ( d1 - d3 );
+        return s.keep( { 0, 1 }, { T( 1 ) - t, t } );
+    }
+
+    const T d5 = -dot( ab, c );
+    const T d6 = -dot( ac, c );
+    if ( d6 >= T( 0 ) && d5 <= d6 )
+        return s.keep( { 2 }, { T( 1 ) } );
+
+    const T vb = d5 * d2 - d1 * d6;
+    if ( vb <= T( 0 ) && d2 >= T( 0 ) && d6 <= T( 0 ) )
+    {
+        const T t = d2 / ( d2 - d6 );
+        return s.keep( { 0, 2 }, { T( 1 ) - t, t } );
+    }
+
+    const T va = d3 * d6 - d5 * d4;
+    if ( va <= T( 0 ) && ( d4 - d3 ) >= T( 0 ) && ( d5 - d6 ) >= T( 0 ) )
+    {
+        const T t = ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) );
+        return s.keep( { 1, 2 }, { T( 1 ) - t, t } );
+    }
+
+    const T denom = T( 1 ) / ( va + vb + vc );
+    const T v     = vb * denom;
+    const T w     = vc * denom;
+    s.keep( { 0, 1, 2 }, { T( 1 ) - v - w, v, w } );
+}
+
+// Reduce the simplex to the sub-simplex that contains the point closest to the origin.
+// Returns `false` if the origin is inside the tetrahedron.
+template<typename T>
+bool solve( Simplex<T>& s ) noexcept
+{
+    switch ( s.count )
+    {
+    case 1:
+        s.bary[0] = T( 1 );
+        return true;
+    case 2:
+    {
+        const Vector<T, 3> ab = s.v[1].w - s.v[0].w;
+        const T            l  = dot( ab, ab );
+        const T            t  = l > T( 0 ) ? -dot( s.v[0].w, ab ) / l : T( 0 );
+
+        if ( t <= T( 0 ) )
+            s.keep( { 0 }, { T( 1 ) } );
+        else if ( t >= T( 1 ) )
+            s.keep( { 1 }, { T( 1 ) } );
+        else
+            s.keep( { 0, 1 }, { T( 1 ) - t, t } );
+
+        return true;
+    }
+    case 3:
+        solveTriangle( s );
+        return true;
+    default:
+        break;
+    }
+
+    // Tetrahedron. Test each face to see if the origin is on the opposite side of the
+    // face from the remaining vertex.
+    static constexpr uint32_t faces[4][4] = {
+        { 0, 1, 2, 3 },
+        { 0, 2, 3, 1 },
+        { 0, 3, 1, 2 },
+        { 1, 3, 2, 0 },
+    };
+
+    const Vector<T, 3> ab     = s.v[1].w - s.v[0].w;
+    const Vector<T, 3> ac     = s.v[2].w - s.v[0].w;
+    const Vector<T, 3> ad     = s.v[3].w - s.v[0].w;
+    const T            volume = dot( ab, cross( ac, ad ) );
+    const T            scale  = std::max( { lengthSqr( ab ), lengthSqr( ac ), lengthSqr( ad ), std::numeric_limits<T>::min() } );
+    const bool         flat   = std::abs( volume ) <= T( 100 ) * EPSILON<T> * scale * std::sqrt( scale );
+
+    Simplex<T> best;
+    T          bestDist = std::numeric_limits<T>::max();
+    bool       outside  = false;
+
+    for ( const auto& f: faces )
+    {
+        const Vector<T, 3>& p0 = s.v[f[0]].w;
+        const Vector<T, 3>  n  = cross( s.v[f[1]].w - p0, s.v[f[2]].w - p0 );
+
+        const T signOrigin = -dot( p0, n );
+        const T signOther  = dot( s.v[f[3]].w - p0, n );
+
+        if ( !flat && signOrigin * signOther >= T( 0 ) )
+            continue;
+
+        outside = true;
+
+        Simplex<T> sub;
+        sub.v[0]  = s.v[f[0]];
+        sub.v[1]  = s.v[f[1]];
+        sub.v[2]  = s.v[f[2]];
+        sub.count = 3;
+        solveTriangle( sub );
+
+        Vector<T, 3> p { T( 0 ) };
+        for ( uint32_t i = 0; i < sub.count; ++i )
+            p += sub.v[i].w * sub.bary[i];
+
+        const T dist = lengthSqr( p );
+        if ( dist < bestDist )
+        {
+            bestDist = dist;
+            best     = sub;
+        }
+    }
+
+    if ( !outside )
+        return false;
+
+    s = best;
+    return true;
+}
+
+template<typename T>
+Vector<T, 3> closest( const Simplex<T>& s, Vector<T, 3>& pointA, Vector<T, 3>& pointB ) noexcept
+{
+    Vector<T, 3> w { T( 0 ) };
+    pointA = Vector<T, 3> { T( 0 ) };
+    pointB = Vector<T, 3> { T( 0 ) };
+
+    for ( uint32_t i = 0; i < s.count; ++i )
+    {
+        w += s.v[i].w * s.bary[i];
+        pointA += s.v[i].a * s.bary[i];
+        pointB += s.v[i].b * s.bary[i];
+    }
+
+    return w;
+}
+
+template<typename T, typename SA, typename SB>
+GJKResult<T> gjk( const SA& a, const SB& b, GJKCache<T>* cache, bool booleanOnly, Simplex<T>* outSimplex )
+{
+    constexpr uint32_t maxIterations = 64;
+    const T            tolerance     = T( 100 ) * EPSILON<T>;
+
+    Simplex<T> s;
+
+    if ( cache && cache->count > 0 )
+    {
+        for ( uint32_t i = 0; i < cache->count; ++i )
+            s.v[s.count++] = supportVertex<T>( a, b, cache->directions[i] );
+    }
+    else
+    {
+        s.v[0]  = supportVertex<T>( a, b, Vector<T, 3> { T( 1 ), T( 0 ), T( 0 ) } );
+        s.count = 1;
+    }
+
+    GJKResult<T> result;
+
+    Vector<T, 3> v;
+    T            distSqr = std::numeric_limits<T>::max();
+
+    for ( result.iterations = 0; result.iterations < maxIterations; ++result.iterations )
+    {
+        if ( !solve( s ) )
+        {
+            result.intersecting = true;
+            break;
+        }
+
+        v                 = closest( s, result.pointA, result.pointB );
+        const T newDistSq = lengthSqr( v );
+
+        // The closest point is (numerically) the origin.
+        if ( newDistSq <= std::numeric_limits<T>::min() || newDistSq <= tolerance * tolerance * std::max( T( 1 ), lengthSqr( s.v[0].w ) ) )
+        {
+            result.intersecting = true;
+            break;
+        }
+
+        // No progress; the previous simplex was already optimal.
+        if ( newDistSq >= distSqr )
+            break;
+
+        distSqr = newDistSq;
+
+        const SimplexVertex<T> w = supportVertex<T>( a, b, -v );
+
+        // Found a separating axis.
+        if ( booleanOnly && dot( w.w, v ) > T( 0 ) )
+            break;
+
+        // Converged: the new vertex doesn't get closer to the origin.
+        if ( distSqr - dot( v, w.w ) <= tolerance * distSqr )
+            break;
+
+        // Duplicate vertex.
+        bool duplicate = false;
+        for ( uint32_t i = 0; i < s.count; ++i )
+            duplicate = duplicate || lengthSqr( s.v[i].w - w.w ) <= tolerance * tolerance * distSqr;
+
+        if ( duplicate )
+            break;
+
+        s.v[s.count++] = w;
+    }
+
+    if ( !result.intersecting )
+        result.distance = std::sqrt( lengthSqr( result.pointA - result.pointB ) );
+
+    if ( cache )
+    {
+        cache->count = s.count;
+        for ( uint32_t i = 0; i < s.count; ++i )
+            cache->directions[i] = s.v[i].d;
+    }
+
+    if ( outSimplex )
+        *outSimplex = s;
+
+    return result;
+}
+}  // namespace detail
+
+/// <summary>
+/// Compute the distance and the closest points between two convex shapes using the
+/// Gilbert–Johnson–Keerthi algorithm.
+/// </summary>
+/// <remarks>
+/// A shape is either a callable that returns the point of the shape that is furthest in a
+/// given direction (`Vector<T, 3>( const Vector<T, 3>&amp; d )`) or a type for which a `support`
+/// overload exists (points, spheres, AABBs, OBBs, capsules, hulls and `Transformed` shapes).
+/// </remarks>
+/// <seealso href="https://graphics.stanford.edu/courses/cs448b-00-winter/papers/gilbert.pdf"/>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The first shape.</param>
+/// <param name="b">The second shape.</param>
+/// <param name="cache">Warm-start state for this pair of shapes. Updated with the final simplex.</param>
+/// <returns>The distance and closest points.</returns>
+template<typename T = float, typename SA, typename SB>
+GJKResult<T> gjkDistance( const SA& a, const SB& b, GJKCache<T>& cache )
+{
+    return detail::gjk<T>( a, b, &cache, false, nullptr );
+}
+
+/// <summary>
+/// Compute the distance and the closest points between two convex shapes using the
+/// Gilbert–Johnson–Keerthi algorithm.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The first shape.</param>
+/// <param name="b">The second shape.</param>
+/// <returns>The distance and closest points.</returns>
+template<typename T = float, typename SA, typename SB>
+GJKResult<T> gjkDistance( const SA& a, const SB& b )
+{
+    return detail::gjk<T>( a, b, nullptr, false, nullptr );
+}
+
+/// <summary>
+/// Check to see if two convex shapes intersect using the Gilbert–Johnson–Keerthi algorithm.
+/// This stops as soon as a separating axis is found, which is faster than computing the distance.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The first shape.</param>
+/// <param name="b">The second shape.</param>
+/// <param name="cache">Warm-start state for this pair of shapes. Updated with the final simplex.</param>
+/// <returns>`true` if the shapes intersect, `false` otherwise.</returns>
+template<typename T = float, typename SA, typename SB>
+bool gjkIntersects( const SA& a, const SB& b, GJKCache<T>& cache )
+{
+    return detail::gjk<T>( a, b, &cache, true, nullptr ).intersecting;
+}
+
+/// <summary>
+/// Check to see if two convex shapes intersect using the Gilbert–Johnson–Keerthi algorithm.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The first shape.</param>
+/// <param name="b">The second shape.</param>
+/// <returns>`true` if the shapes intersect, `false` otherwise.</returns>
+template<typename T = float, typename SA, typename SB>
+bool gjkIntersects( const SA& a, const SB& b )
+{
+    return detail::gjk<T>( a, b, nullptr, true, nullptr ).intersecting;
+}
+
+/// <summary>
+/// Compute the penetration depth and direction of two intersecting convex shapes using the
+/// Expanding Polytope Algorithm, starting from the simplex that GJK terminates with.
+/// </summary>
+/// <remarks>
+/// The polytope is stored in fixed-capacity arrays on the stack (bounded by the iteration limit),
+/// so no memory is allocated.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The first shape.</param>
+/// <param name="b">The second shape.</param>
+/// <param name="cache">Warm-start state for the GJK phase.</param>
+/// <returns>The penetration depth and direction. `intersecting` is `false` if the shapes don't intersect.</returns>
+template<typename T = float, typename SA, typename SB>
+PenetrationResult<T> epa( const SA& a, const SB& b, GJKCache<T>& cache )
+{
+    using detail::SimplexVertex;
+
+    constexpr uint32_t maxIterations = 64;
+    const T            tolerance     = T( 1000 ) * EPSILON<T>;
+
+    // Each iteration adds one vertex, and a closed triangle mesh with V vertices has 2V - 4 faces.
+    constexpr std::size_t maxVertices = maxIterations + 4;
+    constexpr std::size_t maxFaces    = maxVertices * 2 - 4;
+    constexpr std::size_t maxEdges    = maxFaces * 3;
+
+    PenetrationResult<T> result;
+
+    detail::Simplex<T> s;
+    if ( !detail::gjk<T>( a, b, &cache, false, &s ).intersecting )
+        return result;
+
+    result.intersecting = true;
+
+    SimplexVertex<T> vertices[maxVertices];
+    uint32_t         vertexCount = s.count;
+    std::copy( s.v, s.v + s.count, vertices );
+
+    // Blow up the simplex to a tetrahedron when GJK terminated early (touching contact).
+    static const Vector<T, 3> axes[] = {
+        { T( 1 ), T( 0 ), T( 0 ) }, { T( -1 ), T( 0 ), T( 0 ) },
+        { T( 0 ), T( 1 ), T( 0 ) }, { T( 0 ), T( -1 ), T( 0 ) },
+        { T( 0 ), T( 0 ), T( 1 ) }, { T( 0 ), T( 0 ), T( -1 ) },
+    };
+
+    auto addIfIndependent = [&]( const Vector<T, 3>& d ) {
+        const SimplexVertex<T> w = detail::supportVertex<T>( a, b, d );
+        const Vector<T, 3>     e = w.w - vertices[0].w;
+
+        bool independent = false;
+        switch ( vertexCount )
+        {
+        case 1:
+            independent = lengthSqr( e ) > tolerance * tolerance;
+            break;
+        case 2:
+            independent = lengthSqr( cross( vertices[1].w - vertices[0].w, e ) ) > tolerance * tolerance;
+            break;
+        case 3:
+            independent = std::abs( dot( cross( vertices[1].w - vertices[0].w, vertices[2].w - vertices[0].w ), e ) ) > tolerance * tolerance;
+            break;
+        default:
+            break;
+        }
+
+        if ( independent )
+            vertices[vertexCount++] = w;
+
+        return independent;
+    };
+
+    while ( vertexCount < 4 )
+    {
+        bool added = false;
+        if ( vertexCount == 1 )
+        {
+            for ( const auto& d: axes )
+                if ( ( added = addIfIndependent( d ) ) )
+                    break;
+        }
+        else if ( vertexCount == 2 )
+        {
+            const Vector<T, 3> line = vertices[1].w - vertices[0].w;
+            for ( const auto& axis: axes )
+            {
+                const Vector<T, 3> d = cross( line, axis );
+                if ( lengthSqr( d ) > T( 0 ) && ( added = addIfIndependent( d ) ) )
+                    break;
+            }
+        }
+        else
+        {
+            const Vector<T, 3> n = cross( vertices[1].w - vertices[0].w, vertices[2].w - vertices[0].w );
+            added                = addIfIndependent( n ) || addIfIndependent( -n );
+        }
+
+        // The Minkowski difference is degenerate (flat): the shapes are just touching.
+        if ( !added )
+        {
+            result.normal = Vector<T, 3> { T( 1 ), T( 0 ), T( 0 ) };
+            Vector<T, 3> pa, pb;
+            detail::closest( s, pa, pb );
+            result.pointA = pa;
+            result.pointB = pb;
+            return result;
+        }
+    }
+
+    struct Face
+    {
+        uint32_t     i[3];
+        Vector<T, 3> normal;
+        T            distance;
+    };
+
+    Face        faces[maxFaces];
+    std::size_t faceCount = 0;
+
+    auto makeFace = [&]( uint32_t i0, uint32_t i1, uint32_t i2 ) {
+        Face         f { { i0, i1, i2 }, {}, T( 0 ) };
+        Vector<T, 3> n = cross( vertices[i1].w - vertices[i0].w, vertices[i2].w - vertices[i0].w );
+        const T      l = length( n );
+
+        f.normal   = l > T( 0 ) ? n / l : Vector<T, 3> { T( 0 ) };
+        f.distance = dot( f.normal, vertices[i0].w );
+
+        return f;
+    };
+
+    // Orient the initial tetrahedron so that all face normals point outwards.
+    if ( dot( cross( vertices[1].w - vertices[0].w, vertices[2].w - vertices[0].w ), vertices[3].w - vertices[0].w ) > T( 0 ) )
+        std::swap( vertices[1], vertices[2] );
+
+    faces[faceCount++] = makeFace( 0, 1, 2 );
+    faces[faceCount++] = makeFace( 0, 3, 1 );
+    faces[faceCount++] = makeFace( 0, 2, 3 );
+    faces[faceCount++] = makeFace( 1, 3, 2 );
+
+    std::pair<uint32_t, uint32_t> edges[maxEdges];
+    std::size_t                   edgeCount = 0;
+
+    Face best = faces[0];
+    for ( uint32_t iteration = 0; iteration < maxIterations && faceCount > 0; ++iteration )
+    {
+        // Find the face that is closest to the origin.
+        std::size_t closest = 0;
+        for ( std::size_t i = 1; i < faceCount; ++i )
+        {
+            if ( faces[i].distance < faces[closest].distance )
+                closest = i;
+        }
+
+        best = faces[closest];
+
+        const SimplexVertex<T> w = detail::supportVertex<T>( a, b, best.normal );
+        if ( dot( w.w, best.normal ) - best.distance <= tolerance * std::max( T( 1 ), best.distance ) )
+            break;
+
+        // Remove all of the faces that can be seen from the new vertex and collect the horizon edges.
+        edgeCount = 0;
+        for ( std::size_t i = 0; i < faceCount; )
+        {
+            if ( dot( faces[i].normal, w.w - vertices[faces[i].i[0]].w ) > T( 0 ) )
+            {
+                for ( int e = 0; e < 3; ++e )
+                {
+                    const uint32_t e0 = faces[i].i[e];
+                    const uint32_t e1 = faces[i].i[( e + 1 ) % 3];
+
+                    // An edge that is shared by two removed faces is not on the horizon (the order of the edges doesn't matter).
+                    std::size_t k = 0;
+                    while ( k < edgeCount && !( edges[k].first == e1 && edges[k].second == e0 ) )
+                        ++k;
+
+                    if ( k < edgeCount )
+                        edges[k] = edges[--edgeCount];
+                    else
+                        edges[edgeCount++] = { e0, e1 };
+                }
+
+                faces[i] = faces[--faceCount];
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        // The polytope is degenerate (numerically non-convex); keep the closest face found so far.
+        if ( faceCount + edgeCount > maxFaces )
+            break;
+
+        const uint32_t index    = vertexCount;
+        vertices[vertexCount++] = w;
+
+        for ( std::size_t e = 0; e < edgeCount; ++e )
+            faces[faceCount++] = makeFace( edges[e].first, edges[e].second, index );
+    }
+
+    result.normal = best.normal;
+    result.depth  = best.distance;
+
+    // Compute the barycentric coordinates of the projection of the origin onto the closest face.
+    const Vector<T, 3>  p  = best.normal * best.distance;
+    const Vector<T, 3>& v0 = vertices[best.i[0]].w;
+    const Vector<T, 3>  e1 = vertices[best.i[1]].w - v0;
+    const Vector<T, 3>  e2 = vertices[best.i[2]].w - v0;
+    const Vector<T, 3>  ep = p - v0;
+
+    const T d11   = dot( e1, e1 );
+    const T d12   = dot( e1, e2 );
+    const T d22   = dot( e2, e2 );
+    const T dp1   = dot( ep, e1 );
+    const T dp2   = dot( ep, e2 );
+    const T denom = d11 * d22 - d12 * d12;
+
+    T u = T( 0 ), v = T( 0 );
+    if ( std::abs( denom ) > std::numeric_limits<T>::min() )
+    {
+        u = ( d22 * dp1 - d12 * dp2 ) / denom;
+        v = ( d11 * dp2 - d12 * dp1 ) / denom;
+    }
+
+    const T bary[3] = { T( 1 ) - u - v, u, v };
+
+    result.pointA = Vector<T, 3> { T( 0 ) };
+    result.pointB = Vector<T, 3> { T( 0 ) };
+    for ( int i = 0; i < 3; ++i )
+    {
+        result.pointA += vertices[best.i[i]].a * bary[i];
+        result.pointB += vertices[best.i[i]].b * bary[i];
+    }
+
+    return result;
+}
+
+/// <summary>
+/// Compute the penetration depth and direction of two intersecting convex shapes using the
+/// Expanding Polytope Algorithm.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The first shape.</param>
+/// <param name="b">The second shape.</param>
+/// <returns>The penetration depth and direction. `intersecting` is `false` if the shapes don't intersect.</returns>
+template<typename T = float, typename SA, typename SB>
+PenetrationResult<T> epa( const SA& a, const SB& b )
+{
+    GJKCache<T> cache;
+    return epa<T>( a, b, cache );
+}
+
+}  // namespace FastMath
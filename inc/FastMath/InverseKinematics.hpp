@@ -0,0 +1,877 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The limits of a joint in an IKChain.
+/// </summary>
+/// <remarks>
+/// Limits are applied to the local rotation of the joint, relative to its rest pose (the identity rotation).
+///
+/// If `axis` is non-zero, the joint is a hinge that only rotates about `axis` (in the local space of the
+/// parent) within [minAngle..maxAngle]. Otherwise, the joint is a ball joint: the rotation is decomposed into a
+/// swing of the bone away from its rest direction (limited to `maxSwing`) and a twist about the bone (limited to
+/// [minAngle..maxAngle]).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct JointLimit
+{
+    /// <summary>
+    /// The JointLimit value type.
+    /// </summary>
+    using value_type = T;
+
+    Vector<T, 3> axis { T( 0 ) };  // The (normalized) hinge axis, or zero for a ball joint.
+    T            minAngle = -PI<T>;  // The minimum hinge (or twist) angle in radians.
+    T            maxAngle = PI<T>;   // The maximum hinge (or twist) angle in radians.
+    T            maxSwing = PI<T>;   // The maximum swing angle of a ball joint in radians.
+};
+
+/// <summary>
+/// A chain of joints for inverse kinematics.
+/// </summary>
+/// <remarks>
+/// Bone `i` goes from joint `i` to joint `i + 1`, and the last joint is the end effector. The world rotation of
+/// joint `i` is the world rotation of its parent multiplied by `rotations[i]`, and the position of joint `i + 1`
+/// is the position of joint `i` plus `offsets[i]` rotated by the world rotation of joint `i`.
+///
+/// The solvers update `rotations`, and also leave the world space pose of the chain in `positions` and
+/// `worldRotations` (see `forwardKinematics`). These are resized on first use, so solving a chain again does not
+/// allocate memory.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct IKChain
+{
+    /// <summary>
+    /// The IKChain value type.
+    /// </summary>
+    using value_type = T;
+
+    Vector<T, 3>               origin;                                    // The world position of the first joint.
+    Quaternion<T>              parentRotation = Quaternion<T>::IDENTITY;  // The world rotation of the parent of the first joint.
+    std::vector<Vector<T, 3>>  offsets;                                   // The bone vectors (in the local space of each joint).
+    std::vector<Quaternion<T>> rotations;                                 // The local rotation of each joint.
+    std::vector<JointLimit<T>> limits;                                    // The joint limits (empty, or one for each joint).
+
+    std::vector<Vector<T, 3>>  positions;       // The world positions of the joints (including the end effector).
+    std::vector<Quaternion<T>> worldRotations;  // The world rotations of the joints.
+
+    /// <summary>
+    /// Get the number of bones in the chain.
+    /// </summary>
+    /// <returns>The number of bones.</returns>
+    std::size_t size() const noexcept
+    {
+        return offsets.size();
+    }
+};
+
+/// <summary>
+/// Settings for the iterative IK solvers.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct IKSettings
+{
+    /// <summary>
+    /// The IKSettings value type.
+    /// </summary>
+    using value_type = T;
+
+    uint32_t maxIterations = 16;         // The maximum number of iterations.
+    T        tolerance     = T( 1e-3 );  // Stop when the end effector is closer than this to the target.
+};
+
+/// <summary>
+/// A structure-of-arrays view over many two-bone chains. This is the layout expected by the batch two-bone solver.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size. Chain `i` has the root joint `a`, the middle joint `b`,
+/// the end effector `c`, the target `t` and the pole `p` (all in world space).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct TwoBoneSoA
+{
+    std::span<const T> ax, ay, az;
+    std::span<const T> bx, by, bz;
+    std::span<const T> cx, cy, cz;
+    std::span<const T> tx, ty, tz;
+    std::span<const T> px, py, pz;
+
+    /// <summary>
+    /// Get the number of chains in the view.
+    /// </summary>
+    /// <returns>The number of chains.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return ax.size();
+    }
+};
+
+/// <summary>
+/// A structure-of-arrays view over many chains of joint positions with the same number of joints.
+/// This is the layout expected by the batch FABRIK solver.
+/// </summary>
+/// <remarks>
+/// The joints are stored joint-major: joint `j` of chain `i` is `( x[j * size() + i], y[j * size() + i], z[j * size() + i] )`,
+/// and the length of bone `j` (from joint `j` to joint `j + 1`) of chain `i` is `lengths[j * size() + i]`.
+/// The target of chain `i` is `( tx[i], ty[i], tz[i] )`.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct IKChainSoA
+{
+    std::span<T>       x, y, z;
+    std::span<const T> lengths;
+    std::span<const T> tx, ty, tz;
+
+    /// <summary>
+    /// Get the number of chains in the view.
+    /// </summary>
+    /// <returns>The number of chains.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return tx.size();
+    }
+
+    /// <summary>
+    /// Get the number of joints in each chain (including the end effector).
+    /// </summary>
+    /// <returns>The number of joints.</returns>
+    constexpr std::size_t getJointCount() const noexcept
+    {
+        return tx.empty() ? 0 : x.size() / tx.size();
+    }
+};
+
+using JointLimitf = JointLimit<float>;
+using JointLimitd = JointLimit<double>;
+using IKChainf    = IKChain<float>;
+using IKChaind    = IKChain<double>;
+using IKSettingsf = IKSettings<float>;
+using IKSettingsd = IKSettings<double>;
+
+namespace detail
+{
+// The shortest rotation from the (normalized) direction u to v. `axis` (perpendicular to u) is used if u and v are opposite.
+template<typename T>
+Quaternion<T> rotationBetween( const Vector<T, 3>& u, const Vector<T, 3>& v, const Vector<T, 3>& axis ) noexcept
+{
+    const T w = T( 1 ) + dot( u, v );
+    if ( w < T( 1e-6 ) )
+        return { T( 0 ), axis };
+
+    return normalize( Quaternion<T> { w, cross( u, v ) } );
+}
+
+// A rotation about a (normalized) axis. Unlike axisAngle, this does not assert that the axis is normalized
+// (since computed axes are only normalized to within rounding error).
+template<typename T>
+Quaternion<T> rotationAbout( const Vector<T, 3>& axis, T angle ) noexcept
+{
+    return { std::cos( angle * T( 0.5 ) ), axis * std::sin( angle * T( 0.5 ) ) };
+}
+
+// A unit vector that is perpendicular to v.
+template<typename T>
+Vector<T, 3> perpendicular( const Vector<T, 3>& v ) noexcept
+{
+    return normalize( std::abs( v.x ) > std::abs( v.z ) ? Vector<T, 3> { -v.y, v.x, T( 0 ) } : Vector<T, 3> { T( 0 ), -v.z, v.y } );
+}
+
+// Normalize v, or return `fallback` if v is (close to) zero.
+template<typename T>
+Vector<T, 3> normalizeOr( const Vector<T, 3>& v, const Vector<T, 3>& fallback ) noexcept
+{
+    const T l = lengthSqr( v );
+    return l > T( 1e-12 ) ? v / std::sqrt( l ) : fallback;
+}
+
+// Update the world space pose of the chain, starting at joint `first`.
+template<typename T>
+void forwardKinematics( IKChain<T>& chain, std::size_t first ) noexcept
+{
+    for ( std::size_t i = first; i < chain.size(); ++i )
+    {
+        const Quaternion<T>& parent = i > 0 ? chain.worldRotations[i - 1] : chain.parentRotation;
+
+        chain.worldRotations[i] = parent * chain.rotations[i];
+        chain.positions[i + 1]  = chain.positions[i] + chain.worldRotations[i] * chain.offsets[i];
+    }
+}
+
+// Set the local rotation of joint i so that its world rotation is `world`, and apply the joint limits.
+template<typename T>
+void setWorldRotation( IKChain<T>& chain, std::size_t i, const Quaternion<T>& world ) noexcept
+{
+    const Quaternion<T>& parent = i > 0 ? chain.worldRotations[i - 1] : chain.parentRotation;
+
+    Quaternion<T> local = normalize( conjugate( parent ) * world );
+    if ( !chain.limits.empty() )
+        local = constrain( local, chain.limits[i], normalizeOr( chain.offsets[i], Vector<T, 3> { T( 0 ), T( 1 ), T( 0 ) } ) );
+
+    chain.rotations[i] = local;
+}
+}  // namespace detail
+
+/// <summary>
+/// Apply joint limits to a local joint rotation.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="q">The local rotation of the joint.</param>
+/// <param name="limit">The joint limits.</param>
+/// <param name="boneAxis">The (normalized) direction of the bone in the rest pose. This is the twist axis of ball joints.</param>
+/// <returns>The closest rotation (in swing and twist) that satisfies the limits.</returns>
+template<typename T>
+Quaternion<T> constrain( const Quaternion<T>& q, const JointLimit<T>& limit, const Vector<T, 3>& boneAxis ) noexcept
+{
+    const bool         hinge = lengthSqr( limit.axis ) > T( 0 );
+    const Vector<T, 3> axis  = hinge ? limit.axis : boneAxis;
+
+    // Swing-twist decomposition (q = swing * twist).
+    const Vector<T, 3> v { q.x, q.y, q.z };
+    const T            p = dot( v, axis );
+
+    T angle = T( 2 ) * std::atan2( p, q.w );
+    if ( angle > PI<T> )
+        angle -= TWO_PI<T>;
+    else if ( angle < -PI<T> )
+        angle += TWO_PI<T>;
+
+    const Quaternion<T> twist = detail::rotationAbout( axis, std::clamp( angle, limit.minAngle, limit.maxAngle ) );
+    if ( hinge )
+        return twist;
+
+    const T       l     = std::sqrt( q.w * q.w + p * p );
+    Quaternion<T> swing = l > T( 1e-6 ) ? q * conjugate( Quaternion<T> { q.w / l, axis * ( p / l ) } ) : q;
+    if ( swing.w < T( 0 ) )
+        swing = swing * T( -1 );
+
+    const T swingAngle = T( 2 ) * std::acos( std::min( swing.w, T( 1 ) ) );
+    if ( swingAngle > limit.maxSwing )
+    {
+        const Vector<T, 3> swingAxis = detail::normalizeOr( Vector<T, 3> { swing.x, swing.y, swing.z }, detail::perpendicular( axis ) );
+        swing                        = detail::rotationAbout( swingAxis, limit.maxSwing );
+    }
+
+    return swing * twist;
+}
+
+/// <summary>
+/// Update the world space pose (`positions` and `worldRotations`) of a chain from its local rotations.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="chain">The chain.</param>
+template<typename T>
+void forwardKinematics( IKChain<T>& chain )
+{
+    assert( chain.rotations.size() == chain.size() );
+    assert( chain.limits.empty() || chain.limits.size() == chain.size() );
+
+    chain.positions.resize( chain.size() + 1 );
+    chain.worldRotations.resize( chain.size() );
+    chain.positions[0] = chain.origin;
+
+    detail::forwardKinematics( chain, 0 );
+}
+
+/// <summary>
+/// Analytic two-bone IK.
+/// </summary>
+/// <remarks>
+/// Computes the world space rotations to apply to the root and middle joints of a two-bone chain (for example,
+/// shoulder-elbow-wrist) so that the end effector reaches the target, with the middle joint bending towards the
+/// pole. If the target is out of reach, the chain is stretched towards it.
+///
+/// The new world rotations of the joints are `rootRotation * oldRootRotation` and `midRotation * oldMidRotation`.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="a">The position of the root joint.</param>
+/// <param name="b">The position of the middle joint.</param>
+/// <param name="c">The position of the end effector.</param>
+/// <param name="target">The target position of the end effector.</param>
+/// <param name="pole">The position that the middle joint should bend towards.</param>
+/// <param name="rootRotation">Receives the world space rotation to apply to the root joint.</param>
+/// <param name="midRotation">Receives the world space rotation to apply to the middle joint.</param>
+template<typename T>
+void solveTwoBone( const Vector<T, 3>& a, const Vector<T, 3>& b, const Vector<T, 3>& c, const Vector<T, 3>& target, const Vector<T, 3>& pole,
+                   Quaternion<T>& rootRotation, Quaternion<T>& midRotation ) noexcept
+{
+    constexpr T eps = T( 1e-4 );
+
+    const Vector<T, 3> ab = b - a;
+    const Vector<T, 3> bc = c - b;
+    const Vector<T, 3> ac = c - a;
+    const Vector<T, 3> at = target - a;
+    const Vector<T, 3> ap = pole - a;
+
+    const T lab = std::max( length( ab ), eps );
+    const T lbc = std::max( length( bc ), eps );
+    const T lac = std::max( length( ac ), eps );
+    const T lat = std::clamp( length( at ), std::abs( lab - lbc ) + eps, lab + lbc - eps );
+
+    // The current and desired angles at the root (between ac and ab) and at the middle joint (between ba and bc).
+    const T c0 = std::clamp( dot( ac, ab ) / ( lac * lab ), T( -1 ), T( 1 ) );
+    const T c1 = std::clamp( -dot( ab, bc ) / ( lab * lbc ), T( -1 ), T( 1 ) );
+    const T d0 = std::clamp( ( lab * lab + lat * lat - lbc * lbc ) / ( T( 2 ) * lab * lat ), T( -1 ), T( 1 ) );
+    const T d1 = std::clamp( ( lab * lab + lbc * lbc - lat * lat ) / ( T( 2 ) * lab * lbc ), T( -1 ), T( 1 ) );
+
+    // The bend axis.
+    const Vector<T, 3> acDir = ac / lac;
+    const Vector<T, 3> n     = detail::normalizeOr( cross( ac, ab ), detail::normalizeOr( cross( ac, ap ), detail::perpendicular( acDir ) ) );
+
+    // Rotations by the difference of the angles (using half angle identities).
+    const auto rotation = [&n]( T cosFrom, T cosTo ) {
+        const T sinFrom = std::sqrt( std::max( T( 1 ) - cosFrom * cosFrom, T( 0 ) ) );
+        const T sinTo   = std::sqrt( std::max( T( 1 ) - cosTo * cosTo, T( 0 ) ) );
+        const T cosD    = std::clamp( cosTo * cosFrom + sinTo * sinFrom, T( -1 ), T( 1 ) );
+        const T sinD    = sinTo * cosFrom - cosTo * sinFrom;
+        const T s       = std::sqrt( ( T( 1 ) - cosD ) * T( 0.5 ) );
+
+        return Quaternion<T> { std::sqrt( ( T( 1 ) + cosD ) * T( 0.5 ) ), n * ( sinD < T( 0 ) ? -s : s ) };
+    };
+
+    const Quaternion<T> r0 = rotation( c0, d0 );
+    const Quaternion<T> r1 = rotation( c1, d1 );
+
+    // The end effector is now on the line through ac. Rotate it to the target.
+    const Vector<T, 3>  atDir = detail::normalizeOr( at, acDir );
+    const Quaternion<T> r2    = detail::rotationBetween( acDir, atDir, n );
+
+    // Twist about the target direction so that the middle joint bends towards the pole.
+    const Vector<T, 3> mid = r2 * ( r0 * ab );
+    const Vector<T, 3> u   = mid - atDir * dot( mid, atDir );
+    const Vector<T, 3> v   = ap - atDir * dot( ap, atDir );
+
+    Quaternion<T> r3 = Quaternion<T>::IDENTITY;
+    if ( lengthSqr( u ) > eps * eps && lengthSqr( v ) > eps * eps )
+        r3 = detail::rotationBetween( normalize( u ), normalize( v ), atDir );
+
+    rootRotation = r3 * r2 * r0;
+    midRotation  = rootRotation * r1;
+}
+
+/// <summary>
+/// Analytic two-bone IK on a chain with two bones.
+/// </summary>
+/// <remarks>
+/// Joint limits are not applied.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="chain">The chain to solve.</param>
+/// <param name="target">The target position of the end effector.</param>
+/// <param name="pole">The position that the middle joint should bend towards.</param>
+/// <returns>The distance from the end effector to the target.</returns>
+template<typename T>
+T solveTwoBone( IKChain<T>& chain, const Vector<T, 3>& target, const Vector<T, 3>& pole )
+{
+    assert( chain.size() == 2 );
+
+    forwardKinematics( chain );
+
+    Quaternion<T> rootRotation, midRotation;
+    solveTwoBone( chain.positions[0], chain.positions[1], chain.positions[2], target, pole, rootRotation, midRotation );
+
+    const Quaternion<T> root = normalize( rootRotation * chain.worldRotations[0] );
+    const Quaternion<T> mid  = normalize( midRotation * chain.worldRotations[1] );
+
+    chain.rotations[0] = normalize( conjugate( chain.parentRotation ) * root );
+    chain.rotations[1] = normalize( conjugate( root ) * mid );
+
+    detail::forwardKinematics( chain, 0 );
+
+    return length( chain.positions[2] - target );
+}
+
+/// <summary>
+/// Solve a chain using cyclic coordinate descent (CCD).
+/// </summary>
+/// <remarks>
+/// Each iteration rotates the joints (from the end effector to the root) so that the end effector points at the target,
+/// and applies the joint limits.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="chain">The chain to solve.</param>
+/// <param name="target">The target position of the end effector.</param>
+/// <param name="settings">The solver settings.</param>
+/// <returns>The distance from the end effector to the target.</returns>
+template<typename T>
+T solveCCD( IKChain<T>& chain, const Vector<T, 3>& target, const IKSettings<T>& settings = {} )
+{
+    forwardKinematics( chain );
+
+    const std::size_t n = chain.size();
+    for ( uint32_t iteration = 0; iteration < settings.maxIterations; ++iteration )
+    {
+        if ( lengthSqr( chain.positions[n] - target ) <= settings.tolerance * settings.tolerance )
+            break;
+
+        for ( std::size_t i = n; i-- > 0; )
+        {
+            const Vector<T, 3> toEnd    = chain.positions[n] - chain.positions[i];
+            const Vector<T, 3> toTarget = target - chain.positions[i];
+            if ( lengthSqr( toEnd ) < T( 1e-12 ) || lengthSqr( toTarget ) < T( 1e-12 ) )
+                continue;
+
+            const Vector<T, 3>  u     = normalize( toEnd );
+            const Quaternion<T> delta = detail::rotationBetween( u, normalize( toTarget ), detail::perpendicular( u ) );
+
+            detail::setWorldRotation( chain, i, delta * chain.worldRotations[i] );
+            detail::forwardKinematics( chain, i );
+        }
+    }
+
+    return length( chain.positions[n] - target );
+}
+
+/// <summary>
+/// Solve a chain using forward and backward reaching inverse kinematics (FABRIK).
+/// </summary>
+/// <remarks>
+/// Each iteration moves the joint positions (keeping the bone lengths) from the end effector to the target and back
+/// to the root, and then converts the positions to joint rotations (with the shortest rotation of each bone) and
+/// applies the joint limits.
+/// </remarks>
+/// <seealso href="http://andreasaristidou.com/FABRIK.html"/>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="chain">The chain to solve.</param>
+/// <param name="target">The target position of the end effector.</param>
+/// <param name="settings">The solver settings.</param>
+/// <returns>The distance from the end effector to the target.</returns>
+template<typename T>
+T solveFABRIK( IKChain<T>& chain, const Vector<T, 3>& target, const IKSettings<T>& settings = {} )
+{
+    forwardKinematics( chain );
+
+    const std::size_t n = chain.size();
+    for ( uint32_t iteration = 0; iteration < settings.maxIterations; ++iteration )
+    {
+        if ( lengthSqr( chain.positions[n] - target ) <= settings.tolerance * settings.tolerance )
+            break;
+
+        std::vector<Vector<T, 3>>& p = chain.positions;
+
+        // Backward: from the end effector to the root.
+        p[n] = target;
+        for ( std::size_t i = n; i-- > 0; )
+            p[i] = p[i + 1] + detail::normalizeOr( p[i] - p[i + 1], Vector<T, 3> { T( 0 ) } ) * length( chain.offsets[i] );
+
+        // Forward: from the root to the end effector.
+        p[0] = chain.origin;
+        for ( std::size_t i = 0; i < n; ++i )
+            p[i + 1] = p[i] + detail::normalizeOr( p[i + 1] - p[i], Vector<T, 3> { T( 0 ) } ) * length( chain.offsets[i] );
+
+        // Convert to rotations. p[i + 1] is replaced with the constrained position of the joint.
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            const Quaternion<T>& parent  = i > 0 ? chain.worldRotations[i - 1] : chain.parentRotation;
+            const Quaternion<T>  world   = parent * chain.rotations[i];
+            const Vector<T, 3>   current = world * chain.offsets[i];
+            const Vector<T, 3>   desired = p[i + 1] - p[i];
+
+            if ( lengthSqr( current ) > T( 1e-12 ) && lengthSqr( desired ) > T( 1e-12 ) )
+            {
+                const Vector<T, 3> u = normalize( current );
+                detail::setWorldRotation( chain, i, detail::rotationBetween( u, normalize( desired ), detail::perpendicular( u ) ) * world );
+            }
+
+            chain.worldRotations[i] = parent * chain.rotations[i];
+            p[i + 1]                = p[i] + chain.worldRotations[i] * chain.offsets[i];
+        }
+    }
+
+    return length( chain.positions[n] - target );
+}
+
+namespace detail
+{
+#if defined( LS_AVX2 )
+// 8 vectors (or quaternions) in SoA form.
+struct Vector8
+{
+    __m256 x, y, z;
+};
+
+struct Quaternion8
+{
+    __m256 w, x, y, z;
+};
+
+inline Vector8 load8( std::span<const float> x, std::span<const float> y, std::span<const float> z, std::size_t i ) noexcept
+{
+    return { _mm256_loadu_ps( x.data() + i ), _mm256_loadu_ps( y.data() + i ), _mm256_loadu_ps( z.data() + i ) };
+}
+
+inline Vector8 add8( const Vector8& a, const Vector8& b ) noexcept
+{
+    return { _mm256_add_ps( a.x, b.x ), _mm256_add_ps( a.y, b.y ), _mm256_add_ps( a.z, b.z ) };
+}
+
+inline Vector8 sub8( const Vector8& a, const Vector8& b ) noexcept
+{
+    return { _mm256_sub_ps( a.x, b.x ), _mm256_sub_ps( a.y, b.y ), _mm256_sub_ps( a.z, b.z ) };
+}
+
+inline Vector8 mul8( const Vector8& a, __m256 s ) noexcept
+{
+    return { _mm256_mul_ps( a.x, s ), _mm256_mul_ps( a.y, s ), _mm256_mul_ps( a.z, s ) };
+}
+
+inline __m256 dot8( const Vector8& a, const Vector8& b ) noexcept
+{
+    return _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( a.x, b.x ), _mm256_mul_ps( a.y, b.y ) ), _mm256_mul_ps( a.z, b.z ) );
+}
+
+inline Vector8 cross8( const Vector8& a, const Vector8& b ) noexcept
+{
+    return {
+        _mm256_sub_ps( _mm256_mul_ps( a.y, b.z ), _mm256_mul_ps( a.z, b.y ) ),
+        _mm256_sub_ps( _mm256_mul_ps( a.z, b.x ), _mm256_mul_ps( a.x, b.z ) ),
+        _mm256_sub_ps( _mm256_mul_ps( a.x, b.y ), _mm256_mul_ps( a.y, b.x ) ),
+    };
+}
+
+inline Vector8 select8( __m256 mask, const Vector8& a, const Vector8& b ) noexcept
+{
+    return { _mm256_blendv_ps( b.x, a.x, mask ), _mm256_blendv_ps( b.y, a.y, mask ), _mm256_blendv_ps( b.z, a.z, mask ) };
+}
+
+// Normalize v, or use `fallback` where v is (close to) zero.
+inline Vector8 normalizeOr8( const Vector8& v, const Vector8& fallback ) noexcept
+{
+    const __m256 l    = dot8( v, v );
+    const __m256 mask = _mm256_cmp_ps( l, _mm256_set1_ps( 1e-12f ), _CMP_GT_OQ );
+    const __m256 s    = _mm256_div_ps( _mm256_set1_ps( 1.0f ), _mm256_sqrt_ps( _mm256_max_ps( l, _mm256_set1_ps( 1e-12f ) ) ) );
+
+    return select8( mask, mul8( v, s ), fallback );
+}
+
+inline Vector8 perpendicular8( const Vector8& v ) noexcept
+{
+    const __m256  absMask = _mm256_castsi256_ps( _mm256_set1_epi32( 0x7fffffff ) );
+    const __m256  mask    = _mm256_cmp_ps( _mm256_and_ps( v.x, absMask ), _mm256_and_ps( v.z, absMask ), _CMP_GT_OQ );
+    const __m256  zero    = _mm256_setzero_ps();
+    const Vector8 a { _mm256_sub_ps( zero, v.y ), v.x, zero };
+    const Vector8 b { zero, _mm256_sub_ps( zero, v.z ), v.y };
+
+    return normalizeOr8( select8( mask, a, b ), { zero, _mm256_set1_ps( 1.0f ), zero } );
+}
+
+inline Quaternion8 mul8( const Quaternion8& a, const Quaternion8& b ) noexcept
+{
+    return {
+        _mm256_sub_ps( _mm256_sub_ps( _mm256_mul_ps( a.w, b.w ), _mm256_mul_ps( a.x, b.x ) ), _mm256_add_ps( _mm256_mul_ps( a.y, b.y ), _mm256_mul_ps( a.z, b.z ) ) ),
+        _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( a.w, b.x ), _mm256_mul_ps( a.x, b.w ) ), _mm256_sub_ps( _mm256_mul_ps( a.y, b.z ), _mm256_mul_ps( a.z, b.y ) ) ),
+        _mm256_add_ps( _mm256_sub_ps( _mm256_mul_ps( a.w, b.y ), _mm256_mul_ps( a.x, b.z ) ), _mm256_add_ps( _mm256_mul_ps( a.y, b.w ), _mm256_mul_ps( a.z, b.x ) ) ),
+        _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( a.w, b.z ), _mm256_mul_ps( a.x, b.y ) ), _mm256_sub_ps( _mm256_mul_ps( a.z, b.w ), _mm256_mul_ps( a.y, b.x ) ) ),
+    };
+}
+
+// Rotate a vector by a (unit) quaternion.
+inline Vector8 rotate8( const Quaternion8& q, const Vector8& v ) noexcept
+{
+    const Vector8 qv { q.x, q.y, q.z };
+    const Vector8 t = mul8( cross8( qv, v ), _mm256_set1_ps( 2.0f ) );
+
+    return add8( add8( v, mul8( t, q.w ) ), cross8( qv, t ) );
+}
+
+// The shortest rotation from the (normalized) direction u to v. `axis` is used where u and v are opposite.
+inline Quaternion8 rotationBetween8( const Vector8& u, const Vector8& v, const Vector8& axis ) noexcept
+{
+    const __m256  w    = _mm256_add_ps( _mm256_set1_ps( 1.0f ), dot8( u, v ) );
+    const __m256  mask = _mm256_cmp_ps( w, _mm256_set1_ps( 1e-6f ), _CMP_LT_OQ );
+    const Vector8 c    = select8( mask, axis, cross8( u, v ) );
+    const __m256  qw   = _mm256_andnot_ps( mask, w );
+    const __m256  l    = _mm256_add_ps( _mm256_mul_ps( qw, qw ), dot8( c, c ) );
+    const __m256  s    = _mm256_div_ps( _mm256_set1_ps( 1.0f ), _mm256_sqrt_ps( l ) );
+
+    return { _mm256_mul_ps( qw, s ), _mm256_mul_ps( c.x, s ), _mm256_mul_ps( c.y, s ), _mm256_mul_ps( c.z, s ) };
+}
+
+inline __m256 clamp8( __m256 x, __m256 min, __m256 max ) noexcept
+{
+    return _mm256_min_ps( _mm256_max_ps( x, min ), max );
+}
+
+inline __m256 length8( const Vector8& v ) noexcept
+{
+    return _mm256_sqrt_ps( dot8( v, v ) );
+}
+
+// 8-wide version of the scalar two-bone solver.
+inline void solveTwoBone8( const Vector8& a, const Vector8& b, const Vector8& c, const Vector8& target, const Vector8& pole, Quaternion8& rootRotation,
+                           Quaternion8& midRotation ) noexcept
+{
+    const __m256 eps     = _mm256_set1_ps( 1e-4f );
+    const __m256 one     = _mm256_set1_ps( 1.0f );
+    const __m256 minus   = _mm256_set1_ps( -1.0f );
+    const __m256 half    = _mm256_set1_ps( 0.5f );
+    const __m256 two     = _mm256_set1_ps( 2.0f );
+    const __m256 zero    = _mm256_setzero_ps();
+    const __m256 absMask = _mm256_castsi256_ps( _mm256_set1_epi32( 0x7fffffff ) );
+
+    const Vector8 ab = sub8( b, a );
+    const Vector8 bc = sub8( c, b );
+    const Vector8 ac = sub8( c, a );
+    const Vector8 at = sub8( target, a );
+    const Vector8 ap = sub8( pole, a );
+
+    const __m256 lab = _mm256_max_ps( length8( ab ), eps );
+    const __m256 lbc = _mm256_max_ps( length8( bc ), eps );
+    const __m256 lac = _mm256_max_ps( length8( ac ), eps );
+    const __m256 lat = clamp8( length8( at ), _mm256_add_ps( _mm256_and_ps( _mm256_sub_ps( lab, lbc ), absMask ), eps ), _mm256_sub_ps( _mm256_add_ps( lab, lbc ), eps ) );
+
+    const __m256 lab2 = _mm256_mul_ps( lab, lab );
+    const __m256 lbc2 = _mm256_mul_ps( lbc, lbc );
+    const __m256 lat2 = _mm256_mul_ps( lat, lat );
+
+    const __m256 c0 = clamp8( _mm256_div_ps( dot8( ac, ab ), _mm256_mul_ps( lac, lab ) ), minus, one );
+    const __m256 c1 = clamp8( _mm256_div_ps( _mm256_sub_ps( zero, dot8( ab, bc ) ), _mm256_mul_ps( lab, lbc ) ), minus, one );
+    const __m256 d0 = clamp8( _mm256_div_ps( _mm256_sub_ps( _mm256_add_ps( lab2, lat2 ), lbc2 ), _mm256_mul_ps( two, _mm256_mul_ps( lab, lat ) ) ), minus, one );
+    const __m256 d1 = clamp8( _mm256_div_ps( _mm256_sub_ps( _mm256_add_ps( lab2, lbc2 ), lat2 ), _mm256_mul_ps( two, _mm256_mul_ps( lab, lbc ) ) ), minus, one );
+
+    const Vector8 acDir = mul8( ac, _mm256_div_ps( one, lac ) );
+    const Vector8 n     = normalizeOr8( cross8( ac, ab ), normalizeOr8( cross8( ac, ap ), perpendicular8( acDir ) ) );
+
+    const auto rotation = [&]( __m256 cosFrom, __m256 cosTo ) {
+        const __m256 sinFrom = _mm256_sqrt_ps( _mm256_max_ps( _mm256_sub_ps( one, _mm256_mul_ps( cosFrom, cosFrom ) ), zero ) );
+        const __m256 sinTo   = _mm256_sqrt_ps( _mm256_max_ps( _mm256_sub_ps( one, _mm256_mul_ps( cosTo, cosTo ) ), zero ) );
+        const __m256 cosD    = clamp8( _mm256_add_ps( _mm256_mul_ps( cosTo, cosFrom ), _mm256_mul_ps( sinTo, sinFrom ) ), minus, one );
+        const __m256 sinD    = _mm256_sub_ps( _mm256_mul_ps( sinTo, cosFrom ), _mm256_mul_ps( cosTo, sinFrom ) );
+        const __m256 s       = _mm256_sqrt_ps( _mm256_mul_ps( _mm256_sub_ps( one, cosD ), half ) );
+        const __m256 signedS = _mm256_or_ps( s, _mm256_and_ps( sinD, _mm256_castsi256_ps( _mm256_set1_epi32( static_cast<int32_t>( 0x80000000 ) ) ) ) );
+
+        return Quaternion8 { _mm256_sqrt_ps( _mm256_mul_ps( _mm256_add_ps( one, cosD ), half ) ), _mm256_mul_ps( n.x, signedS ), _mm256_mul_ps( n.y, signedS ),
+                             _mm256_mul_ps( n.z, signedS ) };
+    };
+
+    const Quaternion8 r0 = rotation( c0, d0 );
+    const Quaternion8 r1 = rotation( c1, d1 );
+
+    const Vector8     atDir = normalizeOr8( at, acDir );
+    const Quaternion8 r2    = rotationBetween8( acDir, atDir, n );
+
+    const Vector8 mid = rotate8( r2, rotate8( r0, ab ) );
+    const Vector8 u   = sub8( mid, mul8( atDir, dot8( mid, atDir ) ) );
+    const Vector8 v   = sub8( ap, mul8( atDir, dot8( ap, atDir ) ) );
+
+    const __m256 eps2  = _mm256_mul_ps( eps, eps );
+    const __m256 valid = _mm256_and_ps( _mm256_cmp_ps( dot8( u, u ), eps2, _CMP_GT_OQ ), _mm256_cmp_ps( dot8( v, v ), eps2, _CMP_GT_OQ ) );
+
+    const Vector8     unit { zero, zero, zero };
+    const Quaternion8 twist = rotationBetween8( normalizeOr8( u, unit ), normalizeOr8( v, unit ), atDir );
+    const Quaternion8 r3 {
+        _mm256_blendv_ps( one, twist.w, valid ),
+        _mm256_and_ps( twist.x, valid ),
+        _mm256_and_ps( twist.y, valid ),
+        _mm256_and_ps( twist.z, valid ),
+    };
+
+    rootRotation = mul8( mul8( r3, r2 ), r0 );
+    midRotation  = mul8( rootRotation, r1 );
+}
+#endif
+}  // namespace detail
+
+/// <summary>
+/// Analytic two-bone IK for many chains.
+/// </summary>
+/// <remarks>
+/// With AVX2 enabled, 8 single-precision chains are solved at a time (see the scalar `solveTwoBone` for the
+/// meaning of the results).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="chains">The chains.</param>
+/// <param name="rootRotations">Receives the world space rotation to apply to the root joint of each chain. Must have the same size as `chains`.</param>
+/// <param name="midRotations">Receives the world space rotation to apply to the middle joint of each chain. Must have the same size as `chains`.</param>
+template<typename T>
+void solveTwoBone( const TwoBoneSoA<T>& chains, std::span<Quaternion<std::type_identity_t<T>>> rootRotations,
+                   std::span<Quaternion<std::type_identity_t<T>>> midRotations ) noexcept
+{
+    assert( rootRotations.size() == chains.size() );
+    assert( midRotations.size() == chains.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        alignas( 32 ) float r[8][8];
+
+        for ( ; i + Simd::WIDTH <= chains.size(); i += Simd::WIDTH )
+        {
+            const detail::Vector8 a      = detail::load8( chains.ax, chains.ay, chains.az, i );
+            const detail::Vector8 b      = detail::load8( chains.bx, chains.by, chains.bz, i );
+            const detail::Vector8 c      = detail::load8( chains.cx, chains.cy, chains.cz, i );
+            const detail::Vector8 target = detail::load8( chains.tx, chains.ty, chains.tz, i );
+            const detail::Vector8 pole   = detail::load8( chains.px, chains.py, chains.pz, i );
+
+            detail::Quaternion8 root, mid;
+            detail::solveTwoBone8( a, b, c, target, pole, root, mid );
+
+            _mm256_store_ps( r[0], root.w );
+            _mm256_store_ps( r[1], root.x );
+            _mm256_store_ps( r[2], root.y );
+            _mm256_store_ps( r[3], root.z );
+            _mm256_store_ps( r[4], mid.w );
+            _mm256_store_ps( r[5], mid.x );
+            _mm256_store_ps( r[6], mid.y );
+            _mm256_store_ps( r[7], mid.z );
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                rootRotations[i + j] = { r[0][j], r[1][j], r[2][j], r[3][j] };
+                midRotations[i + j]  = { r[4][j], r[5][j], r[6][j], r[7][j] };
+            }
+        }
+    }
+#endif
+
+    for ( ; i < chains.size(); ++i )
+    {
+        solveTwoBone( Vector<T, 3> { chains.ax[i], chains.ay[i], chains.az[i] }, Vector<T, 3> { chains.bx[i], chains.by[i], chains.bz[i] },
+                      Vector<T, 3> { chains.cx[i], chains.cy[i], chains.cz[i] }, Vector<T, 3> { chains.tx[i], chains.ty[i], chains.tz[i] },
+                      Vector<T, 3> { chains.px[i], chains.py[i], chains.pz[i] }, rootRotations[i], midRotations[i] );
+    }
+}
+
+/// <summary>
+/// Solve many chains of joint positions using FABRIK.
+/// </summary>
+/// <remarks>
+/// This solves for the joint positions only (without joint limits). With AVX2 enabled, 8 single-precision
+/// chains are solved at a time, and a block of chains stops iterating when all of its chains are within the
+/// tolerance. The first joint of each chain stays in place.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="chains">The chains. The joint positions are updated in place.</param>
+/// <param name="settings">The solver settings.</param>
+template<typename T>
+void solveFABRIK( const IKChainSoA<T>& chains, const IKSettings<std::type_identity_t<T>>& settings = {} ) noexcept
+{
+    const std::size_t count  = chains.size();
+    const std::size_t joints = chains.getJointCount();
+
+    assert( chains.x.size() == joints * count && chains.y.size() == joints * count && chains.z.size() == joints * count );
+    assert( chains.lengths.size() >= ( joints > 0 ? joints - 1 : 0 ) * count );
+
+    if ( joints < 2 )
+        return;
+
+    const std::size_t n = joints - 1;  // The index of the end effector.
+    std::size_t       i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 tolerance = _mm256_set1_ps( settings.tolerance * settings.tolerance );
+
+        const auto load = [&]( std::size_t j, std::size_t i ) {
+            const std::size_t k = j * count + i;
+            return detail::Vector8 { _mm256_loadu_ps( chains.x.data() + k ), _mm256_loadu_ps( chains.y.data() + k ), _mm256_loadu_ps( chains.z.data() + k ) };
+        };
+
+        const auto store = [&]( std::size_t j, std::size_t i, const detail::Vector8& p ) {
+            const std::size_t k = j * count + i;
+            _mm256_storeu_ps( chains.x.data() + k, p.x );
+            _mm256_storeu_ps( chains.y.data() + k, p.y );
+            _mm256_storeu_ps( chains.z.data() + k, p.z );
+        };
+
+        const detail::Vector8 zero { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            const detail::Vector8 target = detail::load8( chains.tx, chains.ty, chains.tz, i );
+            const detail::Vector8 root   = load( 0, i );
+
+            for ( uint32_t iteration = 0; iteration < settings.maxIterations; ++iteration )
+            {
+                const detail::Vector8 e = detail::sub8( load( n, i ), target );
+                if ( _mm256_movemask_ps( _mm256_cmp_ps( detail::dot8( e, e ), tolerance, _CMP_GT_OQ ) ) == 0 )
+                    break;
+
+                // Backward.
+                detail::Vector8 p = target;
+                store( n, i, p );
+                for ( std::size_t j = n; j-- > 0; )
+                {
+                    const detail::Vector8 d = detail::normalizeOr8( detail::sub8( load( j, i ), p ), zero );
+                    p                       = detail::add8( p, detail::mul8( d, _mm256_loadu_ps( chains.lengths.data() + j * count + i ) ) );
+                    store( j, i, p );
+                }
+
+                // Forward.
+                p = root;
+                store( 0, i, p );
+                for ( std::size_t j = 0; j < n; ++j )
+                {
+                    const detail::Vector8 d = detail::normalizeOr8( detail::sub8( load( j + 1, i ), p ), zero );
+                    p                       = detail::add8( p, detail::mul8( d, _mm256_loadu_ps( chains.lengths.data() + j * count + i ) ) );
+                    store( j + 1, i, p );
+                }
+            }
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        const auto load = [&]( std::size_t j ) {
+            const std::size_t k = j * count + i;
+            return Vector<T, 3> { chains.x[k], chains.y[k], chains.z[k] };
+        };
+
+        const auto store = [&]( std::size_t j, const Vector<T, 3>& p ) {
+            const std::size_t k = j * count + i;
+            chains.x[k]         = p.x;
+            chains.y[k]         = p.y;
+            chains.z[k]         = p.z;
+        };
+
+        const Vector<T, 3> target { chains.tx[i], chains.ty[i], chains.tz[i] };
+        const Vector<T, 3> root = load( 0 );
+
+        for ( uint32_t iteration = 0; iteration < settings.maxIterations; ++iteration )
+        {
+            if ( lengthSqr( load( n ) - target ) <= settings.tolerance * settings.tolerance )
+                break;
+
+            Vector<T, 3> p = target;
+            store( n, p );
+            for ( std::size_t j = n; j-- > 0; )
+            {
+                p = p + detail::normalizeOr( load( j ) - p, Vector<T, 3> { T( 0 ) } ) * chains.lengths[j * count + i];
+                store( j, p );
+            }
+
+            p = root;
+            store( 0, p );
+            for ( std::size_t j = 0; j < n; ++j )
+            {
+                p = p + detail::normalizeOr( load( j + 1 ) - p, Vector<T, 3> { T( 0 ) } ) * chains.lengths[j * count + i];
+                store( j + 1, p );
+            }
+        }
+    }
+}
+
+}  // namespace FastMath
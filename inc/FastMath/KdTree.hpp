@@ -0,0 +1,490 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Morton.hpp"
+#include "Simd.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A static k-d tree for nearest neighbor and radius queries over a point cloud.
+/// </summary>
+/// <remarks>
+/// The tree is perfectly balanced: each node splits its range of points at the median along
+/// the axis of largest extent, and the tree is subdivided until each leaf contains at most
+/// `maxLeafSize` points. This allows an implicit layout where the children of node `i` are
+/// `2i + 1` and `2i + 2` and the range of points of a node follows from its position, so
+/// interior nodes only store a split value and an axis.
+///
+/// The points are copied into structure-of-arrays storage in leaf order so that leaves can be
+/// scanned 8 points at a time. All nodes on one level of the tree are split in parallel
+/// using the ThreadPool and the result does not depend on the number of threads.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct KdTree
+{
+    /// <summary>
+    /// The KdTree value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Returned by queries that don't find a point.
+    /// </summary>
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// <summary>
+    /// The maximum depth of the tree (and the size of the traversal stack).
+    /// </summary>
+    static constexpr std::size_t MAX_DEPTH = 32;
+
+    /// <summary>
+    /// Construct an empty tree.
+    /// </summary>
+    KdTree() = default;
+
+    /// <summary>
+    /// Build a tree over a set of points.
+    /// </summary>
+    /// <seealso cref="build"/>
+    /// <param name="points">The points.</param>
+    /// <param name="maxLeafSize">The maximum number of points in a leaf node.</param>
+    /// <param name="pool">The thread pool to use to build the tree.</param>
+    explicit KdTree( std::span<const Vector<T, 3>> points, std::size_t maxLeafSize = 32, ThreadPool& pool = ThreadPool::getDefault() );
+
+    /// <summary>
+    /// Build (or rebuild) the tree over a set of points.
+    /// </summary>
+    /// <param name="points">The points. The index of a point in this array is the index that is returned by the queries.</param>
+    /// <param name="maxLeafSize">The maximum number of points in a leaf node.</param>
+    /// <param name="pool">The thread pool to use to build the tree.</param>
+    void build( std::span<const Vector<T, 3>> points, std::size_t maxLeafSize = 32, ThreadPool& pool = ThreadPool::getDefault() );
+
+    /// <summary>
+    /// Check to see if the tree is empty.
+    /// </summary>
+    /// <returns>`true` if the tree does not contain any points.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of points in the tree.
+    /// </summary>
+    /// <returns>The number of points in the tree.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the bounds of all of the points in the tree.
+    /// </summary>
+    /// <returns>The bounds of the points, or an empty AABB if the tree is empty.</returns>
+    AABB<T> getBounds() const noexcept;
+
+    /// <summary>
+    /// Find the `k` nearest points to a query point, where `k` is the size of the output spans.
+    /// </summary>
+    /// <param name="p">The query point.</param>
+    /// <param name="indices">Receives the indices of the nearest points, closest first.</param>
+    /// <param name="distancesSqr">Receives the squared distances to the nearest points. Must have the same size as `indices`.</param>
+    /// <param name="maxDistanceSqr">Only points that are closer than this are returned.</param>
+    /// <returns>The number of points that were found (at most `k`).</returns>
+    std::size_t nearest( const Vector<T, 3>& p, std::span<uint32_t> indices, std::span<T> distancesSqr, T maxDistanceSqr = std::numeric_limits<T>::max() ) const noexcept;
+
+    /// <summary>
+    /// Find the nearest point to a query point.
+    /// </summary>
+    /// <param name="p">The query point.</param>
+    /// <param name="maxDistanceSqr">The maximum squared distance to search. Receives the squared distance to the nearest point.</param>
+    /// <returns>The index of the nearest point, or `INVALID_INDEX` if no point is closer than `maxDistanceSqr`.</returns>
+    uint32_t nearest( const Vector<T, 3>& p, T& maxDistanceSqr ) const noexcept;
+
+    /// <summary>
+    /// Find the `k` nearest points for a batch of query points.
+    /// </summary>
+    /// <remarks>
+    /// The queries are processed in Morton order so that consecutive queries visit the same
+    /// nodes of the tree, and the batch is distributed over the ThreadPool. The results are
+    /// written in the order of the queries. Unused slots (when fewer than `k` points are within
+    /// `maxDistanceSqr`) receive `INVALID_INDEX` and `std::numeric_limits&lt;T&gt;::max()`.
+    /// </remarks>
+    /// <param name="queries">The query points.</param>
+    /// <param name="k">The number of neighbors per query.</param>
+    /// <param name="indices">Receives `k` indices per query.</param>
+    /// <param name="distancesSqr">Receives `k` squared distances per query.</param>
+    /// <param name="maxDistanceSqr">Only points that are closer than this are returned.</param>
+    /// <param name="pool">The thread pool to use.</param>
+    void nearest( std::span<const Vector<T, 3>> queries, std::size_t k, std::span<uint32_t> indices, std::span<T> distancesSqr, T maxDistanceSqr = std::numeric_limits<T>::max(), ThreadPool& pool = ThreadPool::getDefault() ) const;
+
+    /// <summary>
+    /// Find all points within a radius of a query point.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `void( uint32_t index, T distanceSqr )`.</typeparam>
+    /// <param name="p">The query point.</param>
+    /// <param name="r">The search radius.</param>
+    /// <param name="f">Invoked for each point that is within the radius (in no particular order).</param>
+    template<typename F>
+    void radius( const Vector<T, 3>& p, T r, F&& f ) const;
+
+private:
+    // The range of points in the subtree of a node.
+    struct Range
+    {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    struct StackEntry
+    {
+        uint32_t node;
+        Range    range;
+        T        distanceSqr;
+    };
+
+    // Scan a leaf and invoke f( i, distanceSqr ) for each point (in leaf order) that is closer than maxDistanceSqr.
+    template<typename F>
+    void scanLeaf( const Vector<T, 3>& p, Range range, const T& maxDistanceSqr, F&& f ) const noexcept;
+
+    // Depth-first traversal, near child first. `maxDistanceSqr` may shrink during the traversal.
+    template<typename F>
+    void traverse( const Vector<T, 3>& p, const T& maxDistanceSqr, F&& f ) const noexcept;
+
+    std::size_t           depth = 0;
+    AABB<T>               bounds;
+    std::vector<T>        splits;
+    std::vector<uint8_t>  axes;
+    std::vector<T>        x, y, z;
+    std::vector<uint32_t> indices;
+};
+
+using KdTreef = KdTree<float>;
+using KdTreed = KdTree<double>;
+
+template<typename T>
+KdTree<T>::KdTree( std::span<const Vector<T, 3>> points, std::size_t maxLeafSize, ThreadPool& pool )
+{
+    build( points, maxLeafSize, pool );
+}
+
+template<typename T>
+void KdTree<T>::build( std::span<const Vector<T, 3>> points, std::size_t maxLeafSize, ThreadPool& pool )
+{
+    assert( points.size() < INVALID_INDEX );
+
+    const auto count = static_cast<uint32_t>( points.size() );
+    maxLeafSize      = std::max<std::size_t>( maxLeafSize, 1 );
+
+    // The number of levels such that halving the points `depth` times gives leaves that are no larger than maxLeafSize.
+    depth = 0;
+    while ( depth < MAX_DEPTH && ( ( static_cast<std::size_t>( count ) + ( std::size_t( 1 ) << depth ) - 1 ) >> depth ) > maxLeafSize )
+        ++depth;
+
+    const std::size_t interiorCount = ( std::size_t( 1 ) << depth ) - 1;
+    splits.resize( count > 0 ? interiorCount : 0 );
+    axes.resize( count > 0 ? interiorCount : 0 );
+
+    indices.resize( count );
+
+    bounds = AABB<T> {};
+    for ( const auto& p: points )
+        bounds = merge( bounds, p );
+
+    if ( count == 0 )
+    {
+        x.clear();
+        y.clear();
+        z.clear();
+        return;
+    }
+
+    // The points are partitioned by value (rather than through an index array) so that the
+    // median selection works on contiguous memory.
+    struct Item
+    {
+        Vector<T, 3> p;
+        uint32_t     index;
+    };
+
+    std::vector<Item> items( count );
+    pool.parallelFor( 0, count, 1 << 14, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+            items[i] = { points[i], static_cast<uint32_t>( i ) };
+    } );
+
+    // Split all nodes of a level in parallel. The ranges of the next level are the halves of
+    // the ranges of this level.
+    std::vector<uint32_t> ranges { 0, count };
+    std::vector<uint32_t> next;
+
+    for ( std::size_t level = 0; level < depth; ++level )
+    {
+        const std::size_t levelCount = std::size_t( 1 ) << level;
+        const std::size_t first      = levelCount - 1;
+
+        pool.parallelFor( 0, levelCount, 1, [&]( std::size_t b, std::size_t e ) {
+            for ( std::size_t n = b; n < e; ++n )
+            {
+                const uint32_t begin = ranges[n];
+                const uint32_t end   = ranges[n + 1];
+                const uint32_t mid   = begin + ( end - begin ) / 2;
+
+                AABB<T> box;
+                for ( uint32_t i = begin; i < end; ++i )
+                    box = merge( box, items[i].p );
+
+                const Vector<T, 3> ext  = box.max - box.min;
+                const uint8_t      axis = ext.x >= ext.y && ext.x >= ext.z ? 0 : ( ext.y >= ext.z ? 1 : 2 );
+
+                // Ties are broken by index so that the partition is a strict weak ordering.
+                std::nth_element( items.begin() + begin, items.begin() + mid, items.begin() + end, [axis]( const Item& a, const Item& b ) {
+                    return a.p[axis] < b.p[axis] || ( a.p[axis] == b.p[axis] && a.index < b.index );
+                } );
+
+                splits[first + n] = items[mid].p[axis];
+                axes[first + n]   = axis;
+            }
+        } );
+
+        next.resize( levelCount * 2 + 1 );
+        for ( std::size_t n = 0; n < levelCount; ++n )
+        {
+            next[n * 2]     = ranges[n];
+            next[n * 2 + 1] = ranges[n] + ( ranges[n + 1] - ranges[n] ) / 2;
+        }
+        next[levelCount * 2] = count;
+        std::swap( ranges, next );
+    }
+
+    // Copy the points to SoA storage in leaf order.
+    x.resize( count );
+    y.resize( count );
+    z.resize( count );
+
+    pool.parallelFor( 0, count, 1 << 14, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+        {
+            x[i]       = items[i].p.x;
+            y[i]       = items[i].p.y;
+            z[i]       = items[i].p.z;
+            indices[i] = items[i].index;
+        }
+    } );
+}
+
+template<typename T>
+bool KdTree<T>::empty() const noexcept
+{
+    return indices.empty();
+}
+
+template<typename T>
+std::size_t KdTree<T>::size() const noexcept
+{
+    return indices.size();
+}
+
+template<typename T>
+AABB<T> KdTree<T>::getBounds() const noexcept
+{
+    return bounds;
+}
+
+template<typename T>
+template<typename F>
+void KdTree<T>::scanLeaf( const Vector<T, 3>& p, Range range, const T& maxDistanceSqr, F&& f ) const noexcept
+{
+    uint32_t i = range.begin;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 qx = _mm256_set1_ps( p.x );
+        const __m256 qy = _mm256_set1_ps( p.y );
+        const __m256 qz = _mm256_set1_ps( p.z );
+
+        for ( ; i + Simd::WIDTH <= range.end; i += Simd::WIDTH )
+        {
+            const __m256 dx = _mm256_sub_ps( _mm256_loadu_ps( x.data() + i ), qx );
+            const __m256 dy = _mm256_sub_ps( _mm256_loadu_ps( y.data() + i ), qy );
+            const __m256 dz = _mm256_sub_ps( _mm256_loadu_ps( z.data() + i ), qz );
+
+            __m256 d = _mm256_mul_ps( dx, dx );
+            d        = _mm256_add_ps( d, _mm256_mul_ps( dy, dy ) );
+            d        = _mm256_add_ps( d, _mm256_mul_ps( dz, dz ) );
+
+            auto mask = static_cast<uint32_t>( _mm256_movemask_ps( _mm256_cmp_ps( d, _mm256_set1_ps( maxDistanceSqr ), _CMP_LT_OQ ) ) );
+            if ( mask == 0 )
+                continue;
+
+            alignas( 32 ) float dist[Simd::WIDTH];
+            _mm256_store_ps( dist, d );
+
+            while ( mask )
+            {
+                const int lane = std::countr_zero( mask );
+                mask &= mask - 1;
+
+                // The threshold may have been reduced by a previous lane.
+                if ( dist[lane] < maxDistanceSqr )
+                    f( i + lane, dist[lane] );
+            }
+        }
+    }
+#endif
+
+    for ( ; i < range.end; ++i )
+    {
+        const T dx = x[i] - p.x;
+        const T dy = y[i] - p.y;
+        const T dz = z[i] - p.z;
+        const T d  = dx * dx + dy * dy + dz * dz;
+
+        if ( d < maxDistanceSqr )
+            f( i, d );
+    }
+}
+
+template<typename T>
+template<typename F>
+void KdTree<T>::traverse( const Vector<T, 3>& p, const T& maxDistanceSqr, F&& f ) const noexcept
+{
+    if ( empty() )
+        return;
+
+    StackEntry stack[MAX_DEPTH + 1];
+    int        sp = 0;
+
+    stack[sp++] = { 0, { 0, static_cast<uint32_t>( indices.size() ) }, T( 0 ) };
+
+    while ( sp > 0 )
+    {
+        StackEntry entry = stack[--sp];
+        if ( entry.distanceSqr >= maxDistanceSqr )
+            continue;
+
+        // Descend to the leaf that contains the query point, pushing the far children.
+        for ( std::size_t level = std::bit_width( entry.node + 1 ) - 1; level < depth; ++level )
+        {
+            const T        diff = p[axes[entry.node]] - splits[entry.node];
+            const uint32_t mid  = entry.range.begin + ( entry.range.end - entry.range.begin ) / 2;
+
+            const StackEntry left { entry.node * 2 + 1, { entry.range.begin, mid }, entry.distanceSqr };
+            const StackEntry right { entry.node * 2 + 2, { mid, entry.range.end }, entry.distanceSqr };
+
+            StackEntry other = diff < T( 0 ) ? right : left;
+            entry            = diff < T( 0 ) ? left : right;
+
+            other.distanceSqr = std::max( entry.distanceSqr, diff * diff );
+            if ( other.distanceSqr < maxDistanceSqr )
+                stack[sp++] = other;
+        }
+
+        scanLeaf( p, entry.range, maxDistanceSqr, f );
+    }
+}
+
+template<typename T>
+std::size_t KdTree<T>::nearest( const Vector<T, 3>& p, std::span<uint32_t> outIndices, std::span<T> distancesSqr, T maxDistanceSqr ) const noexcept
+{
+    assert( outIndices.size() == distancesSqr.size() );
+
+    const std::size_t k     = outIndices.size();
+    std::size_t       count = 0;
+
+    if ( k == 0 )
+        return 0;
+
+    T threshold = maxDistanceSqr;
+
+    // The results are kept sorted by insertion; k is expected to be small.
+    traverse( p, threshold, [&]( uint32_t i, T d ) {
+        std::size_t j = count < k ? count++ : k - 1;
+        while ( j > 0 && distancesSqr[j - 1] > d )
+        {
+            distancesSqr[j] = distancesSqr[j - 1];
+            outIndices[j]   = outIndices[j - 1];
+            --j;
+        }
+
+        distancesSqr[j] = d;
+        outIndices[j]   = indices[i];
+
+        if ( count == k )
+            threshold = distancesSqr[k - 1];
+    } );
+
+    return count;
+}
+
+template<typename T>
+uint32_t KdTree<T>::nearest( const Vector<T, 3>& p, T& maxDistanceSqr ) const noexcept
+{
+    uint32_t best = INVALID_INDEX;
+
+    traverse( p, maxDistanceSqr, [&]( uint32_t i, T d ) {
+        maxDistanceSqr = d;
+        best           = indices[i];
+    } );
+
+    return best;
+}
+
+template<typename T>
+void KdTree<T>::nearest( std::span<const Vector<T, 3>> queries, std::size_t k, std::span<uint32_t> outIndices, std::span<T> distancesSqr, T maxDistanceSqr, ThreadPool& pool ) const
+{
+    assert( outIndices.size() >= queries.size() * k );
+    assert( distancesSqr.size() >= queries.size() * k );
+
+    // Sort the queries along a Z-order curve.
+    AABB<T> box = bounds;
+    for ( const auto& q: queries )
+        box = merge( box, q );
+
+    std::vector<std::pair<uint32_t, uint32_t>> order( queries.size() );
+    pool.parallelFor( 0, queries.size(), 1 << 14, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+            order[i] = { mortonCode( queries[i], box ), static_cast<uint32_t>( i ) };
+    } );
+
+    std::sort( order.begin(), order.end() );
+
+    pool.parallelFor( 0, queries.size(), 256, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+        {
+            const std::size_t q = order[i].second;
+
+            auto idx  = outIndices.subspan( q * k, k );
+            auto dist = distancesSqr.subspan( q * k, k );
+
+            const std::size_t n = nearest( queries[q], idx, dist, maxDistanceSqr );
+            std::fill( idx.begin() + n, idx.end(), INVALID_INDEX );
+            std::fill( dist.begin() + n, dist.end(), std::numeric_limits<T>::max() );
+        }
+    } );
+}
+
+template<typename T>
+template<typename F>
+void KdTree<T>::radius( const Vector<T, 3>& p, T r, F&& f ) const
+{
+    // Include points that are exactly on the sphere.
+    const T rSqr = std::nextafter( r * r, std::numeric_limits<T>::max() );
+
+    traverse( p, rSqr, [&]( uint32_t i, T d ) {
+        f( indices[i], d );
+    } );
+}
+
+}  // namespace FastMath
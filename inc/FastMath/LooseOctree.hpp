@@ -0,0 +1,445 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "SpatialHash.hpp"
+#include "Sphere.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A loose octree for broad-phase queries over dynamic objects.
+/// </summary>
+/// <remarks>
+/// The bounds of each node are twice the size of its cell, so an object can be stored in the
+/// node whose cell contains the center of the object at the deepest level where the object is
+/// no larger than the cell. The node is computed directly from the bounds of the object
+/// (without descending the tree), so inserting, moving and removing an object is O(maxDepth).
+///
+/// Nodes are created on demand and are stored in a hash map keyed on their level and cell
+/// coordinates, so the memory usage is proportional to the number of occupied nodes rather
+/// than the size of the world. Each node counts the objects in its subtree so that queries
+/// skip empty subtrees. Objects that are outside of the world bounds are stored in the root.
+///
+/// Objects, nodes and the hash table are stored in pooled arrays that are only reallocated
+/// when they grow: once the tree has reached its working size, updates do not allocate.
+/// Nodes whose subtrees become empty are removed from the hash table and recycled, so the
+/// number of nodes follows the objects as they move through the world.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct LooseOctree
+{
+    /// <summary>
+    /// The LooseOctree value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// An invalid object handle.
+    /// </summary>
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// <summary>
+    /// The maximum depth of the tree (the level and the cell coordinates of a node are packed into a 64-bit key).
+    /// </summary>
+    static constexpr uint32_t MAX_DEPTH = 19;
+
+    /// <summary>
+    /// Construct an empty octree.
+    /// </summary>
+    /// <param name="worldBounds">The bounds of the world. The root node is the cube that contains these bounds.</param>
+    /// <param name="maxDepth">The number of levels below the root.</param>
+    explicit LooseOctree( const AABB<T>& worldBounds, uint32_t maxDepth = 8 );
+
+    /// <summary>
+    /// Reserve storage for objects and nodes.
+    /// </summary>
+    /// <param name="numObjects">The number of objects.</param>
+    /// <param name="numNodes">The number of occupied nodes.</param>
+    void reserve( std::size_t numObjects, std::size_t numNodes );
+
+    /// <summary>
+    /// Insert an object.
+    /// </summary>
+    /// <param name="bounds">The bounds of the object.</param>
+    /// <returns>The handle of the object.</returns>
+    uint32_t insert( const AABB<T>& bounds );
+
+    /// <summary>
+    /// Insert a batch of objects.
+    /// </summary>
+    /// <param name="bounds">The bounds of the objects.</param>
+    /// <param name="handles">Receives the handle of each object. Must have the same size as `bounds`.</param>
+    void insert( std::span<const AABB<T>> bounds, std::span<uint32_t> handles );
+
+    /// <summary>
+    /// Update the bounds of an object.
+    /// </summary>
+    /// <param name="handle">The handle of the object.</param>
+    /// <param name="bounds">The new bounds of the object.</param>
+    void update( uint32_t handle, const AABB<T>& bounds );
+
+    /// <summary>
+    /// Remove an object. The handle may be reused by subsequent insertions.
+    /// </summary>
+    /// <param name="handle">The handle of the object.</param>
+    void remove( uint32_t handle ) noexcept;
+
+    /// <summary>
+    /// Remove all objects (and nodes) while keeping the allocated storage.
+    /// </summary>
+    void clear() noexcept;
+
+    /// <summary>
+    /// Get the number of objects in the octree.
+    /// </summary>
+    /// <returns>The number of objects.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the number of nodes in the octree.
+    /// </summary>
+    /// <returns>The number of nodes that contain at least one object in their subtree.</returns>
+    std::size_t getNodeCount() const noexcept;
+
+    /// <summary>
+    /// Get the bounds of an object.
+    /// </summary>
+    /// <param name="handle">The handle of the object.</param>
+    /// <returns>The bounds of the object.</returns>
+    const AABB<T>& getBounds( uint32_t handle ) const noexcept;
+
+    /// <summary>
+    /// Find all objects whose bounds overlap an AABB.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `void( uint32_t handle )`.</typeparam>
+    /// <param name="box">The AABB to test.</param>
+    /// <param name="f">Invoked for each object that overlaps the box.</param>
+    template<typename F>
+    void query( const AABB<T>& box, F&& f ) const;
+
+    /// <summary>
+    /// Find all objects whose bounds overlap a sphere.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `void( uint32_t handle )`.</typeparam>
+    /// <param name="sphere">The sphere to test.</param>
+    /// <param name="f">Invoked for each object that overlaps the sphere.</param>
+    template<typename F>
+    void query( const Sphere<T>& sphere, F&& f ) const;
+
+private:
+    struct Node
+    {
+        // The first object in the node (or the next free node, for recycled nodes).
+        uint32_t head;
+        // The number of objects in this node and its descendants.
+        uint32_t subtreeCount;
+    };
+
+    struct Location
+    {
+        uint32_t           level;
+        Vector<int32_t, 3> cell;
+    };
+
+    // The cell coordinates at level L have L bits, so each takes MAX_DEPTH bits of the key,
+    // and the level takes the bits above them.
+    static constexpr uint32_t LEVEL_BITS = 5;
+    static_assert( MAX_DEPTH < ( 1u << LEVEL_BITS ) && 3 * MAX_DEPTH + LEVEL_BITS <= 64, "Node keys must be unique." );
+
+    static constexpr uint64_t key( const Location& l ) noexcept
+    {
+        return ( static_cast<uint64_t>( l.level ) << ( 3 * MAX_DEPTH ) ) | ( static_cast<uint64_t>( l.cell.x ) << ( 2 * MAX_DEPTH ) ) |
+               ( static_cast<uint64_t>( l.cell.y ) << MAX_DEPTH ) | static_cast<uint64_t>( l.cell.z );
+    }
+
+    Location locate( const AABB<T>& bounds ) const noexcept;
+    uint32_t getOrCreateNode( const Location& l );
+    uint32_t addToSubtrees( Location l );
+    void     removeFromSubtrees( Location l ) noexcept;
+
+    Vector<T, 3> origin;
+    T            rootSize;
+    uint32_t     maxDepth;
+
+    detail::ObjectPool<T> objects;
+    detail::CellMap       map;
+    std::vector<Node>     nodes;
+    std::vector<Location> locations;  // The location of each node.
+    uint32_t              freeNodes     = INVALID_INDEX;
+    std::size_t           freeNodeCount = 0;
+};
+
+using LooseOctreef = LooseOctree<float>;
+using LooseOctreed = LooseOctree<double>;
+
+template<typename T>
+LooseOctree<T>::LooseOctree( const AABB<T>& worldBounds, uint32_t maxDepth )
+: maxDepth { std::min( maxDepth, MAX_DEPTH ) }
+{
+    const Vector<T, 3> e = worldBounds.max - worldBounds.min;
+
+    origin   = worldBounds.min;
+    rootSize = std::max( { e.x, e.y, e.z, std::numeric_limits<T>::min() } );
+}
+
+template<typename T>
+void LooseOctree<T>::reserve( std::size_t numObjects, std::size_t numNodes )
+{
+    objects.reserve( numObjects );
+    nodes.reserve( numNodes );
+    locations.reserve( numNodes );
+    map.reserve( numNodes );
+}
+
+template<typename T>
+auto LooseOctree<T>::locate( const AABB<T>& bounds ) const noexcept -> Location
+{
+    const Vector<T, 3> c = ( center( bounds ) - origin ) / rootSize;
+    const Vector<T, 3> e = ( bounds.max - bounds.min ) / rootSize;
+    const T            m = std::max( { e.x, e.y, e.z } );
+
+    // Outside of the world: store in the root.
+    if ( c.x < T( 0 ) || c.y < T( 0 ) || c.z < T( 0 ) || c.x >= T( 1 ) || c.y >= T( 1 ) || c.z >= T( 1 ) )
+        return { 0, { 0, 0, 0 } };
+
+    // The deepest level where the object is no larger than the cell size (half the loose node size).
+    uint32_t level = 0;
+    T        cell  = T( 0.5 );
+    while ( level < maxDepth && m <= cell )
+    {
+        ++level;
+        cell *= T( 0.5 );
+    }
+
+    const T                  n   = static_cast<T>( 1u << level );
+    const auto               max = static_cast<int32_t>( ( 1u << level ) - 1 );
+    const Vector<int32_t, 3> xyz {
+        std::min( static_cast<int32_t>( c.x * n ), max ),
+        std::min( static_cast<int32_t>( c.y * n ), max ),
+        std::min( static_cast<int32_t>( c.z * n ), max )
+    };
+
+    return { level, xyz };
+}
+
+template<typename T>
+uint32_t LooseOctree<T>::getOrCreateNode( const Location& l )
+{
+    const uint64_t k    = key( l );
+    uint32_t       node = map.find( k );
+    if ( node == detail::CellMap::INVALID_INDEX )
+    {
+        if ( freeNodes != INVALID_INDEX )
+        {
+            node      = freeNodes;
+            freeNodes = nodes[node].head;
+            --freeNodeCount;
+
+            nodes[node]     = { INVALID_INDEX, 0 };
+            locations[node] = l;
+        }
+        else
+        {
+            node = static_cast<uint32_t>( nodes.size() );
+            nodes.push_back( { INVALID_INDEX, 0 } );
+            locations.push_back( l );
+        }
+
+        map.insert( k, node );
+    }
+
+    return node;
+}
+
+// Count an object in the subtrees of a node and its ancestors (creating them as needed).
+// Returns the node at location `l`.
+template<typename T>
+uint32_t LooseOctree<T>::addToSubtrees( Location l )
+{
+    const uint32_t node = getOrCreateNode( l );
+    for ( ;; )
+    {
+        ++nodes[getOrCreateNode( l )].subtreeCount;
+        if ( l.level == 0 )
+            break;
+
+        l = { l.level - 1, { l.cell.x >> 1, l.cell.y >> 1, l.cell.z >> 1 } };
+    }
+
+    return node;
+}
+
+// Remove an object from the subtree counts of a node and its ancestors, and recycle the nodes whose
+// subtrees become empty. Free nodes are linked through `head`, so this does not allocate.
+template<typename T>
+void LooseOctree<T>::removeFromSubtrees( Location l ) noexcept
+{
+    for ( ;; )
+    {
+        const uint64_t k    = key( l );
+        const uint32_t node = map.find( k );
+        if ( --nodes[node].subtreeCount == 0 )
+        {
+            assert( nodes[node].head == INVALID_INDEX );
+
+            map.erase( k );
+            nodes[node].head = freeNodes;
+            freeNodes        = node;
+            ++freeNodeCount;
+        }
+
+        if ( l.level == 0 )
+            break;
+
+        l = { l.level - 1, { l.cell.x >> 1, l.cell.y >> 1, l.cell.z >> 1 } };
+    }
+}
+
+template<typename T>
+uint32_t LooseOctree<T>::insert( const AABB<T>& bounds )
+{
+    const uint32_t h    = objects.alloc( bounds );
+    const uint32_t node = addToSubtrees( locate( bounds ) );
+    objects.link( h, node, nodes[node].head );
+
+    return h;
+}
+
+template<typename T>
+void LooseOctree<T>::insert( std::span<const AABB<T>> bounds, std::span<uint32_t> handles )
+{
+    assert( handles.size() >= bounds.size() );
+
+    objects.reserve( objects.bounds.size() + bounds.size() );
+
+    for ( std::size_t i = 0; i < bounds.size(); ++i )
+        handles[i] = insert( bounds[i] );
+}
+
+template<typename T>
+void LooseOctree<T>::update( uint32_t handle, const AABB<T>& bounds )
+{
+    assert( objects.cell[handle] != INVALID_INDEX );
+
+    objects.bounds[handle] = bounds;
+
+    const uint32_t prev         = objects.cell[handle];
+    const Location prevLocation = locations[prev];
+    const Location l            = locate( bounds );
+    if ( l.level == prevLocation.level && l.cell == prevLocation.cell )
+        return;
+
+    // Count the object in its new subtrees first, so that the common ancestors are not recycled.
+    const uint32_t node = addToSubtrees( l );
+    objects.unlink( handle, nodes[prev].head );
+    objects.link( handle, node, nodes[node].head );
+    removeFromSubtrees( prevLocation );
+}
+
+template<typename T>
+void LooseOctree<T>::remove( uint32_t handle ) noexcept
+{
+    assert( objects.cell[handle] != INVALID_INDEX );
+
+    const uint32_t node = objects.cell[handle];
+    objects.unlink( handle, nodes[node].head );
+    objects.release( handle );
+    removeFromSubtrees( locations[node] );
+}
+
+template<typename T>
+void LooseOctree<T>::clear() noexcept
+{
+    objects.clear();
+    map.clear();
+    nodes.clear();
+    locations.clear();
+    freeNodes     = INVALID_INDEX;
+    freeNodeCount = 0;
+}
+
+template<typename T>
+std::size_t LooseOctree<T>::size() const noexcept
+{
+    return objects.count;
+}
+
+template<typename T>
+std::size_t LooseOctree<T>::getNodeCount() const noexcept
+{
+    return nodes.size() - freeNodeCount;
+}
+
+template<typename T>
+const AABB<T>& LooseOctree<T>::getBounds( uint32_t handle ) const noexcept
+{
+    return objects.bounds[handle];
+}
+
+template<typename T>
+template<typename F>
+void LooseOctree<T>::query( const AABB<T>& box, F&& f ) const
+{
+    if ( objects.count == 0 || isEmpty( box ) )
+        return;
+
+    // Depth-first traversal; at most 7 siblings are pending per level.
+    Location stack[MAX_DEPTH * 7 + 8];
+    int      sp = 0;
+
+    stack[sp++] = { 0, { 0, 0, 0 } };
+
+    while ( sp > 0 )
+    {
+        const Location l    = stack[--sp];
+        const uint32_t node = map.find( key( l ) );
+        if ( node == detail::CellMap::INVALID_INDEX || nodes[node].subtreeCount == 0 )
+            continue;
+
+        // The root also contains the objects that are outside of the world, so it is always visited.
+        if ( l.level > 0 )
+        {
+            const T            cell = rootSize / static_cast<T>( 1u << l.level );
+            const Vector<T, 3> lo   = origin + Vector<T, 3> { static_cast<T>( l.cell.x ), static_cast<T>( l.cell.y ), static_cast<T>( l.cell.z ) } * cell;
+            const Vector<T, 3> half { cell * T( 0.5 ) };
+
+            if ( !intersects( AABB<T> { lo - half, lo + Vector<T, 3> { cell } + half }, box ) )
+                continue;
+        }
+
+        for ( uint32_t h = nodes[node].head; h != INVALID_INDEX; h = objects.next[h] )
+        {
+            if ( intersects( objects.bounds[h], box ) )
+                f( h );
+        }
+
+        if ( l.level < maxDepth )
+        {
+            for ( int32_t i = 0; i < 8; ++i )
+                stack[sp++] = { l.level + 1, { l.cell.x * 2 + ( i & 1 ), l.cell.y * 2 + ( ( i >> 1 ) & 1 ), l.cell.z * 2 + ( i >> 2 ) } };
+        }
+    }
+}
+
+template<typename T>
+template<typename F>
+void LooseOctree<T>::query( const Sphere<T>& sphere, F&& f ) const
+{
+    query( toAABB( sphere ), [&]( uint32_t h ) {
+        if ( intersects( sphere, objects.bounds[h] ) )
+            f( h );
+    } );
+}
+
+}  // namespace FastMath
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ClipSpace.hpp"
 #include "MatrixBase.hpp"
 
 #include <cassert>
@@ -976,6 +977,93 @@ constexpr Matrix<T, N, M> inverse( const Matrix<T, N, M>& m ) noexcept
     return Matrix_Inverse<T, N, M>::inverse( m );
 }
 
+/// <summary>
+/// Compute the eigenvalues and eigenvectors of a symmetric matrix using the cyclic Jacobi method.
+/// </summary>
+/// <remarks>
+/// The eigenvalues are sorted in descending order and the \f(i^{th}\f) column of `eigenVectors`
+/// is the (normalized) eigenvector of the \f(i^{th}\f) eigenvalue. Only the upper triangle of `m`
+/// is assumed to be meaningful but `m` should be symmetric.
+/// </remarks>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <typeparam name="N">The number of rows and columns of the matrix.</typeparam>
+/// <param name="m">The symmetric matrix.</param>
+/// <param name="eigenValues">Receives the eigenvalues of the matrix.</param>
+/// <param name="eigenVectors">Receives the eigenvectors of the matrix (as columns).</param>
+/// <param name="maxSweeps">The maximum number of sweeps over the off-diagonal elements.</param>
+template<typename T, std::size_t N>
+constexpr void eigenSymmetric( const Matrix<T, N, N>& m, Vector<T, N>& eigenValues, Matrix<T, N, N>& eigenVectors, int maxSweeps = 32 ) noexcept
+{
+    Matrix<T, N, N> a = m;
+    Matrix<T, N, N> v = Matrix<T, N, N>::IDENTITY;
+
+    for ( int sweep = 0; sweep < maxSweeps; ++sweep )
+    {
+        T off = T( 0 );
+        for ( std::size_t p = 0; p < N; ++p )
+            for ( std::size_t q = p + 1; q < N; ++q )
+                off += a[p][q] * a[p][q];
+
+        if ( off <= std::numeric_limits<T>::min() )
+            break;
+
+        for ( std::size_t p = 0; p < N; ++p )
+        {
+            for ( std::size_t q = p + 1; q < N; ++q )
+            {
+                if ( std::abs( a[p][q] ) <= std::numeric_limits<T>::min() )
+                    continue;
+
+                // Find the rotation that eliminates a[p][q].
+                const T theta = ( a[q][q] - a[p][p] ) / ( T( 2 ) * a[p][q] );
+                const T t     = ( theta >= T( 0 ) ? T( 1 ) : T( -1 ) ) / ( std::abs( theta ) + std::sqrt( theta * theta + T( 1 ) ) );
+                const T c     = T( 1 ) / std::sqrt( t * t + T( 1 ) );
+                const T s     = t * c;
+
+                for ( std::size_t k = 0; k < N; ++k )
+                {
+                    const T akp = a[k][p];
+                    const T akq = a[k][q];
+                    a[k][p]     = c * akp - s * akq;
+                    a[k][q]     = s * akp + c * akq;
+                }
+
+                for ( std::size_t k = 0; k < N; ++k )
+                {
+                    const T apk = a[p][k];
+                    const T aqk = a[q][k];
+                    a[p][k]     = c * apk - s * aqk;
+                    a[q][k]     = s * apk + c * aqk;
+                }
+
+                for ( std::size_t k = 0; k < N; ++k )
+                {
+                    const T vkp = v[k][p];
+                    const T vkq = v[k][q];
+                    v[k][p]     = c * vkp - s * vkq;
+                    v[k][q]     = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    // Sort the eigenvalues (and eigenvectors) in descending order.
+    std::size_t order[N];
+    for ( std::size_t i = 0; i < N; ++i )
+        order[i] = i;
+
+    for ( std::size_t i = 1; i < N; ++i )
+        for ( std::size_t j = i; j > 0 && a[order[j]][order[j]] > a[order[j - 1]][order[j - 1]]; --j )
+            std::swap( order[j], order[j - 1] );
+
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        eigenValues[i] = a[order[i]][order[i]];
+        for ( std::size_t k = 0; k < N; ++k )
+            eigenVectors[k][i] = v[k][order[i]];
+    }
+}
+
 /// <summary>
 /// Construct a 4x4 translation matrix.
 /// \f[ \mathbf{T}_\mathbf{t} = \begin{bmatrix}
@@ -1124,7 +1212,8 @@ constexpr Matrix<T, 4, 4> rotateZ( T angle ) noexcept
 template<typename T>
 constexpr Matrix<T, 4, 4> rotateAxisAngle( const Vector<T, 3>& axis, T angle ) noexcept
 {
-    assert( ( "Axis must be normalized", isNormalized( axis ) ) );
+    // Allow for the rounding error of normalize().
+    assert( ( "Axis must be normalized", isNormalized( axis, T( 8 ) * EPSILON<T> ) ) );
 
     const T c  = std::cos( angle );
     const T s  = std::sin( angle );
@@ -1320,6 +1409,161 @@ constexpr Matrix<T, 4, 4> frustum( T l, T r, T b, T t, T n, T f ) noexcept
 #endif
 }
 
+/// <summary>
+/// Create the inverse of a left-handed frustum projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2n} & 0 & 0 & \frac{r+l}{2n} \\
+/// 0 & \frac{t-b}{2n} & 0 & \frac{t+b}{2n} \\
+/// 0 & 0 & 0 & 1 \\
+/// 0 & 0 & -\frac{f-n}{fn} & \frac{1}{n}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="frustumLH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `frustumLH01( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> frustumLH01Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        ( r - l ) / ( T( 2 ) * n ), T( 0 ), T( 0 ), ( r + l ) / ( T( 2 ) * n ),
+        T( 0 ), ( t - b ) / ( T( 2 ) * n ), T( 0 ), ( t + b ) / ( T( 2 ) * n ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( f * n ), T( 1 ) / n
+    };
+}
+
+/// <summary>
+/// Create the inverse of a left-handed frustum projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2n} & 0 & 0 & \frac{r+l}{2n} \\
+/// 0 & \frac{t-b}{2n} & 0 & \frac{t+b}{2n} \\
+/// 0 & 0 & 0 & 1 \\
+/// 0 & 0 & -\frac{f-n}{2fn} & \frac{f+n}{2fn}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="frustumLH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `frustumLH11( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> frustumLH11Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        ( r - l ) / ( T( 2 ) * n ), T( 0 ), T( 0 ), ( r + l ) / ( T( 2 ) * n ),
+        T( 0 ), ( t - b ) / ( T( 2 ) * n ), T( 0 ), ( t + b ) / ( T( 2 ) * n ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( T( 2 ) * f * n ), ( f + n ) / ( T( 2 ) * f * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed frustum projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2n} & 0 & 0 & \frac{r+l}{2n} \\
+/// 0 & \frac{t-b}{2n} & 0 & \frac{t+b}{2n} \\
+/// 0 & 0 & 0 & -1 \\
+/// 0 & 0 & -\frac{f-n}{fn} & \frac{1}{n}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="frustumRH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `frustumRH01( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> frustumRH01Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        ( r - l ) / ( T( 2 ) * n ), T( 0 ), T( 0 ), ( r + l ) / ( T( 2 ) * n ),
+        T( 0 ), ( t - b ) / ( T( 2 ) * n ), T( 0 ), ( t + b ) / ( T( 2 ) * n ),
+        T( 0 ), T( 0 ), T( 0 ), T( -1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( f * n ), T( 1 ) / n
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed frustum projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2n} & 0 & 0 & \frac{r+l}{2n} \\
+/// 0 & \frac{t-b}{2n} & 0 & \frac{t+b}{2n} \\
+/// 0 & 0 & 0 & -1 \\
+/// 0 & 0 & -\frac{f-n}{2fn} & \frac{f+n}{2fn}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="frustumRH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `frustumRH11( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> frustumRH11Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        ( r - l ) / ( T( 2 ) * n ), T( 0 ), T( 0 ), ( r + l ) / ( T( 2 ) * n ),
+        T( 0 ), ( t - b ) / ( T( 2 ) * n ), T( 0 ), ( t + b ) / ( T( 2 ) * n ),
+        T( 0 ), T( 0 ), T( 0 ), T( -1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( T( 2 ) * f * n ), ( f + n ) / ( T( 2 ) * f * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a frustum projection matrix using the default configuration based on the value
+/// of `LS_DEPTH_RANGE` and `LS_HANDEDNESS`
+/// </summary>
+/// <seealso cref="frustum"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `frustum( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> frustumInverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+#if LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return frustumLH01Inverse( l, r, b, t, n, f );
+#elif LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return frustumLH11Inverse( l, r, b, t, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return frustumRH01Inverse( l, r, b, t, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return frustumRH11Inverse( l, r, b, t, n, f );
+#endif
+}
+
 /// <summary>
 /// Creates a left-handed orthographic projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
 /// \f[ \mathbf{P}_{0,1} = \begin{bmatrix}
@@ -1490,6 +1734,149 @@ constexpr Matrix<T, 4, 4> orthographic( T l, T r, T b, T t, T n, T f ) noexcept
 #endif
 }
 
+/// <summary>
+/// Create the inverse of a left-handed orthographic projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2} & 0 & 0 & \frac{r+l}{2} \\
+/// 0 & \frac{t-b}{2} & 0 & \frac{t+b}{2} \\
+/// 0 & 0 & f-n & n \\
+/// 0 & 0 & 0 & 1
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="orthographicLH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `orthographicLH01( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> orthographicLH01Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    return {
+        ( r - l ) * T( 0.5 ), T( 0 ), T( 0 ), ( r + l ) * T( 0.5 ),
+        T( 0 ), ( t - b ) * T( 0.5 ), T( 0 ), ( t + b ) * T( 0.5 ),
+        T( 0 ), T( 0 ), f - n, n,
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a left-handed orthographic projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2} & 0 & 0 & \frac{r+l}{2} \\
+/// 0 & \frac{t-b}{2} & 0 & \frac{t+b}{2} \\
+/// 0 & 0 & \frac{f-n}{2} & \frac{f+n}{2} \\
+/// 0 & 0 & 0 & 1
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="orthographicLH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `orthographicLH11( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> orthographicLH11Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    return {
+        ( r - l ) * T( 0.5 ), T( 0 ), T( 0 ), ( r + l ) * T( 0.5 ),
+        T( 0 ), ( t - b ) * T( 0.5 ), T( 0 ), ( t + b ) * T( 0.5 ),
+        T( 0 ), T( 0 ), ( f - n ) * T( 0.5 ), ( f + n ) * T( 0.5 ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed orthographic projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2} & 0 & 0 & \frac{r+l}{2} \\
+/// 0 & \frac{t-b}{2} & 0 & \frac{t+b}{2} \\
+/// 0 & 0 & -(f-n) & -n \\
+/// 0 & 0 & 0 & 1
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="orthographicRH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `orthographicRH01( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> orthographicRH01Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    return {
+        ( r - l ) * T( 0.5 ), T( 0 ), T( 0 ), ( r + l ) * T( 0.5 ),
+        T( 0 ), ( t - b ) * T( 0.5 ), T( 0 ), ( t + b ) * T( 0.5 ),
+        T( 0 ), T( 0 ), n - f, -n,
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed orthographic projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// \frac{r-l}{2} & 0 & 0 & \frac{r+l}{2} \\
+/// 0 & \frac{t-b}{2} & 0 & \frac{t+b}{2} \\
+/// 0 & 0 & -\frac{f-n}{2} & -\frac{f+n}{2} \\
+/// 0 & 0 & 0 & 1
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="orthographicRH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `orthographicRH11( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> orthographicRH11Inverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    return {
+        ( r - l ) * T( 0.5 ), T( 0 ), T( 0 ), ( r + l ) * T( 0.5 ),
+        T( 0 ), ( t - b ) * T( 0.5 ), T( 0 ), ( t + b ) * T( 0.5 ),
+        T( 0 ), T( 0 ), ( n - f ) * T( 0.5 ), -( f + n ) * T( 0.5 ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Create the inverse of an orthographic projection matrix using the default configuration based on the value
+/// of `LS_DEPTH_RANGE` and `LS_HANDEDNESS`
+/// </summary>
+/// <seealso cref="orthographic"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `orthographic( l, r, b, t, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> orthographicInverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+#if LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return orthographicLH01Inverse( l, r, b, t, n, f );
+#elif LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return orthographicLH11Inverse( l, r, b, t, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return orthographicRH01Inverse( l, r, b, t, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return orthographicRH11Inverse( l, r, b, t, n, f );
+#endif
+}
+
 /// <summary>
 /// Create a left-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
 /// \f[ \mathbf{P}_{0,1} = \begin{bmatrix}
@@ -1659,60 +2046,225 @@ constexpr Matrix<T, 4, 4> perspectiveFoV( T fovy, T aspectRatio, T n, T f ) noex
 }
 
 /// <summary>
-/// Create a left-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
-/// \f[ \mathbf{P}_{0,1} = \begin{bmatrix}
-/// \frac{2n}{w} & 0 & 0 & 0 \\
-/// 0 & \frac{2n}{h} & 0 & 0 \\
-/// 0 & 0 & \frac{f}{f-n} & -\frac{fn}{f-n} \\
-/// 0 & 0 & 1 & 0
+/// Create the inverse of a left-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// a \tan(\theta_{fov}/2) & 0 & 0 & 0 \\
+/// 0 & \tan(\theta_{fov}/2) & 0 & 0 \\
+/// 0 & 0 & 0 & 1 \\
+/// 0 & 0 & -\frac{f-n}{fn} & \frac{1}{n}
 /// \end{bmatrix} \f]
+/// Where:
+/// * \f(a\f) is the aspect ratio
 /// </summary>
+/// <seealso cref="perspectiveFoVLH01"/>
 /// <typeparam name="T">The matrix type.</typeparam>
-/// <param name="w">The frustum width at the near clipping plane in view space.</param>
-/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
 /// <param name="n">The distance to the near clipping plane in view space.</param>
 /// <param name="f">The distance to the far clipping plane in view space.</param>
-/// <returns>A left-handed perspective projection matrix.</returns>
+/// <returns>The inverse of `perspectiveFoVLH01( fovy, aspectRatio, n, f )`.</returns>
 template<typename T>
-constexpr Matrix<T, 4, 4> perspectiveLH01( T w, T h, T n, T f ) noexcept
+constexpr Matrix<T, 4, 4> perspectiveFoVLH01Inverse( T fovy, T aspectRatio, T n, T f ) noexcept
 {
-    assert( std::abs( w ) > EPSILON<T> );
-    assert( std::abs( h ) > EPSILON<T> );
-    assert( std::abs( f - n ) > EPSILON<T> );
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    const T tanHalfFoV = std::tan( fovy * T( 0.5 ) );
 
     return {
-        T( 2 ) * n / w, T( 0 ), T( 0 ), T( 0 ),
-        T( 0 ), T( 2 ) * n / h, T( 0 ), T( 0 ),
-        T( 0 ), T( 0 ), f / ( f - n ), -( f * n ) / ( f - n ),
-        T( 0 ), T( 0 ), T( 1 ), T( 0 )
+        tanHalfFoV * aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), tanHalfFoV, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( f * n ), T( 1 ) / n
     };
 }
 
 /// <summary>
-/// Create a left-handed perspective projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
-/// \f[ \mathbf{P}_{-1,1} = \begin{bmatrix}
-/// \frac{2n}{w} & 0 & 0 & 0 \\
-/// 0 & \frac{2n}{h} & 0 & 0 \\
-/// 0 & 0 & \frac{f+n}{f-n} & -\frac{2fn}{f-n} \\
-/// 0 & 0 & 1 & 0
+/// Create the inverse of a left-handed perspective projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// a \tan(\theta_{fov}/2) & 0 & 0 & 0 \\
+/// 0 & \tan(\theta_{fov}/2) & 0 & 0 \\
+/// 0 & 0 & 0 & 1 \\
+/// 0 & 0 & -\frac{f-n}{2fn} & \frac{f+n}{2fn}
 /// \end{bmatrix} \f]
+/// Where:
+/// * \f(a\f) is the aspect ratio
 /// </summary>
+/// <seealso cref="perspectiveFoVLH11"/>
 /// <typeparam name="T">The matrix type.</typeparam>
-/// <param name="w">The frustum width at the near clipping plane in view space.</param>
-/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
 /// <param name="n">The distance to the near clipping plane in view space.</param>
 /// <param name="f">The distance to the far clipping plane in view space.</param>
-/// <returns>A left-handed perspective projection matrix.</returns>
+/// <returns>The inverse of `perspectiveFoVLH11( fovy, aspectRatio, n, f )`.</returns>
 template<typename T>
-constexpr Matrix<T, 4, 4> perspectiveLH11( T w, T h, T n, T f ) noexcept
+constexpr Matrix<T, 4, 4> perspectiveFoVLH11Inverse( T fovy, T aspectRatio, T n, T f ) noexcept
 {
-    assert( std::abs( w ) > EPSILON<T> );
-    assert( std::abs( h ) > EPSILON<T> );
-    assert( std::abs( f - n ) > EPSILON<T> );
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    const T tanHalfFoV = std::tan( fovy * T( 0.5 ) );
 
     return {
-        T( 2 ) * n / w, T( 0 ), T( 0 ), T( 0 ),
-        T( 0 ), T( 2 ) * n / h, T( 0 ), T( 0 ),
+        tanHalfFoV * aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), tanHalfFoV, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( T( 2 ) * f * n ), ( f + n ) / ( T( 2 ) * f * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// a \tan(\theta_{fov}/2) & 0 & 0 & 0 \\
+/// 0 & \tan(\theta_{fov}/2) & 0 & 0 \\
+/// 0 & 0 & 0 & -1 \\
+/// 0 & 0 & -\frac{f-n}{fn} & \frac{1}{n}
+/// \end{bmatrix} \f]
+/// Where:
+/// * \f(a\f) is the aspect ratio
+/// </summary>
+/// <seealso cref="perspectiveFoVRH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveFoVRH01( fovy, aspectRatio, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoVRH01Inverse( T fovy, T aspectRatio, T n, T f ) noexcept
+{
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    const T tanHalfFoV = std::tan( fovy * T( 0.5 ) );
+
+    return {
+        tanHalfFoV * aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), tanHalfFoV, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( -1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( f * n ), T( 1 ) / n
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed perspective projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// a \tan(\theta_{fov}/2) & 0 & 0 & 0 \\
+/// 0 & \tan(\theta_{fov}/2) & 0 & 0 \\
+/// 0 & 0 & 0 & -1 \\
+/// 0 & 0 & -\frac{f-n}{2fn} & \frac{f+n}{2fn}
+/// \end{bmatrix} \f]
+/// Where:
+/// * \f(a\f) is the aspect ratio
+/// </summary>
+/// <seealso cref="perspectiveFoVRH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveFoVRH11( fovy, aspectRatio, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoVRH11Inverse( T fovy, T aspectRatio, T n, T f ) noexcept
+{
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    const T tanHalfFoV = std::tan( fovy * T( 0.5 ) );
+
+    return {
+        tanHalfFoV * aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), tanHalfFoV, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( -1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( T( 2 ) * f * n ), ( f + n ) / ( T( 2 ) * f * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a perspective projection matrix using the default configuration based on the values
+/// of `LS_HANDEDNESS` and `LS_DEPTH_RANGE`.
+/// </summary>
+/// <seealso cref="perspectiveFoV"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveFoV( fovy, aspectRatio, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoVInverse( T fovy, T aspectRatio, T n, T f ) noexcept
+{
+#if LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return perspectiveFoVLH01Inverse( fovy, aspectRatio, n, f );
+#elif LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return perspectiveFoVLH11Inverse( fovy, aspectRatio, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return perspectiveFoVRH01Inverse( fovy, aspectRatio, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return perspectiveFoVRH11Inverse( fovy, aspectRatio, n, f );
+#endif
+}
+
+/// <summary>
+/// Create a left-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1} = \begin{bmatrix}
+/// \frac{2n}{w} & 0 & 0 & 0 \\
+/// 0 & \frac{2n}{h} & 0 & 0 \\
+/// 0 & 0 & \frac{f}{f-n} & -\frac{fn}{f-n} \\
+/// 0 & 0 & 1 & 0
+/// \end{bmatrix} \f]
+/// </summary>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>A left-handed perspective projection matrix.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveLH01( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( w ) > EPSILON<T> );
+    assert( std::abs( h ) > EPSILON<T> );
+    assert( std::abs( f - n ) > EPSILON<T> );
+
+    return {
+        T( 2 ) * n / w, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), T( 2 ) * n / h, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), f / ( f - n ), -( f * n ) / ( f - n ),
+        T( 0 ), T( 0 ), T( 1 ), T( 0 )
+    };
+}
+
+/// <summary>
+/// Create a left-handed perspective projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1} = \begin{bmatrix}
+/// \frac{2n}{w} & 0 & 0 & 0 \\
+/// 0 & \frac{2n}{h} & 0 & 0 \\
+/// 0 & 0 & \frac{f+n}{f-n} & -\frac{2fn}{f-n} \\
+/// 0 & 0 & 1 & 0
+/// \end{bmatrix} \f]
+/// </summary>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>A left-handed perspective projection matrix.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveLH11( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( w ) > EPSILON<T> );
+    assert( std::abs( h ) > EPSILON<T> );
+    assert( std::abs( f - n ) > EPSILON<T> );
+
+    return {
+        T( 2 ) * n / w, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), T( 2 ) * n / h, T( 0 ), T( 0 ),
         T( 0 ), T( 0 ), ( f + n ) / ( f - n ), -( T( 2 ) * f * n ) / ( f - n ),
         T( 0 ), T( 0 ), T( 1 ), T( 0 )
     };
@@ -1806,6 +2358,151 @@ constexpr Matrix<T, 4, 4> perspective( T w, T h, T n, T f ) noexcept
 #endif
 }
 
+/// <summary>
+/// Create the inverse of a left-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// \frac{w}{2n} & 0 & 0 & 0 \\
+/// 0 & \frac{h}{2n} & 0 & 0 \\
+/// 0 & 0 & 0 & 1 \\
+/// 0 & 0 & -\frac{f-n}{fn} & \frac{1}{n}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="perspectiveLH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveLH01( w, h, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveLH01Inverse( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        w / ( T( 2 ) * n ), T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), h / ( T( 2 ) * n ), T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( f * n ), T( 1 ) / n
+    };
+}
+
+/// <summary>
+/// Create the inverse of a left-handed perspective projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// \frac{w}{2n} & 0 & 0 & 0 \\
+/// 0 & \frac{h}{2n} & 0 & 0 \\
+/// 0 & 0 & 0 & 1 \\
+/// 0 & 0 & -\frac{f-n}{2fn} & \frac{f+n}{2fn}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="perspectiveLH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveLH11( w, h, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveLH11Inverse( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        w / ( T( 2 ) * n ), T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), h / ( T( 2 ) * n ), T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( T( 2 ) * f * n ), ( f + n ) / ( T( 2 ) * f * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed perspective projection matrix that maps depth values to the range \f([0 \ldots 1]\f).
+/// \f[ \mathbf{P}_{0,1}^{-1} = \begin{bmatrix}
+/// \frac{w}{2n} & 0 & 0 & 0 \\
+/// 0 & \frac{h}{2n} & 0 & 0 \\
+/// 0 & 0 & 0 & -1 \\
+/// 0 & 0 & -\frac{f-n}{fn} & \frac{1}{n}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="perspectiveRH01"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveRH01( w, h, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveRH01Inverse( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        w / ( T( 2 ) * n ), T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), h / ( T( 2 ) * n ), T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( -1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( f * n ), T( 1 ) / n
+    };
+}
+
+/// <summary>
+/// Create the inverse of a right-handed perspective projection matrix that maps depth values to the range \f([-1 \ldots 1]\f).
+/// \f[ \mathbf{P}_{-1,1}^{-1} = \begin{bmatrix}
+/// \frac{w}{2n} & 0 & 0 & 0 \\
+/// 0 & \frac{h}{2n} & 0 & 0 \\
+/// 0 & 0 & 0 & -1 \\
+/// 0 & 0 & -\frac{f-n}{2fn} & \frac{f+n}{2fn}
+/// \end{bmatrix} \f]
+/// </summary>
+/// <seealso cref="perspectiveRH11"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveRH11( w, h, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveRH11Inverse( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    return {
+        w / ( T( 2 ) * n ), T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), h / ( T( 2 ) * n ), T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), T( -1 ),
+        T( 0 ), T( 0 ), -( f - n ) / ( T( 2 ) * f * n ), ( f + n ) / ( T( 2 ) * f * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a perspective projection matrix using the default configuration based on the values
+/// of `LS_HANDEDNESS` and `LS_DEPTH_RANGE`.
+/// </summary>
+/// <seealso cref="perspective"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The frustum width at the near clipping plane in view space.</param>
+/// <param name="h">The frustum height at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspective( w, h, n, f )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> perspectiveInverse( T w, T h, T n, T f ) noexcept
+{
+#if LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return perspectiveLH01Inverse( w, h, n, f );
+#elif LS_HANDEDNESS == LS_LEFT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return perspectiveLH11Inverse( w, h, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_ZERO_TO_ONE
+    return perspectiveRH01Inverse( w, h, n, f );
+#elif LS_HANDEDNESS == LS_RIGHT_HANDED && LS_DEPTH_RANGE == LS_NEGATIVE_ONE_TO_ONE
+    return perspectiveRH11Inverse( w, h, n, f );
+#endif
+}
+
 /// <summary>
 /// Build a left-handed view matrix.
 /// </summary>
@@ -1870,6 +2567,73 @@ constexpr Matrix<T, 4, 4> lookAt( const Vector<T, 3>& eye, const Vector<T, 3>& t
 #endif
 }
 
+/// <summary>
+/// Build the inverse of a left-handed look-at view matrix (the camera-to-world transformation).
+/// </summary>
+/// <seealso cref="lookAtLH"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="target">The target to look at.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookAtLH( eye, target, up )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> lookAtLHInverse( const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    const Vector<T, 3> Z( normalize( target - eye ) );
+    const Vector<T, 3> X( normalize( cross( up, Z ) ) );
+    const Vector<T, 3> Y( cross( Z, X ) );
+
+    return {
+        X.x, Y.x, Z.x, eye.x,
+        X.y, Y.y, Z.y, eye.y,
+        X.z, Y.z, Z.z, eye.z,
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Build the inverse of a right-handed look-at view matrix (the camera-to-world transformation).
+/// </summary>
+/// <seealso cref="lookAtRH"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="target">The target to look at.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookAtRH( eye, target, up )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> lookAtRHInverse( const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    const Vector<T, 3> Z( normalize( eye - target ) );
+    const Vector<T, 3> X( normalize( cross( up, Z ) ) );
+    const Vector<T, 3> Y( cross( Z, X ) );
+
+    return {
+        X.x, Y.x, Z.x, eye.x,
+        X.y, Y.y, Z.y, eye.y,
+        X.z, Y.z, Z.z, eye.z,
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Build the inverse of a look-at view matrix depending on the value of `LS_HANDEDNESS`.
+/// </summary>
+/// <seealso cref="lookAt"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="target">The target to look at.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookAt( eye, target, up )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> lookAtInverse( const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+#if LS_HANDEDNESS == LS_LEFT_HANDED
+    return lookAtLHInverse( eye, target, up );
+#else
+    return lookAtRHInverse( eye, target, up );
+#endif
+}
+
 /// <summary>
 /// Build a left-handed view matrix based on the eye position and a look-towards direction.
 /// </summary>
@@ -1934,6 +2698,663 @@ constexpr Matrix<T, 4, 4> lookTo( const Vector<T, 3>& eye, const Vector<T, 3>& d
 #endif
 }
 
+/// <summary>
+/// Build the inverse of a left-handed look-to view matrix (the camera-to-world transformation).
+/// </summary>
+/// <seealso cref="lookToLH"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="direction">The direction the camera is looking.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookToLH( eye, direction, up )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> lookToLHInverse( const Vector<T, 3>& eye, const Vector<T, 3>& direction, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    const Vector<T, 3> Z( normalize( direction ) );
+    const Vector<T, 3> X( normalize( cross( up, Z ) ) );
+    const Vector<T, 3> Y( cross( Z, X ) );
+
+    return {
+        X.x, Y.x, Z.x, eye.x,
+        X.y, Y.y, Z.y, eye.y,
+        X.z, Y.z, Z.z, eye.z,
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Build the inverse of a right-handed look-to view matrix (the camera-to-world transformation).
+/// </summary>
+/// <seealso cref="lookToRH"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="direction">The direction the camera is looking.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookToRH( eye, direction, up )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> lookToRHInverse( const Vector<T, 3>& eye, const Vector<T, 3>& direction, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    const Vector<T, 3> Z( normalize( -direction ) );
+    const Vector<T, 3> X( normalize( cross( up, Z ) ) );
+    const Vector<T, 3> Y( cross( Z, X ) );
+
+    return {
+        X.x, Y.x, Z.x, eye.x,
+        X.y, Y.y, Z.y, eye.y,
+        X.z, Y.z, Z.z, eye.z,
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Build the inverse of a look-to view matrix depending on the value of `LS_HANDEDNESS`.
+/// </summary>
+/// <seealso cref="lookTo"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="direction">The direction the camera is looking.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookTo( eye, direction, up )`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> lookToInverse( const Vector<T, 3>& eye, const Vector<T, 3>& direction, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+#if LS_HANDEDNESS == LS_LEFT_HANDED
+    return lookToLHInverse( eye, direction, up );
+#else
+    return lookToRHInverse( eye, direction, up );
+#endif
+}
+
+/// <summary>
+/// Compute the inverse of a view matrix (any rigid transformation) without knowing the parameters that were used to build it.
+/// \f[ \mathbf{V}^{-1} = \begin{bmatrix}
+/// \mathbf{R}^T & -\mathbf{R}^T\mathbf{t} \\
+/// 0 & 1
+/// \end{bmatrix} \f]
+/// </summary>
+/// <remarks>
+/// The upper 3x3 part of the matrix must be orthonormal (no scale or shear), which is the case for
+/// the matrices returned by `lookAt` and `lookTo`. Use `inverse` for general matrices.
+/// </remarks>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="v">The view matrix.</param>
+/// <returns>The inverse of the view matrix.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> viewInverse( const Matrix<T, 4, 4>& v ) noexcept
+{
+    return {
+        v[0][0], v[1][0], v[2][0], -( v[0][0] * v[0][3] + v[1][0] * v[1][3] + v[2][0] * v[2][3] ),
+        v[0][1], v[1][1], v[2][1], -( v[0][1] * v[0][3] + v[1][1] * v[1][3] + v[2][1] * v[2][3] ),
+        v[0][2], v[1][2], v[2][2], -( v[0][2] * v[0][3] + v[1][2] * v[1][3] + v[2][2] * v[2][3] ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Compute the inverse of a projection matrix without knowing the parameters that were used to build it.
+/// </summary>
+/// <remarks>
+/// All of the frustum, perspective and orthographic projection matrices have the block structure
+/// \f[ \mathbf{P} = \begin{bmatrix}
+/// \mathbf{A} & \mathbf{B} \\
+/// 0 & \mathbf{C}
+/// \end{bmatrix} \f]
+/// where \f( \mathbf{A} \f) is a 2x2 diagonal matrix. The inverse is computed from the blocks as
+/// \f[ \mathbf{P}^{-1} = \begin{bmatrix}
+/// \mathbf{A}^{-1} & -\mathbf{A}^{-1}\mathbf{B}\mathbf{C}^{-1} \\
+/// 0 & \mathbf{C}^{-1}
+/// \end{bmatrix} \f]
+/// which handles both perspective and orthographic projections (for any handedness and depth range) without branching.
+/// </remarks>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="p">The projection matrix.</param>
+/// <returns>The inverse of the projection matrix.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> projectionInverse( const Matrix<T, 4, 4>& p ) noexcept
+{
+    assert( p[0][1] == T( 0 ) && p[1][0] == T( 0 ) );
+    assert( p[2][0] == T( 0 ) && p[2][1] == T( 0 ) && p[3][0] == T( 0 ) && p[3][1] == T( 0 ) );
+
+    const T invA0  = T( 1 ) / p[0][0];
+    const T invA1  = T( 1 ) / p[1][1];
+    const T invDet = T( 1 ) / ( p[2][2] * p[3][3] - p[2][3] * p[3][2] );
+
+    // The inverse of the lower-right 2x2 block.
+    const T c00 = p[3][3] * invDet;
+    const T c01 = -p[2][3] * invDet;
+    const T c10 = -p[3][2] * invDet;
+    const T c11 = p[2][2] * invDet;
+
+    return {
+        invA0, T( 0 ), -( p[0][2] * c00 + p[0][3] * c10 ) * invA0, -( p[0][2] * c01 + p[0][3] * c11 ) * invA0,
+        T( 0 ), invA1, -( p[1][2] * c00 + p[1][3] * c10 ) * invA1, -( p[1][2] * c01 + p[1][3] * c11 ) * invA1,
+        T( 0 ), T( 0 ), c00, c01,
+        T( 0 ), T( 0 ), c10, c11
+    };
+}
+
+/// <summary>
+/// Compute the inverse of a combined view-projection matrix \f( \mathbf{P}\mathbf{V} \f) from its factors.
+/// </summary>
+/// <remarks>
+/// This is used to transform points from clip space (or normalized device coordinates) back to world space,
+/// for example to reconstruct world positions from a depth buffer. It is more accurate and much cheaper than
+/// inverting the combined matrix with `inverse`.
+/// </remarks>
+/// <seealso cref="viewInverse"/>
+/// <seealso cref="projectionInverse"/>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="view">The view matrix (a rigid transformation).</param>
+/// <param name="projection">The projection matrix.</param>
+/// <returns>The inverse of `projection * view`.</returns>
+template<typename T>
+constexpr Matrix<T, 4, 4> viewProjectionInverse( const Matrix<T, 4, 4>& view, const Matrix<T, 4, 4>& projection ) noexcept
+{
+    return viewInverse( view ) * projectionInverse( projection );
+}
+
+/// <summary>
+/// Create a frustum projection matrix for the handedness and depth range of a clip space policy.
+/// </summary>
+/// <remarks>
+/// The near and far clipping planes are mapped to the depth range of the policy (for example,
+/// `DepthRange::OneToZero` creates a reverse-Z projection matrix). The policy is resolved at compile time.
+/// </remarks>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>A frustum projection matrix.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> frustum( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( r - l ) > EPSILON<T> );
+    assert( std::abs( t - b ) > EPSILON<T> );
+    assert( std::abs( f - n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        T( 2 ) * n / ( r - l ), T( 0 ), -s * ( r + l ) / ( r - l ), T( 0 ),
+        T( 0 ), T( 2 ) * n / ( t - b ), -s * ( t + b ) / ( t - b ), T( 0 ),
+        T( 0 ), T( 0 ), s * ( zf * f - zn * n ) / ( f - n ), ( zn - zf ) * n * f / ( f - n ),
+        T( 0 ), T( 0 ), s, T( 0 )
+    };
+}
+
+/// <summary>
+/// Create a frustum projection matrix with the far clipping plane at infinity.
+/// </summary>
+/// <remarks>
+/// This is the limit of `frustum` as the far clipping plane goes to infinity. Combined with
+/// `DepthRange::OneToZero`, this gives the best depth precision for a floating-point depth buffer.
+/// </remarks>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">(optional) The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <returns>A frustum projection matrix with an infinite far clipping plane.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Matrix<T, 4, 4> frustumInfinite( T l, T r, T b, T t, T n ) noexcept
+{
+    assert( std::abs( r - l ) > EPSILON<T> );
+    assert( std::abs( t - b ) > EPSILON<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        T( 2 ) * n / ( r - l ), T( 0 ), -s * ( r + l ) / ( r - l ), T( 0 ),
+        T( 0 ), T( 2 ) * n / ( t - b ), -s * ( t + b ) / ( t - b ), T( 0 ),
+        T( 0 ), T( 0 ), s * zf, ( zn - zf ) * n,
+        T( 0 ), T( 0 ), s, T( 0 )
+    };
+}
+
+/// <summary>
+/// Create an orthographic projection matrix for the handedness and depth range of a clip space policy.
+/// </summary>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>An orthographic projection matrix.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> orthographic( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( r - l ) > EPSILON<T> );
+    assert( std::abs( t - b ) > EPSILON<T> );
+    assert( std::abs( f - n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        T( 2 ) / ( r - l ), T( 0 ), T( 0 ), -( r + l ) / ( r - l ),
+        T( 0 ), T( 2 ) / ( t - b ), T( 0 ), -( t + b ) / ( t - b ),
+        T( 0 ), T( 0 ), s * ( zf - zn ) / ( f - n ), ( zn * f - zf * n ) / ( f - n ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Create a perspective projection matrix for the handedness and depth range of a clip space policy.
+/// </summary>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>A perspective projection matrix.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoV( T fovy, T aspectRatio, T n, T f ) noexcept
+{
+    assert( std::abs( aspectRatio ) > EPSILON<T> );
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( f - n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    const T d = T( 1 ) / std::tan( fovy * T( 0.5 ) );
+
+    return {
+        d / aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), d, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), s * ( zf * f - zn * n ) / ( f - n ), ( zn - zf ) * n * f / ( f - n ),
+        T( 0 ), T( 0 ), s, T( 0 )
+    };
+}
+
+/// <summary>
+/// Create a perspective projection matrix with the far clipping plane at infinity.
+/// </summary>
+/// <seealso cref="frustumInfinite"/>
+/// <typeparam name="P">(optional) The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <returns>A perspective projection matrix with an infinite far clipping plane.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoVInfinite( T fovy, T aspectRatio, T n ) noexcept
+{
+    assert( std::abs( aspectRatio ) > EPSILON<T> );
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    const T d = T( 1 ) / std::tan( fovy * T( 0.5 ) );
+
+    return {
+        d / aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), d, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), s * zf, ( zn - zf ) * n,
+        T( 0 ), T( 0 ), s, T( 0 )
+    };
+}
+
+/// <summary>
+/// Create a perspective projection matrix for the handedness and depth range of a clip space policy.
+/// </summary>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The width of the frustum at the near clipping plane in view space.</param>
+/// <param name="h">The height of the frustum at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>A perspective projection matrix.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> perspective( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( w ) > EPSILON<T> );
+    assert( std::abs( h ) > EPSILON<T> );
+    assert( std::abs( f - n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        T( 2 ) * n / w, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), T( 2 ) * n / h, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), s * ( zf * f - zn * n ) / ( f - n ), ( zn - zf ) * n * f / ( f - n ),
+        T( 0 ), T( 0 ), s, T( 0 )
+    };
+}
+
+/// <summary>
+/// Create a perspective projection matrix with the far clipping plane at infinity.
+/// </summary>
+/// <seealso cref="frustumInfinite"/>
+/// <typeparam name="P">(optional) The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The width of the frustum at the near clipping plane in view space.</param>
+/// <param name="h">The height of the frustum at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <returns>A perspective projection matrix with an infinite far clipping plane.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Matrix<T, 4, 4> perspectiveInfinite( T w, T h, T n ) noexcept
+{
+    assert( std::abs( w ) > EPSILON<T> );
+    assert( std::abs( h ) > EPSILON<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        T( 2 ) * n / w, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), T( 2 ) * n / h, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), s * zf, ( zn - zf ) * n,
+        T( 0 ), T( 0 ), s, T( 0 )
+    };
+}
+
+/// <summary>
+/// Build a view matrix for the handedness of a clip space policy.
+/// </summary>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="target">The target to look at.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>A view matrix.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> lookAt( const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    if constexpr ( P::handedness == Handedness::Left )
+        return lookAtLH( eye, target, up );
+    else
+        return lookAtRH( eye, target, up );
+}
+
+/// <summary>
+/// Build a look-to view matrix for the handedness of a clip space policy.
+/// </summary>
+/// <seealso cref="ClipSpace"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="direction">The direction the camera is looking.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>A look-to view matrix.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> lookTo( const Vector<T, 3>& eye, const Vector<T, 3>& direction, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    if constexpr ( P::handedness == Handedness::Left )
+        return lookToLH( eye, direction, up );
+    else
+        return lookToRH( eye, direction, up );
+}
+
+/// <summary>
+/// Create the inverse of a frustum projection matrix for a clip space policy.
+/// </summary>
+/// <seealso cref="frustumLH01Inverse"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `frustum<P>( l, r, b, t, n, f )`.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> frustumInverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        ( r - l ) / ( T( 2 ) * n ), T( 0 ), T( 0 ), ( r + l ) / ( T( 2 ) * n ),
+        T( 0 ), ( t - b ) / ( T( 2 ) * n ), T( 0 ), ( t + b ) / ( T( 2 ) * n ),
+        T( 0 ), T( 0 ), T( 0 ), s,
+        T( 0 ), T( 0 ), ( f - n ) / ( ( zn - zf ) * n * f ), ( zf * f - zn * n ) / ( ( zf - zn ) * n * f )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a frustum projection matrix with the far clipping plane at infinity.
+/// </summary>
+/// <typeparam name="P">(optional) The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <returns>The inverse of `frustumInfinite<P>( l, r, b, t, n )`.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Matrix<T, 4, 4> frustumInfiniteInverse( T l, T r, T b, T t, T n ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        ( r - l ) / ( T( 2 ) * n ), T( 0 ), T( 0 ), ( r + l ) / ( T( 2 ) * n ),
+        T( 0 ), ( t - b ) / ( T( 2 ) * n ), T( 0 ), ( t + b ) / ( T( 2 ) * n ),
+        T( 0 ), T( 0 ), T( 0 ), s,
+        T( 0 ), T( 0 ), T( 1 ) / ( ( zn - zf ) * n ), zf / ( ( zf - zn ) * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of an orthographic projection matrix for a clip space policy.
+/// </summary>
+/// <seealso cref="orthographicLH01Inverse"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="l">The distance to the left clipping plane in view space.</param>
+/// <param name="r">The distance to the right clipping plane in view space.</param>
+/// <param name="b">The distance to the bottom clipping plane in view space.</param>
+/// <param name="t">The distance to the top clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `orthographic<P>( l, r, b, t, n, f )`.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> orthographicInverse( T l, T r, T b, T t, T n, T f ) noexcept
+{
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        ( r - l ) * T( 0.5 ), T( 0 ), T( 0 ), ( r + l ) * T( 0.5 ),
+        T( 0 ), ( t - b ) * T( 0.5 ), T( 0 ), ( t + b ) * T( 0.5 ),
+        T( 0 ), T( 0 ), s * ( f - n ) / ( zf - zn ), -s * ( zn * f - zf * n ) / ( zf - zn ),
+        T( 0 ), T( 0 ), T( 0 ), T( 1 )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a perspective projection matrix for a clip space policy.
+/// </summary>
+/// <seealso cref="perspectiveFoVLH01Inverse"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveFoV<P>( fovy, aspectRatio, n, f )`.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoVInverse( T fovy, T aspectRatio, T n, T f ) noexcept
+{
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    const T tanHalfFoV = std::tan( fovy * T( 0.5 ) );
+
+    return {
+        tanHalfFoV * aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), tanHalfFoV, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), s,
+        T( 0 ), T( 0 ), ( f - n ) / ( ( zn - zf ) * n * f ), ( zf * f - zn * n ) / ( ( zf - zn ) * n * f )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a perspective projection matrix with the far clipping plane at infinity.
+/// </summary>
+/// <typeparam name="P">(optional) The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="fovy">The vertical field of view (in radians).</param>
+/// <param name="aspectRatio">The aspect ratio of the screen (\f(width/height\f)).</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveFoVInfinite<P>( fovy, aspectRatio, n )`.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Matrix<T, 4, 4> perspectiveFoVInfiniteInverse( T fovy, T aspectRatio, T n ) noexcept
+{
+    assert( std::abs( fovy ) < PI<T> );
+    assert( std::abs( n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    const T tanHalfFoV = std::tan( fovy * T( 0.5 ) );
+
+    return {
+        tanHalfFoV * aspectRatio, T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), tanHalfFoV, T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), s,
+        T( 0 ), T( 0 ), T( 1 ) / ( ( zn - zf ) * n ), zf / ( ( zf - zn ) * n )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a perspective projection matrix for a clip space policy.
+/// </summary>
+/// <seealso cref="perspectiveLH01Inverse"/>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The width of the frustum at the near clipping plane in view space.</param>
+/// <param name="h">The height of the frustum at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <param name="f">The distance to the far clipping plane in view space.</param>
+/// <returns>The inverse of `perspective<P>( w, h, n, f )`.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> perspectiveInverse( T w, T h, T n, T f ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+    assert( std::abs( f ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        w / ( T( 2 ) * n ), T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), h / ( T( 2 ) * n ), T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), s,
+        T( 0 ), T( 0 ), ( f - n ) / ( ( zn - zf ) * n * f ), ( zf * f - zn * n ) / ( ( zf - zn ) * n * f )
+    };
+}
+
+/// <summary>
+/// Create the inverse of a perspective projection matrix with the far clipping plane at infinity.
+/// </summary>
+/// <typeparam name="P">(optional) The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="w">The width of the frustum at the near clipping plane in view space.</param>
+/// <param name="h">The height of the frustum at the near clipping plane in view space.</param>
+/// <param name="n">The distance to the near clipping plane in view space.</param>
+/// <returns>The inverse of `perspectiveInfinite<P>( w, h, n )`.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Matrix<T, 4, 4> perspectiveInfiniteInverse( T w, T h, T n ) noexcept
+{
+    assert( std::abs( n ) > EPSILON<T> );
+
+    constexpr T s  = detail::viewDirection<P, T>();
+    constexpr T zn = detail::nearDepth<P, T>();
+    constexpr T zf = detail::farDepth<P, T>();
+
+    return {
+        w / ( T( 2 ) * n ), T( 0 ), T( 0 ), T( 0 ),
+        T( 0 ), h / ( T( 2 ) * n ), T( 0 ), T( 0 ),
+        T( 0 ), T( 0 ), T( 0 ), s,
+        T( 0 ), T( 0 ), T( 1 ) / ( ( zn - zf ) * n ), zf / ( ( zf - zn ) * n )
+    };
+}
+
+/// <summary>
+/// Build the inverse of a view matrix for the handedness of a clip space policy.
+/// </summary>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="target">The target to look at.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookAt<P>( eye, target, up )`.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> lookAtInverse( const Vector<T, 3>& eye, const Vector<T, 3>& target, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    if constexpr ( P::handedness == Handedness::Left )
+        return lookAtLHInverse( eye, target, up );
+    else
+        return lookAtRHInverse( eye, target, up );
+}
+
+/// <summary>
+/// Build the inverse of a look-to view matrix for the handedness of a clip space policy.
+/// </summary>
+/// <typeparam name="P">The clip space policy.</typeparam>
+/// <typeparam name="T">The matrix type.</typeparam>
+/// <param name="eye">The eye position.</param>
+/// <param name="direction">The direction the camera is looking.</param>
+/// <param name="up">(optional) The up vector (usually {0, 1, 0}).</param>
+/// <returns>The inverse of `lookTo<P>( eye, direction, up )`.</returns>
+template<ClipSpacePolicy P, typename T>
+constexpr Matrix<T, 4, 4> lookToInverse( const Vector<T, 3>& eye, const Vector<T, 3>& direction, const Vector<T, 3>& up = Vector<T, 3>::UNIT_Y )
+{
+    if constexpr ( P::handedness == Handedness::Left )
+        return lookToLHInverse( eye, direction, up );
+    else
+        return lookToRHInverse( eye, direction, up );
+}
+
 template<typename T, ConvertibleTo<T> U, std::size_t N, std::size_t M>
 constexpr Matrix<T, N, M> operator*( U lhs, const Matrix<T, N, M>& rhs ) noexcept
 {
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Simd.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The triangles that reference each vertex of an indexed triangle mesh, stored in compressed
+/// sparse row format.
+/// </summary>
+/// <remarks>
+/// The corners of vertex `v` are `corners[offsets[v]]` to `corners[offsets[v + 1] - 1]`, where a
+/// corner is `triangle * 3 + k`. Corners are always sorted in ascending order, which makes any
+/// per-vertex accumulation over the corners independent of the number of threads.
+/// </remarks>
+struct VertexAdjacency
+{
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> corners;
+
+    /// <summary>
+    /// Build the adjacency of a mesh.
+    /// </summary>
+    /// <param name="vertexCount">The number of vertices in the mesh.</param>
+    /// <param name="indices">The vertex indices (3 per triangle).</param>
+    VertexAdjacency( std::size_t vertexCount, std::span<const uint32_t> indices )
+    : offsets( vertexCount + 1, 0 )
+    , corners( indices.size() )
+    {
+        assert( indices.size() % 3 == 0 );
+
+        for ( uint32_t i: indices )
+        {
+            assert( i < vertexCount );
+            ++offsets[i + 1];
+        }
+
+        for ( std::size_t v = 0; v < vertexCount; ++v )
+            offsets[v + 1] += offsets[v];
+
+        // Counting sort: corners are visited in ascending order.
+        std::vector<uint32_t> cursor( offsets.begin(), offsets.end() - 1 );
+        for ( std::size_t c = 0; c < indices.size(); ++c )
+            corners[cursor[indices[c]]++] = static_cast<uint32_t>( c );
+    }
+
+    /// <summary>
+    /// Get the corners that reference a vertex.
+    /// </summary>
+    /// <param name="v">The vertex index.</param>
+    /// <returns>The corners that reference vertex `v`.</returns>
+    std::span<const uint32_t> operator[]( std::size_t v ) const noexcept
+    {
+        return { corners.data() + offsets[v], corners.data() + offsets[v + 1] };
+    }
+};
+
+/// <summary>
+/// Compute the (unnormalized) normal of each triangle of an indexed triangle mesh.
+/// </summary>
+/// <remarks>
+/// The length of each normal is twice the area of the triangle, so the normals can be summed
+/// directly to produce area-weighted vertex normals.
+/// For single-precision input, 8 triangles are processed per iteration when AVX2 is enabled.
+/// </remarks>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="positions">The vertex positions.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="faceNormals">The output face normals (1 per triangle).</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void computeFaceNormals( std::span<const Vector<T, 3>> positions, std::span<const uint32_t> indices, std::span<Vector<T, 3>> faceNormals, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    const std::size_t triangleCount = indices.size() / 3;
+    assert( faceNormals.size() >= triangleCount );
+
+    pool.parallelFor( 0, triangleCount, 4096, [&]( std::size_t begin, std::size_t end ) {
+        std::size_t i = begin;
+
+#if defined( LS_AVX2 )
+        if constexpr ( std::is_same_v<T, float> && sizeof( Vector<T, 3> ) == 3 * sizeof( float ) )
+        {
+            const float*  base   = &positions.data()->x;
+            const __m256i stride = _mm256_setr_epi32( 0, 3, 6, 9, 12, 15, 18, 21 );
+            const __m256i three  = _mm256_set1_epi32( 3 );
+
+            for ( ; i + Simd::WIDTH <= end; i += Simd::WIDTH )
+            {
+                // Gather the vertex indices of 8 triangles, then the components of their positions.
+                const int* tri = reinterpret_cast<const int*>( indices.data() + i * 3 );
+
+                __m256 p[3][3];
+                for ( int k = 0; k < 3; ++k )
+                {
+                    const __m256i v = _mm256_mullo_epi32( _mm256_i32gather_epi32( tri + k, stride, 4 ), three );
+                    for ( int c = 0; c < 3; ++c )
+                        p[k][c] = _mm256_i32gather_ps( base + c, v, 4 );
+                }
+
+                const __m256 e1x = _mm256_sub_ps( p[1][0], p[0][0] );
+                const __m256 e1y = _mm256_sub_ps( p[1][1], p[0][1] );
+                const __m256 e1z = _mm256_sub_ps( p[1][2], p[0][2] );
+                const __m256 e2x = _mm256_sub_ps( p[2][0], p[0][0] );
+                const __m256 e2y = _mm256_sub_ps( p[2][1], p[0][1] );
+                const __m256 e2z = _mm256_sub_ps( p[2][2], p[0][2] );
+
+                alignas( 32 ) float nx[Simd::WIDTH], ny[Simd::WIDTH], nz[Simd::WIDTH];
+                _mm256_store_ps( nx, _mm256_sub_ps( _mm256_mul_ps( e1y, e2z ), _mm256_mul_ps( e1z, e2y ) ) );
+                _mm256_store_ps( ny, _mm256_sub_ps( _mm256_mul_ps( e1z, e2x ), _mm256_mul_ps( e1x, e2z ) ) );
+                _mm256_store_ps( nz, _mm256_sub_ps( _mm256_mul_ps( e1x, e2y ), _mm256_mul_ps( e1y, e2x ) ) );
+
+                for ( std::size_t k = 0; k < Simd::WIDTH; ++k )
+                    faceNormals[i + k] = { nx[k], ny[k], nz[k] };
+            }
+        }
+#endif
+
+        for ( ; i < end; ++i )
+        {
+            const Vector<T, 3>& p0 = positions[indices[i * 3 + 0]];
+            const Vector<T, 3>& p1 = positions[indices[i * 3 + 1]];
+            const Vector<T, 3>& p2 = positions[indices[i * 3 + 2]];
+
+            faceNormals[i] = cross( p1 - p0, p2 - p0 );
+        }
+    } );
+}
+
+/// <summary>
+/// Compute area-weighted vertex normals of an indexed triangle mesh.
+/// </summary>
+/// <remarks>
+/// Face normals are computed in parallel and then gathered per vertex (rather than scattered per
+/// face) in ascending triangle order, so no atomics are required and the result is bitwise
+/// identical regardless of the number of threads in the pool.
+/// Vertices that are not referenced by any (non-degenerate) triangle get a zero normal.
+/// </remarks>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="positions">The vertex positions.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="adjacency">The adjacency of the mesh (see `VertexAdjacency`).</param>
+/// <param name="normals">The output vertex normals (1 per vertex).</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void computeNormals( std::span<const Vector<T, 3>> positions, std::span<const uint32_t> indices, const VertexAdjacency& adjacency, std::span<Vector<T, 3>> normals,
+                     ThreadPool& pool = ThreadPool::getDefault() )
+{
+    assert( normals.size() >= positions.size() );
+    assert( adjacency.offsets.size() == positions.size() + 1 );
+    assert( adjacency.corners.size() == indices.size() );
+
+    std::vector<Vector<T, 3>> faceNormals( indices.size() / 3 );
+    computeFaceNormals<T>( positions, indices, faceNormals, pool );
+
+    pool.parallelFor( 0, positions.size(), 4096, [&]( std::size_t begin, std::size_t end ) {
+        for ( std::size_t v = begin; v < end; ++v )
+        {
+            Vector<T, 3> n { T( 0 ) };
+            for ( uint32_t corner: adjacency[v] )
+                n += faceNormals[corner / 3];
+
+            const T l = lengthSqr( n );
+            normals[v] = l > T( 0 ) ? n / std::sqrt( l ) : Vector<T, 3> { T( 0 ) };
+        }
+    } );
+}
+
+/// <summary>
+/// Compute area-weighted vertex normals of an indexed triangle mesh.
+/// </summary>
+/// <remarks>
+/// Builds the adjacency of the mesh. To compute both normals and tangents of the same mesh, build a
+/// `VertexAdjacency` once and pass it to both functions instead.
+/// </remarks>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="positions">The vertex positions.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="normals">The output vertex normals (1 per vertex).</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void computeNormals( std::span<const Vector<T, 3>> positions, std::span<const uint32_t> indices, std::span<Vector<T, 3>> normals, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    computeNormals<T>( positions, indices, VertexAdjacency( positions.size(), indices ), normals, pool );
+}
+
+/// <summary>
+/// Compute per-vertex tangents of an indexed triangle mesh.
+/// </summary>
+/// <remarks>
+/// The tangent frame follows the MikkTSpace conventions: the tangent of each triangle corner is
+/// projected onto the tangent plane of the vertex normal, weighted by the angle of the corner,
+/// and the `w` component stores the handedness of the bitangent (`bitangent = w * cross( normal, tangent )`).
+/// Unlike the reference implementation, vertices are not split where the handedness changes
+/// (mirrored UVs); the mesh is expected to be split on UV seams already.
+/// The result is independent of the number of threads in the pool.
+/// </remarks>
+/// <seealso href="http://www.mikktspace.com/"/>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="positions">The vertex positions.</param>
+/// <param name="normals">The (normalized) vertex normals.</param>
+/// <param name="texCoords">The vertex texture coordinates.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="adjacency">The adjacency of the mesh (see `VertexAdjacency`).</param>
+/// <param name="tangents">The output tangents (1 per vertex).</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void computeTangents( std::span<const Vector<T, 3>> positions, std::span<const Vector<T, 3>> normals, std::span<const Vector<T, 2>> texCoords, std::span<const uint32_t> indices,
+                      const VertexAdjacency& adjacency, std::span<Vector<T, 4>> tangents, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    assert( normals.size() >= positions.size() );
+    assert( texCoords.size() >= positions.size() );
+    assert( tangents.size() >= positions.size() );
+    assert( adjacency.offsets.size() == positions.size() + 1 );
+    assert( adjacency.corners.size() == indices.size() );
+
+    const std::size_t triangleCount = indices.size() / 3;
+
+    // Per-triangle (unnormalized) texture space derivatives.
+    struct FaceTangent
+    {
+        Vector<T, 3> s;
+        Vector<T, 3> t;
+    };
+
+    std::vector<FaceTangent> faceTangents( triangleCount );
+
+    pool.parallelFor( 0, triangleCount, 4096, [&]( std::size_t begin, std::size_t end ) {
+        for ( std::size_t i = begin; i < end; ++i )
+        {
+            const uint32_t i0 = indices[i * 3 + 0];
+            const uint32_t i1 = indices[i * 3 + 1];
+            const uint32_t i2 = indices[i * 3 + 2];
+
+            const Vector<T, 3> d1 = positions[i1] - positions[i0];
+            const Vector<T, 3> d2 = positions[i2] - positions[i0];
+            const Vector<T, 2> t1 = texCoords[i1] - texCoords[i0];
+            const Vector<T, 2> t2 = texCoords[i2] - texCoords[i0];
+
+            const T area = t1.x * t2.y - t2.x * t1.y;
+            const T sign = area < T( 0 ) ? T( -1 ) : T( 1 );
+
+            // The magnitude is irrelevant since the per-corner vectors are normalized after
+            // projection, but the orientation must be preserved.
+            faceTangents[i].s = ( d1 * t2.y - d2 * t1.y ) * sign;
+            faceTangents[i].t = ( d2 * t1.x - d1 * t2.x ) * sign;
+        }
+    } );
+
+    pool.parallelFor( 0, positions.size(), 4096, [&]( std::size_t begin, std::size_t end ) {
+        for ( std::size_t v = begin; v < end; ++v )
+        {
+            const Vector<T, 3>& n = normals[v];
+
+            Vector<T, 3> tangent { T( 0 ) };
+            Vector<T, 3> bitangent { T( 0 ) };
+
+            for ( uint32_t corner: adjacency[v] )
+            {
+                const uint32_t tri = corner / 3;
+                const uint32_t k   = corner % 3;
+
+                // Angle of the corner.
+                const Vector<T, 3>& p  = positions[v];
+                const Vector<T, 3>  e0 = positions[indices[tri * 3 + ( k + 1 ) % 3]] - p;
+                const Vector<T, 3>  e1 = positions[indices[tri * 3 + ( k + 2 ) % 3]] - p;
+                const T             l  = std::sqrt( lengthSqr( e0 ) * lengthSqr( e1 ) );
+                if ( l <= T( 0 ) )
+                    continue;
+
+                const T angle = std::acos( std::clamp( dot( e0, e1 ) / l, T( -1 ), T( 1 ) ) );
+
+                // Project onto the tangent plane of the vertex.
+                Vector<T, 3> s = faceTangents[tri].s - n * dot( n, faceTangents[tri].s );
+                Vector<T, 3> t = faceTangents[tri].t - n * dot( n, faceTangents[tri].t );
+
+                const T ls = lengthSqr( s );
+                const T lt = lengthSqr( t );
+                if ( ls > T( 0 ) )
+                    tangent += s * ( angle / std::sqrt( ls ) );
+                if ( lt > T( 0 ) )
+                    bitangent += t * ( angle / std::sqrt( lt ) );
+            }
+
+            // Orthonormalize against the normal.
+            tangent -= n * dot( n, tangent );
+            const T l = lengthSqr( tangent );
+            if ( l > T( 0 ) )
+            {
+                tangent /= std::sqrt( l );
+            }
+            else
+            {
+                // Degenerate UVs: pick any vector perpendicular to the normal.
+                const Vector<T, 3> a = std::abs( n.x ) < T( 0.9 ) ? Vector<T, 3> { T( 1 ), T( 0 ), T( 0 ) } : Vector<T, 3> { T( 0 ), T( 1 ), T( 0 ) };
+                tangent              = cross( a, n );
+                const T la           = lengthSqr( tangent );
+                tangent              = la > T( 0 ) ? tangent / std::sqrt( la ) : a;
+            }
+
+            const T w = dot( cross( n, tangent ), bitangent ) < T( 0 ) ? T( -1 ) : T( 1 );
+
+            tangents[v] = { tangent.x, tangent.y, tangent.z, w };
+        }
+    } );
+}
+
+/// <summary>
+/// Compute per-vertex tangents of an indexed triangle mesh.
+/// </summary>
+/// <remarks>
+/// Builds the adjacency of the mesh. To compute both normals and tangents of the same mesh, build a
+/// `VertexAdjacency` once and pass it to both functions instead.
+/// </remarks>
+/// <typeparam name="T">The vertex type.</typeparam>
+/// <param name="positions">The vertex positions.</param>
+/// <param name="normals">The (normalized) vertex normals.</param>
+/// <param name="texCoords">The vertex texture coordinates.</param>
+/// <param name="indices">The vertex indices (3 per triangle).</param>
+/// <param name="tangents">The output tangents (1 per vertex).</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void computeTangents( std::span<const Vector<T, 3>> positions, std::span<const Vector<T, 3>> normals, std::span<const Vector<T, 2>> texCoords, std::span<const uint32_t> indices, std::span<Vector<T, 4>> tangents, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    computeTangents<T>( positions, normals, texCoords, indices, VertexAdjacency( positions.size(), indices ), tangents, pool );
+}
+
+}  // namespace FastMath
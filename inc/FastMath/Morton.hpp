@@ -0,0 +1,66 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace FastMath
+{
+
+/// <summary>
+/// Spread the lower 10 bits of an integer so that there are two zero bits between each bit.
+/// </summary>
+/// <param name="v">The value to expand (only the lower 10 bits are used).</param>
+/// <returns>The expanded value.</returns>
+constexpr uint32_t expandBits( uint32_t v ) noexcept
+{
+    v &= 0x3FFu;
+    v = ( v * 0x00010001u ) & 0xFF0000FFu;
+    v = ( v * 0x00000101u ) & 0x0F00F00Fu;
+    v = ( v * 0x00000011u ) & 0xC30C30C3u;
+    v = ( v * 0x00000005u ) & 0x49249249u;
+
+    return v;
+}
+
+/// <summary>
+/// Interleave the bits of three 10-bit integers into a 30-bit Morton code.
+/// </summary>
+/// <param name="x">The x coordinate in the range [0 ... 1023].</param>
+/// <param name="y">The y coordinate in the range [0 ... 1023].</param>
+/// <param name="z">The z coordinate in the range [0 ... 1023].</param>
+/// <returns>The Morton code.</returns>
+constexpr uint32_t mortonEncode( uint32_t x, uint32_t y, uint32_t z ) noexcept
+{
+    return ( expandBits( x ) << 2 ) | ( expandBits( y ) << 1 ) | expandBits( z );
+}
+
+/// <summary>
+/// Compute the 30-bit Morton code of a point, relative to a bounding box.
+/// </summary>
+/// <remarks>
+/// Sorting points by their Morton code orders them along a Z-order curve, so points that are
+/// close in the sorted order are also close in space.
+/// </remarks>
+/// <typeparam name="T">The vector type.</typeparam>
+/// <param name="p">The point. Points outside of the bounds are clamped to the bounds.</param>
+/// <param name="bounds">The bounds of all of the points.</param>
+/// <returns>The Morton code of the point.</returns>
+template<typename T>
+constexpr uint32_t mortonCode( const Vector<T, 3>& p, const AABB<T>& bounds ) noexcept
+{
+    uint32_t c[3];
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const T extent = bounds.max[i] - bounds.min[i];
+        const T t      = extent > T( 0 ) ? ( p[i] - bounds.min[i] ) / extent : T( 0 );
+
+        c[i] = static_cast<uint32_t>( std::clamp( t * T( 1024 ), T( 0 ), T( 1023 ) ) );
+    }
+
+    return mortonEncode( c[0], c[1], c[2] );
+}
+
+}  // namespace FastMath
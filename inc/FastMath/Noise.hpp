@@ -0,0 +1,1028 @@
+#pragma once
+
+#include "Simd.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The lattice noise functions.
+/// </summary>
+enum class Noise
+{
+    /// <summary>
+    /// Perlin's improved noise: gradients on the corners of a hypercube lattice blended with a quintic curve.
+    /// Evaluates \f( 2^N \f) lattice points per sample.
+    /// </summary>
+    Perlin,
+    /// <summary>
+    /// Simplex noise: radially symmetric kernels on the corners of a simplex lattice. Evaluates \f( N+1 \f) lattice
+    /// points per sample, has fewer directional artifacts and scales much better to higher dimensions.
+    /// </summary>
+    Simplex,
+    /// <summary>
+    /// Value noise: random values on the corners of a hypercube lattice blended with a quintic curve. Evaluates
+    /// \f( 2^N \f) lattice points per sample like Perlin noise, but without the gradients, so it is cheaper and has
+    /// more visible lattice artifacts.
+    /// </summary>
+    Value,
+};
+
+namespace detail
+{
+
+// The maximum number of samples per chunk when evaluating noise in parallel.
+inline constexpr std::size_t NOISE_GRAIN_SIZE = 4096;
+
+// Lattice points are hashed by combining the product of each coordinate with a large odd constant.
+inline constexpr uint32_t NOISE_PRIMES[4] = { 0x8da6b343u, 0xd8163841u, 0xcb1ab31fu, 0x165667b1u };
+
+// The factors that scale the noise to [-1, 1]. Perlin noise is at most N/2 (at the center of a cell where all of
+// the gradients point to the center). The maximum of simplex noise was found numerically by choosing the best
+// gradient for each corner and maximizing over the points of a simplex.
+inline constexpr double PERLIN_SCALE[5]  = { 0.0, 0.0, 1.0, 2.0 / 3.0, 0.5 };
+inline constexpr double SIMPLEX_SCALE[5] = { 0.0, 0.0, 70.14, 62.15, 54.28 };
+
+// The squared radius of the simplex kernels. A radius of sqrt( 1/2 ) is the distance from a corner to the opposite
+// face of the simplex, so the kernels vanish before they reach the neighboring simplices and the noise is continuous.
+inline constexpr double SIMPLEX_RADIUS_SQUARED = 0.5;
+
+constexpr uint32_t noiseSeed( uint32_t seed ) noexcept
+{
+    return seed * 0x9e3779b9u;
+}
+
+constexpr uint32_t mixHash( uint32_t h ) noexcept
+{
+    h ^= h >> 15;
+    h *= 0x2c1b3c6du;
+    h ^= h >> 12;
+    h *= 0x297a2d39u;
+    h ^= h >> 15;
+
+    return h;
+}
+
+// The seed of an octave. Each octave uses a different seed so that the lattices of the octaves are not correlated,
+// and the user seed is mixed so that nearby seeds give unrelated noise (seed 0 uses the octave index).
+constexpr uint32_t octaveSeed( uint32_t seed, int octave ) noexcept
+{
+    return mixHash( seed ) ^ static_cast<uint32_t>( octave );
+}
+
+// The gradient of a lattice point. The components are +1 or -1, except for one component that is 0 for N of
+// every N + 1 hashes (the edges and the diagonals of the hypercube).
+template<typename T, std::size_t N>
+constexpr void noiseGradient( uint32_t h, T ( &g )[N] ) noexcept
+{
+    const uint32_t zero = ( ( ( h >> 8 ) & 0xffffu ) * uint32_t( N + 1 ) ) >> 16;
+
+    for ( std::size_t d = 0; d < N; ++d )
+        g[d] = d == zero ? T( 0 ) : ( ( h >> d ) & 1u ) ? T( -1 ) : T( 1 );
+}
+
+// The value of a lattice point, uniformly distributed in [-1, 1) (from the upper 24 bits of the hash).
+template<typename T>
+constexpr T noiseValue( uint32_t h ) noexcept
+{
+    return T( h >> 8 ) * T( 1.0 / ( 1u << 23 ) ) - T( 1 );
+}
+
+template<typename T, std::size_t N>
+T perlin( const T ( &p )[N], uint32_t seed, T* derivative ) noexcept
+{
+    T        t[N], s[N], ds[N];
+    uint32_t h0[N];
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        const T f = std::floor( p[d] );
+
+        t[d]  = p[d] - f;
+        s[d]  = t[d] * t[d] * t[d] * ( t[d] * ( t[d] * T( 6 ) - T( 15 ) ) + T( 10 ) );
+        ds[d] = T( 30 ) * t[d] * t[d] * ( t[d] - T( 1 ) ) * ( t[d] - T( 1 ) );
+        h0[d] = static_cast<uint32_t>( static_cast<int32_t>( f ) ) * NOISE_PRIMES[d];
+    }
+
+    T value = T( 0 );
+    if ( derivative )
+        std::fill_n( derivative, N, T( 0 ) );
+
+    for ( uint32_t c = 0; c < ( 1u << N ); ++c )
+    {
+        uint32_t h = noiseSeed( seed );
+        for ( std::size_t d = 0; d < N; ++d )
+            h ^= ( c >> d ) & 1u ? h0[d] + NOISE_PRIMES[d] : h0[d];
+
+        T g[N];
+        noiseGradient( mixHash( h ), g );
+
+        // The weight of the corner, and the value of its gradient ramp.
+        T w = T( 1 ), dot = T( 0 );
+        for ( std::size_t d = 0; d < N; ++d )
+        {
+            const bool upper = ( c >> d ) & 1u;
+
+            w *= upper ? s[d] : T( 1 ) - s[d];
+            dot += g[d] * ( upper ? t[d] - T( 1 ) : t[d] );
+        }
+
+        value += w * dot;
+
+        if ( derivative )
+        {
+            for ( std::size_t k = 0; k < N; ++k )
+            {
+                T dw = ( c >> k ) & 1u ? ds[k] : -ds[k];
+                for ( std::size_t d = 0; d < N; ++d )
+                {
+                    if ( d != k )
+                        dw *= ( c >> d ) & 1u ? s[d] : T( 1 ) - s[d];
+                }
+
+                derivative[k] += dw * dot + w * g[k];
+            }
+        }
+    }
+
+    if ( derivative )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            derivative[d] *= T( PERLIN_SCALE[N] );
+    }
+
+    return value * T( PERLIN_SCALE[N] );
+}
+
+template<typename T, std::size_t N>
+T valueNoise( const T ( &p )[N], uint32_t seed, T* derivative ) noexcept
+{
+    T        s[N], ds[N];
+    uint32_t h0[N];
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        const T f = std::floor( p[d] );
+        const T t = p[d] - f;
+
+        s[d]  = t * t * t * ( t * ( t * T( 6 ) - T( 15 ) ) + T( 10 ) );
+        ds[d] = T( 30 ) * t * t * ( t - T( 1 ) ) * ( t - T( 1 ) );
+        h0[d] = static_cast<uint32_t>( static_cast<int32_t>( f ) ) * NOISE_PRIMES[d];
+    }
+
+    // The values of the corners are in [-1, 1) and the weights sum to 1, so the noise needs no scaling.
+    T value = T( 0 );
+    if ( derivative )
+        std::fill_n( derivative, N, T( 0 ) );
+
+    for ( uint32_t c = 0; c < ( 1u << N ); ++c )
+    {
+        uint32_t h = noiseSeed( seed );
+        for ( std::size_t d = 0; d < N; ++d )
+            h ^= ( c >> d ) & 1u ? h0[d] + NOISE_PRIMES[d] : h0[d];
+
+        const T v = noiseValue<T>( mixHash( h ) );
+
+        T w = T( 1 );
+        for ( std::size_t d = 0; d < N; ++d )
+            w *= ( c >> d ) & 1u ? s[d] : T( 1 ) - s[d];
+
+        value += w * v;
+
+        if ( derivative )
+        {
+            for ( std::size_t k = 0; k < N; ++k )
+            {
+                T dw = ( c >> k ) & 1u ? ds[k] : -ds[k];
+                for ( std::size_t d = 0; d < N; ++d )
+                {
+                    if ( d != k )
+                        dw *= ( c >> d ) & 1u ? s[d] : T( 1 ) - s[d];
+                }
+
+                derivative[k] += dw * v;
+            }
+        }
+    }
+
+    return value;
+}
+
+template<typename T, std::size_t N>
+T simplex( const T ( &p )[N], uint32_t seed, T* derivative ) noexcept
+{
+    // The factors to skew the input space to the hypercube lattice, and to unskew it back.
+    const T F = ( std::sqrt( T( N + 1 ) ) - T( 1 ) ) / T( N );
+    const T G = ( T( 1 ) - T( 1 ) / std::sqrt( T( N + 1 ) ) ) / T( N );
+
+    T skew = T( 0 );
+    for ( std::size_t d = 0; d < N; ++d )
+        skew += p[d];
+    skew *= F;
+
+    int32_t cell[N];
+    T       unskew = T( 0 );
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        cell[d] = static_cast<int32_t>( std::floor( p[d] + skew ) );
+        unskew += T( cell[d] );
+    }
+    unskew *= G;
+
+    T x0[N];
+    for ( std::size_t d = 0; d < N; ++d )
+        x0[d] = p[d] - ( T( cell[d] ) - unskew );
+
+    // The order of the components determines the simplex that contains the point.
+    uint32_t rank[N] = {};
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        for ( std::size_t j = i + 1; j < N; ++j )
+        {
+            if ( x0[i] > x0[j] )
+                ++rank[i];
+            else
+                ++rank[j];
+        }
+    }
+
+    T value = T( 0 );
+    if ( derivative )
+        std::fill_n( derivative, N, T( 0 ) );
+
+    for ( uint32_t k = 0; k <= N; ++k )
+    {
+        uint32_t h = noiseSeed( seed );
+        T        x[N];
+        T        r2 = T( 0 );
+        for ( std::size_t d = 0; d < N; ++d )
+        {
+            const uint32_t o = rank[d] + k >= N ? 1u : 0u;
+
+            h ^= static_cast<uint32_t>( cell[d] + static_cast<int32_t>( o ) ) * NOISE_PRIMES[d];
+            x[d] = x0[d] - T( o ) + T( k ) * G;
+            r2 += x[d] * x[d];
+        }
+
+        const T t = T( SIMPLEX_RADIUS_SQUARED ) - r2;
+        if ( t <= T( 0 ) )
+            continue;
+
+        T g[N];
+        noiseGradient( mixHash( h ), g );
+
+        T dot = T( 0 );
+        for ( std::size_t d = 0; d < N; ++d )
+            dot += g[d] * x[d];
+
+        const T t2 = t * t;
+        value += t2 * t2 * dot;
+
+        if ( derivative )
+        {
+            for ( std::size_t d = 0; d < N; ++d )
+                derivative[d] += t2 * t2 * g[d] - T( 8 ) * t2 * t * dot * x[d];
+        }
+    }
+
+    if ( derivative )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            derivative[d] *= T( SIMPLEX_SCALE[N] );
+    }
+
+    return value * T( SIMPLEX_SCALE[N] );
+}
+
+// The sum of the octaves of a noise function, normalized by the sum of the amplitudes.
+template<Noise K, typename T, std::size_t N>
+T fractal( const T ( &p )[N], int octaves, T lacunarity, T gain, bool turbulence, uint32_t seed, T* derivative ) noexcept
+{
+    assert( octaves > 0 );
+
+    T value = T( 0 ), total = T( 0 ), frequency = T( 1 ), amplitude = T( 1 );
+    if ( derivative )
+        std::fill_n( derivative, N, T( 0 ) );
+
+    for ( int o = 0; o < octaves; ++o )
+    {
+        T q[N], dn[N];
+        for ( std::size_t d = 0; d < N; ++d )
+            q[d] = p[d] * frequency;
+
+        const uint32_t s = octaveSeed( seed, o );
+
+        T n;
+        if constexpr ( K == Noise::Perlin )
+            n = perlin( q, s, derivative ? dn : nullptr );
+        else if constexpr ( K == Noise::Simplex )
+            n = simplex( q, s, derivative ? dn : nullptr );
+        else
+            n = valueNoise( q, s, derivative ? dn : nullptr );
+
+        const T sign = turbulence && n < T( 0 ) ? T( -1 ) : T( 1 );
+        n *= sign;
+
+        value += amplitude * n;
+        if ( derivative )
+        {
+            for ( std::size_t d = 0; d < N; ++d )
+                derivative[d] += sign * amplitude * frequency * dn[d];
+        }
+
+        total += amplitude;
+        frequency *= lacunarity;
+        amplitude *= gain;
+    }
+
+    if ( derivative )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            derivative[d] /= total;
+    }
+
+    return value / total;
+}
+
+#if defined( LS_AVX2 )
+inline __m256i mixHash8( __m256i h ) noexcept
+{
+    h = _mm256_xor_si256( h, _mm256_srli_epi32( h, 15 ) );
+    h = _mm256_mullo_epi32( h, _mm256_set1_epi32( 0x2c1b3c6d ) );
+    h = _mm256_xor_si256( h, _mm256_srli_epi32( h, 12 ) );
+    h = _mm256_mullo_epi32( h, _mm256_set1_epi32( 0x297a2d39 ) );
+    h = _mm256_xor_si256( h, _mm256_srli_epi32( h, 15 ) );
+
+    return h;
+}
+
+template<std::size_t N>
+inline void noiseGradient8( __m256i h, __m256 ( &g )[N] ) noexcept
+{
+    const __m256i zero = _mm256_srli_epi32( _mm256_mullo_epi32( _mm256_and_si256( _mm256_srli_epi32( h, 8 ), _mm256_set1_epi32( 0xffff ) ), _mm256_set1_epi32( N + 1 ) ), 16 );
+
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        // Move bit d of the hash to the sign bit of 1.0f.
+        const __m256i sign = _mm256_and_si256( _mm256_slli_epi32( h, static_cast<int>( 31 - d ) ), _mm256_set1_epi32( static_cast<int>( 0x80000000u ) ) );
+        const __m256  one  = _mm256_castsi256_ps( _mm256_xor_si256( _mm256_castps_si256( _mm256_set1_ps( 1.0f ) ), sign ) );
+
+        g[d] = _mm256_andnot_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( zero, _mm256_set1_epi32( static_cast<int>( d ) ) ) ), one );
+    }
+}
+
+template<std::size_t N>
+__m256 perlin8( const __m256 ( &p )[N], uint32_t seed, __m256* derivative ) noexcept
+{
+    const __m256 one = _mm256_set1_ps( 1.0f );
+
+    __m256  t[N], s[N], ds[N];
+    __m256i h0[N];
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        const __m256 f = _mm256_floor_ps( p[d] );
+
+        t[d] = _mm256_sub_ps( p[d], f );
+
+        const __m256 t2 = _mm256_mul_ps( t[d], t[d] );
+        const __m256 t1 = _mm256_sub_ps( t[d], one );
+
+        s[d]  = _mm256_mul_ps( _mm256_mul_ps( t2, t[d] ), Simd::fmadd( t[d], Simd::fmadd( t[d], _mm256_set1_ps( 6.0f ), _mm256_set1_ps( -15.0f ) ), _mm256_set1_ps( 10.0f ) ) );
+        ds[d] = _mm256_mul_ps( _mm256_mul_ps( _mm256_set1_ps( 30.0f ), t2 ), _mm256_mul_ps( t1, t1 ) );
+        h0[d] = _mm256_mullo_epi32( _mm256_cvttps_epi32( f ), _mm256_set1_epi32( static_cast<int>( NOISE_PRIMES[d] ) ) );
+    }
+
+    __m256 value = _mm256_setzero_ps();
+    if ( derivative )
+        std::fill_n( derivative, N, _mm256_setzero_ps() );
+
+    for ( uint32_t c = 0; c < ( 1u << N ); ++c )
+    {
+        __m256i h = _mm256_set1_epi32( static_cast<int>( noiseSeed( seed ) ) );
+        for ( std::size_t d = 0; d < N; ++d )
+            h = _mm256_xor_si256( h, ( c >> d ) & 1u ? _mm256_add_epi32( h0[d], _mm256_set1_epi32( static_cast<int>( NOISE_PRIMES[d] ) ) ) : h0[d] );
+
+        __m256 g[N];
+        noiseGradient8( mixHash8( h ), g );
+
+        __m256 w = one, dot = _mm256_setzero_ps();
+        for ( std::size_t d = 0; d < N; ++d )
+        {
+            const bool upper = ( c >> d ) & 1u;
+
+            w   = _mm256_mul_ps( w, upper ? s[d] : _mm256_sub_ps( one, s[d] ) );
+            dot = Simd::fmadd( g[d], upper ? _mm256_sub_ps( t[d], one ) : t[d], dot );
+        }
+
+        value = Simd::fmadd( w, dot, value );
+
+        if ( derivative )
+        {
+            for ( std::size_t k = 0; k < N; ++k )
+            {
+                __m256 dw = ( c >> k ) & 1u ? ds[k] : _mm256_sub_ps( _mm256_setzero_ps(), ds[k] );
+                for ( std::size_t d = 0; d < N; ++d )
+                {
+                    if ( d != k )
+                        dw = _mm256_mul_ps( dw, ( c >> d ) & 1u ? s[d] : _mm256_sub_ps( one, s[d] ) );
+                }
+
+                derivative[k] = Simd::fmadd( dw, dot, Simd::fmadd( w, g[k], derivative[k] ) );
+            }
+        }
+    }
+
+    const __m256 scale = _mm256_set1_ps( static_cast<float>( PERLIN_SCALE[N] ) );
+    if ( derivative )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            derivative[d] = _mm256_mul_ps( derivative[d], scale );
+    }
+
+    return _mm256_mul_ps( value, scale );
+}
+
+template<std::size_t N>
+__m256 valueNoise8( const __m256 ( &p )[N], uint32_t seed, __m256* derivative ) noexcept
+{
+    const __m256 one = _mm256_set1_ps( 1.0f );
+
+    __m256  s[N], ds[N];
+    __m256i h0[N];
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        const __m256 f  = _mm256_floor_ps( p[d] );
+        const __m256 t  = _mm256_sub_ps( p[d], f );
+        const __m256 t2 = _mm256_mul_ps( t, t );
+        const __m256 t1 = _mm256_sub_ps( t, one );
+
+        s[d]  = _mm256_mul_ps( _mm256_mul_ps( t2, t ), Simd::fmadd( t, Simd::fmadd( t, _mm256_set1_ps( 6.0f ), _mm256_set1_ps( -15.0f ) ), _mm256_set1_ps( 10.0f ) ) );
+        ds[d] = _mm256_mul_ps( _mm256_mul_ps( _mm256_set1_ps( 30.0f ), t2 ), _mm256_mul_ps( t1, t1 ) );
+        h0[d] = _mm256_mullo_epi32( _mm256_cvttps_epi32( f ), _mm256_set1_epi32( static_cast<int>( NOISE_PRIMES[d] ) ) );
+    }
+
+    __m256 value = _mm256_setzero_ps();
+    if ( derivative )
+        std::fill_n( derivative, N, _mm256_setzero_ps() );
+
+    for ( uint32_t c = 0; c < ( 1u << N ); ++c )
+    {
+        __m256i h = _mm256_set1_epi32( static_cast<int>( noiseSeed( seed ) ) );
+        for ( std::size_t d = 0; d < N; ++d )
+            h = _mm256_xor_si256( h, ( c >> d ) & 1u ? _mm256_add_epi32( h0[d], _mm256_set1_epi32( static_cast<int>( NOISE_PRIMES[d] ) ) ) : h0[d] );
+
+        // The upper 24 bits of the hash are converted exactly.
+        const __m256 v = Simd::fmadd( _mm256_cvtepi32_ps( _mm256_srli_epi32( mixHash8( h ), 8 ) ), _mm256_set1_ps( 1.0f / ( 1u << 23 ) ), _mm256_set1_ps( -1.0f ) );
+
+        __m256 w = one;
+        for ( std::size_t d = 0; d < N; ++d )
+            w = _mm256_mul_ps( w, ( c >> d ) & 1u ? s[d] : _mm256_sub_ps( one, s[d] ) );
+
+        value = Simd::fmadd( w, v, value );
+
+        if ( derivative )
+        {
+            for ( std::size_t k = 0; k < N; ++k )
+            {
+                __m256 dw = ( c >> k ) & 1u ? ds[k] : _mm256_sub_ps( _mm256_setzero_ps(), ds[k] );
+                for ( std::size_t d = 0; d < N; ++d )
+                {
+                    if ( d != k )
+                        dw = _mm256_mul_ps( dw, ( c >> d ) & 1u ? s[d] : _mm256_sub_ps( one, s[d] ) );
+                }
+
+                derivative[k] = Simd::fmadd( dw, v, derivative[k] );
+            }
+        }
+    }
+
+    return value;
+}
+
+template<std::size_t N>
+__m256 simplex8( const __m256 ( &p )[N], uint32_t seed, __m256* derivative ) noexcept
+{
+    const float F = ( std::sqrt( float( N + 1 ) ) - 1.0f ) / float( N );
+    const float G = ( 1.0f - 1.0f / std::sqrt( float( N + 1 ) ) ) / float( N );
+
+    __m256 skew = p[0];
+    for ( std::size_t d = 1; d < N; ++d )
+        skew = _mm256_add_ps( skew, p[d] );
+    skew = _mm256_mul_ps( skew, _mm256_set1_ps( F ) );
+
+    __m256 cell[N];
+    __m256 unskew = _mm256_setzero_ps();
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        cell[d] = _mm256_floor_ps( _mm256_add_ps( p[d], skew ) );
+        unskew  = _mm256_add_ps( unskew, cell[d] );
+    }
+    unskew = _mm256_mul_ps( unskew, _mm256_set1_ps( G ) );
+
+    __m256  x0[N];
+    __m256i h0[N];
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        x0[d] = _mm256_sub_ps( p[d], _mm256_sub_ps( cell[d], unskew ) );
+        h0[d] = _mm256_mullo_epi32( _mm256_cvttps_epi32( cell[d] ), _mm256_set1_epi32( static_cast<int>( NOISE_PRIMES[d] ) ) );
+    }
+
+    // The comparison masks are -1 (true) or 0.
+    __m256i rank[N];
+    for ( std::size_t d = 0; d < N; ++d )
+        rank[d] = _mm256_setzero_si256();
+
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        for ( std::size_t j = i + 1; j < N; ++j )
+        {
+            const __m256i greater = _mm256_castps_si256( _mm256_cmp_ps( x0[i], x0[j], _CMP_GT_OQ ) );
+
+            rank[i] = _mm256_sub_epi32( rank[i], greater );
+            rank[j] = _mm256_add_epi32( rank[j], _mm256_add_epi32( greater, _mm256_set1_epi32( 1 ) ) );
+        }
+    }
+
+    __m256 value = _mm256_setzero_ps();
+    if ( derivative )
+        std::fill_n( derivative, N, _mm256_setzero_ps() );
+
+    for ( uint32_t k = 0; k <= N; ++k )
+    {
+        __m256i h  = _mm256_set1_epi32( static_cast<int>( noiseSeed( seed ) ) );
+        __m256  r2 = _mm256_setzero_ps();
+        __m256  x[N];
+        for ( std::size_t d = 0; d < N; ++d )
+        {
+            // The corner is offset in the components with a rank of at least N - k.
+            const __m256i o = _mm256_cmpgt_epi32( rank[d], _mm256_set1_epi32( static_cast<int>( N - k ) - 1 ) );
+
+            h    = _mm256_xor_si256( h, _mm256_add_epi32( h0[d], _mm256_and_si256( o, _mm256_set1_epi32( static_cast<int>( NOISE_PRIMES[d] ) ) ) ) );
+            x[d] = _mm256_add_ps( _mm256_sub_ps( x0[d], _mm256_and_ps( _mm256_castsi256_ps( o ), _mm256_set1_ps( 1.0f ) ) ), _mm256_set1_ps( float( k ) * G ) );
+            r2   = Simd::fmadd( x[d], x[d], r2 );
+        }
+
+        const __m256 t  = _mm256_max_ps( _mm256_sub_ps( _mm256_set1_ps( static_cast<float>( SIMPLEX_RADIUS_SQUARED ) ), r2 ), _mm256_setzero_ps() );
+        const __m256 t2 = _mm256_mul_ps( t, t );
+        const __m256 t4 = _mm256_mul_ps( t2, t2 );
+
+        __m256 g[N];
+        noiseGradient8( mixHash8( h ), g );
+
+        __m256 dot = _mm256_setzero_ps();
+        for ( std::size_t d = 0; d < N; ++d )
+            dot = Simd::fmadd( g[d], x[d], dot );
+
+        value = Simd::fmadd( t4, dot, value );
+
+        if ( derivative )
+        {
+            const __m256 a = _mm256_mul_ps( _mm256_mul_ps( _mm256_set1_ps( -8.0f ), _mm256_mul_ps( t2, t ) ), dot );
+            for ( std::size_t d = 0; d < N; ++d )
+                derivative[d] = Simd::fmadd( t4, g[d], Simd::fmadd( a, x[d], derivative[d] ) );
+        }
+    }
+
+    const __m256 scale = _mm256_set1_ps( static_cast<float>( SIMPLEX_SCALE[N] ) );
+    if ( derivative )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            derivative[d] = _mm256_mul_ps( derivative[d], scale );
+    }
+
+    return _mm256_mul_ps( value, scale );
+}
+#endif
+
+template<Noise K, typename T, std::size_t N>
+void noiseRange( const std::array<std::span<const T>, N>& p, std::span<T> out, const std::array<std::span<T>, N>& derivatives, int octaves,
+                 T lacunarity, T gain, bool turbulence, uint32_t seed, std::size_t begin, std::size_t end ) noexcept
+{
+    assert( octaves > 0 );
+
+    const bool hasDerivatives = !derivatives[0].empty();
+
+    std::size_t i = begin;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        float total = 0.0f, amplitude = 1.0f;
+        for ( int o = 0; o < octaves; ++o, amplitude *= gain )
+            total += amplitude;
+
+        const __m256 normalize = _mm256_set1_ps( 1.0f / total );
+        const __m256 signMask  = _mm256_set1_ps( -0.0f );
+
+        for ( ; i + Simd::WIDTH <= end; i += Simd::WIDTH )
+        {
+            __m256 x[N];
+            for ( std::size_t d = 0; d < N; ++d )
+                x[d] = _mm256_loadu_ps( p[d].data() + i );
+
+            __m256 value = _mm256_setzero_ps(), derivative[N];
+            for ( std::size_t d = 0; d < N; ++d )
+                derivative[d] = _mm256_setzero_ps();
+
+            float frequency = 1.0f;
+            amplitude       = 1.0f;
+            for ( int o = 0; o < octaves; ++o )
+            {
+                __m256 q[N], dn[N];
+                for ( std::size_t d = 0; d < N; ++d )
+                    q[d] = _mm256_mul_ps( x[d], _mm256_set1_ps( frequency ) );
+
+                const uint32_t s = octaveSeed( seed, o );
+
+                __m256 n;
+                if constexpr ( K == Noise::Perlin )
+                    n = perlin8( q, s, hasDerivatives ? dn : nullptr );
+                else if constexpr ( K == Noise::Simplex )
+                    n = simplex8( q, s, hasDerivatives ? dn : nullptr );
+                else
+                    n = valueNoise8( q, s, hasDerivatives ? dn : nullptr );
+
+                // Turbulence takes the absolute value (and flips the derivative where the noise is negative).
+                const __m256 sign = turbulence ? _mm256_and_ps( n, signMask ) : _mm256_setzero_ps();
+                n                 = _mm256_xor_ps( n, sign );
+
+                value = Simd::fmadd( _mm256_set1_ps( amplitude ), n, value );
+                if ( hasDerivatives )
+                {
+                    for ( std::size_t d = 0; d < N; ++d )
+                        derivative[d] = Simd::fmadd( _mm256_set1_ps( amplitude * frequency ), _mm256_xor_ps( dn[d], sign ), derivative[d] );
+                }
+
+                frequency *= lacunarity;
+                amplitude *= gain;
+            }
+
+            _mm256_storeu_ps( out.data() + i, _mm256_mul_ps( value, normalize ) );
+            if ( hasDerivatives )
+            {
+                for ( std::size_t d = 0; d < N; ++d )
+                    _mm256_storeu_ps( derivatives[d].data() + i, _mm256_mul_ps( derivative[d], normalize ) );
+            }
+        }
+    }
+#endif
+
+    for ( ; i < end; ++i )
+    {
+        T x[N], derivative[N];
+        for ( std::size_t d = 0; d < N; ++d )
+            x[d] = p[d][i];
+
+        out[i] = fractal<K>( x, octaves, lacunarity, gain, turbulence, seed, hasDerivatives ? derivative : nullptr );
+        if ( hasDerivatives )
+        {
+            for ( std::size_t d = 0; d < N; ++d )
+                derivatives[d][i] = derivative[d];
+        }
+    }
+}
+
+template<Noise K, typename T, std::size_t N>
+void noise( const std::array<std::span<const T>, N>& p, std::span<T> out, const std::array<std::span<T>, N>& derivatives, int octaves, T lacunarity,
+            T gain, bool turbulence, uint32_t seed, ThreadPool& pool )
+{
+    static_assert( N >= 2 && N <= 4, "Noise is only defined in 2, 3, and 4 dimensions." );
+    assert( octaves > 0 );
+
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        assert( p[d].size() >= out.size() );
+        assert( derivatives[0].empty() || derivatives[d].size() >= out.size() );
+    }
+
+    pool.parallelFor( 0, out.size(), NOISE_GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+        noiseRange<K>( p, out, derivatives, octaves, lacunarity, gain, turbulence, seed, begin, end );
+    } );
+}
+
+template<Noise K, typename T, std::size_t N>
+T noise( const Vector<T, N>& p, std::type_identity_t<Vector<T, N>>* derivative, int octaves, T lacunarity, T gain, bool turbulence, uint32_t seed ) noexcept
+{
+    static_assert( N >= 2 && N <= 4, "Noise is only defined in 2, 3, and 4 dimensions." );
+    assert( octaves > 0 );
+
+    T x[N], dn[N];
+    for ( std::size_t d = 0; d < N; ++d )
+        x[d] = p[d];
+
+    const T value = fractal<K>( x, octaves, lacunarity, gain, turbulence, seed, derivative ? dn : nullptr );
+    if ( derivative )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            ( *derivative )[d] = dn[d];
+    }
+
+    return value;
+}
+
+}  // namespace detail
+
+/// <summary>
+/// Evaluate Perlin noise.
+/// </summary>
+/// <remarks>
+/// The noise is \f( C^2 \f) continuous, is 0 on the integer lattice, and its values are in the range \f([-1 \ldots 1]\f).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<typename T, std::size_t N>
+T perlin( const Vector<T, N>& p, uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<Noise::Perlin>( p, nullptr, 1, T( 2 ), T( 0.5 ), false, seed );
+}
+
+/// <summary>
+/// Evaluate Perlin noise and its analytic derivative.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="derivative">Receives the gradient of the noise at `p`.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<typename T, std::size_t N>
+T perlin( const Vector<T, N>& p, Vector<T, N>& derivative, uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<Noise::Perlin>( p, &derivative, 1, T( 2 ), T( 0.5 ), false, seed );
+}
+
+/// <summary>
+/// Evaluate simplex noise.
+/// </summary>
+/// <remarks>
+/// The noise is \f( C^2 \f) continuous and its values are in the range \f([-1 \ldots 1]\f).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<typename T, std::size_t N>
+T simplex( const Vector<T, N>& p, uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<Noise::Simplex>( p, nullptr, 1, T( 2 ), T( 0.5 ), false, seed );
+}
+
+/// <summary>
+/// Evaluate simplex noise and its analytic derivative.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="derivative">Receives the gradient of the noise at `p`.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<typename T, std::size_t N>
+T simplex( const Vector<T, N>& p, Vector<T, N>& derivative, uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<Noise::Simplex>( p, &derivative, 1, T( 2 ), T( 0.5 ), false, seed );
+}
+
+/// <summary>
+/// Evaluate value noise.
+/// </summary>
+/// <remarks>
+/// The noise is \f( C^2 \f) continuous, its derivative is 0 on the integer lattice, and its values are in the range
+/// \f([-1 \ldots 1]\f).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<typename T, std::size_t N>
+T valueNoise( const Vector<T, N>& p, uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<Noise::Value>( p, nullptr, 1, T( 2 ), T( 0.5 ), false, seed );
+}
+
+/// <summary>
+/// Evaluate value noise and its analytic derivative.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="derivative">Receives the gradient of the noise at `p`.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<typename T, std::size_t N>
+T valueNoise( const Vector<T, N>& p, Vector<T, N>& derivative, uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<Noise::Value>( p, &derivative, 1, T( 2 ), T( 0.5 ), false, seed );
+}
+
+/// <summary>
+/// Evaluate fractal Brownian motion: the sum of several octaves of noise with increasing frequencies and
+/// decreasing amplitudes.
+/// </summary>
+/// <remarks>
+/// Octave \f( i \f) has the frequency \f( lacunarity^i \f) and the amplitude \f( gain^i \f), and uses a differently seeded
+/// lattice (derived from `seed`, so different seeds give uncorrelated layers). The sum is divided by the sum of the amplitudes, so the values are in the range \f([-1 \ldots 1]\f).
+/// </remarks>
+/// <typeparam name="K">(optional) The noise function.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="octaves">The number of octaves (must be at least 1).</param>
+/// <param name="lacunarity">(optional) The frequency multiplier between octaves.</param>
+/// <param name="gain">(optional) The amplitude multiplier between octaves.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<Noise K = Noise::Simplex, typename T, std::size_t N>
+T fbm( const Vector<T, N>& p, int octaves, std::type_identity_t<T> lacunarity = T( 2 ), std::type_identity_t<T> gain = T( 0.5 ), uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<K>( p, nullptr, octaves, lacunarity, gain, false, seed );
+}
+
+/// <summary>
+/// Evaluate fractal Brownian motion and its analytic derivative.
+/// </summary>
+/// <typeparam name="K">(optional) The noise function.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="derivative">Receives the gradient of the noise at `p`.</param>
+/// <param name="octaves">The number of octaves (must be at least 1).</param>
+/// <param name="lacunarity">(optional) The frequency multiplier between octaves.</param>
+/// <param name="gain">(optional) The amplitude multiplier between octaves.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<Noise K = Noise::Simplex, typename T, std::size_t N>
+T fbm( const Vector<T, N>& p, Vector<T, N>& derivative, int octaves, std::type_identity_t<T> lacunarity = T( 2 ), std::type_identity_t<T> gain = T( 0.5 ),
+       uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<K>( p, &derivative, octaves, lacunarity, gain, false, seed );
+}
+
+/// <summary>
+/// Evaluate turbulence: fractal Brownian motion of the absolute value of the noise.
+/// </summary>
+/// <remarks>
+/// The values are in the range \f([0 \ldots 1]\f). The creases where the noise crosses 0 make turbulence useful for
+/// fire, smoke, and marble-like patterns.
+/// </remarks>
+/// <typeparam name="K">(optional) The noise function.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="octaves">The number of octaves (must be at least 1).</param>
+/// <param name="lacunarity">(optional) The frequency multiplier between octaves.</param>
+/// <param name="gain">(optional) The amplitude multiplier between octaves.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<Noise K = Noise::Simplex, typename T, std::size_t N>
+T turbulence( const Vector<T, N>& p, int octaves, std::type_identity_t<T> lacunarity = T( 2 ), std::type_identity_t<T> gain = T( 0.5 ), uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<K>( p, nullptr, octaves, lacunarity, gain, true, seed );
+}
+
+/// <summary>
+/// Evaluate turbulence and its analytic derivative (where the noise is not 0).
+/// </summary>
+/// <typeparam name="K">(optional) The noise function.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The point at which to evaluate the noise.</param>
+/// <param name="derivative">Receives the gradient of the noise at `p`.</param>
+/// <param name="octaves">The number of octaves (must be at least 1).</param>
+/// <param name="lacunarity">(optional) The frequency multiplier between octaves.</param>
+/// <param name="gain">(optional) The amplitude multiplier between octaves.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <returns>The value of the noise.</returns>
+template<Noise K = Noise::Simplex, typename T, std::size_t N>
+T turbulence( const Vector<T, N>& p, Vector<T, N>& derivative, int octaves, std::type_identity_t<T> lacunarity = T( 2 ), std::type_identity_t<T> gain = T( 0.5 ),
+              uint32_t seed = 0 ) noexcept
+{
+    return detail::noise<K>( p, &derivative, octaves, lacunarity, gain, true, seed );
+}
+
+/// <summary>
+/// Evaluate Perlin noise for a batch of points.
+/// </summary>
+/// <remarks>
+/// The points are stored as a structure of arrays (one array for each coordinate). The points are split into chunks
+/// that are evaluated in parallel, and single-precision points are evaluated 8 at a time with AVX2.
+/// \code
+/// std::vector<float> x( count ), y( count ), z( count ), value( count );
+/// perlin<float, 3>( { x, y, z }, value );
+/// \endcode
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The coordinates of the points.</param>
+/// <param name="values">Receives the values of the noise.</param>
+/// <param name="derivatives">(optional) Receives the components of the gradient of the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T, std::size_t N>
+void perlin( const std::array<std::span<const T>, N>& p, std::span<T> values, const std::array<std::span<T>, N>& derivatives = {}, uint32_t seed = 0,
+             ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::noise<Noise::Perlin>( p, values, derivatives, 1, T( 2 ), T( 0.5 ), false, seed, pool );
+}
+
+/// <summary>
+/// Evaluate simplex noise for a batch of points.
+/// </summary>
+/// <remarks>
+/// See `perlin` for details.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The coordinates of the points.</param>
+/// <param name="values">Receives the values of the noise.</param>
+/// <param name="derivatives">(optional) Receives the components of the gradient of the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T, std::size_t N>
+void simplex( const std::array<std::span<const T>, N>& p, std::span<T> values, const std::array<std::span<T>, N>& derivatives = {}, uint32_t seed = 0,
+              ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::noise<Noise::Simplex>( p, values, derivatives, 1, T( 2 ), T( 0.5 ), false, seed, pool );
+}
+
+/// <summary>
+/// Evaluate value noise for a batch of points.
+/// </summary>
+/// <remarks>
+/// See `perlin` for details.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The coordinates of the points.</param>
+/// <param name="values">Receives the values of the noise.</param>
+/// <param name="derivatives">(optional) Receives the components of the gradient of the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T, std::size_t N>
+void valueNoise( const std::array<std::span<const T>, N>& p, std::span<T> values, const std::array<std::span<T>, N>& derivatives = {}, uint32_t seed = 0,
+                 ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::noise<Noise::Value>( p, values, derivatives, 1, T( 2 ), T( 0.5 ), false, seed, pool );
+}
+
+/// <summary>
+/// Evaluate fractal Brownian motion for a batch of points.
+/// </summary>
+/// <remarks>
+/// See `perlin` for details.
+/// </remarks>
+/// <typeparam name="K">The noise function.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The coordinates of the points.</param>
+/// <param name="values">Receives the values of the noise.</param>
+/// <param name="octaves">The number of octaves (must be at least 1).</param>
+/// <param name="lacunarity">The frequency multiplier between octaves.</param>
+/// <param name="gain">The amplitude multiplier between octaves.</param>
+/// <param name="derivatives">(optional) Receives the components of the gradient of the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<Noise K, typename T, std::size_t N>
+void fbm( const std::array<std::span<const T>, N>& p, std::span<T> values, int octaves, T lacunarity, T gain,
+          const std::array<std::span<T>, N>& derivatives = {}, uint32_t seed = 0, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::noise<K>( p, values, derivatives, octaves, lacunarity, gain, false, seed, pool );
+}
+
+/// <summary>
+/// Evaluate turbulence for a batch of points.
+/// </summary>
+/// <remarks>
+/// See `perlin` for details.
+/// </remarks>
+/// <typeparam name="K">The noise function.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of dimensions (2, 3, or 4).</typeparam>
+/// <param name="p">The coordinates of the points.</param>
+/// <param name="values">Receives the values of the noise.</param>
+/// <param name="octaves">The number of octaves (must be at least 1).</param>
+/// <param name="lacunarity">The frequency multiplier between octaves.</param>
+/// <param name="gain">The amplitude multiplier between octaves.</param>
+/// <param name="derivatives">(optional) Receives the components of the gradient of the noise.</param>
+/// <param name="seed">(optional) Selects an uncorrelated noise field.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<Noise K, typename T, std::size_t N>
+void turbulence( const std::array<std::span<const T>, N>& p, std::span<T> values, int octaves, T lacunarity, T gain,
+                 const std::array<std::span<T>, N>& derivatives = {}, uint32_t seed = 0, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::noise<K>( p, values, derivatives, octaves, lacunarity, gain, true, seed, pool );
+}
+
+}  // namespace FastMath
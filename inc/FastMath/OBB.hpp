@@ -0,0 +1,465 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Ray.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// An oriented bounding box defined by a center point, half-extents and a rotation.
+/// </summary>
+/// <remarks>
+/// The columns of the rotation matrix are the local axes of the box in world space, that
+/// is, a point in the local space of the box is transformed to world space by
+/// \f(\mathbf{p}_{world} = \mathbf{c} + \mathbf{R}\mathbf{p}_{local}\f).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct OBB
+{
+    /// <summary>
+    /// The OBB value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Default construct an OBB at the origin with zero extents and no rotation.
+    /// </summary>
+    constexpr OBB() noexcept;
+
+    /// <summary>
+    /// Construct an OBB from a center, half-extents and a rotation matrix.
+    /// </summary>
+    /// <param name="center">The center of the box.</param>
+    /// <param name="halfExtents">The distance from the center to the faces of the box along each local axis.</param>
+    /// <param name="rotation">An orthonormal rotation matrix whose columns are the local axes of the box.</param>
+    constexpr OBB( const Vector<T, 3>& center, const Vector<T, 3>& halfExtents, const Matrix<T, 3, 3>& rotation ) noexcept;
+
+    /// <summary>
+    /// Construct an OBB from a center, half-extents and a rotation quaternion.
+    /// </summary>
+    /// <param name="center">The center of the box.</param>
+    /// <param name="halfExtents">The distance from the center to the faces of the box along each local axis.</param>
+    /// <param name="rotation">A unit quaternion that rotates the local axes of the box to world space.</param>
+    constexpr OBB( const Vector<T, 3>& center, const Vector<T, 3>& halfExtents, const Quaternion<T>& rotation ) noexcept;
+
+    /// <summary>
+    /// Construct an OBB from an AABB.
+    /// </summary>
+    /// <param name="aabb">The AABB.</param>
+    explicit constexpr OBB( const AABB<T>& aabb ) noexcept;
+
+    Vector<T, 3>    center;
+    Vector<T, 3>    halfExtents;
+    Matrix<T, 3, 3> rotation;
+};
+
+using OBBf = OBB<float>;
+using OBBd = OBB<double>;
+
+/// <summary>
+/// A structure-of-arrays view over a set of OBBs. This is the layout expected by
+/// the 8-wide batch functions.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size. The rotation matrices are stored in row-major
+/// order (`rotation[3 * i + j]` is row `i`, column `j`).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct OBBSoA
+{
+    std::span<const T> cx, cy, cz;
+    std::span<const T> ex, ey, ez;
+    std::span<const T> rotation[9];
+
+    /// <summary>
+    /// Get the number of OBBs in the view.
+    /// </summary>
+    /// <returns>The number of OBBs.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return cx.size();
+    }
+};
+
+template<typename T>
+constexpr OBB<T>::OBB() noexcept
+: center { T( 0 ) }
+, halfExtents { T( 0 ) }
+, rotation { Matrix<T, 3, 3>::IDENTITY }
+{}
+
+template<typename T>
+constexpr OBB<T>::OBB( const Vector<T, 3>& center, const Vector<T, 3>& halfExtents, const Matrix<T, 3, 3>& rotation ) noexcept
+: center { center }
+, halfExtents { halfExtents }
+, rotation { rotation }
+{}
+
+template<typename T>
+constexpr OBB<T>::OBB( const Vector<T, 3>& center, const Vector<T, 3>& halfExtents, const Quaternion<T>& rotation ) noexcept
+: center { center }
+, halfExtents { halfExtents }
+, rotation { toMat3( rotation ) }
+{}
+
+template<typename T>
+constexpr OBB<T>::OBB( const AABB<T>& aabb ) noexcept
+: center { FastMath::center( aabb ) }
+, halfExtents { extents( aabb ) }
+, rotation { Matrix<T, 3, 3>::IDENTITY }
+{}
+
+/// <summary>
+/// Get one of the local axes of an OBB in world space.
+/// </summary>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="o">The OBB.</param>
+/// <param name="i">The index of the axis (0, 1 or 2).</param>
+/// <returns>The \f(i^{th}\f) column of the rotation matrix.</returns>
+template<typename T>
+constexpr Vector<T, 3> axis( const OBB<T>& o, std::size_t i ) noexcept
+{
+    assert( i < 3 );
+    return { o.rotation[0][i], o.rotation[1][i], o.rotation[2][i] };
+}
+
+/// <summary>
+/// Fit an OBB to a set of points using principal component analysis.
+/// </summary>
+/// <remarks>
+/// The axes of the box are the eigenvectors of the covariance matrix of the points. The
+/// result is a good (but not optimal) fit for point sets that have a dominant direction.
+/// </remarks>
+/// <typeparam name="T">The point type.</typeparam>
+/// <param name="points">The points to fit.</param>
+/// <returns>An OBB that contains all of the points.</returns>
+template<typename T>
+OBB<T> fitOBB( std::span<const Vector<T, 3>> points ) noexcept
+{
+    if ( points.empty() )
+        return {};
+
+    // Mean.
+    Vector<T, 3> mean { T( 0 ) };
+    for ( const auto& p: points )
+        mean += p;
+    mean /= static_cast<T>( points.size() );
+
+    // Covariance.
+    Matrix<T, 3, 3> covariance {};
+    for ( const auto& p: points )
+    {
+        const Vector<T, 3> d = p - mean;
+        for ( std::size_t i = 0; i < 3; ++i )
+            for ( std::size_t j = i; j < 3; ++j )
+                covariance[i][j] += d[i] * d[j];
+    }
+    for ( std::size_t i = 0; i < 3; ++i )
+        for ( std::size_t j = 0; j < i; ++j )
+            covariance[i][j] = covariance[j][i];
+
+    Vector<T, 3>    eigenValues;
+    Matrix<T, 3, 3> eigenVectors;
+    eigenSymmetric( covariance, eigenValues, eigenVectors );
+
+    // Make sure the axes form a right-handed basis.
+    const Vector<T, 3> u { eigenVectors[0][0], eigenVectors[1][0], eigenVectors[2][0] };
+    const Vector<T, 3> v { eigenVectors[0][1], eigenVectors[1][1], eigenVectors[2][1] };
+    const Vector<T, 3> w = cross( u, v );
+
+    const Matrix<T, 3, 3> rotation {
+        u.x, v.x, w.x,
+        u.y, v.y, w.y,
+        u.z, v.z, w.z
+    };
+
+    // Project the points onto the axes to find the extents.
+    Vector<T, 3> minP { std::numeric_limits<T>::max() };
+    Vector<T, 3> maxP { std::numeric_limits<T>::lowest() };
+    for ( const auto& p: points )
+    {
+        const Vector<T, 3> d = p - mean;
+        const Vector<T, 3> l { dot( d, u ), dot( d, v ), dot( d, w ) };
+        for ( std::size_t i = 0; i < 3; ++i )
+        {
+            minP[i] = std::min( minP[i], l[i] );
+            maxP[i] = std::max( maxP[i], l[i] );
+        }
+    }
+
+    return { mean + rotation * ( ( minP + maxP ) * T( 0.5 ) ), ( maxP - minP ) * T( 0.5 ), rotation };
+}
+
+/// <summary>
+/// Compute the AABB that bounds an OBB.
+/// </summary>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="o">The OBB.</param>
+/// <returns>The AABB that bounds the OBB.</returns>
+template<typename T>
+constexpr AABB<T> toAABB( const OBB<T>& o ) noexcept
+{
+    Vector<T, 3> e;
+    for ( std::size_t i = 0; i < 3; ++i )
+        e[i] = std::abs( o.rotation[i][0] ) * o.halfExtents.x + std::abs( o.rotation[i][1] ) * o.halfExtents.y + std::abs( o.rotation[i][2] ) * o.halfExtents.z;
+
+    return { o.center - e, o.center + e };
+}
+
+/// <summary>
+/// Check to see if a point is inside (or on the boundary of) an OBB.
+/// </summary>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="o">The OBB.</param>
+/// <param name="p">The point to check.</param>
+/// <returns>`true` if `p` is contained in `o`, `false` otherwise.</returns>
+template<typename T>
+constexpr bool contains( const OBB<T>& o, const Vector<T, 3>& p ) noexcept
+{
+    const Vector<T, 3> l = transpose( o.rotation ) * ( p - o.center );
+
+    return std::abs( l.x ) <= o.halfExtents.x && std::abs( l.y ) <= o.halfExtents.y && std::abs( l.z ) <= o.halfExtents.z;
+}
+
+/// <summary>
+/// Check to see if two OBBs overlap using the separating axis theorem.
+/// </summary>
+/// <remarks>
+/// The 15 potential separating axes are the 3 face normals of each box and the 9 cross
+/// products of their edges. The test returns as soon as a separating axis is found. A small
+/// epsilon is added to the rotation terms to make the test robust when edges are (nearly) parallel.
+/// </remarks>
+/// <seealso href="https://realtimecollisiondetection.net/"/>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="a">The first OBB.</param>
+/// <param name="b">The second OBB.</param>
+/// <returns>`true` if the boxes overlap, `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const OBB<T>& a, const OBB<T>& b ) noexcept
+{
+    // Express b in the coordinate frame of a.
+    const Matrix<T, 3, 3> rt = transpose( a.rotation );
+    const Matrix<T, 3, 3> R  = rt * b.rotation;
+    const Vector<T, 3>    t  = rt * ( b.center - a.center );
+
+    const Vector<T, 3>& ea = a.halfExtents;
+    const Vector<T, 3>& eb = b.halfExtents;
+
+    Matrix<T, 3, 3> absR;
+    for ( std::size_t i = 0; i < 3; ++i )
+        for ( std::size_t j = 0; j < 3; ++j )
+            absR[i][j] = std::abs( R[i][j] ) + T( 1e-6 );
+
+    // Axes of a.
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const T rb = eb.x * absR[i][0] + eb.y * absR[i][1] + eb.z * absR[i][2];
+        if ( std::abs( t[i] ) > ea[i] + rb )
+            return false;
+    }
+
+    // Axes of b.
+    for ( std::size_t j = 0; j < 3; ++j )
+    {
+        const T ra = ea.x * absR[0][j] + ea.y * absR[1][j] + ea.z * absR[2][j];
+        if ( std::abs( t.x * R[0][j] + t.y * R[1][j] + t.z * R[2][j] ) > ra + eb[j] )
+            return false;
+    }
+
+    // Cross products of the axes of a and b.
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const std::size_t i1 = ( i + 1 ) % 3;
+        const std::size_t i2 = ( i + 2 ) % 3;
+
+        for ( std::size_t j = 0; j < 3; ++j )
+        {
+            const std::size_t j1 = ( j + 1 ) % 3;
+            const std::size_t j2 = ( j + 2 ) % 3;
+
+            const T ra = ea[i1] * absR[i2][j] + ea[i2] * absR[i1][j];
+            const T rb = eb[j1] * absR[i][j2] + eb[j2] * absR[i][j1];
+            if ( std::abs( t[i2] * R[i1][j] - t[i1] * R[i2][j] ) > ra + rb )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Check to see if an OBB and an AABB overlap using the separating axis theorem.
+/// </summary>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="o">The OBB.</param>
+/// <param name="a">The AABB.</param>
+/// <returns>`true` if the boxes overlap, `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const OBB<T>& o, const AABB<T>& a ) noexcept
+{
+    return intersects( OBB<T> { a }, o );
+}
+
+/// <summary>
+/// Intersect a ray with an OBB.
+/// </summary>
+/// <remarks>
+/// The ray is transformed into the local space of the box and tested against the box
+/// using the slab test. Since the rotation is orthonormal, distances are preserved.
+/// </remarks>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="o">The OBB.</param>
+/// <param name="t">If the ray hits the box, receives the distance to the entry point (or `tMin` if the origin is inside the box).</param>
+/// <param name="tMin">The minimum distance along the ray to consider.</param>
+/// <param name="tMax">The maximum distance along the ray to consider.</param>
+/// <returns>`true` if the ray hits the box in the range \f([t_{min} \ldots t_{max}]\f), `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Ray<T>& r, const OBB<T>& o, T& t, T tMin = T( 0 ), T tMax = std::numeric_limits<T>::max() ) noexcept
+{
+    const Matrix<T, 3, 3> rt = transpose( o.rotation );
+    const Ray<T>          local { rt * ( r.origin - o.center ), rt * r.direction };
+
+    return intersects( local, AABB<T> { -o.halfExtents, o.halfExtents }, t, tMin, tMax );
+}
+
+/// <summary>
+/// Test pairs of OBBs for overlap: box `i` of `a` is tested against box `i` of `b`.
+/// The indices of the overlapping pairs are written to `overlapping`.
+/// </summary>
+/// <remarks>
+/// For single-precision input, 8 pairs are tested per iteration when AVX2 is enabled.
+/// All 15 axes are evaluated for the 8 pairs in lock-step and the iteration ends early once
+/// all 8 pairs are separated. The indices are written in increasing order. `overlapping`
+/// must have room for at least `a.size()` indices.
+/// </remarks>
+/// <typeparam name="T">The OBB type.</typeparam>
+/// <param name="a">The first box of each pair (in SoA layout).</param>
+/// <param name="b">The second box of each pair (in SoA layout). Must have the same size as `a`.</param>
+/// <param name="overlapping">Receives the indices of the pairs that overlap.</param>
+/// <returns>The number of overlapping pairs written to `overlapping`.</returns>
+template<typename T>
+std::size_t intersectPairs( const OBBSoA<T>& a, const OBBSoA<T>& b, std::span<uint32_t> overlapping ) noexcept
+{
+    const std::size_t count = a.size();
+
+    assert( b.size() == count );
+    assert( overlapping.size() >= count );
+
+    std::size_t i = 0;
+    std::size_t n = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 signBit = _mm256_set1_ps( -0.0f );
+        const __m256 epsilon = _mm256_set1_ps( 1e-6f );
+
+        auto abs = [&]( __m256 x ) { return _mm256_andnot_ps( signBit, x ); };
+        auto mad = []( __m256 x, __m256 y, __m256 z ) { return _mm256_add_ps( _mm256_mul_ps( x, y ), z ); };
+
+        for ( ; i + Simd::WIDTH <= count; i += Simd::WIDTH )
+        {
+            __m256 ra[9], rb[9];
+            for ( std::size_t k = 0; k < 9; ++k )
+            {
+                ra[k] = _mm256_loadu_ps( a.rotation[k].data() + i );
+                rb[k] = _mm256_loadu_ps( b.rotation[k].data() + i );
+            }
+
+            const __m256 ea[3] = { _mm256_loadu_ps( a.ex.data() + i ), _mm256_loadu_ps( a.ey.data() + i ), _mm256_loadu_ps( a.ez.data() + i ) };
+            const __m256 eb[3] = { _mm256_loadu_ps( b.ex.data() + i ), _mm256_loadu_ps( b.ey.data() + i ), _mm256_loadu_ps( b.ez.data() + i ) };
+            const __m256 d[3]  = {
+                _mm256_sub_ps( _mm256_loadu_ps( b.cx.data() + i ), _mm256_loadu_ps( a.cx.data() + i ) ),
+                _mm256_sub_ps( _mm256_loadu_ps( b.cy.data() + i ), _mm256_loadu_ps( a.cy.data() + i ) ),
+                _mm256_sub_ps( _mm256_loadu_ps( b.cz.data() + i ), _mm256_loadu_ps( a.cz.data() + i ) )
+            };
+
+            // R = A^T * B and t = A^T * d
+            __m256 R[3][3], absR[3][3], t[3];
+            for ( std::size_t r = 0; r < 3; ++r )
+            {
+                t[r] = mad( ra[r], d[0], mad( ra[3 + r], d[1], _mm256_mul_ps( ra[6 + r], d[2] ) ) );
+                for ( std::size_t c = 0; c < 3; ++c )
+                {
+                    R[r][c]    = mad( ra[r], rb[c], mad( ra[3 + r], rb[3 + c], _mm256_mul_ps( ra[6 + r], rb[6 + c] ) ) );
+                    absR[r][c] = _mm256_add_ps( abs( R[r][c] ), epsilon );
+                }
+            }
+
+            __m256 separated = _mm256_setzero_ps();
+
+            // Axes of a and b.
+            for ( std::size_t k = 0; k < 3; ++k )
+            {
+                const __m256 rbA = mad( eb[0], absR[k][0], mad( eb[1], absR[k][1], _mm256_mul_ps( eb[2], absR[k][2] ) ) );
+                separated        = _mm256_or_ps( separated, _mm256_cmp_ps( abs( t[k] ), _mm256_add_ps( ea[k], rbA ), _CMP_GT_OQ ) );
+
+                const __m256 raB  = mad( ea[0], absR[0][k], mad( ea[1], absR[1][k], _mm256_mul_ps( ea[2], absR[2][k] ) ) );
+                const __m256 dist = mad( t[0], R[0][k], mad( t[1], R[1][k], _mm256_mul_ps( t[2], R[2][k] ) ) );
+                separated         = _mm256_or_ps( separated, _mm256_cmp_ps( abs( dist ), _mm256_add_ps( raB, eb[k] ), _CMP_GT_OQ ) );
+            }
+
+            // Skip the edge axes if all pairs are already separated.
+            if ( _mm256_movemask_ps( separated ) != 0xff )
+            {
+                for ( std::size_t k = 0; k < 3; ++k )
+                {
+                    const std::size_t k1 = ( k + 1 ) % 3;
+                    const std::size_t k2 = ( k + 2 ) % 3;
+
+                    for ( std::size_t j = 0; j < 3; ++j )
+                    {
+                        const std::size_t j1 = ( j + 1 ) % 3;
+                        const std::size_t j2 = ( j + 2 ) % 3;
+
+                        const __m256 rA   = mad( ea[k1], absR[k2][j], _mm256_mul_ps( ea[k2], absR[k1][j] ) );
+                        const __m256 rB   = mad( eb[j1], absR[k][j2], _mm256_mul_ps( eb[j2], absR[k][j1] ) );
+                        const __m256 dist = _mm256_sub_ps( _mm256_mul_ps( t[k2], R[k1][j] ), _mm256_mul_ps( t[k1], R[k2][j] ) );
+                        separated         = _mm256_or_ps( separated, _mm256_cmp_ps( abs( dist ), _mm256_add_ps( rA, rB ), _CMP_GT_OQ ) );
+                    }
+                }
+            }
+
+            const uint32_t mask = ~static_cast<uint32_t>( _mm256_movemask_ps( separated ) ) & 0xffu;
+            n += Simd::compressIndices8( static_cast<uint32_t>( i ), mask, overlapping.data() + n );
+        }
+    }
+#endif
+
+    for ( ; i < count; ++i )
+    {
+        auto load = []( const OBBSoA<T>& s, std::size_t k ) {
+            OBB<T> o;
+            o.center      = { s.cx[k], s.cy[k], s.cz[k] };
+            o.halfExtents = { s.ex[k], s.ey[k], s.ez[k] };
+            for ( std::size_t r = 0; r < 3; ++r )
+                for ( std::size_t c = 0; c < 3; ++c )
+                    o.rotation[r][c] = s.rotation[r * 3 + c][k];
+
+            return o;
+        };
+
+        if ( intersects( load( a, i ), load( b, i ) ) )
+            overlapping[n++] = static_cast<uint32_t>( i );
+    }
+
+    return n;
+}
+
+}  // namespace FastMath
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Vector.hpp"
+
+#include <span>
+
+/// <summary>
+/// Robust geometric predicates.
+/// </summary>
+/// <remarks>
+/// These are adaptive-precision predicates in the style of Shewchuk: each predicate first
+/// evaluates the determinant in double precision together with a bound on its rounding error.
+/// Only if the sign cannot be decided from that estimate is the determinant recomputed
+/// (in progressively more precise stages) using floating-point expansion arithmetic, which
+/// always produces the correct sign.
+///
+/// The predicates are compiled in `src/Predicates.cpp` without `-ffast-math` (`/fp:precise` on
+/// MSVC) and without floating-point contraction, so they remain exact even though the rest of the
+/// library (and the code that calls them) is compiled with fast-math. As with the original
+/// implementation, the results are exact as long as no intermediate value overflows or underflows.
+/// </remarks>
+/// <seealso href="https://www.cs.cmu.edu/~quake/robust.html"/>
+namespace FastMath::Predicates
+{
+
+/// <summary>
+/// Determine the orientation of three points in the plane.
+/// </summary>
+/// <param name="a">The first point.</param>
+/// <param name="b">The second point.</param>
+/// <param name="c">The third point.</param>
+/// <returns>
+/// A positive value if `a`, `b`, and `c` are in counterclockwise order, a negative value if they
+/// are in clockwise order, and zero if they are collinear. The magnitude is approximately twice the
+/// signed area of the triangle.
+/// </returns>
+double orient2d( const Vector2d& a, const Vector2d& b, const Vector2d& c ) noexcept;
+
+/// <summary>
+/// Determine the orientation of a point relative to the plane through three points.
+/// </summary>
+/// <param name="a">The first point on the plane.</param>
+/// <param name="b">The second point on the plane.</param>
+/// <param name="c">The third point on the plane.</param>
+/// <param name="d">The point to test.</param>
+/// <returns>
+/// A positive value if `d` lies below the plane through `a`, `b`, and `c` (where "below" means that
+/// `a`, `b`, and `c` appear in counterclockwise order when viewed from above the plane), a negative value
+/// if `d` lies above the plane, and zero if the points are coplanar. The magnitude is approximately
+/// six times the signed volume of the tetrahedron.
+/// </returns>
+double orient3d( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d ) noexcept;
+
+/// <summary>
+/// Determine whether a point lies inside the circle through three points.
+/// </summary>
+/// <param name="a">The first point on the circle.</param>
+/// <param name="b">The second point on the circle.</param>
+/// <param name="c">The third point on the circle.</param>
+/// <param name="d">The point to test.</param>
+/// <returns>
+/// A positive value if `d` lies inside the circle, a negative value if it lies outside, and zero if
+/// the four points are cocircular. `a`, `b`, and `c` must be in counterclockwise order
+/// (`orient2d( a, b, c ) > 0`), otherwise the sign of the result is reversed.
+/// </returns>
+double incircle( const Vector2d& a, const Vector2d& b, const Vector2d& c, const Vector2d& d ) noexcept;
+
+/// <summary>
+/// Determine whether a point lies inside the sphere through four points.
+/// </summary>
+/// <param name="a">The first point on the sphere.</param>
+/// <param name="b">The second point on the sphere.</param>
+/// <param name="c">The third point on the sphere.</param>
+/// <param name="d">The fourth point on the sphere.</param>
+/// <param name="e">The point to test.</param>
+/// <returns>
+/// A positive value if `e` lies inside the sphere, a negative value if it lies outside, and zero if
+/// the five points are cospherical. `a`, `b`, `c`, and `d` must have a positive orientation
+/// (`orient3d( a, b, c, d ) > 0`), otherwise the sign of the result is reversed.
+/// </returns>
+double insphere( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, const Vector3d& e ) noexcept;
+
+/// <summary>
+/// Determine the orientation of many points relative to a line.
+/// </summary>
+/// <remarks>
+/// When AVX2 is enabled, the floating-point filter is evaluated for 4 points per iteration and only
+/// the points whose sign is uncertain are recomputed with the adaptive predicate.
+/// </remarks>
+/// <param name="a">The first point on the line.</param>
+/// <param name="b">The second point on the line.</param>
+/// <param name="points">The points to test.</param>
+/// <param name="results">Receives `orient2d( a, b, points[i] )` for each point. Must have room for `points.size()` values.</param>
+void orient2d( const Vector2d& a, const Vector2d& b, std::span<const Vector2d> points, std::span<double> results ) noexcept;
+
+/// <summary>
+/// Determine the orientation of many points relative to a plane.
+/// </summary>
+/// <remarks>
+/// When AVX2 is enabled, the floating-point filter is evaluated for 4 points per iteration and only
+/// the points whose sign is uncertain are recomputed with the adaptive predicate.
+/// </remarks>
+/// <param name="a">The first point on the plane.</param>
+/// <param name="b">The second point on the plane.</param>
+/// <param name="c">The third point on the plane.</param>
+/// <param name="points">The points to test.</param>
+/// <param name="results">Receives `orient3d( a, b, c, points[i] )` for each point. Must have room for `points.size()` values.</param>
+void orient3d( const Vector3d& a, const Vector3d& b, const Vector3d& c, std::span<const Vector3d> points, std::span<double> results ) noexcept;
+
+/// <summary>
+/// Determine whether many points lie inside the circle through three points.
+/// </summary>
+/// <remarks>
+/// When AVX2 is enabled, the floating-point filter is evaluated for 4 points per iteration and only
+/// the points whose sign is uncertain are recomputed with the adaptive predicate.
+/// </remarks>
+/// <param name="a">The first point on the circle.</param>
+/// <param name="b">The second point on the circle.</param>
+/// <param name="c">The third point on the circle.</param>
+/// <param name="points">The points to test.</param>
+/// <param name="results">Receives `incircle( a, b, c, points[i] )` for each point. Must have room for `points.size()` values.</param>
+void incircle( const Vector2d& a, const Vector2d& b, const Vector2d& c, std::span<const Vector2d> points, std::span<double> results ) noexcept;
+
+/// <summary>
+/// Determine whether many points lie inside the sphere through four points.
+/// </summary>
+/// <remarks>
+/// When AVX2 is enabled, the floating-point filter is evaluated for 4 points per iteration and only
+/// the points whose sign is uncertain are recomputed with the adaptive predicate.
+/// </remarks>
+/// <param name="a">The first point on the sphere.</param>
+/// <param name="b">The second point on the sphere.</param>
+/// <param name="c">The third point on the sphere.</param>
+/// <param name="d">The fourth point on the sphere.</param>
+/// <param name="points">The points to test.</param>
+/// <param name="results">Receives `insphere( a, b, c, d, points[i] )` for each point. Must have room for `points.size()` values.</param>
+void insphere( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, std::span<const Vector3d> points, std::span<double> results ) noexcept;
+
+}  // namespace FastMath::Predicates
@@ -6,7 +6,10 @@
 #include "QuaternionBase.hpp"
 #include "Vector.hpp"
 
+#include <cassert>
 #include <cstddef>
+#include <span>
+#include <type_traits>
 
 namespace FastMath
 {
@@ -945,7 +948,8 @@ constexpr Vector<T, 3> axis( const Quaternion<T>& q, const Vector<T, 3>& v = { 0
 template<typename T>
 constexpr Quaternion<T> axisAngle( const Vector<T, 3>& axis, T angle ) noexcept
 {
-    assert( isNormalized( axis ) );  // Axis must be normalized.
+    // Axis must be normalized (allowing for the rounding error of normalize()).
+    assert( isNormalized( axis, T( 8 ) * EPSILON<T> ) );
 
     const T s = std::sin( angle * T( 0.5 ) );
     const T c = std::cos( angle * T( 0.5 ) );
@@ -1131,6 +1135,28 @@ constexpr Quaternion<T> lerp( const Quaternion<T>& q0, const Quaternion<T>& q1,
     return q0 * ( T( 1 ) - t ) + q1 * t;
 }
 
+/// <summary>
+/// Normalized linear interpolation (nlerp) of two quaternions.
+/// </summary>
+/// <remarks>
+/// The interpolation takes the shortest path between `q0` and `q1` and the result is
+/// renormalized. Unlike slerp, the rotation does not occur at a constant rate, but nlerp
+/// is much cheaper to evaluate and the difference is negligible for small angles
+/// (such as the angle between consecutive animation keys).
+/// </remarks>
+/// <typeparam name="T">The quaternion type.</typeparam>
+/// <param name="q0">The starting quaternion.</param>
+/// <param name="q1">The ending quaternion.</param>
+/// <param name="t">The interpolation factor (in the range [0..1]).</param>
+/// <returns>The normalized quaternion that is a linear interpolation between `q0` and `q1`.</returns>
+template<typename T>
+constexpr Quaternion<T> nlerp( const Quaternion<T>& q0, const Quaternion<T>& q1, const T t ) noexcept
+{
+    // Negate q1 if necessary to take the shortest path.
+    const Quaternion<T> q = dot( q0, q1 ) < T( 0 ) ? q1 * T( -1 ) : q1;
+    return normalize( lerp( q0, q, t ) );
+}
+
 /// <summary>
 /// Compute an intermediate control point (\f(s_i\f)) for use in squad interpolation.
 /// \f[ s_i=\exp\left(-\frac{\log\left(q_{i+1}q_i^{-1}\right)+\log\left(q_{i-1}q_i^{-1}\right)}{4}\right)q_i \f]
@@ -1165,25 +1191,79 @@ constexpr Quaternion<T> slerp( const Quaternion<T>& q0, const Quaternion<T>& q1,
 {
     T c = dot( q0, q1 );  // cosine angle between q0 and q1.
 
+    Quaternion<T> q = q1;
+    // If the cosine angle between q0 and q1 is < 0, then negate q1 so
+    // that the interpolation takes the shortest path from q0 to q1.
+    // This is done first, so that antipodal quaternions (which represent
+    // the same rotation) take the small angle path below.
+    if ( c < T( 0 ) )
+    {
+        // Note: unary negation of a quaternion is the conjugate.
+        q = q * T( -1 );
+        c = -c;
+    }
+
     // If cosine angle is close to 1, then the angle between q0 and q1
     // is very near 0. In this case, just perform a linear interpolation
     // to avoid divide by 0 error (when sin(a) ~= 0).
     if ( c > T( 1 ) - EPSILON<T> )
     {
-        return lerp( q0, q1, t );
+        return lerp( q0, q, t );
     }
 
-    Quaternion<T> q = q1;
-    // If the cosine angle between q0 and q1 is < 0, then negate q1 so
-    // that the interpolation takes the shortest path from q1 to q1.
-    if ( c < T( 0 ) )
+    const T a = std::acos( c );  // Compute the angle.
+    return ( q0 * std::sin( ( T( 1 ) - t ) * a ) + q * std::sin( t * a ) ) / std::sin( a );
+}
+
+/// <summary>
+/// Fast approximate spherical linear interpolation.
+/// </summary>
+/// <remarks>
+/// The slerp weights \f(\frac{\sin(1-t)\theta}{\sin\theta}\f) and \f(\frac{\sin t\theta}{\sin\theta}\f) are
+/// evaluated with a polynomial in \f(\cos\theta - 1\f) (Eberly) instead of calling `acos` and `sin`,
+/// so there is no special case (and no division) when the angle between the quaternions is close to 0.
+///
+/// The interpolation takes the shortest path between `q0` and `q1`. The absolute error of the weights is
+/// at most 2e-5 (when `q0` and `q1` are 180 degrees apart), and the error decreases rapidly as the angle
+/// gets smaller: it is below 1e-6 for rotations up to 120 degrees apart and below 2e-8 for rotations up
+/// to 90 degrees apart. For unit quaternions, this corresponds to a maximum angular error of the interpolated
+/// rotation of about 2e-5 radians (0.001 degrees). The result is not renormalized.
+/// </remarks>
+/// <seealso href="https://www.geometrictools.com/Documentation/FastAndAccurateSlerp.pdf"/>
+/// <typeparam name="T">The quaternion type.</typeparam>
+/// <param name="q0">The starting quaternion.</param>
+/// <param name="q1">The ending quaternion.</param>
+/// <param name="t">The interpolation parameter ([0..1]).</param>
+/// <returns>The interpolated quaternion \f(q_t\f).</returns>
+template<typename T>
+constexpr Quaternion<T> fastSlerp( const Quaternion<T>& q0, const Quaternion<T>& q1, const T t ) noexcept
+{
+    // The coefficients of the series are u_i = 1 / ( i( 2i + 1 ) ) and v_i = i / ( 2i + 1 ). The last
+    // term is scaled by 1 + mu to minimize the maximum error of the truncated series.
+    constexpr T MU   = T( 1.85298109240830 );
+    constexpr T u[8] = { T( 1 ) / T( 3 ), T( 1 ) / T( 10 ), T( 1 ) / T( 21 ), T( 1 ) / T( 36 ), T( 1 ) / T( 55 ), T( 1 ) / T( 78 ), T( 1 ) / T( 105 ), MU / T( 136 ) };
+    constexpr T v[8] = { T( 1 ) / T( 3 ), T( 2 ) / T( 5 ), T( 3 ) / T( 7 ), T( 4 ) / T( 9 ), T( 5 ) / T( 11 ), T( 6 ) / T( 13 ), T( 7 ) / T( 15 ), MU * T( 8 ) / T( 17 ) };
+
+    T c = dot( q0, q1 );  // cosine angle between q0 and q1.
+
+    // Negate q1 to take the shortest path.
+    const T sign = c < T( 0 ) ? T( -1 ) : T( 1 );
+    c *= sign;
+
+    const T cm1 = c - T( 1 );
+    const T d   = T( 1 ) - t;
+    const T tt  = t * t;
+    const T dd  = d * d;
+
+    T f0 = T( 1 );
+    T f1 = T( 1 );
+    for ( int i = 7; i >= 0; --i )
     {
-        q = -q;
-        c = -c;
+        f0 = T( 1 ) + ( u[i] * dd - v[i] ) * cm1 * f0;
+        f1 = T( 1 ) + ( u[i] * tt - v[i] ) * cm1 * f1;
     }
 
-    const T a = std::acos( c );  // Compute the angle.
-    return ( q0 * std::sin( ( T( 1 ) - t ) * a ) + q * std::sin( t * a ) ) / std::sin( a );
+    return q0 * ( d * f0 ) + q1 * ( sign * t * f1 );
 }
 
 /// <summary>
@@ -1203,6 +1283,153 @@ constexpr Quaternion<T> squad( const Quaternion<T>& q0, const Quaternion<T>& q1,
     return slerp( slerp( q0, q1, t ), slerp( s0, s1, t ), T( 2 ) * t * ( T( 1 ) - t ) );
 }
 
+/// <summary>
+/// Accumulates a weighted average of rotations (a weighted nlerp of any number of rotations).
+/// </summary>
+/// <remarks>
+/// Each rotation is added on the same hemisphere as the running sum (since \f(q\f) and \f(-q\f) represent
+/// the same rotation), and the average is the normalized sum. This is a good approximation of the true average
+/// when the rotations are close to each other (such as the rotations of a bone in several animation poses). Use
+/// `averageMarkley` when the rotations are far apart.
+/// </remarks>
+/// <typeparam name="T">The quaternion type.</typeparam>
+template<typename T>
+struct QuaternionAccumulator
+{
+    /// <summary>
+    /// The QuaternionAccumulator value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Add a rotation to the average.
+    /// </summary>
+    /// <param name="q">The rotation to add.</param>
+    /// <param name="weight">The weight of the rotation.</param>
+    constexpr void add( const Quaternion<T>& q, T weight = T( 1 ) ) noexcept;
+
+    /// <summary>
+    /// Get the sum of the weights of the rotations that were added.
+    /// </summary>
+    /// <returns>The total weight.</returns>
+    constexpr T getWeight() const noexcept;
+
+    /// <summary>
+    /// Get the (normalized) average of the rotations that were added.
+    /// </summary>
+    /// <returns>The average rotation, or the identity if nothing was added.</returns>
+    constexpr Quaternion<T> getAverage() const noexcept;
+
+    /// <summary>
+    /// Remove all of the rotations.
+    /// </summary>
+    constexpr void reset() noexcept;
+
+private:
+    // The weighted sum of the rotations.
+    Quaternion<T> sum { T( 0 ), T( 0 ), T( 0 ), T( 0 ) };
+    // The sum of the weights.
+    T weight = T( 0 );
+};
+
+template<typename T>
+constexpr void QuaternionAccumulator<T>::add( const Quaternion<T>& q, T _weight ) noexcept
+{
+    // Stay on the hemisphere of the rotations that were already added.
+    sum += q * ( dot( sum, q ) < T( 0 ) ? -_weight : _weight );
+    weight += _weight;
+}
+
+template<typename T>
+constexpr T QuaternionAccumulator<T>::getWeight() const noexcept
+{
+    return weight;
+}
+
+template<typename T>
+constexpr Quaternion<T> QuaternionAccumulator<T>::getAverage() const noexcept
+{
+    return lengthSqr( sum ) > T( 0 ) ? normalize( sum ) : Quaternion<T> {};
+}
+
+template<typename T>
+constexpr void QuaternionAccumulator<T>::reset() noexcept
+{
+    sum    = { T( 0 ), T( 0 ), T( 0 ), T( 0 ) };
+    weight = T( 0 );
+}
+
+/// <summary>
+/// Compute the weighted average of several rotations using normalized linear interpolation.
+/// </summary>
+/// <remarks>
+/// See `QuaternionAccumulator` for details.
+/// </remarks>
+/// <typeparam name="T">The quaternion type.</typeparam>
+/// <param name="rotations">The rotations to average.</param>
+/// <param name="weights">(optional) The weight of each rotation. If empty, all rotations have the same weight.</param>
+/// <returns>The average rotation, or the identity if `rotations` is empty.</returns>
+template<typename T>
+constexpr Quaternion<T> average( std::span<const Quaternion<T>> rotations, std::span<const std::type_identity_t<T>> weights = {} ) noexcept
+{
+    assert( weights.empty() || weights.size() == rotations.size() );
+
+    QuaternionAccumulator<T> accumulator;
+    for ( std::size_t i = 0; i < rotations.size(); ++i )
+        accumulator.add( rotations[i], weights.empty() ? T( 1 ) : weights[i] );
+
+    return accumulator.getAverage();
+}
+
+/// <summary>
+/// Compute the weighted average of several rotations using Markley's method.
+/// </summary>
+/// <remarks>
+/// The average is the eigenvector of \f( \mathbf{M}=\sum_i w_i q_i q_i^T \f) with the largest eigenvalue, which is the
+/// rotation that minimizes the weighted sum of the squared chordal distances to the rotations. Unlike `average`, the
+/// result is accurate when the rotations are far apart, and it doesn't depend on the order of the rotations (or their
+/// hemisphere), but it is much more expensive to compute. The result is on the same hemisphere as the first rotation.
+/// </remarks>
+/// <seealso href="https://doi.org/10.2514/1.28949"/>
+/// <typeparam name="T">The quaternion type.</typeparam>
+/// <param name="rotations">The (normalized) rotations to average.</param>
+/// <param name="weights">(optional) The weight of each rotation. If empty, all rotations have the same weight.</param>
+/// <returns>The average rotation, or the identity if `rotations` is empty.</returns>
+template<typename T>
+Quaternion<T> averageMarkley( std::span<const Quaternion<T>> rotations, std::span<const std::type_identity_t<T>> weights = {} ) noexcept
+{
+    assert( weights.empty() || weights.size() == rotations.size() );
+
+    if ( rotations.empty() )
+        return {};
+
+    Matrix<T, 4> m;
+    for ( std::size_t i = 0; i < rotations.size(); ++i )
+    {
+        const Quaternion<T>& q = rotations[i];
+        const T              w = weights.empty() ? T( 1 ) : weights[i];
+
+        for ( std::size_t r = 0; r < 4; ++r )
+        {
+            for ( std::size_t c = r; c < 4; ++c )
+                m[r][c] += w * q[r] * q[c];
+        }
+    }
+
+    for ( std::size_t r = 1; r < 4; ++r )
+    {
+        for ( std::size_t c = 0; c < r; ++c )
+            m[r][c] = m[c][r];
+    }
+
+    Vector<T, 4> eigenValues;
+    Matrix<T, 4> eigenVectors;
+    eigenSymmetric( m, eigenValues, eigenVectors );
+
+    const Quaternion<T> q { eigenVectors[0][0], eigenVectors[1][0], eigenVectors[2][0], eigenVectors[3][0] };
+    return normalize( dot( q, rotations[0] ) < T( 0 ) ? q * T( -1 ) : q );
+}
+
 template<typename T>
 constexpr Vector<bool, 4> lessThan( const Quaternion<T>& a, const Quaternion<T>& b ) noexcept
 {
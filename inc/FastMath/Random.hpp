@@ -0,0 +1,573 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A pseudo-random number generator that runs 8 independent xoshiro128+ generators in parallel,
+/// one per SIMD lane.
+/// </summary>
+/// <remarks>
+/// Each call to `next` produces 32 random bits for each of the 8 lanes (with a single AVX2 instruction
+/// per step of the generator). The generator is meant for floating-point samples: the low bits of
+/// xoshiro128+ have a low linear complexity, so the samplers only use the high bits.
+///
+/// A generator is seeded with a seed and a stream. Generators with the same seed and different streams
+/// produce statistically independent sequences, which makes it easy to get reproducible results in
+/// parallel code by seeding a generator for each chunk of work (instead of each thread):
+/// \code
+/// pool.parallelFor( 0, points.size(), GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+///     Random random { seed, begin / GRAIN_SIZE };
+///     onUnitSphere<float>( random, std::span { points }.subspan( begin, end - begin ) );
+/// } );
+/// \endcode
+/// </remarks>
+/// <seealso href="https://prng.di.unimi.it/"/>
+struct Random
+{
+    /// <summary>
+    /// Construct a generator.
+    /// </summary>
+    /// <param name="seed">(optional) The seed.</param>
+    /// <param name="stream">(optional) The stream (for example, a thread or chunk index).</param>
+    explicit Random( uint64_t seed = 0, uint64_t stream = 0 ) noexcept;
+
+    /// <summary>
+    /// Reset the state of the generator.
+    /// </summary>
+    /// <param name="seed">The seed.</param>
+    /// <param name="stream">(optional) The stream (for example, a thread or chunk index).</param>
+    void seed( uint64_t seed, uint64_t stream = 0 ) noexcept;
+
+    /// <summary>
+    /// Generate the next 32 random bits of each lane.
+    /// </summary>
+    /// <param name="bits">Receives the random bits.</param>
+    void next( uint32_t ( &bits )[Simd::WIDTH] ) noexcept;
+
+#if defined( LS_AVX2 )
+    /// <summary>
+    /// Generate the next 32 random bits of each lane.
+    /// </summary>
+    /// <returns>The random bits.</returns>
+    __m256i next() noexcept;
+#endif
+
+    /// <summary>
+    /// Fill a buffer with random bits.
+    /// </summary>
+    /// <remarks>
+    /// Consecutive blocks of 8 values are generated by consecutive calls to `next`.
+    /// </remarks>
+    /// <param name="bits">Receives the random bits.</param>
+    void generate( std::span<uint32_t> bits ) noexcept;
+
+private:
+    alignas( 32 ) uint32_t state[4][Simd::WIDTH];
+};
+
+namespace detail
+{
+constexpr uint64_t splitMix64( uint64_t& x ) noexcept
+{
+    uint64_t z = ( x += 0x9e3779b97f4a7c15ull );
+    z          = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+    z          = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+
+    return z ^ ( z >> 31 );
+}
+}  // namespace detail
+
+inline Random::Random( uint64_t _seed, uint64_t stream ) noexcept
+{
+    seed( _seed, stream );
+}
+
+inline void Random::seed( uint64_t _seed, uint64_t stream ) noexcept
+{
+    // The stream is hashed so that nearby seeds and streams do not produce related states.
+    uint64_t s = stream;
+    uint64_t x = _seed ^ detail::splitMix64( s );
+
+    for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+    {
+        for ( std::size_t j = 0; j < 4; j += 2 )
+        {
+            const uint64_t z = detail::splitMix64( x );
+
+            state[j][i]     = static_cast<uint32_t>( z );
+            state[j + 1][i] = static_cast<uint32_t>( z >> 32 );
+        }
+
+        // The state must not be all zeros.
+        if ( ( state[0][i] | state[1][i] | state[2][i] | state[3][i] ) == 0 )
+            state[0][i] = 1;
+    }
+}
+
+inline void Random::next( uint32_t ( &bits )[Simd::WIDTH] ) noexcept
+{
+#if defined( LS_AVX2 )
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( bits ), next() );
+#else
+    for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+    {
+        bits[i] = state[0][i] + state[3][i];
+
+        const uint32_t t = state[1][i] << 9;
+
+        state[2][i] ^= state[0][i];
+        state[3][i] ^= state[1][i];
+        state[1][i] ^= state[2][i];
+        state[0][i] ^= state[3][i];
+        state[2][i] ^= t;
+        state[3][i] = std::rotl( state[3][i], 11 );
+    }
+#endif
+}
+
+#if defined( LS_AVX2 )
+inline __m256i Random::next() noexcept
+{
+    __m256i s0 = _mm256_load_si256( reinterpret_cast<const __m256i*>( state[0] ) );
+    __m256i s1 = _mm256_load_si256( reinterpret_cast<const __m256i*>( state[1] ) );
+    __m256i s2 = _mm256_load_si256( reinterpret_cast<const __m256i*>( state[2] ) );
+    __m256i s3 = _mm256_load_si256( reinterpret_cast<const __m256i*>( state[3] ) );
+
+    const __m256i result = _mm256_add_epi32( s0, s3 );
+    const __m256i t      = _mm256_slli_epi32( s1, 9 );
+
+    s2 = _mm256_xor_si256( s2, s0 );
+    s3 = _mm256_xor_si256( s3, s1 );
+    s1 = _mm256_xor_si256( s1, s2 );
+    s0 = _mm256_xor_si256( s0, s3 );
+    s2 = _mm256_xor_si256( s2, t );
+    s3 = _mm256_or_si256( _mm256_slli_epi32( s3, 11 ), _mm256_srli_epi32( s3, 21 ) );
+
+    _mm256_store_si256( reinterpret_cast<__m256i*>( state[0] ), s0 );
+    _mm256_store_si256( reinterpret_cast<__m256i*>( state[1] ), s1 );
+    _mm256_store_si256( reinterpret_cast<__m256i*>( state[2] ), s2 );
+    _mm256_store_si256( reinterpret_cast<__m256i*>( state[3] ), s3 );
+
+    return result;
+}
+#endif
+
+inline void Random::generate( std::span<uint32_t> bits ) noexcept
+{
+    for ( std::size_t i = 0; i < bits.size(); i += Simd::WIDTH )
+    {
+        uint32_t block[Simd::WIDTH];
+        next( block );
+
+        std::copy_n( block, std::min( Simd::WIDTH, bits.size() - i ), bits.data() + i );
+    }
+}
+
+namespace detail
+{
+// The next uniform value in [0, 1) of each lane. Single-precision values use the high 24 bits of one draw,
+// and double-precision values use the high 53 bits of two draws.
+template<typename T>
+void uniformBlock( Random& random, T ( &u )[Simd::WIDTH] ) noexcept
+{
+    uint32_t hi[Simd::WIDTH];
+    random.next( hi );
+
+    if constexpr ( sizeof( T ) <= sizeof( float ) )
+    {
+        for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+            u[i] = T( hi[i] >> 8 ) * T( 0x1p-24 );
+    }
+    else
+    {
+        uint32_t lo[Simd::WIDTH];
+        random.next( lo );
+
+        for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+            u[i] = T( ( uint64_t( hi[i] ) << 32 | lo[i] ) >> 11 ) * T( 0x1p-53 );
+    }
+}
+
+#if defined( LS_AVX2 )
+inline __m256 uniform8( Random& random ) noexcept
+{
+    return _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_srli_epi32( random.next(), 8 ) ), _mm256_set1_ps( 0x1p-24f ) );
+}
+#endif
+
+// Generate the samples from `begin` to the end of the buffer, 8 at a time. Each sample `f( u )` is computed from
+// K uniform values that are drawn in the same order as the SIMD implementations (one block of 8 for each value).
+template<std::size_t K, typename T, typename Out, typename F>
+void sampleBlocks( Random& random, std::span<Out> out, std::size_t begin, F&& f ) noexcept
+{
+    for ( std::size_t i = begin; i < out.size(); i += Simd::WIDTH )
+    {
+        T u[K][Simd::WIDTH];
+        for ( std::size_t k = 0; k < K; ++k )
+            uniformBlock( random, u[k] );
+
+        const std::size_t n = std::min( Simd::WIDTH, out.size() - i );
+        for ( std::size_t l = 0; l < n; ++l )
+        {
+            T v[K];
+            for ( std::size_t k = 0; k < K; ++k )
+                v[k] = u[k][l];
+
+            out[i + l] = f( v );
+        }
+    }
+}
+
+// The components of the samples are generated as a flat array of values, so the same code works for
+// any number of components. `scale` and `bias` repeat with a period of N components.
+template<typename T, std::size_t N>
+void uniformFlat( Random& random, std::span<T> values, const T ( &scale )[N], const T ( &bias )[N] ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        // A block of 8 samples is N registers.
+        __m256 s[N], b[N];
+        for ( std::size_t r = 0; r < N; ++r )
+        {
+            alignas( 32 ) float ts[Simd::WIDTH], tb[Simd::WIDTH];
+            for ( std::size_t l = 0; l < Simd::WIDTH; ++l )
+            {
+                ts[l] = scale[( r * Simd::WIDTH + l ) % N];
+                tb[l] = bias[( r * Simd::WIDTH + l ) % N];
+            }
+
+            s[r] = _mm256_load_ps( ts );
+            b[r] = _mm256_load_ps( tb );
+        }
+
+        for ( ; i + N * Simd::WIDTH <= values.size(); i += N * Simd::WIDTH )
+        {
+            for ( std::size_t r = 0; r < N; ++r )
+                _mm256_storeu_ps( values.data() + i + r * Simd::WIDTH, Simd::fmadd( uniform8( random ), s[r], b[r] ) );
+        }
+    }
+#endif
+
+    for ( ; i < values.size(); i += Simd::WIDTH )
+    {
+        T u[Simd::WIDTH];
+        uniformBlock( random, u );
+
+        const std::size_t n = std::min( Simd::WIDTH, values.size() - i );
+        for ( std::size_t l = 0; l < n; ++l )
+            values[i + l] = u[l] * scale[( i + l ) % N] + bias[( i + l ) % N];
+    }
+}
+}  // namespace detail
+
+/// <summary>
+/// Generate uniformly distributed values in the range \f([min \ldots max)\f).
+/// </summary>
+/// <typeparam name="T">The value type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="values">Receives the values.</param>
+/// <param name="min">(optional) The minimum value.</param>
+/// <param name="max">(optional) The maximum value.</param>
+template<FloatingPoint T>
+void uniform( Random& random, std::span<T> values, std::type_identity_t<T> min = T( 0 ), std::type_identity_t<T> max = T( 1 ) ) noexcept
+{
+    const T scale[1] = { max - min };
+    const T bias[1]  = { min };
+
+    detail::uniformFlat( random, values, scale, bias );
+}
+
+/// <summary>
+/// Generate uniformly distributed points in an axis-aligned box.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of components.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="points">Receives the points.</param>
+/// <param name="min">The minimum corner of the box.</param>
+/// <param name="max">The maximum corner of the box.</param>
+template<FloatingPoint T, std::size_t N>
+void uniformBox( Random& random, std::type_identity_t<std::span<Vector<T, N>>> points, const Vector<T, N>& min, const Vector<T, N>& max ) noexcept
+{
+    static_assert( sizeof( Vector<T, N> ) == N * sizeof( T ), "The components of the points must be contiguous." );
+
+    if ( points.empty() )
+        return;
+
+    T scale[N], bias[N];
+    for ( std::size_t j = 0; j < N; ++j )
+    {
+        scale[j] = max[j] - min[j];
+        bias[j]  = min[j];
+    }
+
+    detail::uniformFlat( random, std::span<T> { &points.data()->x, points.size() * N }, scale, bias );
+}
+
+/// <summary>
+/// Generate uniformly distributed points on the unit circle.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="points">Receives the points.</param>
+template<FloatingPoint T>
+void onUnitCircle( Random& random, std::span<Vector<T, 2>> points ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        for ( ; i + Simd::WIDTH <= points.size(); i += Simd::WIDTH )
+        {
+            __m256 s, c;
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s, c );
+
+            Simd::storeVector2x8( &points[i].x, c, s );
+        }
+    }
+#endif
+
+    detail::sampleBlocks<1, T>( random, points, i, []( const T ( &u )[1] ) {
+        const T phi = TWO_PI<T> * u[0];
+        return Vector<T, 2> { std::cos( phi ), std::sin( phi ) };
+    } );
+}
+
+/// <summary>
+/// Generate uniformly distributed points in the unit disk.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="points">Receives the points.</param>
+template<FloatingPoint T>
+void inUnitDisk( Random& random, std::span<Vector<T, 2>> points ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        for ( ; i + Simd::WIDTH <= points.size(); i += Simd::WIDTH )
+        {
+            const __m256 r = _mm256_sqrt_ps( detail::uniform8( random ) );
+
+            __m256 s, c;
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s, c );
+
+            Simd::storeVector2x8( &points[i].x, _mm256_mul_ps( r, c ), _mm256_mul_ps( r, s ) );
+        }
+    }
+#endif
+
+    detail::sampleBlocks<2, T>( random, points, i, []( const T ( &u )[2] ) {
+        const T r   = std::sqrt( u[0] );
+        const T phi = TWO_PI<T> * u[1];
+        return Vector<T, 2> { r * std::cos( phi ), r * std::sin( phi ) };
+    } );
+}
+
+/// <summary>
+/// Generate uniformly distributed points on the unit sphere (random directions).
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="points">Receives the points.</param>
+template<FloatingPoint T>
+void onUnitSphere( Random& random, std::span<Vector<T, 3>> points ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        for ( ; i + Simd::WIDTH <= points.size(); i += Simd::WIDTH )
+        {
+            // z = 1 - 2u, and the radius of the circle at height z is sqrt( 1 - z^2 ) = 2 sqrt( u (1 - u) ).
+            const __m256 u = detail::uniform8( random );
+            const __m256 z = Simd::fmadd( u, _mm256_set1_ps( -2.0f ), _mm256_set1_ps( 1.0f ) );
+            const __m256 r = _mm256_mul_ps( _mm256_set1_ps( 2.0f ), _mm256_sqrt_ps( _mm256_mul_ps( u, _mm256_sub_ps( _mm256_set1_ps( 1.0f ), u ) ) ) );
+
+            __m256 s, c;
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s, c );
+
+            Simd::storeVector3x8( &points[i].x, _mm256_mul_ps( r, c ), _mm256_mul_ps( r, s ), z );
+        }
+    }
+#endif
+
+    detail::sampleBlocks<2, T>( random, points, i, []( const T ( &u )[2] ) {
+        const T r   = T( 2 ) * std::sqrt( u[0] * ( T( 1 ) - u[0] ) );
+        const T phi = TWO_PI<T> * u[1];
+        return Vector<T, 3> { r * std::cos( phi ), r * std::sin( phi ), T( 1 ) - T( 2 ) * u[0] };
+    } );
+}
+
+/// <summary>
+/// Generate uniformly distributed points in the unit sphere.
+/// </summary>
+/// <remarks>
+/// The distance to the center is the maximum of 3 uniform values, which has the density \f( 3r^2 \f) of the
+/// radius in a ball, without computing a cube root.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="points">Receives the points.</param>
+template<FloatingPoint T>
+void inUnitSphere( Random& random, std::span<Vector<T, 3>> points ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        for ( ; i + Simd::WIDTH <= points.size(); i += Simd::WIDTH )
+        {
+            const __m256 u = detail::uniform8( random );
+            const __m256 z = Simd::fmadd( u, _mm256_set1_ps( -2.0f ), _mm256_set1_ps( 1.0f ) );
+            const __m256 r = _mm256_mul_ps( _mm256_set1_ps( 2.0f ), _mm256_sqrt_ps( _mm256_mul_ps( u, _mm256_sub_ps( _mm256_set1_ps( 1.0f ), u ) ) ) );
+
+            __m256 s, c;
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s, c );
+
+            __m256 d = detail::uniform8( random );
+            d        = _mm256_max_ps( d, detail::uniform8( random ) );
+            d        = _mm256_max_ps( d, detail::uniform8( random ) );
+
+            Simd::storeVector3x8( &points[i].x, _mm256_mul_ps( _mm256_mul_ps( r, c ), d ), _mm256_mul_ps( _mm256_mul_ps( r, s ), d ), _mm256_mul_ps( z, d ) );
+        }
+    }
+#endif
+
+    detail::sampleBlocks<5, T>( random, points, i, []( const T ( &u )[5] ) {
+        const T r   = T( 2 ) * std::sqrt( u[0] * ( T( 1 ) - u[0] ) );
+        const T phi = TWO_PI<T> * u[1];
+        const T d   = std::max( { u[2], u[3], u[4] } );
+        return Vector<T, 3> { r * std::cos( phi ), r * std::sin( phi ), T( 1 ) - T( 2 ) * u[0] } * d;
+    } );
+}
+
+/// <summary>
+/// Generate cosine-weighted directions in the hemisphere around a normal.
+/// </summary>
+/// <remarks>
+/// The directions have the density \f( \frac{\cos\theta}{\pi} \f) (Malley's method: uniform points in the unit disk
+/// projected up to the hemisphere), which is the importance sampling density for diffuse lighting.
+/// The tangent frame of the normal is computed with the branchless construction of Duff et al.
+/// </remarks>
+/// <seealso href="https://jcgt.org/published/0006/01/01/"/>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="directions">Receives the directions.</param>
+/// <param name="normal">(optional) The (normalized) axis of the hemisphere.</param>
+template<FloatingPoint T>
+void cosineHemisphere( Random& random, std::span<Vector<T, 3>> directions, const Vector<std::type_identity_t<T>, 3>& normal = Vector<T, 3>::UNIT_Z ) noexcept
+{
+    const T            sign = std::copysign( T( 1 ), normal.z );
+    const T            a    = T( -1 ) / ( sign + normal.z );
+    const T            b    = normal.x * normal.y * a;
+    const Vector<T, 3> t { T( 1 ) + sign * normal.x * normal.x * a, sign * b, -sign * normal.x };
+    const Vector<T, 3> bt { b, sign + normal.y * normal.y * a, -normal.y };
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        __m256 m[3][3];
+        for ( int j = 0; j < 3; ++j )
+        {
+            m[j][0] = _mm256_set1_ps( t[j] );
+            m[j][1] = _mm256_set1_ps( bt[j] );
+            m[j][2] = _mm256_set1_ps( normal[j] );
+        }
+
+        for ( ; i + Simd::WIDTH <= directions.size(); i += Simd::WIDTH )
+        {
+            const __m256 u = detail::uniform8( random );
+            const __m256 r = _mm256_sqrt_ps( u );
+            const __m256 z = _mm256_sqrt_ps( _mm256_sub_ps( _mm256_set1_ps( 1.0f ), u ) );
+
+            __m256 s, c;
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s, c );
+
+            const __m256 x = _mm256_mul_ps( r, c );
+            const __m256 y = _mm256_mul_ps( r, s );
+
+            __m256 d[3];
+            for ( int j = 0; j < 3; ++j )
+                d[j] = Simd::fmadd( m[j][0], x, Simd::fmadd( m[j][1], y, _mm256_mul_ps( m[j][2], z ) ) );
+
+            Simd::storeVector3x8( &directions[i].x, d[0], d[1], d[2] );
+        }
+    }
+#endif
+
+    detail::sampleBlocks<2, T>( random, directions, i, [&]( const T ( &u )[2] ) {
+        const T r   = std::sqrt( u[0] );
+        const T phi = TWO_PI<T> * u[1];
+        return t * ( r * std::cos( phi ) ) + bt * ( r * std::sin( phi ) ) + normal * std::sqrt( T( 1 ) - u[0] );
+    } );
+}
+
+/// <summary>
+/// Generate uniformly distributed rotations.
+/// </summary>
+/// <remarks>
+/// Uses Shoemake's method, which maps 3 uniform values to a uniformly distributed point on the unit 3-sphere.
+/// </remarks>
+/// <seealso href="https://doi.org/10.1016/B978-0-08-050755-2.50036-1"/>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="random">The random number generator.</param>
+/// <param name="rotations">Receives the (unit) quaternions.</param>
+template<FloatingPoint T>
+void uniformRotation( Random& random, std::span<Quaternion<T>> rotations ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        static_assert( sizeof( Quaternion<float> ) == 4 * sizeof( float ) );
+
+        for ( ; i + Simd::WIDTH <= rotations.size(); i += Simd::WIDTH )
+        {
+            const __m256 u  = detail::uniform8( random );
+            const __m256 r1 = _mm256_sqrt_ps( _mm256_sub_ps( _mm256_set1_ps( 1.0f ), u ) );
+            const __m256 r2 = _mm256_sqrt_ps( u );
+
+            __m256 s1, c1, s2, c2;
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s1, c1 );
+            Simd::sincos( _mm256_mul_ps( detail::uniform8( random ), _mm256_set1_ps( TWO_PI<float> ) ), s2, c2 );
+
+            Simd::storeVector4x8( &rotations[i].w, _mm256_mul_ps( r2, c2 ), _mm256_mul_ps( r1, s1 ), _mm256_mul_ps( r1, c1 ), _mm256_mul_ps( r2, s2 ) );
+        }
+    }
+#endif
+
+    detail::sampleBlocks<3, T>( random, rotations, i, []( const T ( &u )[3] ) {
+        const T r1     = std::sqrt( T( 1 ) - u[0] );
+        const T r2     = std::sqrt( u[0] );
+        const T theta1 = TWO_PI<T> * u[1];
+        const T theta2 = TWO_PI<T> * u[2];
+        return Quaternion<T> { r2 * std::cos( theta2 ), r1 * std::sin( theta1 ), r1 * std::cos( theta1 ), r2 * std::sin( theta2 ) };
+    } );
+}
+
+}  // namespace FastMath
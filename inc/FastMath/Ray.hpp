@@ -0,0 +1,570 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Common.hpp"
+#include "Simd.hpp"
+#include "Sphere.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A ray defined by an origin and a direction.
+/// </summary>
+/// <remarks>
+/// The reciprocal of the direction is precomputed when the ray is constructed so that
+/// slab tests against AABBs only require multiplications. Zero components of the direction
+/// are replaced by a very small value (with the same sign) so that the reciprocal stays
+/// finite, which is required when compiling with `-ffast-math`.
+/// The direction does not need to be normalized. Hit distances are expressed in units of
+/// the length of the direction.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Ray
+{
+    /// <summary>
+    /// The Ray value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Default construct a ray at the origin pointing along the positive z axis.
+    /// </summary>
+    constexpr Ray() noexcept;
+
+    /// <summary>
+    /// Construct a ray from an origin and a direction.
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The direction of the ray.</param>
+    constexpr Ray( const Vector<T, 3>& origin, const Vector<T, 3>& direction ) noexcept;
+
+    Vector<T, 3> origin;
+    Vector<T, 3> direction;
+    Vector<T, 3> invDirection;
+};
+
+using Rayf = Ray<float>;
+using Rayd = Ray<double>;
+
+/// <summary>
+/// A packet of 8 rays in structure-of-arrays layout.
+/// </summary>
+/// <remarks>
+/// Unused lanes (when the packet is constructed from less than 8 rays) have a maximum
+/// distance of -1 and never report a hit.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct RayPacket
+{
+    /// <summary>
+    /// The RayPacket value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Default construct an empty ray packet.
+    /// </summary>
+    constexpr RayPacket() noexcept;
+
+    /// <summary>
+    /// Construct a ray packet from up to 8 rays.
+    /// </summary>
+    /// <param name="rays">The rays to store in the packet. Only the first 8 rays are used.</param>
+    /// <param name="tMax">The maximum hit distance for all of the rays in the packet.</param>
+    explicit constexpr RayPacket( std::span<const Ray<T>> rays, T tMax = std::numeric_limits<T>::max() ) noexcept;
+
+    alignas( 32 ) T ox[Simd::WIDTH], oy[Simd::WIDTH], oz[Simd::WIDTH];
+    alignas( 32 ) T dx[Simd::WIDTH], dy[Simd::WIDTH], dz[Simd::WIDTH];
+    alignas( 32 ) T ix[Simd::WIDTH], iy[Simd::WIDTH], iz[Simd::WIDTH];
+    alignas( 32 ) T tMax[Simd::WIDTH];
+};
+
+/// <summary>
+/// A packet of 8 triangles in structure-of-arrays layout.
+/// </summary>
+/// <remarks>
+/// Each triangle is stored as its first vertex and the two edges that share that vertex.
+/// Unused lanes (when the packet is constructed from less than 8 triangles) are degenerate
+/// and never report a hit.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct TrianglePacket
+{
+    /// <summary>
+    /// The TrianglePacket value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Default construct an empty triangle packet.
+    /// </summary>
+    constexpr TrianglePacket() noexcept;
+
+    /// <summary>
+    /// Construct a triangle packet from a list of vertices. Each consecutive
+    /// triple of vertices is a triangle.
+    /// </summary>
+    /// <param name="vertices">The triangle vertices. Only the first 24 vertices (8 triangles) are used.</param>
+    explicit constexpr TrianglePacket( std::span<const Vector<T, 3>> vertices ) noexcept;
+
+    alignas( 32 ) T v0x[Simd::WIDTH], v0y[Simd::WIDTH], v0z[Simd::WIDTH];
+    alignas( 32 ) T e1x[Simd::WIDTH], e1y[Simd::WIDTH], e1z[Simd::WIDTH];
+    alignas( 32 ) T e2x[Simd::WIDTH], e2y[Simd::WIDTH], e2z[Simd::WIDTH];
+};
+
+namespace detail
+{
+/// <summary>
+/// Compute a reciprocal that stays finite when `x` is 0.
+/// </summary>
+template<typename T>
+constexpr T safeReciprocal( T x ) noexcept
+{
+    constexpr T tiny = T( 1e-20 );
+    return T( 1 ) / ( std::abs( x ) > tiny ? x : std::copysign( tiny, x ) );
+}
+
+#if defined( LS_AVX2 )
+/// <summary>
+/// Möller–Trumbore ray-triangle test on 8 lanes. Rays and triangles are either
+/// broadcast or per-lane which allows the same kernel to be used for 8 rays vs. 1 triangle
+/// and 1 ray vs. 8 triangles.
+/// </summary>
+inline uint32_t intersectTriangles8( __m256 ox, __m256 oy, __m256 oz,
+                                     __m256 dx, __m256 dy, __m256 dz,
+                                     __m256 v0x, __m256 v0y, __m256 v0z,
+                                     __m256 e1x, __m256 e1y, __m256 e1z,
+                                     __m256 e2x, __m256 e2y, __m256 e2z,
+                                     __m256 tMax, float* t ) noexcept
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = _mm256_set1_ps( 1.0f );
+
+    // p = d x e2
+    const __m256 px = _mm256_sub_ps( _mm256_mul_ps( dy, e2z ), _mm256_mul_ps( dz, e2y ) );
+    const __m256 py = _mm256_sub_ps( _mm256_mul_ps( dz, e2x ), _mm256_mul_ps( dx, e2z ) );
+    const __m256 pz = _mm256_sub_ps( _mm256_mul_ps( dx, e2y ), _mm256_mul_ps( dy, e2x ) );
+
+    const __m256 det    = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( e1x, px ), _mm256_mul_ps( e1y, py ) ), _mm256_mul_ps( e1z, pz ) );
+    const __m256 absDet = _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), det );
+    const __m256 valid  = _mm256_cmp_ps( absDet, _mm256_set1_ps( std::numeric_limits<float>::min() ), _CMP_GT_OQ );
+    // Avoid dividing by 0 in lanes that are already rejected.
+    const __m256 invDet = _mm256_div_ps( one, _mm256_blendv_ps( one, det, valid ) );
+
+    // s = o - v0
+    const __m256 sx = _mm256_sub_ps( ox, v0x );
+    const __m256 sy = _mm256_sub_ps( oy, v0y );
+    const __m256 sz = _mm256_sub_ps( oz, v0z );
+
+    const __m256 u = _mm256_mul_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( sx, px ), _mm256_mul_ps( sy, py ) ), _mm256_mul_ps( sz, pz ) ), invDet );
+
+    // q = s x e1
+    const __m256 qx = _mm256_sub_ps( _mm256_mul_ps( sy, e1z ), _mm256_mul_ps( sz, e1y ) );
+    const __m256 qy = _mm256_sub_ps( _mm256_mul_ps( sz, e1x ), _mm256_mul_ps( sx, e1z ) );
+    const __m256 qz = _mm256_sub_ps( _mm256_mul_ps( sx, e1y ), _mm256_mul_ps( sy, e1x ) );
+
+    const __m256 v  = _mm256_mul_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( dx, qx ), _mm256_mul_ps( dy, qy ) ), _mm256_mul_ps( dz, qz ) ), invDet );
+    const __m256 tt = _mm256_mul_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( e2x, qx ), _mm256_mul_ps( e2y, qy ) ), _mm256_mul_ps( e2z, qz ) ), invDet );
+
+    __m256 hit = valid;
+    hit        = _mm256_and_ps( hit, _mm256_cmp_ps( u, zero, _CMP_GE_OQ ) );
+    hit        = _mm256_and_ps( hit, _mm256_cmp_ps( v, zero, _CMP_GE_OQ ) );
+    hit        = _mm256_and_ps( hit, _mm256_cmp_ps( _mm256_add_ps( u, v ), one, _CMP_LE_OQ ) );
+    hit        = _mm256_and_ps( hit, _mm256_cmp_ps( tt, zero, _CMP_GE_OQ ) );
+    hit        = _mm256_and_ps( hit, _mm256_cmp_ps( tt, tMax, _CMP_LE_OQ ) );
+
+    _mm256_storeu_ps( t, _mm256_blendv_ps( _mm256_set1_ps( std::numeric_limits<float>::max() ), tt, hit ) );
+
+    return static_cast<uint32_t>( _mm256_movemask_ps( hit ) );
+}
+#endif
+}  // namespace detail
+
+template<typename T>
+constexpr Ray<T>::Ray() noexcept
+: Ray( Vector<T, 3> { T( 0 ) }, Vector<T, 3> { T( 0 ), T( 0 ), T( 1 ) } )
+{}
+
+template<typename T>
+constexpr Ray<T>::Ray( const Vector<T, 3>& origin, const Vector<T, 3>& direction ) noexcept
+: origin { origin }
+, direction { direction }
+, invDirection { detail::safeReciprocal( direction.x ), detail::safeReciprocal( direction.y ), detail::safeReciprocal( direction.z ) }
+{}
+
+template<typename T>
+constexpr RayPacket<T>::RayPacket() noexcept
+: RayPacket( std::span<const Ray<T>> {} )
+{}
+
+template<typename T>
+constexpr RayPacket<T>::RayPacket( std::span<const Ray<T>> rays, T _tMax ) noexcept
+{
+    const Ray<T> unused;
+
+    for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+    {
+        const Ray<T>& r = i < rays.size() ? rays[i] : unused;
+
+        ox[i]   = r.origin.x;
+        oy[i]   = r.origin.y;
+        oz[i]   = r.origin.z;
+        dx[i]   = r.direction.x;
+        dy[i]   = r.direction.y;
+        dz[i]   = r.direction.z;
+        ix[i]   = r.invDirection.x;
+        iy[i]   = r.invDirection.y;
+        iz[i]   = r.invDirection.z;
+        tMax[i] = i < rays.size() ? _tMax : T( -1 );
+    }
+}
+
+template<typename T>
+constexpr TrianglePacket<T>::TrianglePacket() noexcept
+: TrianglePacket( std::span<const Vector<T, 3>> {} )
+{}
+
+template<typename T>
+constexpr TrianglePacket<T>::TrianglePacket( std::span<const Vector<T, 3>> vertices ) noexcept
+{
+    const std::size_t numTriangles = std::min( vertices.size() / 3, Simd::WIDTH );
+
+    for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+    {
+        Vector<T, 3> v0 { T( 0 ) }, e1 { T( 0 ) }, e2 { T( 0 ) };
+        if ( i < numTriangles )
+        {
+            v0 = vertices[i * 3 + 0];
+            e1 = vertices[i * 3 + 1] - v0;
+            e2 = vertices[i * 3 + 2] - v0;
+        }
+
+        v0x[i] = v0.x;
+        v0y[i] = v0.y;
+        v0z[i] = v0.z;
+        e1x[i] = e1.x;
+        e1y[i] = e1.y;
+        e1z[i] = e1.z;
+        e2x[i] = e2.x;
+        e2y[i] = e2.y;
+        e2z[i] = e2.z;
+    }
+}
+
+/// <summary>
+/// Compute the point along the ray at distance `t`.
+/// </summary>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="t">The distance along the ray.</param>
+/// <returns>The point \f(\mathbf{o} + t\mathbf{d}\f).</returns>
+template<typename T>
+constexpr Vector<T, 3> pointAt( const Ray<T>& r, T t ) noexcept
+{
+    return r.origin + r.direction * t;
+}
+
+/// <summary>
+/// Intersect a ray with an AABB using the branch-free slab test.
+/// </summary>
+/// <seealso href="https://tavianator.com/2022/ray_box_boundary.html"/>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="a">The AABB.</param>
+/// <param name="t">If the ray hits the box, receives the distance to the entry point (or `tMin` if the origin is inside the box).</param>
+/// <param name="tMin">The minimum distance along the ray to consider.</param>
+/// <param name="tMax">The maximum distance along the ray to consider.</param>
+/// <returns>`true` if the ray hits the box in the range \f([t_{min} \ldots t_{max}]\f), `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Ray<T>& r, const AABB<T>& a, T& t, T tMin = T( 0 ), T tMax = std::numeric_limits<T>::max() ) noexcept
+{
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        const T t1 = ( a.min[i] - r.origin[i] ) * r.invDirection[i];
+        const T t2 = ( a.max[i] - r.origin[i] ) * r.invDirection[i];
+
+        tMin = std::max( tMin, std::min( t1, t2 ) );
+        tMax = std::min( tMax, std::max( t1, t2 ) );
+    }
+
+    t = tMin;
+
+    return tMin <= tMax;
+}
+
+/// <summary>
+/// Intersect a ray with a triangle using the Möller–Trumbore algorithm.
+/// </summary>
+/// <remarks>
+/// Both front-facing and back-facing triangles are reported as hits.
+/// </remarks>
+/// <seealso href="https://www.graphics.cornell.edu/pubs/1997/MT97.pdf"/>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="v0">The first vertex of the triangle.</param>
+/// <param name="v1">The second vertex of the triangle.</param>
+/// <param name="v2">The third vertex of the triangle.</param>
+/// <param name="t">If the ray hits the triangle, receives the distance to the hit point.</param>
+/// <param name="u">If the ray hits the triangle, receives the barycentric coordinate of `v1`.</param>
+/// <param name="v">If the ray hits the triangle, receives the barycentric coordinate of `v2`.</param>
+/// <param name="tMax">The maximum distance along the ray to consider.</param>
+/// <returns>`true` if the ray hits the triangle in the range \f([0 \ldots t_{max}]\f), `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Ray<T>& r, const Vector<T, 3>& v0, const Vector<T, 3>& v1, const Vector<T, 3>& v2, T& t, T& u, T& v, T tMax = std::numeric_limits<T>::max() ) noexcept
+{
+    const Vector<T, 3> e1 = v1 - v0;
+    const Vector<T, 3> e2 = v2 - v0;
+    const Vector<T, 3> p  = cross( r.direction, e2 );
+    const T            det = dot( e1, p );
+
+    if ( std::abs( det ) <= std::numeric_limits<T>::min() )
+        return false;
+
+    const T            invDet = T( 1 ) / det;
+    const Vector<T, 3> s      = r.origin - v0;
+
+    const T _u = dot( s, p ) * invDet;
+    if ( _u < T( 0 ) || _u > T( 1 ) )
+        return false;
+
+    const Vector<T, 3> q  = cross( s, e1 );
+    const T            _v = dot( r.direction, q ) * invDet;
+    if ( _v < T( 0 ) || _u + _v > T( 1 ) )
+        return false;
+
+    const T _t = dot( e2, q ) * invDet;
+    if ( _t < T( 0 ) || _t > tMax )
+        return false;
+
+    t = _t;
+    u = _u;
+    v = _v;
+
+    return true;
+}
+
+/// <summary>
+/// Intersect a ray with a triangle using the Möller–Trumbore algorithm.
+/// </summary>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="v0">The first vertex of the triangle.</param>
+/// <param name="v1">The second vertex of the triangle.</param>
+/// <param name="v2">The third vertex of the triangle.</param>
+/// <param name="t">If the ray hits the triangle, receives the distance to the hit point.</param>
+/// <param name="tMax">The maximum distance along the ray to consider.</param>
+/// <returns>`true` if the ray hits the triangle in the range \f([0 \ldots t_{max}]\f), `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Ray<T>& r, const Vector<T, 3>& v0, const Vector<T, 3>& v1, const Vector<T, 3>& v2, T& t, T tMax = std::numeric_limits<T>::max() ) noexcept
+{
+    T u, v;
+    return intersects( r, v0, v1, v2, t, u, v, tMax );
+}
+
+/// <summary>
+/// Intersect a ray with a sphere.
+/// </summary>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="s">The sphere.</param>
+/// <param name="t">If the ray hits the sphere, receives the distance to the first hit point (or 0 if the origin is inside the sphere).</param>
+/// <param name="tMax">The maximum distance along the ray to consider.</param>
+/// <returns>`true` if the ray hits the sphere in the range \f([0 \ldots t_{max}]\f), `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Ray<T>& r, const Sphere<T>& s, T& t, T tMax = std::numeric_limits<T>::max() ) noexcept
+{
+    const Vector<T, 3> m = r.origin - s.center;
+    const T            a = dot( r.direction, r.direction );
+    const T            b = dot( m, r.direction );
+    const T            c = dot( m, m ) - s.radius * s.radius;
+
+    // The origin is outside of the sphere and the ray is pointing away from it.
+    if ( c > T( 0 ) && b > T( 0 ) )
+        return false;
+
+    const T discr = b * b - a * c;
+    if ( discr < T( 0 ) || a <= T( 0 ) )
+        return false;
+
+    const T _t = std::max( T( 0 ), ( -b - std::sqrt( discr ) ) / a );
+    if ( _t > tMax )
+        return false;
+
+    t = _t;
+
+    return true;
+}
+
+/// <summary>
+/// Intersect 8 rays with an AABB.
+/// </summary>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="rays">The ray packet.</param>
+/// <param name="a">The AABB.</param>
+/// <param name="t">Receives the entry distance for each ray that hits the box. Lanes that miss receive the maximum value of `T`.</param>
+/// <returns>A bit mask with bit `i` set if ray `i` hits the box in the range \f([0 \ldots t_{max}]\f).</returns>
+template<typename T>
+uint32_t intersects( const RayPacket<T>& rays, const AABB<T>& a, std::span<std::type_identity_t<T>, Simd::WIDTH> t ) noexcept
+{
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        const __m256 ox = _mm256_load_ps( rays.ox );
+        const __m256 oy = _mm256_load_ps( rays.oy );
+        const __m256 oz = _mm256_load_ps( rays.oz );
+        const __m256 ix = _mm256_load_ps( rays.ix );
+        const __m256 iy = _mm256_load_ps( rays.iy );
+        const __m256 iz = _mm256_load_ps( rays.iz );
+
+        const __m256 tx1 = _mm256_mul_ps( _mm256_sub_ps( _mm256_set1_ps( a.min.x ), ox ), ix );
+        const __m256 tx2 = _mm256_mul_ps( _mm256_sub_ps( _mm256_set1_ps( a.max.x ), ox ), ix );
+        const __m256 ty1 = _mm256_mul_ps( _mm256_sub_ps( _mm256_set1_ps( a.min.y ), oy ), iy );
+        const __m256 ty2 = _mm256_mul_ps( _mm256_sub_ps( _mm256_set1_ps( a.max.y ), oy ), iy );
+        const __m256 tz1 = _mm256_mul_ps( _mm256_sub_ps( _mm256_set1_ps( a.min.z ), oz ), iz );
+        const __m256 tz2 = _mm256_mul_ps( _mm256_sub_ps( _mm256_set1_ps( a.max.z ), oz ), iz );
+
+        __m256 tNear = _mm256_setzero_ps();
+        tNear        = _mm256_max_ps( tNear, _mm256_min_ps( tx1, tx2 ) );
+        tNear        = _mm256_max_ps( tNear, _mm256_min_ps( ty1, ty2 ) );
+        tNear        = _mm256_max_ps( tNear, _mm256_min_ps( tz1, tz2 ) );
+
+        __m256 tFar = _mm256_load_ps( rays.tMax );
+        tFar        = _mm256_min_ps( tFar, _mm256_max_ps( tx1, tx2 ) );
+        tFar        = _mm256_min_ps( tFar, _mm256_max_ps( ty1, ty2 ) );
+        tFar        = _mm256_min_ps( tFar, _mm256_max_ps( tz1, tz2 ) );
+
+        const __m256 hit = _mm256_cmp_ps( tNear, tFar, _CMP_LE_OQ );
+        _mm256_storeu_ps( t.data(), _mm256_blendv_ps( _mm256_set1_ps( std::numeric_limits<float>::max() ), tNear, hit ) );
+
+        return static_cast<uint32_t>( _mm256_movemask_ps( hit ) );
+    }
+    else
+#endif
+    {
+        uint32_t mask = 0;
+        for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+        {
+            Ray<T> r;
+            r.origin       = { rays.ox[i], rays.oy[i], rays.oz[i] };
+            r.invDirection = { rays.ix[i], rays.iy[i], rays.iz[i] };
+
+            t[i] = std::numeric_limits<T>::max();
+            T _t;
+            if ( rays.tMax[i] >= T( 0 ) && intersects( r, a, _t, T( 0 ), rays.tMax[i] ) )
+            {
+                t[i] = _t;
+                mask |= 1u << i;
+            }
+        }
+
+        return mask;
+    }
+}
+
+/// <summary>
+/// Intersect 8 rays with a triangle.
+/// </summary>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="rays">The ray packet.</param>
+/// <param name="v0">The first vertex of the triangle.</param>
+/// <param name="v1">The second vertex of the triangle.</param>
+/// <param name="v2">The third vertex of the triangle.</param>
+/// <param name="t">Receives the hit distance for each ray that hits the triangle. Lanes that miss receive the maximum value of `T`.</param>
+/// <returns>A bit mask with bit `i` set if ray `i` hits the triangle in the range \f([0 \ldots t_{max}]\f).</returns>
+template<typename T>
+uint32_t intersects( const RayPacket<T>& rays, const Vector<T, 3>& v0, const Vector<T, 3>& v1, const Vector<T, 3>& v2, std::span<std::type_identity_t<T>, Simd::WIDTH> t ) noexcept
+{
+    const Vector<T, 3> e1 = v1 - v0;
+    const Vector<T, 3> e2 = v2 - v0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return detail::intersectTriangles8(
+            _mm256_load_ps( rays.ox ), _mm256_load_ps( rays.oy ), _mm256_load_ps( rays.oz ),
+            _mm256_load_ps( rays.dx ), _mm256_load_ps( rays.dy ), _mm256_load_ps( rays.dz ),
+            _mm256_set1_ps( v0.x ), _mm256_set1_ps( v0.y ), _mm256_set1_ps( v0.z ),
+            _mm256_set1_ps( e1.x ), _mm256_set1_ps( e1.y ), _mm256_set1_ps( e1.z ),
+            _mm256_set1_ps( e2.x ), _mm256_set1_ps( e2.y ), _mm256_set1_ps( e2.z ),
+            _mm256_load_ps( rays.tMax ), t.data() );
+    }
+    else
+#endif
+    {
+        uint32_t mask = 0;
+        for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+        {
+            const Ray<T> r { { rays.ox[i], rays.oy[i], rays.oz[i] }, { rays.dx[i], rays.dy[i], rays.dz[i] } };
+
+            t[i] = std::numeric_limits<T>::max();
+            T _t;
+            if ( rays.tMax[i] >= T( 0 ) && intersects( r, v0, v1, v2, _t, rays.tMax[i] ) )
+            {
+                t[i] = _t;
+                mask |= 1u << i;
+            }
+        }
+
+        return mask;
+    }
+}
+
+/// <summary>
+/// Intersect a ray with 8 triangles.
+/// </summary>
+/// <typeparam name="T">The ray type.</typeparam>
+/// <param name="r">The ray.</param>
+/// <param name="triangles">The triangle packet.</param>
+/// <param name="t">Receives the hit distance for each triangle that is hit. Lanes that miss receive the maximum value of `T`.</param>
+/// <param name="tMax">The maximum distance along the ray to consider.</param>
+/// <returns>A bit mask with bit `i` set if triangle `i` is hit in the range \f([0 \ldots t_{max}]\f).</returns>
+template<typename T>
+uint32_t intersects( const Ray<T>& r, const TrianglePacket<T>& triangles, std::span<std::type_identity_t<T>, Simd::WIDTH> t, T tMax = std::numeric_limits<T>::max() ) noexcept
+{
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        return detail::intersectTriangles8(
+            _mm256_set1_ps( r.origin.x ), _mm256_set1_ps( r.origin.y ), _mm256_set1_ps( r.origin.z ),
+            _mm256_set1_ps( r.direction.x ), _mm256_set1_ps( r.direction.y ), _mm256_set1_ps( r.direction.z ),
+            _mm256_load_ps( triangles.v0x ), _mm256_load_ps( triangles.v0y ), _mm256_load_ps( triangles.v0z ),
+            _mm256_load_ps( triangles.e1x ), _mm256_load_ps( triangles.e1y ), _mm256_load_ps( triangles.e1z ),
+            _mm256_load_ps( triangles.e2x ), _mm256_load_ps( triangles.e2y ), _mm256_load_ps( triangles.e2z ),
+            _mm256_set1_ps( tMax ), t.data() );
+    }
+    else
+#endif
+    {
+        uint32_t mask = 0;
+        for ( std::size_t i = 0; i < Simd::WIDTH; ++i )
+        {
+            const Vector<T, 3> v0 { triangles.v0x[i], triangles.v0y[i], triangles.v0z[i] };
+            const Vector<T, 3> v1 = v0 + Vector<T, 3> { triangles.e1x[i], triangles.e1y[i], triangles.e1z[i] };
+            const Vector<T, 3> v2 = v0 + Vector<T, 3> { triangles.e2x[i], triangles.e2y[i], triangles.e2z[i] };
+
+            t[i] = std::numeric_limits<T>::max();
+            T _t;
+            if ( intersects( r, v0, v1, v2, _t, tMax ) )
+            {
+                t[i] = _t;
+                mask |= 1u << i;
+            }
+        }
+
+        return mask;
+    }
+}
+
+}  // namespace FastMath
@@ -0,0 +1,316 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace FastMath::Simd
+{
+
+/// <summary>
+/// The number of single-precision lanes processed per iteration by the 8-wide
+/// batch functions.
+/// </summary>
+inline constexpr std::size_t WIDTH = 8;
+
+/// <summary>
+/// Lookup table that maps an 8-bit lane mask to the left-packed indices of the
+/// set lanes. For example, the mask `0b00100101` maps to `{ 0, 2, 5, 0, 0, 0, 0, 0 }`.
+/// </summary>
+struct CompressTable
+{
+    constexpr CompressTable() noexcept
+    : indices {}
+    {
+        for ( uint32_t mask = 0; mask < 256; ++mask )
+        {
+            uint8_t n = 0;
+            for ( uint8_t i = 0; i < 8; ++i )
+            {
+                if ( mask & ( 1u << i ) )
+                    indices[mask][n++] = i;
+            }
+        }
+    }
+
+    alignas( 64 ) std::array<std::array<uint8_t, 8>, 256> indices;
+};
+
+inline constexpr CompressTable COMPRESS_TABLE {};
+
+/// <summary>
+/// Write `base + i` to `out` for each set bit `i` of `mask` (in increasing order).
+/// </summary>
+/// <param name="base">The index of the first lane.</param>
+/// <param name="mask">An 8-bit mask of the lanes to write.</param>
+/// <param name="out">The output buffer.</param>
+/// <returns>The number of indices that were written (the number of bits set in `mask`).</returns>
+inline std::size_t compressIndices( uint32_t base, uint32_t mask, uint32_t* out ) noexcept
+{
+    std::size_t n = 0;
+    while ( mask )
+    {
+        out[n++] = base + static_cast<uint32_t>( std::countr_zero( mask ) );
+        mask &= mask - 1;
+    }
+
+    return n;
+}
+
+/// <summary>
+/// Write `base + i` to `out` for each set bit `i` of `mask` (in increasing order)
+/// without branching on the individual bits.
+/// </summary>
+/// <remarks>
+/// When intrinsics are enabled, all 8 lanes are stored to `out` regardless of the
+/// number of bits that are set in `mask`. The caller must ensure that `out` has room
+/// for at least 8 values.
+/// </remarks>
+/// <param name="base">The index of the first lane.</param>
+/// <param name="mask">An 8-bit mask of the lanes to write.</param>
+/// <param name="out">The output buffer (with room for at least 8 values).</param>
+/// <returns>The number of indices that were written (the number of bits set in `mask`).</returns>
+inline std::size_t compressIndices8( uint32_t base, uint32_t mask, uint32_t* out ) noexcept
+{
+    mask &= 0xffu;
+
+#if defined( LS_AVX2 )
+    const __m128i packed  = _mm_loadl_epi64( reinterpret_cast<const __m128i*>( COMPRESS_TABLE.indices[mask].data() ) );
+    const __m256i indices = _mm256_add_epi32( _mm256_cvtepu8_epi32( packed ), _mm256_set1_epi32( static_cast<int>( base ) ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), indices );
+
+    return static_cast<std::size_t>( std::popcount( mask ) );
+#else
+    return compressIndices( base, mask, out );
+#endif
+}
+
+#if defined( LS_AVX2 )
+/// <summary>
+/// Load up to 8 floats from `src`. Lanes past `count` are filled with `fill`.
+/// </summary>
+/// <param name="src">The source array.</param>
+/// <param name="count">The number of valid values in `src` (at most 8 are read).</param>
+/// <param name="fill">The value to use for the lanes past `count`.</param>
+/// <returns>The loaded values.</returns>
+inline __m256 loadPartial( const float* src, std::size_t count, float fill = 0.0f ) noexcept
+{
+    if ( count >= WIDTH )
+        return _mm256_loadu_ps( src );
+
+    alignas( 32 ) float tmp[WIDTH] = { fill, fill, fill, fill, fill, fill, fill, fill };
+    for ( std::size_t i = 0; i < count; ++i )
+        tmp[i] = src[i];
+
+    return _mm256_load_ps( tmp );
+}
+
+/// <summary>
+/// Compute `a * b + c`, using a fused multiply-add when FMA is enabled.
+/// </summary>
+/// <param name="a">The first factor.</param>
+/// <param name="b">The second factor.</param>
+/// <param name="c">The addend.</param>
+/// <returns>The result of `a * b + c`.</returns>
+inline __m256 fmadd( __m256 a, __m256 b, __m256 c ) noexcept
+{
+#if defined( LS_FMA )
+    return _mm256_fmadd_ps( a, b, c );
+#else
+    return _mm256_add_ps( _mm256_mul_ps( a, b ), c );
+#endif
+}
+
+/// <summary>
+/// Compute `a * b + c`, using a fused multiply-add when FMA is enabled.
+/// </summary>
+/// <param name="a">The first factor.</param>
+/// <param name="b">The second factor.</param>
+/// <param name="c">The addend.</param>
+/// <returns>The result of `a * b + c`.</returns>
+inline __m128 fmadd( __m128 a, __m128 b, __m128 c ) noexcept
+{
+#if defined( LS_FMA )
+    return _mm_fmadd_ps( a, b, c );
+#else
+    return _mm_add_ps( _mm_mul_ps( a, b ), c );
+#endif
+}
+
+/// <summary>
+/// Transpose an 8x8 matrix of floats stored in 8 registers (one row per register).
+/// </summary>
+/// <param name="rows">The rows of the matrix. On return, they contain the columns.</param>
+inline void transpose8x8( __m256 ( &rows )[8] ) noexcept
+{
+    const __m256 t0 = _mm256_unpacklo_ps( rows[0], rows[1] );
+    const __m256 t1 = _mm256_unpackhi_ps( rows[0], rows[1] );
+    const __m256 t2 = _mm256_unpacklo_ps( rows[2], rows[3] );
+    const __m256 t3 = _mm256_unpackhi_ps( rows[2], rows[3] );
+    const __m256 t4 = _mm256_unpacklo_ps( rows[4], rows[5] );
+    const __m256 t5 = _mm256_unpackhi_ps( rows[4], rows[5] );
+    const __m256 t6 = _mm256_unpacklo_ps( rows[6], rows[7] );
+    const __m256 t7 = _mm256_unpackhi_ps( rows[6], rows[7] );
+
+    const __m256 u0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+    const __m256 u1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+    const __m256 u2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+    const __m256 u3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+    const __m256 u4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+    const __m256 u5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+    const __m256 u6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+    const __m256 u7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+    rows[0] = _mm256_permute2f128_ps( u0, u4, 0x20 );
+    rows[1] = _mm256_permute2f128_ps( u1, u5, 0x20 );
+    rows[2] = _mm256_permute2f128_ps( u2, u6, 0x20 );
+    rows[3] = _mm256_permute2f128_ps( u3, u7, 0x20 );
+    rows[4] = _mm256_permute2f128_ps( u0, u4, 0x31 );
+    rows[5] = _mm256_permute2f128_ps( u1, u5, 0x31 );
+    rows[6] = _mm256_permute2f128_ps( u2, u6, 0x31 );
+    rows[7] = _mm256_permute2f128_ps( u3, u7, 0x31 );
+}
+
+/// <summary>
+/// Compute the reciprocal \f( 1/x \f) of each lane using the hardware estimate refined
+/// with one Newton-Raphson step.
+/// </summary>
+/// <remarks>
+/// The estimate of `_mm256_rcp_ps` has a relative error of about \f( 2^{-12} \f). The Newton-Raphson step
+/// \f( r' = r + r(1 - xr) \f) roughly doubles the number of correct bits, which is enough for most uses
+/// and much cheaper than a division.
+/// </remarks>
+/// <param name="x">The values.</param>
+/// <returns>The reciprocals.</returns>
+inline __m256 rcp( __m256 x ) noexcept
+{
+    const __m256 r = _mm256_rcp_ps( x );
+    const __m256 e = _mm256_sub_ps( _mm256_set1_ps( 1.0f ), _mm256_mul_ps( x, r ) );
+
+    return fmadd( r, e, r );
+}
+
+/// <summary>
+/// Load 8 consecutive 3-component vectors and deinterleave them into one register per component.
+/// </summary>
+/// <param name="src">The components of the vectors \f( x_0, y_0, z_0, x_1, \ldots, z_7 \f) (24 floats).</param>
+/// <param name="x">Receives the x components.</param>
+/// <param name="y">Receives the y components.</param>
+/// <param name="z">Receives the z components.</param>
+inline void loadVector3x8( const float* src, __m256& x, __m256& y, __m256& z ) noexcept
+{
+    const __m256 a = _mm256_loadu_ps( src );
+    const __m256 b = _mm256_loadu_ps( src + 8 );
+    const __m256 c = _mm256_loadu_ps( src + 16 );
+
+    // Gather the lanes of each component from the 3 registers, then move them into place.
+    x = _mm256_permutevar8x32_ps( _mm256_blend_ps( _mm256_blend_ps( a, b, 0x92 ), c, 0x24 ), _mm256_setr_epi32( 0, 3, 6, 1, 4, 7, 2, 5 ) );
+    y = _mm256_permutevar8x32_ps( _mm256_blend_ps( _mm256_blend_ps( a, b, 0x24 ), c, 0x49 ), _mm256_setr_epi32( 1, 4, 7, 2, 5, 0, 3, 6 ) );
+    z = _mm256_permutevar8x32_ps( _mm256_blend_ps( _mm256_blend_ps( a, b, 0x49 ), c, 0x92 ), _mm256_setr_epi32( 2, 5, 0, 3, 6, 1, 4, 7 ) );
+}
+
+/// <summary>
+/// Interleave one register per component and store them as 8 consecutive 3-component vectors.
+/// </summary>
+/// <param name="dst">Receives the components of the vectors \f( x_0, y_0, z_0, x_1, \ldots, z_7 \f) (24 floats).</param>
+/// <param name="x">The x components.</param>
+/// <param name="y">The y components.</param>
+/// <param name="z">The z components.</param>
+inline void storeVector3x8( float* dst, __m256 x, __m256 y, __m256 z ) noexcept
+{
+    // The inverse of the permutations of loadVector3x8.
+    const __m256 tx = _mm256_permutevar8x32_ps( x, _mm256_setr_epi32( 0, 3, 6, 1, 4, 7, 2, 5 ) );
+    const __m256 ty = _mm256_permutevar8x32_ps( y, _mm256_setr_epi32( 5, 0, 3, 6, 1, 4, 7, 2 ) );
+    const __m256 tz = _mm256_permutevar8x32_ps( z, _mm256_setr_epi32( 2, 5, 0, 3, 6, 1, 4, 7 ) );
+
+    _mm256_storeu_ps( dst, _mm256_blend_ps( _mm256_blend_ps( tx, ty, 0x92 ), tz, 0x24 ) );
+    _mm256_storeu_ps( dst + 8, _mm256_blend_ps( _mm256_blend_ps( tx, ty, 0x24 ), tz, 0x49 ) );
+    _mm256_storeu_ps( dst + 16, _mm256_blend_ps( _mm256_blend_ps( tx, ty, 0x49 ), tz, 0x92 ) );
+}
+
+/// <summary>
+/// Interleave one register per component and store them as 8 consecutive 2-component vectors.
+/// </summary>
+/// <param name="dst">Receives the components of the vectors \f( x_0, y_0, x_1, \ldots, y_7 \f) (16 floats).</param>
+/// <param name="x">The x components.</param>
+/// <param name="y">The y components.</param>
+inline void storeVector2x8( float* dst, __m256 x, __m256 y ) noexcept
+{
+    const __m256 lo = _mm256_unpacklo_ps( x, y );  // 0 1 | 4 5
+    const __m256 hi = _mm256_unpackhi_ps( x, y );  // 2 3 | 6 7
+
+    _mm256_storeu_ps( dst, _mm256_permute2f128_ps( lo, hi, 0x20 ) );
+    _mm256_storeu_ps( dst + 8, _mm256_permute2f128_ps( lo, hi, 0x31 ) );
+}
+
+/// <summary>
+/// Interleave one register per component and store them as 8 consecutive 4-component vectors.
+/// </summary>
+/// <param name="dst">Receives the components of the vectors \f( x_0, y_0, z_0, w_0, x_1, \ldots, w_7 \f) (32 floats).</param>
+/// <param name="x">The first components.</param>
+/// <param name="y">The second components.</param>
+/// <param name="z">The third components.</param>
+/// <param name="w">The fourth components.</param>
+inline void storeVector4x8( float* dst, __m256 x, __m256 y, __m256 z, __m256 w ) noexcept
+{
+    const __m256 xy0 = _mm256_unpacklo_ps( x, y );  // 0 1 | 4 5
+    const __m256 xy1 = _mm256_unpackhi_ps( x, y );  // 2 3 | 6 7
+    const __m256 zw0 = _mm256_unpacklo_ps( z, w );
+    const __m256 zw1 = _mm256_unpackhi_ps( z, w );
+
+    const __m256 v04 = _mm256_shuffle_ps( xy0, zw0, 0x44 );
+    const __m256 v15 = _mm256_shuffle_ps( xy0, zw0, 0xee );
+    const __m256 v26 = _mm256_shuffle_ps( xy1, zw1, 0x44 );
+    const __m256 v37 = _mm256_shuffle_ps( xy1, zw1, 0xee );
+
+    _mm256_storeu_ps( dst, _mm256_permute2f128_ps( v04, v15, 0x20 ) );
+    _mm256_storeu_ps( dst + 8, _mm256_permute2f128_ps( v26, v37, 0x20 ) );
+    _mm256_storeu_ps( dst + 16, _mm256_permute2f128_ps( v04, v15, 0x31 ) );
+    _mm256_storeu_ps( dst + 24, _mm256_permute2f128_ps( v26, v37, 0x31 ) );
+}
+
+/// <summary>
+/// Compute the sine and cosine of each lane.
+/// </summary>
+/// <remarks>
+/// The angle is reduced to \f( [-\frac{\pi}{4} \ldots \frac{\pi}{4}] \f) (using a 3-part Cody-Waite reduction) and
+/// the sine and cosine are approximated with the minimax polynomials of Cephes. The maximum error is a few ulp
+/// for \f( |x| < 8192 \f).
+/// </remarks>
+/// <param name="x">The angles (in radians).</param>
+/// <param name="s">Receives the sines.</param>
+/// <param name="c">Receives the cosines.</param>
+inline void sincos( __m256 x, __m256& s, __m256& c ) noexcept
+{
+    // The quadrant of the angle.
+    const __m256  j = _mm256_round_ps( _mm256_mul_ps( x, _mm256_set1_ps( 0.63661977236758134f ) ), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+    const __m256i q = _mm256_cvtps_epi32( j );
+
+    __m256 y = fmadd( j, _mm256_set1_ps( -1.5703125f ), x );
+    y        = fmadd( j, _mm256_set1_ps( -4.837512969970703125e-4f ), y );
+    y        = fmadd( j, _mm256_set1_ps( -7.54978995489188216e-8f ), y );
+
+    const __m256 y2 = _mm256_mul_ps( y, y );
+
+    __m256 ps = fmadd( _mm256_set1_ps( -1.9515295891e-4f ), y2, _mm256_set1_ps( 8.3321608736e-3f ) );
+    ps        = fmadd( ps, y2, _mm256_set1_ps( -1.6666654611e-1f ) );
+    ps        = fmadd( _mm256_mul_ps( ps, y2 ), y, y );
+
+    __m256 pc = fmadd( _mm256_set1_ps( 2.443315711809948e-5f ), y2, _mm256_set1_ps( -1.388731625493765e-3f ) );
+    pc        = fmadd( pc, y2, _mm256_set1_ps( 4.166664568298827e-2f ) );
+    pc        = fmadd( _mm256_mul_ps( pc, y2 ), y2, fmadd( y2, _mm256_set1_ps( -0.5f ), _mm256_set1_ps( 1.0f ) ) );
+
+    // Quadrants 1 and 3 swap the sine and cosine. Quadrants 2 and 3 negate the sine, and quadrants 1 and 2 negate the cosine.
+    const __m256 swap    = _mm256_castsi256_ps( _mm256_cmpeq_epi32( _mm256_and_si256( q, _mm256_set1_epi32( 1 ) ), _mm256_set1_epi32( 1 ) ) );
+    const __m256 signSin = _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_and_si256( q, _mm256_set1_epi32( 2 ) ), 30 ) );
+    const __m256 signCos = _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_and_si256( _mm256_add_epi32( q, _mm256_set1_epi32( 1 ) ), _mm256_set1_epi32( 2 ) ), 30 ) );
+
+    s = _mm256_xor_ps( _mm256_blendv_ps( ps, pc, swap ), signSin );
+    c = _mm256_xor_ps( _mm256_blendv_ps( pc, ps, swap ), signCos );
+}
+#endif
+
+}  // namespace FastMath::Simd
@@ -0,0 +1,404 @@
+#pragma once
+
+#include "Common.hpp"
+#include "DualQuaternion.hpp"
+#include "Matrix.hpp"
+#include "Simd.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// The vertex streams of a skinned mesh.
+/// </summary>
+/// <remarks>
+/// Each vertex is influenced by the same number of bones. The bone indices and weights of vertex `v` are
+/// `boneIndices[v * influences + k]` and `boneWeights[v * influences + k]` for `k` in \f([0 \ldots influences)\f).
+/// The weights of a vertex should sum to 1 (unused influences have a weight of 0).
+/// The normals are optional and may be empty.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct SkinningStreams
+{
+    std::span<const Vector<T, 3>> positions;
+    std::span<const Vector<T, 3>> normals;
+    std::span<const uint16_t>     boneIndices;
+    std::span<const T>            boneWeights;
+    std::size_t                   influences = 4;
+
+    /// <summary>
+    /// Get the number of vertices.
+    /// </summary>
+    /// <returns>The number of vertices.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return positions.size();
+    }
+};
+
+namespace detail
+{
+
+// The maximum number of vertices per chunk when skinning in parallel.
+inline constexpr std::size_t SKINNING_GRAIN_SIZE = 4096;
+
+// The number of vertices ahead of the current vertex whose bones are prefetched.
+inline constexpr std::size_t SKINNING_PREFETCH_DISTANCE = 8;
+
+template<typename T>
+void checkSkinningStreams( const SkinningStreams<T>& vertices, std::span<const Vector<T, 3>> positions, std::span<const Vector<T, 3>> normals ) noexcept
+{
+    assert( vertices.influences > 0 );
+    assert( vertices.boneIndices.size() == vertices.size() * vertices.influences );
+    assert( vertices.boneWeights.size() == vertices.size() * vertices.influences );
+    assert( positions.size() >= vertices.size() );
+    assert( normals.empty() || ( vertices.normals.size() == vertices.size() && normals.size() >= vertices.size() ) );
+}
+
+#if defined( LS_AVX2 )
+// Prefetch the palette entries (`size` floats each) used by a vertex.
+inline void prefetchBones( const uint16_t* bones, std::size_t influences, const float* palette, std::size_t stride, std::size_t size ) noexcept
+{
+    for ( std::size_t k = 0; k < influences; ++k )
+    {
+        // An entry may straddle two cache lines.
+        const float* entry = palette + bones[k] * stride;
+        _mm_prefetch( reinterpret_cast<const char*>( entry ), _MM_HINT_T0 );
+        _mm_prefetch( reinterpret_cast<const char*>( entry + size - 1 ), _MM_HINT_T0 );
+    }
+}
+#endif
+
+/// <summary>
+/// Linear blend skinning of the vertices \f([begin \ldots end)\f).
+/// </summary>
+/// <remarks>
+/// The palette contains the top 3 rows of the bone matrices, and consecutive matrices are `stride` elements
+/// apart (12 for a 3x4 palette and 16 for a 4x4 palette).
+/// </remarks>
+template<typename T>
+void skinLinear( const SkinningStreams<T>& vertices, const T* palette, std::size_t stride, std::span<Vector<T, 3>> positions, std::span<Vector<T, 3>> normals,
+                 std::size_t begin, std::size_t end ) noexcept
+{
+    const std::size_t influences = vertices.influences;
+    const bool        hasNormals = !normals.empty();
+
+    std::size_t i = begin;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        for ( ; i < end; ++i )
+        {
+            const uint16_t* bones   = vertices.boneIndices.data() + i * influences;
+            const float*    weights = vertices.boneWeights.data() + i * influences;
+
+            if ( i + SKINNING_PREFETCH_DISTANCE < end )
+                prefetchBones( bones + SKINNING_PREFETCH_DISTANCE * influences, influences, palette, stride, 12 );
+
+            // Blend the bone matrices: r01 holds rows 0 and 1, r2 holds row 2.
+            __m256 r01 = _mm256_setzero_ps();
+            __m128 r2  = _mm_setzero_ps();
+            for ( std::size_t k = 0; k < influences; ++k )
+            {
+                const float* m = palette + bones[k] * stride;
+                const __m256 w = _mm256_set1_ps( weights[k] );
+
+                r01 = Simd::fmadd( w, _mm256_loadu_ps( m ), r01 );
+                r2  = Simd::fmadd( _mm256_castps256_ps128( w ), _mm_loadu_ps( m + 8 ), r2 );
+            }
+
+            const Vector<float, 3>& p  = vertices.positions[i];
+            const __m128            p4 = _mm_setr_ps( p.x, p.y, p.z, 1.0f );
+            const __m128            n4 = hasNormals ? _mm_setr_ps( vertices.normals[i].x, vertices.normals[i].y, vertices.normals[i].z, 0.0f ) : _mm_setzero_ps();
+
+            // Dot the rows with the position and the normal:
+            // h = [ r0.p, r0.n, r2.p, r2.p | r1.p, r1.n, r2.n, r2.n ]
+            const __m256 a = _mm256_mul_ps( r01, _mm256_set_m128( p4, p4 ) );
+            const __m256 b = _mm256_mul_ps( r01, _mm256_set_m128( n4, n4 ) );
+            const __m256 c = _mm256_set_m128( _mm_mul_ps( r2, n4 ), _mm_mul_ps( r2, p4 ) );
+            const __m256 h = _mm256_hadd_ps( _mm256_hadd_ps( a, b ), _mm256_hadd_ps( c, c ) );
+
+            alignas( 32 ) float result[Simd::WIDTH];
+            _mm256_store_ps( result, h );
+
+            positions[i] = { result[0], result[4], result[2] };
+            if ( hasNormals )
+                normals[i] = { result[1], result[5], result[6] };
+        }
+    }
+#endif
+
+    for ( ; i < end; ++i )
+    {
+        const uint16_t* bones   = vertices.boneIndices.data() + i * influences;
+        const T*        weights = vertices.boneWeights.data() + i * influences;
+
+        T m[12] = {};
+        for ( std::size_t k = 0; k < influences; ++k )
+        {
+            const T* bone = palette + bones[k] * stride;
+            for ( std::size_t e = 0; e < 12; ++e )
+                m[e] += weights[k] * bone[e];
+        }
+
+        const Vector<T, 3>& p = vertices.positions[i];
+        positions[i]          = {
+            m[0] * p.x + m[1] * p.y + m[2] * p.z + m[3],
+            m[4] * p.x + m[5] * p.y + m[6] * p.z + m[7],
+            m[8] * p.x + m[9] * p.y + m[10] * p.z + m[11],
+        };
+
+        if ( hasNormals )
+        {
+            const Vector<T, 3>& n = vertices.normals[i];
+            normals[i]            = {
+                m[0] * n.x + m[1] * n.y + m[2] * n.z,
+                m[4] * n.x + m[5] * n.y + m[6] * n.z,
+                m[8] * n.x + m[9] * n.y + m[10] * n.z,
+            };
+        }
+    }
+}
+
+/// <summary>
+/// Dual quaternion skinning of the vertices \f([begin \ldots end)\f).
+/// </summary>
+template<typename T>
+void skinDualQuaternion( const SkinningStreams<T>& vertices, std::span<const DualQuaternion<T>> palette, std::span<Vector<T, 3>> positions,
+                         std::span<Vector<T, 3>> normals, std::size_t begin, std::size_t end ) noexcept
+{
+    const std::size_t influences = vertices.influences;
+    const bool        hasNormals = !normals.empty();
+
+    std::size_t i = begin;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> && sizeof( DualQuaternion<T> ) == 8 * sizeof( float ) && sizeof( Vector<T, 3> ) == 3 * sizeof( float ) )
+    {
+        const float*  base   = &palette.data()->real.w;
+        const __m256i stride = _mm256_setr_epi32( 0, 3, 6, 9, 12, 15, 18, 21 );
+        const __m256  one    = _mm256_set1_ps( 1.0f );
+        const __m256  two    = _mm256_set1_ps( 2.0f );
+
+        const auto cross8 = []( const __m256* u, const __m256* v, __m256* r ) {
+            r[0] = _mm256_sub_ps( _mm256_mul_ps( u[1], v[2] ), _mm256_mul_ps( u[2], v[1] ) );
+            r[1] = _mm256_sub_ps( _mm256_mul_ps( u[2], v[0] ), _mm256_mul_ps( u[0], v[2] ) );
+            r[2] = _mm256_sub_ps( _mm256_mul_ps( u[0], v[1] ), _mm256_mul_ps( u[1], v[0] ) );
+        };
+
+        // Rotate 8 vectors by 8 (normalized) rotations: v + 2 ( w ( r x v ) + r x ( r x v ) ).
+        const auto rotate8 = [&]( __m256 w, const __m256* r, __m256* v ) {
+            __m256 uv[3], uuv[3];
+            cross8( r, v, uv );
+            cross8( r, uv, uuv );
+            for ( int c = 0; c < 3; ++c )
+                v[c] = Simd::fmadd( two, Simd::fmadd( uv[c], w, uuv[c] ), v[c] );
+        };
+
+        for ( ; i + Simd::WIDTH <= end; i += Simd::WIDTH )
+        {
+            const uint16_t* bones   = vertices.boneIndices.data() + i * influences;
+            const float*    weights = vertices.boneWeights.data() + i * influences;
+
+            if ( i + Simd::WIDTH + SKINNING_PREFETCH_DISTANCE <= end )
+                prefetchBones( bones + SKINNING_PREFETCH_DISTANCE * influences, SKINNING_PREFETCH_DISTANCE * influences, base, 8, 8 );
+
+            // Blend the dual quaternions of each vertex (one vertex per register).
+            __m256 dq[Simd::WIDTH];
+            for ( std::size_t v = 0; v < Simd::WIDTH; ++v )
+            {
+                const uint16_t* b     = bones + v * influences;
+                const __m128    pivot = _mm_loadu_ps( base + b[0] * 8 );
+
+                __m256 acc = _mm256_setzero_ps();
+                for ( std::size_t k = 0; k < influences; ++k )
+                {
+                    const __m256 q = _mm256_loadu_ps( base + b[k] * 8 );
+
+                    // Negate the transformations in the opposite hemisphere of the first bone.
+                    const __m128 d    = _mm_dp_ps( pivot, _mm256_castps256_ps128( q ), 0xFF );
+                    const __m128 sign = _mm_and_ps( d, _mm_set1_ps( -0.0f ) );
+                    const __m128 w    = _mm_xor_ps( _mm_set1_ps( weights[v * influences + k] ), sign );
+
+                    acc = Simd::fmadd( _mm256_broadcastss_ps( w ), q, acc );
+                }
+                dq[v] = acc;
+            }
+
+            // dq = [ rw, rx, ry, rz, dw, dx, dy, dz ] for 8 vertices.
+            Simd::transpose8x8( dq );
+
+            const __m256 lengthSqr = Simd::fmadd( dq[0], dq[0], Simd::fmadd( dq[1], dq[1], Simd::fmadd( dq[2], dq[2], _mm256_mul_ps( dq[3], dq[3] ) ) ) );
+            const __m256 invLength = _mm256_div_ps( one, _mm256_sqrt_ps( lengthSqr ) );
+
+            const __m256 rw    = _mm256_mul_ps( dq[0], invLength );
+            const __m256 dw    = _mm256_mul_ps( dq[4], invLength );
+            const __m256 r[3]  = { _mm256_mul_ps( dq[1], invLength ), _mm256_mul_ps( dq[2], invLength ), _mm256_mul_ps( dq[3], invLength ) };
+            const __m256 dv[3] = { _mm256_mul_ps( dq[5], invLength ), _mm256_mul_ps( dq[6], invLength ), _mm256_mul_ps( dq[7], invLength ) };
+
+            // t = 2 ( rw dv - dw r + r x dv )
+            __m256 t[3];
+            cross8( r, dv, t );
+            for ( int c = 0; c < 3; ++c )
+                t[c] = _mm256_mul_ps( two, _mm256_add_ps( t[c], _mm256_sub_ps( _mm256_mul_ps( rw, dv[c] ), _mm256_mul_ps( dw, r[c] ) ) ) );
+
+            __m256 p[3];
+            for ( int c = 0; c < 3; ++c )
+                p[c] = _mm256_i32gather_ps( &vertices.positions[i].x + c, stride, 4 );
+
+            rotate8( rw, r, p );
+
+            alignas( 32 ) float px[Simd::WIDTH], py[Simd::WIDTH], pz[Simd::WIDTH];
+            _mm256_store_ps( px, _mm256_add_ps( p[0], t[0] ) );
+            _mm256_store_ps( py, _mm256_add_ps( p[1], t[1] ) );
+            _mm256_store_ps( pz, _mm256_add_ps( p[2], t[2] ) );
+
+            for ( std::size_t k = 0; k < Simd::WIDTH; ++k )
+                positions[i + k] = { px[k], py[k], pz[k] };
+
+            if ( hasNormals )
+            {
+                __m256 n[3];
+                for ( int c = 0; c < 3; ++c )
+                    n[c] = _mm256_i32gather_ps( &vertices.normals[i].x + c, stride, 4 );
+
+                rotate8( rw, r, n );
+
+                alignas( 32 ) float nx[Simd::WIDTH], ny[Simd::WIDTH], nz[Simd::WIDTH];
+                _mm256_store_ps( nx, n[0] );
+                _mm256_store_ps( ny, n[1] );
+                _mm256_store_ps( nz, n[2] );
+
+                for ( std::size_t k = 0; k < Simd::WIDTH; ++k )
+                    normals[i + k] = { nx[k], ny[k], nz[k] };
+            }
+        }
+    }
+#endif
+
+    for ( ; i < end; ++i )
+    {
+        const uint16_t* bones   = vertices.boneIndices.data() + i * influences;
+        const T*        weights = vertices.boneWeights.data() + i * influences;
+
+        const Quaternion<T>& pivot = palette[bones[0]].real;
+
+        DualQuaternion<T> blended { Quaternion<T> { T( 0 ), T( 0 ), T( 0 ), T( 0 ) }, Quaternion<T> { T( 0 ), T( 0 ), T( 0 ), T( 0 ) } };
+        for ( std::size_t k = 0; k < influences; ++k )
+        {
+            const DualQuaternion<T>& dq = palette[bones[k]];
+            const T                  w  = dot( pivot, dq.real ) < T( 0 ) ? -weights[k] : weights[k];
+
+            blended.real += dq.real * w;
+            blended.dual += dq.dual * w;
+        }
+
+        // Only the vector part of the translation is needed, so the dual part doesn't need to be made
+        // orthogonal to the real part.
+        const T invLength = T( 1 ) / length( blended.real );
+        blended.real *= invLength;
+        blended.dual *= invLength;
+
+        positions[i] = transformPoint( blended, vertices.positions[i] );
+        if ( hasNormals )
+            normals[i] = transformDirection( blended, vertices.normals[i] );
+    }
+}
+
+}  // namespace detail
+
+/// <summary>
+/// Skin the vertices of a mesh with linear blend skinning.
+/// </summary>
+/// <remarks>
+/// The blended bone matrix of each vertex is the weighted sum of the matrices of its bones. The positions are
+/// transformed by the blended matrix, and the normals by its upper 3x3 part (the normals are not renormalized,
+/// and the bone matrices should not contain non-uniform scale if normals are used).
+/// The palette contains the top 3 rows of the bone matrices (the bottom row is assumed to be \f( [0, 0, 0, 1] \f)).
+/// The vertices are split into chunks that are skinned in parallel. For single-precision vertices, the matrices
+/// are blended with AVX2 (and FMA, if enabled), and the palette entries of upcoming vertices are prefetched.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="vertices">The vertex streams.</param>
+/// <param name="palette">The bone matrices.</param>
+/// <param name="positions">The skinned positions (1 per vertex).</param>
+/// <param name="normals">(optional) The skinned normals (1 per vertex). Requires the normals stream.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void skin( const SkinningStreams<T>& vertices, std::span<const Matrix<std::type_identity_t<T>, 3, 4>> palette, std::span<Vector<T, 3>> positions,
+           std::span<Vector<T, 3>> normals = {}, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::checkSkinningStreams<T>( vertices, positions, normals );
+
+    const T*          data   = palette.empty() ? nullptr : palette.data()->m;
+    const std::size_t stride = sizeof( Matrix<T, 3, 4> ) / sizeof( T );
+
+    pool.parallelFor( 0, vertices.size(), detail::SKINNING_GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+        detail::skinLinear( vertices, data, stride, positions, normals, begin, end );
+    } );
+}
+
+/// <summary>
+/// Skin the vertices of a mesh with linear blend skinning, using a palette of 4x4 matrices.
+/// </summary>
+/// <remarks>
+/// The bottom row of the bone matrices is ignored. See the 3x4 palette overload for details.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="vertices">The vertex streams.</param>
+/// <param name="palette">The bone matrices.</param>
+/// <param name="positions">The skinned positions (1 per vertex).</param>
+/// <param name="normals">(optional) The skinned normals (1 per vertex). Requires the normals stream.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void skin( const SkinningStreams<T>& vertices, std::span<const Matrix<std::type_identity_t<T>, 4, 4>> palette, std::span<Vector<T, 3>> positions,
+           std::span<Vector<T, 3>> normals = {}, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::checkSkinningStreams<T>( vertices, positions, normals );
+
+    const T*          data   = palette.empty() ? nullptr : palette.data()->m;
+    const std::size_t stride = sizeof( Matrix<T, 4, 4> ) / sizeof( T );
+
+    pool.parallelFor( 0, vertices.size(), detail::SKINNING_GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+        detail::skinLinear( vertices, data, stride, positions, normals, begin, end );
+    } );
+}
+
+/// <summary>
+/// Skin the vertices of a mesh with dual quaternion skinning.
+/// </summary>
+/// <remarks>
+/// The dual quaternions of the bones of each vertex are blended (on the same hemisphere as the first bone of the vertex)
+/// and normalized, which avoids the loss of volume of linear blend skinning around twisting joints. The bones can only
+/// represent rigid transformations.
+/// The vertices are split into chunks that are skinned in parallel. For single-precision vertices, 8 vertices are
+/// transformed at a time with AVX2.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="vertices">The vertex streams.</param>
+/// <param name="palette">The (normalized) bone transformations.</param>
+/// <param name="positions">The skinned positions (1 per vertex).</param>
+/// <param name="normals">(optional) The skinned normals (1 per vertex). Requires the normals stream.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<typename T>
+void skin( const SkinningStreams<T>& vertices, std::span<const DualQuaternion<std::type_identity_t<T>>> palette, std::span<Vector<T, 3>> positions,
+           std::span<Vector<T, 3>> normals = {}, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    detail::checkSkinningStreams<T>( vertices, positions, normals );
+
+    pool.parallelFor( 0, vertices.size(), detail::SKINNING_GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+        detail::skinDualQuaternion( vertices, palette, positions, normals, begin, end );
+    } );
+}
+
+}  // namespace FastMath
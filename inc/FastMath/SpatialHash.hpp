@@ -0,0 +1,642 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Sphere.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace FastMath
+{
+
+namespace detail
+{
+// An open addressing (linear probing) hash map from 64-bit cell keys to 32-bit cell indices.
+// The table only allocates when it grows.
+class CellMap
+{
+public:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t find( uint64_t key ) const noexcept
+    {
+        if ( keys.empty() )
+            return INVALID_INDEX;
+
+        for ( std::size_t i = hash( key ) & mask;; i = ( i + 1 ) & mask )
+        {
+            if ( values[i] == INVALID_INDEX )
+                return INVALID_INDEX;
+            if ( keys[i] == key )
+                return values[i];
+        }
+    }
+
+    // The key must not already be in the map.
+    void insert( uint64_t key, uint32_t value )
+    {
+        if ( ( count + 1 ) * 2 > keys.size() )
+            reserve( std::max<std::size_t>( 16, count + 1 ) );
+
+        std::size_t i = hash( key ) & mask;
+        while ( values[i] != INVALID_INDEX )
+            i = ( i + 1 ) & mask;
+
+        keys[i]   = key;
+        values[i] = value;
+        ++count;
+    }
+
+    // The key must be in the map. The entries that follow it in its cluster are shifted back
+    // into the hole, so no tombstones are needed.
+    void erase( uint64_t key ) noexcept
+    {
+        std::size_t i = hash( key ) & mask;
+        while ( values[i] == INVALID_INDEX || keys[i] != key )
+            i = ( i + 1 ) & mask;
+
+        for ( std::size_t j = ( i + 1 ) & mask; values[j] != INVALID_INDEX; j = ( j + 1 ) & mask )
+        {
+            // The entry at j can fill the hole if the hole is between its home slot and j.
+            const std::size_t home = hash( keys[j] ) & mask;
+            if ( ( ( j - home ) & mask ) >= ( ( j - i ) & mask ) )
+            {
+                keys[i]   = keys[j];
+                values[i] = values[j];
+                i         = j;
+            }
+        }
+
+        values[i] = INVALID_INDEX;
+        --count;
+    }
+
+    void reserve( std::size_t n )
+    {
+        std::size_t capacity = 16;
+        while ( capacity < n * 2 )
+            capacity *= 2;
+
+        if ( capacity <= keys.size() )
+            return;
+
+        std::vector<uint64_t> oldKeys( capacity );
+        std::vector<uint32_t> oldValues( capacity, INVALID_INDEX );
+        std::swap( keys, oldKeys );
+        std::swap( values, oldValues );
+
+        mask  = capacity - 1;
+        count = 0;
+        for ( std::size_t i = 0; i < oldKeys.size(); ++i )
+        {
+            if ( oldValues[i] != INVALID_INDEX )
+                insert( oldKeys[i], oldValues[i] );
+        }
+    }
+
+    void clear() noexcept
+    {
+        std::fill( values.begin(), values.end(), INVALID_INDEX );
+        count = 0;
+    }
+
+private:
+    static constexpr uint64_t hash( uint64_t k ) noexcept
+    {
+        k ^= k >> 33;
+        k *= 0xFF51AFD7ED558CCDull;
+        k ^= k >> 33;
+
+        return k;
+    }
+
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> values;
+    std::size_t           mask  = 0;
+    std::size_t           count = 0;
+};
+
+// Pack the lower 21 bits of each cell coordinate into a 63-bit key.
+constexpr uint64_t packCell( const Vector<int32_t, 3>& c ) noexcept
+{
+    return ( static_cast<uint64_t>( c.x & 0x1FFFFF ) << 42 ) | ( static_cast<uint64_t>( c.y & 0x1FFFFF ) << 21 ) | static_cast<uint64_t>( c.z & 0x1FFFFF );
+}
+
+// Pooled storage for the objects of a spatial partition: each object is in an intrusive
+// doubly-linked list of the cell that contains it. Handles of removed objects are reused.
+template<typename T>
+struct ObjectPool
+{
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    std::vector<AABB<T>>  bounds;
+    std::vector<uint32_t> cell;
+    std::vector<uint32_t> next;
+    std::vector<uint32_t> prev;
+    uint32_t              freeList = INVALID_INDEX;
+    std::size_t           count    = 0;
+
+    void reserve( std::size_t n )
+    {
+        bounds.reserve( n );
+        cell.reserve( n );
+        next.reserve( n );
+        prev.reserve( n );
+    }
+
+    uint32_t alloc( const AABB<T>& b )
+    {
+        ++count;
+
+        if ( freeList != INVALID_INDEX )
+        {
+            const uint32_t h = freeList;
+            freeList         = next[h];
+            bounds[h]        = b;
+            return h;
+        }
+
+        bounds.push_back( b );
+        cell.push_back( INVALID_INDEX );
+        next.push_back( INVALID_INDEX );
+        prev.push_back( INVALID_INDEX );
+
+        return static_cast<uint32_t>( bounds.size() - 1 );
+    }
+
+    void release( uint32_t h ) noexcept
+    {
+        cell[h]  = INVALID_INDEX;
+        next[h]  = freeList;
+        freeList = h;
+        --count;
+    }
+
+    void link( uint32_t h, uint32_t c, uint32_t& head ) noexcept
+    {
+        cell[h] = c;
+        prev[h] = INVALID_INDEX;
+        next[h] = head;
+        if ( head != INVALID_INDEX )
+            prev[head] = h;
+        head = h;
+    }
+
+    void unlink( uint32_t h, uint32_t& head ) noexcept
+    {
+        if ( prev[h] != INVALID_INDEX )
+            next[prev[h]] = next[h];
+        else
+            head = next[h];
+
+        if ( next[h] != INVALID_INDEX )
+            prev[next[h]] = prev[h];
+    }
+
+    void clear() noexcept
+    {
+        bounds.clear();
+        cell.clear();
+        next.clear();
+        prev.clear();
+        freeList = INVALID_INDEX;
+        count    = 0;
+    }
+};
+}  // namespace detail
+
+/// <summary>
+/// A uniform grid of cells that is stored in a hash map, for broad-phase queries over
+/// dynamic objects.
+/// </summary>
+/// <remarks>
+/// Each object is stored in the cell that contains the center of its bounds, so inserting,
+/// moving and removing an object are O(1). Queries are expanded by the largest half-extent of
+/// any object in the grid so that objects that overlap neighboring cells are found (a "loose"
+/// grid); the cell size should be close to the typical object size.
+///
+/// Objects, cells and the hash table are stored in pooled arrays that are only reallocated
+/// when they grow: once the grid has reached its working size, updates do not allocate.
+/// Cells that become empty are removed from the hash table and recycled, so the memory usage
+/// follows the number of occupied cells as objects move through an unbounded world.
+///
+/// The half-extents of the objects are counted in buckets by their binary exponent, and
+/// queries are expanded by the largest half-extent in the highest non-empty bucket. The
+/// expansion shrinks when the largest objects are removed or shrink, and is never more than
+/// twice the largest half-extent of the objects in the grid.
+/// Cell coordinates are stored in 21 bits each, so the grid wraps after \f(2^{21}\f) cells
+/// along each axis. Cells that alias only cost performance, not correctness. Coordinates beyond
+/// \f(2^{30}\f) cells from the origin are clamped.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct SpatialHash
+{
+    /// <summary>
+    /// The SpatialHash value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// An invalid object handle.
+    /// </summary>
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// <summary>
+    /// Construct an empty grid.
+    /// </summary>
+    /// <param name="cellSize">The size of the cells.</param>
+    explicit SpatialHash( T cellSize = T( 1 ) ) noexcept;
+
+    /// <summary>
+    /// Reserve storage for objects and cells.
+    /// </summary>
+    /// <param name="numObjects">The number of objects.</param>
+    /// <param name="numCells">The number of occupied cells.</param>
+    void reserve( std::size_t numObjects, std::size_t numCells );
+
+    /// <summary>
+    /// Insert an object.
+    /// </summary>
+    /// <param name="bounds">The bounds of the object.</param>
+    /// <returns>The handle of the object.</returns>
+    uint32_t insert( const AABB<T>& bounds );
+
+    /// <summary>
+    /// Insert a batch of objects.
+    /// </summary>
+    /// <param name="bounds">The bounds of the objects.</param>
+    /// <param name="handles">Receives the handle of each object. Must have the same size as `bounds`.</param>
+    void insert( std::span<const AABB<T>> bounds, std::span<uint32_t> handles );
+
+    /// <summary>
+    /// Update the bounds of an object.
+    /// </summary>
+    /// <param name="handle">The handle of the object.</param>
+    /// <param name="bounds">The new bounds of the object.</param>
+    void update( uint32_t handle, const AABB<T>& bounds );
+
+    /// <summary>
+    /// Remove an object. The handle may be reused by subsequent insertions.
+    /// </summary>
+    /// <param name="handle">The handle of the object.</param>
+    void remove( uint32_t handle ) noexcept;
+
+    /// <summary>
+    /// Remove all objects (and cells) while keeping the allocated storage.
+    /// </summary>
+    void clear() noexcept;
+
+    /// <summary>
+    /// Get the number of objects in the grid.
+    /// </summary>
+    /// <returns>The number of objects.</returns>
+    std::size_t size() const noexcept;
+
+    /// <summary>
+    /// Get the size of the cells.
+    /// </summary>
+    /// <returns>The size of the cells.</returns>
+    T getCellSize() const noexcept;
+
+    /// <summary>
+    /// Get the number of occupied cells.
+    /// </summary>
+    /// <returns>The number of cells that contain at least one object.</returns>
+    std::size_t getCellCount() const noexcept;
+
+    /// <summary>
+    /// Get the cell that contains a point.
+    /// </summary>
+    /// <param name="p">The point.</param>
+    /// <returns>The integer coordinates of the cell.</returns>
+    Vector<int32_t, 3> getCell( const Vector<T, 3>& p ) const noexcept;
+
+    /// <summary>
+    /// Get the bounds of an object.
+    /// </summary>
+    /// <param name="handle">The handle of the object.</param>
+    /// <returns>The bounds of the object.</returns>
+    const AABB<T>& getBounds( uint32_t handle ) const noexcept;
+
+    /// <summary>
+    /// Find all objects whose bounds overlap an AABB.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `void( uint32_t handle )`.</typeparam>
+    /// <param name="box">The AABB to test.</param>
+    /// <param name="f">Invoked for each object that overlaps the box.</param>
+    template<typename F>
+    void query( const AABB<T>& box, F&& f ) const;
+
+    /// <summary>
+    /// Find all objects whose bounds overlap a sphere.
+    /// </summary>
+    /// <typeparam name="F">The callback type: `void( uint32_t handle )`.</typeparam>
+    /// <param name="sphere">The sphere to test.</param>
+    /// <param name="f">Invoked for each object that overlaps the sphere.</param>
+    template<typename F>
+    void query( const Sphere<T>& sphere, F&& f ) const;
+
+private:
+    static constexpr int EXTENT_BUCKETS = 64;
+
+    uint32_t getOrCreateCell( const Vector<int32_t, 3>& c );
+    void     releaseCell( uint32_t cell ) noexcept;
+    void     addExtent( const AABB<T>& bounds ) noexcept;
+    void     removeExtent( const AABB<T>& bounds ) noexcept;
+    T        getMaxHalfExtent() const noexcept;
+
+    static int extentBucket( T halfExtent ) noexcept;
+
+    T cellSize;
+    T invCellSize;
+
+    // The number of objects and the largest half-extent in each bucket.
+    uint32_t extentCounts[EXTENT_BUCKETS] = {};
+    T        extentMax[EXTENT_BUCKETS]    = {};
+    int      topBucket                    = -1;
+
+    detail::ObjectPool<T> objects;
+    detail::CellMap       map;
+    std::vector<uint32_t> heads;  // The first object in each cell (or the next free cell, for recycled cells).
+    std::vector<uint64_t> cellKeys;
+    uint32_t              freeCells     = INVALID_INDEX;
+    std::size_t           freeCellCount = 0;
+};
+
+using SpatialHashf = SpatialHash<float>;
+using SpatialHashd = SpatialHash<double>;
+
+template<typename T>
+SpatialHash<T>::SpatialHash( T cellSize ) noexcept
+: cellSize { cellSize }
+, invCellSize { T( 1 ) / cellSize }
+{
+    assert( cellSize > T( 0 ) );
+}
+
+template<typename T>
+void SpatialHash<T>::reserve( std::size_t numObjects, std::size_t numCells )
+{
+    objects.reserve( numObjects );
+    heads.reserve( numCells );
+    cellKeys.reserve( numCells );
+    map.reserve( numCells );
+}
+
+template<typename T>
+Vector<int32_t, 3> SpatialHash<T>::getCell( const Vector<T, 3>& p ) const noexcept
+{
+    // Converting a value outside of the range of int32_t (or NaN) is undefined, so clamp first. The limit
+    // is exact in float and leaves room for the size of a range of cells in a query.
+    constexpr T limit = T( 1 << 30 );
+
+    const auto cell = [this]( T x ) {
+        const T c = std::floor( x * invCellSize );
+        return static_cast<int32_t>( c > -limit ? ( c < limit ? c : limit ) : -limit );
+    };
+
+    return { cell( p.x ), cell( p.y ), cell( p.z ) };
+}
+
+template<typename T>
+uint32_t SpatialHash<T>::getOrCreateCell( const Vector<int32_t, 3>& c )
+{
+    const uint64_t key = detail::packCell( c );
+
+    uint32_t cell = map.find( key );
+    if ( cell == detail::CellMap::INVALID_INDEX )
+    {
+        if ( freeCells != INVALID_INDEX )
+        {
+            cell      = freeCells;
+            freeCells = heads[cell];
+            --freeCellCount;
+
+            heads[cell]    = INVALID_INDEX;
+            cellKeys[cell] = key;
+        }
+        else
+        {
+            cell = static_cast<uint32_t>( heads.size() );
+            heads.push_back( INVALID_INDEX );
+            cellKeys.push_back( key );
+        }
+
+        map.insert( key, cell );
+    }
+
+    return cell;
+}
+
+// Recycle a cell if it is empty. Free cells are linked through their heads, so this doesn't allocate.
+template<typename T>
+void SpatialHash<T>::releaseCell( uint32_t cell ) noexcept
+{
+    if ( heads[cell] != INVALID_INDEX )
+        return;
+
+    map.erase( cellKeys[cell] );
+    heads[cell] = freeCells;
+    freeCells   = cell;
+    ++freeCellCount;
+}
+
+template<typename T>
+int SpatialHash<T>::extentBucket( T halfExtent ) noexcept
+{
+    if ( !( halfExtent > T( 0 ) ) )
+        return 0;
+
+    return std::clamp( std::ilogb( halfExtent ), -EXTENT_BUCKETS / 2, EXTENT_BUCKETS / 2 - 1 ) + EXTENT_BUCKETS / 2;
+}
+
+template<typename T>
+void SpatialHash<T>::addExtent( const AABB<T>& bounds ) noexcept
+{
+    const Vector<T, 3> e = extents( bounds );
+    const T            m = std::max( { e.x, e.y, e.z, T( 0 ) } );
+    const int          b = extentBucket( m );
+
+    ++extentCounts[b];
+    extentMax[b] = std::max( extentMax[b], m );
+    topBucket    = std::max( topBucket, b );
+}
+
+template<typename T>
+void SpatialHash<T>::removeExtent( const AABB<T>& bounds ) noexcept
+{
+    const Vector<T, 3> e = extents( bounds );
+    const int          b = extentBucket( std::max( { e.x, e.y, e.z, T( 0 ) } ) );
+
+    // The maximum of a bucket is only reset when the bucket is empty, so it may be larger than
+    // the objects that remain (but less than twice as large).
+    if ( --extentCounts[b] == 0 )
+    {
+        extentMax[b] = T( 0 );
+        while ( topBucket >= 0 && extentCounts[topBucket] == 0 )
+            --topBucket;
+    }
+}
+
+template<typename T>
+T SpatialHash<T>::getMaxHalfExtent() const noexcept
+{
+    return topBucket >= 0 ? extentMax[topBucket] : T( 0 );
+}
+
+template<typename T>
+uint32_t SpatialHash<T>::insert( const AABB<T>& bounds )
+{
+    const uint32_t h    = objects.alloc( bounds );
+    const uint32_t cell = getOrCreateCell( getCell( center( bounds ) ) );
+
+    objects.link( h, cell, heads[cell] );
+    addExtent( bounds );
+
+    return h;
+}
+
+template<typename T>
+void SpatialHash<T>::insert( std::span<const AABB<T>> bounds, std::span<uint32_t> handles )
+{
+    assert( handles.size() >= bounds.size() );
+
+    objects.reserve( objects.bounds.size() + bounds.size() );
+
+    for ( std::size_t i = 0; i < bounds.size(); ++i )
+        handles[i] = insert( bounds[i] );
+}
+
+template<typename T>
+void SpatialHash<T>::update( uint32_t handle, const AABB<T>& bounds )
+{
+    assert( objects.cell[handle] != INVALID_INDEX );
+
+    removeExtent( objects.bounds[handle] );
+    addExtent( bounds );
+    objects.bounds[handle] = bounds;
+
+    const uint32_t prev = objects.cell[handle];
+    const uint32_t cell = getOrCreateCell( getCell( center( bounds ) ) );
+    if ( cell == prev )
+        return;
+
+    objects.unlink( handle, heads[prev] );
+    objects.link( handle, cell, heads[cell] );
+    releaseCell( prev );
+}
+
+template<typename T>
+void SpatialHash<T>::remove( uint32_t handle ) noexcept
+{
+    assert( objects.cell[handle] != INVALID_INDEX );
+
+    const uint32_t cell = objects.cell[handle];
+
+    removeExtent( objects.bounds[handle] );
+    objects.unlink( handle, heads[cell] );
+    objects.release( handle );
+    releaseCell( cell );
+}
+
+template<typename T>
+void SpatialHash<T>::clear() noexcept
+{
+    objects.clear();
+    map.clear();
+    heads.clear();
+    cellKeys.clear();
+    freeCells     = INVALID_INDEX;
+    freeCellCount = 0;
+
+    std::fill_n( extentCounts, EXTENT_BUCKETS, 0u );
+    std::fill_n( extentMax, EXTENT_BUCKETS, T( 0 ) );
+    topBucket = -1;
+}
+
+template<typename T>
+std::size_t SpatialHash<T>::size() const noexcept
+{
+    return objects.count;
+}
+
+template<typename T>
+T SpatialHash<T>::getCellSize() const noexcept
+{
+    return cellSize;
+}
+
+template<typename T>
+std::size_t SpatialHash<T>::getCellCount() const noexcept
+{
+    return heads.size() - freeCellCount;
+}
+
+template<typename T>
+const AABB<T>& SpatialHash<T>::getBounds( uint32_t handle ) const noexcept
+{
+    return objects.bounds[handle];
+}
+
+template<typename T>
+template<typename F>
+void SpatialHash<T>::query( const AABB<T>& box, F&& f ) const
+{
+    if ( objects.count == 0 || isEmpty( box ) )
+        return;
+
+    // Objects are stored by their center, so expand the query by the largest half-extent.
+    const Vector<T, 3>       e { getMaxHalfExtent() };
+    const Vector<int32_t, 3> lo = getCell( box.min - e );
+    const Vector<int32_t, 3> hi = getCell( box.max + e );
+
+    // If the query covers more cells than are occupied, testing every object is cheaper.
+    const double cells = ( double( hi.x ) - lo.x + 1 ) * ( double( hi.y ) - lo.y + 1 ) * ( double( hi.z ) - lo.z + 1 );
+    if ( cells > static_cast<double>( getCellCount() ) )
+    {
+        for ( uint32_t h = 0; h < objects.bounds.size(); ++h )
+        {
+            if ( objects.cell[h] != INVALID_INDEX && intersects( objects.bounds[h], box ) )
+                f( h );
+        }
+        return;
+    }
+
+    for ( int32_t x = lo.x; x <= hi.x; ++x )
+    {
+        for ( int32_t y = lo.y; y <= hi.y; ++y )
+        {
+            for ( int32_t z = lo.z; z <= hi.z; ++z )
+            {
+                const uint32_t cell = map.find( detail::packCell( { x, y, z } ) );
+                if ( cell == detail::CellMap::INVALID_INDEX )
+                    continue;
+
+                for ( uint32_t h = heads[cell]; h != INVALID_INDEX; h = objects.next[h] )
+                {
+                    if ( intersects( objects.bounds[h], box ) )
+                        f( h );
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+template<typename F>
+void SpatialHash<T>::query( const Sphere<T>& sphere, F&& f ) const
+{
+    query( toAABB( sphere ), [&]( uint32_t h ) {
+        if ( intersects( sphere, objects.bounds[h] ) )
+            f( h );
+    } );
+}
+
+}  // namespace FastMath
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <span>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A bounding sphere defined by a center point and a radius.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Sphere
+{
+    /// <summary>
+    /// The Sphere value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Default construct a sphere with radius 0 at the origin.
+    /// </summary>
+    constexpr Sphere() noexcept = default;
+
+    /// <summary>
+    /// Construct a sphere from a center point and a radius.
+    /// </summary>
+    /// <param name="center">The center of the sphere.</param>
+    /// <param name="radius">The radius of the sphere.</param>
+    constexpr Sphere( const Vector<T, 3>& center, T radius ) noexcept;
+
+    Vector<T, 3> center;
+    T            radius = T( 0 );
+};
+
+using Spheref = Sphere<float>;
+using Sphered = Sphere<double>;
+
+/// <summary>
+/// A structure-of-arrays view over a set of spheres. This is the layout expected by
+/// the 8-wide batch functions.
+/// </summary>
+/// <remarks>
+/// All of the spans must have the same size.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct SphereSoA
+{
+    std::span<const T> x, y, z;
+    std::span<const T> radius;
+
+    /// <summary>
+    /// Get the number of spheres in the view.
+    /// </summary>
+    /// <returns>The number of spheres.</returns>
+    constexpr std::size_t size() const noexcept
+    {
+        return x.size();
+    }
+};
+
+template<typename T>
+constexpr Sphere<T>::Sphere( const Vector<T, 3>& center, T radius ) noexcept
+: center { center }
+, radius { radius }
+{}
+
+/// <summary>
+/// Check to see if a point is inside (or on the surface of) a sphere.
+/// </summary>
+/// <typeparam name="T">The sphere type.</typeparam>
+/// <param name="s">The sphere.</param>
+/// <param name="p">The point to check.</param>
+/// <returns>`true` if `p` is contained in `s`, `false` otherwise.</returns>
+template<typename T>
+constexpr bool contains( const Sphere<T>& s, const Vector<T, 3>& p ) noexcept
+{
+    return lengthSqr( p - s.center ) <= s.radius * s.radius;
+}
+
+/// <summary>
+/// Check to see if two spheres overlap.
+/// </summary>
+/// <typeparam name="T">The sphere type.</typeparam>
+/// <param name="a">The first sphere.</param>
+/// <param name="b">The second sphere.</param>
+/// <returns>`true` if the spheres overlap, `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Sphere<T>& a, const Sphere<T>& b ) noexcept
+{
+    const T r = a.radius + b.radius;
+    return lengthSqr( a.center - b.center ) <= r * r;
+}
+
+/// <summary>
+/// Check to see if a sphere overlaps an AABB.
+/// </summary>
+/// <typeparam name="T">The sphere type.</typeparam>
+/// <param name="s">The sphere.</param>
+/// <param name="a">The AABB.</param>
+/// <returns>`true` if the sphere and the AABB overlap, `false` otherwise.</returns>
+template<typename T>
+constexpr bool intersects( const Sphere<T>& s, const AABB<T>& a ) noexcept
+{
+    const Vector<T, 3> p {
+        std::clamp( s.center.x, a.min.x, a.max.x ),
+        std::clamp( s.center.y, a.min.y, a.max.y ),
+        std::clamp( s.center.z, a.min.z, a.max.z )
+    };
+
+    return lengthSqr( p - s.center ) <= s.radius * s.radius;
+}
+
+/// <summary>
+/// Compute the AABB that bounds a sphere.
+/// </summary>
+/// <typeparam name="T">The sphere type.</typeparam>
+/// <param name="s">The sphere.</param>
+/// <returns>The AABB that bounds the sphere.</returns>
+template<typename T>
+constexpr AABB<T> toAABB( const Sphere<T>& s ) noexcept
+{
+    const Vector<T, 3> r( s.radius );
+    return { s.center - r, s.center + r };
+}
+
+}  // namespace FastMath
@@ -0,0 +1,881 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A piecewise cubic curve.
+/// </summary>
+/// <remarks>
+/// Each segment is stored in power basis, \f( c_0 + c_1u + c_2u^2 + c_3u^3 \f), so the curve
+/// (and its derivatives) are evaluated using Horner's method regardless of how the spline
+/// was defined. See CatmullRomSpline, BezierSpline, HermiteSpline, and BSpline for the
+/// different ways to construct a spline.
+///
+/// The spline is parameterized over \f( [0 \ldots n] \f), where \f( n \f) is the number of segments.
+/// Segment `i` covers the parameter range \f( [i \ldots i+1] \f). Parameters outside of this range
+/// are clamped.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N>
+struct CubicSpline
+{
+    /// <summary>
+    /// The CubicSpline value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// The vector type of the points on the spline.
+    /// </summary>
+    using vector_type = Vector<T, N>;
+
+    /// <summary>
+    /// Construct an empty spline.
+    /// </summary>
+    CubicSpline() = default;
+
+    /// <summary>
+    /// Add a segment to the end of the spline.
+    /// </summary>
+    /// <param name="c0">The constant coefficient.</param>
+    /// <param name="c1">The linear coefficient.</param>
+    /// <param name="c2">The quadratic coefficient.</param>
+    /// <param name="c3">The cubic coefficient.</param>
+    void addSegment( const Vector<T, N>& c0, const Vector<T, N>& c1, const Vector<T, N>& c2, const Vector<T, N>& c3 );
+
+    /// <summary>
+    /// Check to see if the spline is empty.
+    /// </summary>
+    /// <returns>`true` if the spline does not have any segments.</returns>
+    bool empty() const noexcept;
+
+    /// <summary>
+    /// Get the number of segments in the spline.
+    /// </summary>
+    /// <returns>The number of segments.</returns>
+    std::size_t getSegmentCount() const noexcept;
+
+    /// <summary>
+    /// Get a coefficient of a segment.
+    /// </summary>
+    /// <param name="segment">The index of the segment.</param>
+    /// <param name="k">The degree of the coefficient ([0..3]).</param>
+    /// <returns>The coefficient \f( c_k \f) of the segment.</returns>
+    Vector<T, N> getCoefficient( std::size_t segment, std::size_t k ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the spline.
+    /// </summary>
+    /// <param name="t">The spline parameter.</param>
+    /// <returns>The point on the spline at `t`, or zero if the spline is empty.</returns>
+    Vector<T, N> evaluate( T t ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the first derivative of the spline (with respect to the spline parameter).
+    /// </summary>
+    /// <param name="t">The spline parameter.</param>
+    /// <returns>The tangent of the spline at `t`, or zero if the spline is empty.</returns>
+    Vector<T, N> derivative( T t ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the second derivative of the spline (with respect to the spline parameter).
+    /// </summary>
+    /// <param name="t">The spline parameter.</param>
+    /// <returns>The second derivative of the spline at `t`, or zero if the spline is empty.</returns>
+    Vector<T, N> secondDerivative( T t ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the spline at many parameters.
+    /// </summary>
+    /// <remarks>
+    /// With AVX2 enabled, 8 single-precision parameters are evaluated at a time.
+    /// </remarks>
+    /// <param name="t">The spline parameters.</param>
+    /// <param name="results">Receives the points on the spline. Must have the same size as `t`.</param>
+    void evaluate( std::span<const T> t, std::span<Vector<T, N>> results ) const noexcept;
+
+    /// <summary>
+    /// Evaluate the first derivative of the spline at many parameters.
+    /// </summary>
+    /// <param name="t">The spline parameters.</param>
+    /// <param name="results">Receives the tangents of the spline. Must have the same size as `t`.</param>
+    void derivative( std::span<const T> t, std::span<Vector<T, N>> results ) const noexcept;
+
+    /// <summary>
+    /// Find the parameter of the point on the spline that is closest to a given point.
+    /// </summary>
+    /// <remarks>
+    /// Segments are skipped if the bounding box of their (Bézier) control points is further away
+    /// than the closest point found so far. Within a segment, the closest point is found by Newton's
+    /// method on \f( (C(u) - p) \cdot C'(u) = 0 \f), starting from the closest of a few samples.
+    /// </remarks>
+    /// <param name="p">The query point.</param>
+    /// <returns>The parameter of the closest point on the spline, or 0 if the spline is empty.</returns>
+    T closestParameter( const Vector<T, N>& p ) const noexcept;
+
+private:
+    // The number of values per segment.
+    static constexpr std::size_t STRIDE = 4 * N;
+
+    // Find the segment and local parameter of a spline parameter.
+    std::size_t findSegment( T t, T& u ) const noexcept;
+
+    // The squared distance from p to the bounds of a segment.
+    T boundsDistanceSqr( std::size_t segment, const Vector<T, N>& p ) const noexcept;
+
+    // Find the closest point in a segment.
+    T closestParameter( std::size_t segment, const Vector<T, N>& p, T& distanceSqr ) const noexcept;
+
+    std::vector<T> coefficients;  // The coefficients of each segment (c0..c3).
+    std::vector<T> bounds;        // The minimum and maximum of the Bézier control points of each segment.
+};
+
+/// <summary>
+/// A Catmull-Rom spline that passes through a sequence of points.
+/// </summary>
+/// <remarks>
+/// The tangents of the curve are determined by the neighboring points. The spline has one segment
+/// for each pair of consecutive points. The missing neighbors of the end points are extrapolated
+/// (\f( p_{-1} = 2p_0 - p_1 \f)).
+///
+/// The `alpha` parameter selects the parameterization: 0 for uniform, 0.5 for centripetal (which
+/// avoids cusps and self-intersections within a segment), or 1 for chordal.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N>
+struct CatmullRomSpline : CubicSpline<T, N>
+{
+    /// <summary>
+    /// Construct an empty spline.
+    /// </summary>
+    CatmullRomSpline() = default;
+
+    /// <summary>
+    /// Construct a Catmull-Rom spline through a sequence of points.
+    /// </summary>
+    /// <param name="points">The points to interpolate (at least 2).</param>
+    /// <param name="alpha">The parameterization (0 for uniform, 0.5 for centripetal, 1 for chordal).</param>
+    explicit CatmullRomSpline( std::span<const Vector<T, N>> points, T alpha = T( 0.5 ) );
+};
+
+/// <summary>
+/// A piecewise cubic Bézier spline.
+/// </summary>
+/// <remarks>
+/// Each segment is defined by 4 control points, and consecutive segments share their end
+/// points. So \f( 3n+1 \f) control points define \f( n \f) segments.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N>
+struct BezierSpline : CubicSpline<T, N>
+{
+    /// <summary>
+    /// Construct an empty spline.
+    /// </summary>
+    BezierSpline() = default;
+
+    /// <summary>
+    /// Construct a Bézier spline from control points.
+    /// </summary>
+    /// <param name="controlPoints">The control points. The number of control points must be \f( 3n+1 \f).</param>
+    explicit BezierSpline( std::span<const Vector<T, N>> controlPoints );
+};
+
+/// <summary>
+/// A cubic Hermite spline that passes through a sequence of points with the given tangents.
+/// </summary>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N>
+struct HermiteSpline : CubicSpline<T, N>
+{
+    /// <summary>
+    /// Construct an empty spline.
+    /// </summary>
+    HermiteSpline() = default;
+
+    /// <summary>
+    /// Construct a Hermite spline.
+    /// </summary>
+    /// <param name="points">The points to interpolate.</param>
+    /// <param name="tangents">The tangent (with respect to the spline parameter) at each point. Must have the same size as `points`.</param>
+    HermiteSpline( std::span<const Vector<T, N>> points, std::span<const Vector<T, N>> tangents );
+};
+
+/// <summary>
+/// A uniform cubic B-spline.
+/// </summary>
+/// <remarks>
+/// The curve does not (in general) pass through the control points, but it is \f( C^2 \f)
+/// continuous. Each segment is defined by 4 consecutive control points, so \f( n+3 \f) control
+/// points define \f( n \f) segments.
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+/// <typeparam name="N">The number of vector components.</typeparam>
+template<typename T, std::size_t N>
+struct BSpline : CubicSpline<T, N>
+{
+    /// <summary>
+    /// Construct an empty spline.
+    /// </summary>
+    BSpline() = default;
+
+    /// <summary>
+    /// Construct a uniform B-spline from control points.
+    /// </summary>
+    /// <param name="controlPoints">The control points (at least 4).</param>
+    explicit BSpline( std::span<const Vector<T, N>> controlPoints );
+};
+
+/// <summary>
+/// A lookup table that maps arc length to spline parameter (and back).
+/// </summary>
+/// <remarks>
+/// Traversing a spline at a constant rate of the spline parameter does not result in constant speed.
+/// The table is used to reparameterize the spline by arc length, for example to move along the spline at
+/// constant speed or to place points at equal distances along the spline.
+///
+/// The arc length is integrated using Gauss-Legendre quadrature. The table stores the distance at
+/// evenly spaced parameters, and the spline parameter at evenly spaced distances along the spline.
+/// Looking up a parameter interpolates the second table and refines the result with a Newton step
+/// on the first, so it takes constant time (no search).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct ArcLengthTable
+{
+    /// <summary>
+    /// The ArcLengthTable value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct an empty table.
+    /// </summary>
+    ArcLengthTable() = default;
+
+    /// <summary>
+    /// Build the arc length table for a spline.
+    /// </summary>
+    /// <param name="spline">The spline.</param>
+    /// <param name="samplesPerSegment">The number of table entries for each segment of the spline.</param>
+    template<std::size_t N>
+    explicit ArcLengthTable( const CubicSpline<T, N>& spline, std::size_t samplesPerSegment = 32 );
+
+    /// <summary>
+    /// Get the length of the spline.
+    /// </summary>
+    /// <returns>The arc length of the spline.</returns>
+    T getLength() const noexcept;
+
+    /// <summary>
+    /// Get the distance along the spline at a spline parameter.
+    /// </summary>
+    /// <param name="t">The spline parameter.</param>
+    /// <returns>The arc length from the start of the spline to `t`.</returns>
+    T getDistance( T t ) const noexcept;
+
+    /// <summary>
+    /// Get the spline parameter at a distance along the spline.
+    /// </summary>
+    /// <param name="s">The distance from the start of the spline (clamped to [0..getLength()]).</param>
+    /// <returns>The spline parameter.</returns>
+    T getParameter( T s ) const noexcept;
+
+    /// <summary>
+    /// Get the spline parameters at many distances along the spline.
+    /// </summary>
+    /// <param name="s">The distances from the start of the spline.</param>
+    /// <param name="results">Receives the spline parameters. Must have the same size as `s`.</param>
+    void getParameter( std::span<const T> s, std::span<T> results ) const noexcept;
+
+private:
+    // Linearly interpolate a table at a fractional index.
+    static T lookup( const std::vector<T>& table, T x ) noexcept;
+
+    T              length            = T( 0 );
+    std::size_t    samplesPerSegment = 0;
+    std::vector<T> distances;   // The distance at evenly spaced parameters.
+    std::vector<T> parameters;  // The parameter at evenly spaced distances.
+};
+
+using CubicSpline2f      = CubicSpline<float, 2>;
+using CubicSpline2d      = CubicSpline<double, 2>;
+using CubicSpline3f      = CubicSpline<float, 3>;
+using CubicSpline3d      = CubicSpline<double, 3>;
+using CatmullRomSpline2f = CatmullRomSpline<float, 2>;
+using CatmullRomSpline2d = CatmullRomSpline<double, 2>;
+using CatmullRomSpline3f = CatmullRomSpline<float, 3>;
+using CatmullRomSpline3d = CatmullRomSpline<double, 3>;
+using BezierSpline2f     = BezierSpline<float, 2>;
+using BezierSpline2d     = BezierSpline<double, 2>;
+using BezierSpline3f     = BezierSpline<float, 3>;
+using BezierSpline3d     = BezierSpline<double, 3>;
+using HermiteSpline2f    = HermiteSpline<float, 2>;
+using HermiteSpline2d    = HermiteSpline<double, 2>;
+using HermiteSpline3f    = HermiteSpline<float, 3>;
+using HermiteSpline3d    = HermiteSpline<double, 3>;
+using BSpline2f          = BSpline<float, 2>;
+using BSpline2d          = BSpline<double, 2>;
+using BSpline3f          = BSpline<float, 3>;
+using BSpline3d          = BSpline<double, 3>;
+using ArcLengthTablef    = ArcLengthTable<float>;
+using ArcLengthTabled    = ArcLengthTable<double>;
+
+template<typename T, std::size_t N>
+void CubicSpline<T, N>::addSegment( const Vector<T, N>& c0, const Vector<T, N>& c1, const Vector<T, N>& c2, const Vector<T, N>& c3 )
+{
+    for ( const Vector<T, N>* c: { &c0, &c1, &c2, &c3 } )
+    {
+        for ( std::size_t k = 0; k < N; ++k )
+            coefficients.push_back( ( *c )[k] );
+    }
+
+    // The Bézier control points of the segment bound the curve (convex hull property).
+    const Vector<T, N> b[4] = {
+        c0,
+        c0 + c1 / T( 3 ),
+        c0 + ( c1 * T( 2 ) + c2 ) / T( 3 ),
+        c0 + c1 + c2 + c3,
+    };
+
+    for ( std::size_t k = 0; k < N; ++k )
+        bounds.push_back( std::min( { b[0][k], b[1][k], b[2][k], b[3][k] } ) );
+    for ( std::size_t k = 0; k < N; ++k )
+        bounds.push_back( std::max( { b[0][k], b[1][k], b[2][k], b[3][k] } ) );
+}
+
+template<typename T, std::size_t N>
+bool CubicSpline<T, N>::empty() const noexcept
+{
+    return coefficients.empty();
+}
+
+template<typename T, std::size_t N>
+std::size_t CubicSpline<T, N>::getSegmentCount() const noexcept
+{
+    return coefficients.size() / STRIDE;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CubicSpline<T, N>::getCoefficient( std::size_t segment, std::size_t k ) const noexcept
+{
+    assert( segment < getSegmentCount() && k < 4 );
+
+    return Vector<T, N> { std::span<const T, N>( coefficients.data() + segment * STRIDE + k * N, N ) };
+}
+
+template<typename T, std::size_t N>
+std::size_t CubicSpline<T, N>::findSegment( T t, T& u ) const noexcept
+{
+    const std::size_t n = getSegmentCount();
+    const T           x = std::clamp( t, T( 0 ), static_cast<T>( n ) );
+    const std::size_t i = std::min( static_cast<std::size_t>( x ), n - 1 );
+
+    u = x - static_cast<T>( i );
+    return i;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CubicSpline<T, N>::evaluate( T t ) const noexcept
+{
+    Vector<T, N> r { T( 0 ) };
+    if ( empty() )
+        return r;
+
+    T        u;
+    const T* c = coefficients.data() + findSegment( t, u ) * STRIDE;
+
+    for ( std::size_t k = 0; k < N; ++k )
+        r[k] = ( ( c[3 * N + k] * u + c[2 * N + k] ) * u + c[N + k] ) * u + c[k];
+
+    return r;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CubicSpline<T, N>::derivative( T t ) const noexcept
+{
+    Vector<T, N> r { T( 0 ) };
+    if ( empty() )
+        return r;
+
+    T        u;
+    const T* c = coefficients.data() + findSegment( t, u ) * STRIDE;
+
+    for ( std::size_t k = 0; k < N; ++k )
+        r[k] = ( T( 3 ) * c[3 * N + k] * u + T( 2 ) * c[2 * N + k] ) * u + c[N + k];
+
+    return r;
+}
+
+template<typename T, std::size_t N>
+Vector<T, N> CubicSpline<T, N>::secondDerivative( T t ) const noexcept
+{
+    Vector<T, N> r { T( 0 ) };
+    if ( empty() )
+        return r;
+
+    T        u;
+    const T* c = coefficients.data() + findSegment( t, u ) * STRIDE;
+
+    for ( std::size_t k = 0; k < N; ++k )
+        r[k] = T( 6 ) * c[3 * N + k] * u + T( 2 ) * c[2 * N + k];
+
+    return r;
+}
+
+namespace detail
+{
+#if defined( LS_AVX2 )
+// Find the segments and local parameters of 8 spline parameters.
+inline __m256i findSegment8( __m256 t, std::size_t segmentCount, __m256& u ) noexcept
+{
+    const __m256  n = _mm256_set1_ps( static_cast<float>( segmentCount ) );
+    const __m256  x = _mm256_min_ps( _mm256_max_ps( t, _mm256_setzero_ps() ), n );
+    const __m256i i = _mm256_min_epi32( _mm256_cvttps_epi32( x ), _mm256_set1_epi32( static_cast<int32_t>( segmentCount - 1 ) ) );
+
+    u = _mm256_sub_ps( x, _mm256_cvtepi32_ps( i ) );
+    return i;
+}
+#endif
+}  // namespace detail
+
+template<typename T, std::size_t N>
+void CubicSpline<T, N>::evaluate( std::span<const T> t, std::span<Vector<T, N>> results ) const noexcept
+{
+    assert( results.size() == t.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        assert( coefficients.size() < std::size_t( std::numeric_limits<int32_t>::max() ) );
+
+        alignas( 32 ) float r[N][8];
+
+        for ( ; !empty() && i + Simd::WIDTH <= t.size(); i += Simd::WIDTH )
+        {
+            __m256        u;
+            const __m256i segment = detail::findSegment8( _mm256_loadu_ps( t.data() + i ), getSegmentCount(), u );
+            const __m256i base    = _mm256_mullo_epi32( segment, _mm256_set1_epi32( static_cast<int32_t>( STRIDE ) ) );
+
+            for ( std::size_t k = 0; k < N; ++k )
+            {
+                const float* c = coefficients.data() + k;
+
+                __m256 v = _mm256_i32gather_ps( c + 3 * N, base, 4 );
+                v        = _mm256_add_ps( _mm256_mul_ps( v, u ), _mm256_i32gather_ps( c + 2 * N, base, 4 ) );
+                v        = _mm256_add_ps( _mm256_mul_ps( v, u ), _mm256_i32gather_ps( c + N, base, 4 ) );
+                v        = _mm256_add_ps( _mm256_mul_ps( v, u ), _mm256_i32gather_ps( c, base, 4 ) );
+                _mm256_store_ps( r[k], v );
+            }
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                for ( std::size_t k = 0; k < N; ++k )
+                    results[i + j][k] = r[k][j];
+            }
+        }
+    }
+#endif
+
+    for ( ; i < t.size(); ++i )
+        results[i] = evaluate( t[i] );
+}
+
+template<typename T, std::size_t N>
+void CubicSpline<T, N>::derivative( std::span<const T> t, std::span<Vector<T, N>> results ) const noexcept
+{
+    assert( results.size() == t.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        assert( coefficients.size() < std::size_t( std::numeric_limits<int32_t>::max() ) );
+
+        alignas( 32 ) float r[N][8];
+
+        const __m256 two   = _mm256_set1_ps( 2.0f );
+        const __m256 three = _mm256_set1_ps( 3.0f );
+
+        for ( ; !empty() && i + Simd::WIDTH <= t.size(); i += Simd::WIDTH )
+        {
+            __m256        u;
+            const __m256i segment = detail::findSegment8( _mm256_loadu_ps( t.data() + i ), getSegmentCount(), u );
+            const __m256i base    = _mm256_mullo_epi32( segment, _mm256_set1_epi32( static_cast<int32_t>( STRIDE ) ) );
+
+            for ( std::size_t k = 0; k < N; ++k )
+            {
+                const float* c = coefficients.data() + k;
+
+                __m256 v = _mm256_mul_ps( three, _mm256_i32gather_ps( c + 3 * N, base, 4 ) );
+                v        = _mm256_add_ps( _mm256_mul_ps( v, u ), _mm256_mul_ps( two, _mm256_i32gather_ps( c + 2 * N, base, 4 ) ) );
+                v        = _mm256_add_ps( _mm256_mul_ps( v, u ), _mm256_i32gather_ps( c + N, base, 4 ) );
+                _mm256_store_ps( r[k], v );
+            }
+
+            for ( std::size_t j = 0; j < Simd::WIDTH; ++j )
+            {
+                for ( std::size_t k = 0; k < N; ++k )
+                    results[i + j][k] = r[k][j];
+            }
+        }
+    }
+#endif
+
+    for ( ; i < t.size(); ++i )
+        results[i] = derivative( t[i] );
+}
+
+template<typename T, std::size_t N>
+T CubicSpline<T, N>::boundsDistanceSqr( std::size_t segment, const Vector<T, N>& p ) const noexcept
+{
+    const T* b = bounds.data() + segment * 2 * N;
+
+    T d = T( 0 );
+    for ( std::size_t k = 0; k < N; ++k )
+    {
+        const T e = std::max( { b[k] - p[k], p[k] - b[N + k], T( 0 ) } );
+        d += e * e;
+    }
+
+    return d;
+}
+
+template<typename T, std::size_t N>
+T CubicSpline<T, N>::closestParameter( std::size_t segment, const Vector<T, N>& p, T& distanceSqr ) const noexcept
+{
+    constexpr int SAMPLES    = 8;
+    constexpr int ITERATIONS = 8;
+
+    const Vector<T, N> c0 = getCoefficient( segment, 0 ) - p;
+    const Vector<T, N> c1 = getCoefficient( segment, 1 );
+    const Vector<T, N> c2 = getCoefficient( segment, 2 );
+    const Vector<T, N> c3 = getCoefficient( segment, 3 );
+
+    // Start at the closest of a few samples.
+    T best  = T( 0 );
+    T bestD = std::numeric_limits<T>::max();
+    for ( int s = 0; s <= SAMPLES; ++s )
+    {
+        const T u = static_cast<T>( s ) / T( SAMPLES );
+        const T d = lengthSqr( ( ( c3 * u + c2 ) * u + c1 ) * u + c0 );
+        if ( d < bestD )
+        {
+            best  = u;
+            bestD = d;
+        }
+    }
+
+    // Refine with Newton's method.
+    T u = best;
+    for ( int n = 0; n < ITERATIONS; ++n )
+    {
+        const Vector<T, N> d   = ( ( c3 * u + c2 ) * u + c1 ) * u + c0;
+        const Vector<T, N> d1  = ( c3 * ( u * T( 3 ) ) + c2 * T( 2 ) ) * u + c1;
+        const Vector<T, N> d2  = c3 * ( u * T( 6 ) ) + c2 * T( 2 );
+        const T            f   = dot( d, d1 );
+        const T            df  = dot( d1, d1 ) + dot( d, d2 );
+        if ( df <= T( 0 ) )
+            break;
+
+        const T next = std::clamp( u - f / df, T( 0 ), T( 1 ) );
+        if ( std::abs( next - u ) < EPSILON<T> )
+            break;
+
+        u = next;
+    }
+
+    const T d = lengthSqr( ( ( c3 * u + c2 ) * u + c1 ) * u + c0 );
+    if ( d < bestD )
+    {
+        best  = u;
+        bestD = d;
+    }
+
+    distanceSqr = bestD;
+    return best;
+}
+
+template<typename T, std::size_t N>
+T CubicSpline<T, N>::closestParameter( const Vector<T, N>& p ) const noexcept
+{
+    const std::size_t n = getSegmentCount();
+    if ( n == 0 )
+        return T( 0 );
+
+    // Start with the segment whose bounds are closest.
+    std::size_t first = 0;
+    T           minD  = std::numeric_limits<T>::max();
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        const T d = boundsDistanceSqr( i, p );
+        if ( d < minD )
+        {
+            first = i;
+            minD  = d;
+        }
+    }
+
+    T       bestD;
+    const T u    = closestParameter( first, p, bestD );
+    T       best = static_cast<T>( first ) + u;
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        if ( i == first || boundsDistanceSqr( i, p ) >= bestD )
+            continue;
+
+        T       d;
+        const T v = closestParameter( i, p, d );
+        if ( d < bestD )
+        {
+            best  = static_cast<T>( i ) + v;
+            bestD = d;
+        }
+    }
+
+    return best;
+}
+
+template<typename T, std::size_t N>
+CatmullRomSpline<T, N>::CatmullRomSpline( std::span<const Vector<T, N>> points, T alpha )
+{
+    assert( points.size() >= 2 );
+
+    const std::size_t n = points.size();
+    for ( std::size_t i = 0; i + 1 < n; ++i )
+    {
+        const Vector<T, N>& p1 = points[i];
+        const Vector<T, N>& p2 = points[i + 1];
+        const Vector<T, N>  p0 = i > 0 ? points[i - 1] : p1 * T( 2 ) - p2;
+        const Vector<T, N>  p3 = i + 2 < n ? points[i + 2] : p2 * T( 2 ) - p1;
+
+        // The knot intervals (|p_i+1 - p_i|^alpha). Coincident points use a unit interval.
+        const auto interval = [alpha]( const Vector<T, N>& a, const Vector<T, N>& b ) {
+            const T d = std::pow( lengthSqr( b - a ), alpha * T( 0.5 ) );
+            return d > EPSILON<T> ? d : T( 1 );
+        };
+
+        const T dt0 = interval( p0, p1 );
+        const T dt1 = interval( p1, p2 );
+        const T dt2 = interval( p2, p3 );
+
+        // The tangents of the non-uniform Catmull-Rom spline, scaled to the segment [0..1].
+        const Vector<T, N> m1 = ( ( p1 - p0 ) / dt0 - ( p2 - p0 ) / ( dt0 + dt1 ) + ( p2 - p1 ) / dt1 ) * dt1;
+        const Vector<T, N> m2 = ( ( p2 - p1 ) / dt1 - ( p3 - p1 ) / ( dt1 + dt2 ) + ( p3 - p2 ) / dt2 ) * dt1;
+
+        this->addSegment( p1, m1, ( p2 - p1 ) * T( 3 ) - m1 * T( 2 ) - m2, ( p1 - p2 ) * T( 2 ) + m1 + m2 );
+    }
+}
+
+template<typename T, std::size_t N>
+BezierSpline<T, N>::BezierSpline( std::span<const Vector<T, N>> controlPoints )
+{
+    assert( controlPoints.size() % 3 == 1 );
+
+    for ( std::size_t i = 0; i + 3 < controlPoints.size(); i += 3 )
+    {
+        const Vector<T, N>& p0 = controlPoints[i];
+        const Vector<T, N>& p1 = controlPoints[i + 1];
+        const Vector<T, N>& p2 = controlPoints[i + 2];
+        const Vector<T, N>& p3 = controlPoints[i + 3];
+
+        this->addSegment( p0, ( p1 - p0 ) * T( 3 ), ( p0 - p1 * T( 2 ) + p2 ) * T( 3 ), p3 - p0 + ( p1 - p2 ) * T( 3 ) );
+    }
+}
+
+template<typename T, std::size_t N>
+HermiteSpline<T, N>::HermiteSpline( std::span<const Vector<T, N>> points, std::span<const Vector<T, N>> tangents )
+{
+    assert( points.size() == tangents.size() );
+
+    for ( std::size_t i = 0; i + 1 < points.size(); ++i )
+    {
+        const Vector<T, N>& p0 = points[i];
+        const Vector<T, N>& p1 = points[i + 1];
+        const Vector<T, N>& m0 = tangents[i];
+        const Vector<T, N>& m1 = tangents[i + 1];
+
+        this->addSegment( p0, m0, ( p1 - p0 ) * T( 3 ) - m0 * T( 2 ) - m1, ( p0 - p1 ) * T( 2 ) + m0 + m1 );
+    }
+}
+
+template<typename T, std::size_t N>
+BSpline<T, N>::BSpline( std::span<const Vector<T, N>> controlPoints )
+{
+    assert( controlPoints.size() >= 4 );
+
+    for ( std::size_t i = 0; i + 3 < controlPoints.size(); ++i )
+    {
+        const Vector<T, N>& p0 = controlPoints[i];
+        const Vector<T, N>& p1 = controlPoints[i + 1];
+        const Vector<T, N>& p2 = controlPoints[i + 2];
+        const Vector<T, N>& p3 = controlPoints[i + 3];
+
+        this->addSegment( ( p0 + p1 * T( 4 ) + p2 ) / T( 6 ), ( p2 - p0 ) / T( 2 ), ( p0 - p1 * T( 2 ) + p2 ) / T( 2 ),
+                          ( p3 - p0 + ( p1 - p2 ) * T( 3 ) ) / T( 6 ) );
+    }
+}
+
+template<typename T>
+template<std::size_t N>
+ArcLengthTable<T>::ArcLengthTable( const CubicSpline<T, N>& spline, std::size_t _samplesPerSegment )
+: samplesPerSegment( _samplesPerSegment )
+{
+    assert( samplesPerSegment > 0 );
+
+    // 5 point Gauss-Legendre quadrature on [0..1].
+    constexpr T nodes[5]   = { T( 0.04691007703066800 ), T( 0.23076534494715845 ), T( 0.5 ), T( 0.76923465505284155 ), T( 0.95308992296933200 ) };
+    constexpr T weights[5] = { T( 0.11846344252809454 ), T( 0.23931433524968324 ), T( 0.28444444444444444 ), T( 0.23931433524968324 ), T( 0.11846344252809454 ) };
+
+    const std::size_t count = spline.getSegmentCount() * samplesPerSegment;
+    const T           h     = T( 1 ) / static_cast<T>( samplesPerSegment );
+
+    distances.resize( count + 1 );
+    distances[0] = T( 0 );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const T t0 = static_cast<T>( i ) * h;
+
+        T d = T( 0 );
+        for ( std::size_t k = 0; k < 5; ++k )
+            d += weights[k] * FastMath::length( spline.derivative( t0 + nodes[k] * h ) );
+
+        distances[i + 1] = distances[i] + d * h;
+    }
+
+    length = distances.back();
+
+    // Invert the table (the distances are monotonic).
+    parameters.resize( count + 1 );
+    std::size_t j = 0;
+    for ( std::size_t i = 0; i <= count; ++i )
+    {
+        const T s = count > 0 ? length * static_cast<T>( i ) / static_cast<T>( count ) : T( 0 );
+        while ( j + 1 < count && distances[j + 1] < s )
+            ++j;
+
+        const T d = j < count ? distances[j + 1] - distances[j] : T( 0 );
+        const T u = d > T( 0 ) ? std::clamp( ( s - distances[j] ) / d, T( 0 ), T( 1 ) ) : T( 0 );
+
+        parameters[i] = ( static_cast<T>( j ) + u ) * h;
+    }
+}
+
+template<typename T>
+T ArcLengthTable<T>::lookup( const std::vector<T>& table, T x ) noexcept
+{
+    const std::size_t last = table.size() - 1;
+    const T           y    = std::clamp( x, T( 0 ), static_cast<T>( last ) );
+    const std::size_t i    = std::min( static_cast<std::size_t>( y ), last > 0 ? last - 1 : 0 );
+    const T           u    = y - static_cast<T>( i );
+
+    return last > 0 ? table[i] + ( table[i + 1] - table[i] ) * u : table[0];
+}
+
+template<typename T>
+T ArcLengthTable<T>::getLength() const noexcept
+{
+    return length;
+}
+
+template<typename T>
+T ArcLengthTable<T>::getDistance( T t ) const noexcept
+{
+    if ( distances.empty() )
+        return T( 0 );
+
+    return lookup( distances, t * static_cast<T>( samplesPerSegment ) );
+}
+
+template<typename T>
+T ArcLengthTable<T>::getParameter( T s ) const noexcept
+{
+    if ( parameters.size() < 2 || length <= T( 0 ) )
+        return T( 0 );
+
+    const T x = std::clamp( s, T( 0 ), length );
+
+    // The parameter table gives an initial guess, which is refined with a Newton step on the
+    // (piecewise linear) distance table.
+    const std::size_t last = distances.size() - 1;
+    const T           y    = lookup( parameters, x / length * static_cast<T>( last ) ) * static_cast<T>( samplesPerSegment );
+    const std::size_t i    = std::min( static_cast<std::size_t>( y ), last - 1 );
+    const T           d    = distances[i + 1] - distances[i];
+    const T           e    = x - ( distances[i] + d * ( y - static_cast<T>( i ) ) );
+    const T           z    = d > T( 0 ) ? std::clamp( y + e / d, T( 0 ), static_cast<T>( last ) ) : y;
+
+    return z / static_cast<T>( samplesPerSegment );
+}
+
+template<typename T>
+void ArcLengthTable<T>::getParameter( std::span<const T> s, std::span<T> results ) const noexcept
+{
+    assert( results.size() == s.size() );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        if ( parameters.size() > 1 && length > 0.0f )
+        {
+            const int32_t last     = static_cast<int32_t>( parameters.size() - 1 );
+            const __m256  length8  = _mm256_set1_ps( length );
+            const __m256  scale    = _mm256_set1_ps( static_cast<float>( last ) / length );
+            const __m256  samples  = _mm256_set1_ps( static_cast<float>( samplesPerSegment ) );
+            const __m256  max      = _mm256_set1_ps( static_cast<float>( last ) );
+            const __m256i maxIndex = _mm256_set1_epi32( last - 1 );
+
+            for ( ; i + Simd::WIDTH <= s.size(); i += Simd::WIDTH )
+            {
+                const __m256 x = _mm256_min_ps( _mm256_max_ps( _mm256_loadu_ps( s.data() + i ), _mm256_setzero_ps() ), length8 );
+
+                // Look up the initial guess.
+                const __m256  a  = _mm256_mul_ps( x, scale );
+                const __m256i j  = _mm256_min_epi32( _mm256_cvttps_epi32( a ), maxIndex );
+                const __m256  p0 = _mm256_i32gather_ps( parameters.data(), j, 4 );
+                const __m256  p1 = _mm256_i32gather_ps( parameters.data() + 1, j, 4 );
+                const __m256  y  = _mm256_mul_ps( _mm256_add_ps( p0, _mm256_mul_ps( _mm256_sub_ps( p1, p0 ), _mm256_sub_ps( a, _mm256_cvtepi32_ps( j ) ) ) ), samples );
+
+                // Newton step on the distance table.
+                const __m256i k  = _mm256_min_epi32( _mm256_cvttps_epi32( y ), maxIndex );
+                const __m256  d0 = _mm256_i32gather_ps( distances.data(), k, 4 );
+                const __m256  d  = _mm256_sub_ps( _mm256_i32gather_ps( distances.data() + 1, k, 4 ), d0 );
+                const __m256  e  = _mm256_sub_ps( x, _mm256_add_ps( d0, _mm256_mul_ps( d, _mm256_sub_ps( y, _mm256_cvtepi32_ps( k ) ) ) ) );
+                const __m256  ok = _mm256_cmp_ps( d, _mm256_setzero_ps(), _CMP_GT_OQ );
+                __m256        z  = _mm256_add_ps( y, _mm256_and_ps( _mm256_div_ps( e, d ), ok ) );
+                z                = _mm256_min_ps( _mm256_max_ps( z, _mm256_setzero_ps() ), max );
+
+                _mm256_storeu_ps( results.data() + i, _mm256_div_ps( z, samples ) );
+            }
+        }
+    }
+#endif
+
+    for ( ; i < s.size(); ++i )
+        results[i] = getParameter( s[i] );
+}
+
+}  // namespace FastMath
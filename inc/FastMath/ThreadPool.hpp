@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A fixed-size pool of worker threads used by the parallel algorithms in the library
+/// (BVH construction, mesh processing, skinning, etc.).
+/// </summary>
+/// <remarks>
+/// Work is submitted with `parallelFor`. The calling thread also executes chunks of
+/// the range so nested calls (from a task that is already running on a worker thread)
+/// cannot deadlock, and a pool without any worker threads simply runs everything on the
+/// calling thread.
+/// The way a range is split into chunks only depends on the size of the range and the
+/// grain size, never on the number of threads, so algorithms that combine per-chunk results
+/// in chunk order produce the same results regardless of the number of threads.
+/// </remarks>
+struct ThreadPool
+{
+    /// <summary>
+    /// Create a thread pool.
+    /// </summary>
+    /// <param name="numThreads">The number of worker threads. Since the calling thread also executes work, the default is one less than the number of hardware threads.</param>
+    explicit ThreadPool( std::size_t numThreads = std::max( 1u, std::thread::hardware_concurrency() ) - 1 );
+
+    ThreadPool( const ThreadPool& )            = delete;
+    ThreadPool& operator=( const ThreadPool& ) = delete;
+
+    ~ThreadPool();
+
+    /// <summary>
+    /// Get the thread pool that is shared by all of the parallel algorithms in the library.
+    /// </summary>
+    /// <returns>The default thread pool.</returns>
+    static ThreadPool& getDefault();
+
+    /// <summary>
+    /// Get the number of threads that can execute work concurrently (the worker threads and the calling thread).
+    /// </summary>
+    /// <returns>The concurrency of the pool.</returns>
+    std::size_t getConcurrency() const noexcept;
+
+    /// <summary>
+    /// Invoke `f( chunkBegin, chunkEnd )` for consecutive chunks of the range \f([begin \ldots end)\f) and
+    /// wait for all of the chunks to complete.
+    /// </summary>
+    /// <typeparam name="F">The function type.</typeparam>
+    /// <param name="begin">The start of the range.</param>
+    /// <param name="end">The end of the range (exclusive).</param>
+    /// <param name="grainSize">The maximum number of elements in a chunk.</param>
+    /// <param name="f">The function to invoke for each chunk.</param>
+    template<typename F>
+    void parallelFor( std::size_t begin, std::size_t end, std::size_t grainSize, F&& f );
+
+private:
+    void workerThread();
+    void enqueue( std::function<void()> task );
+
+    std::vector<std::thread>          threads;
+    std::deque<std::function<void()>> tasks;
+    std::mutex                        mutex;
+    std::condition_variable           condition;
+    bool                              stop = false;
+};
+
+inline ThreadPool::ThreadPool( std::size_t numThreads )
+{
+    threads.reserve( numThreads );
+    for ( std::size_t i = 0; i < numThreads; ++i )
+        threads.emplace_back( &ThreadPool::workerThread, this );
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock( mutex );
+        stop = true;
+    }
+    condition.notify_all();
+
+    for ( auto& thread: threads )
+        thread.join();
+}
+
+inline ThreadPool& ThreadPool::getDefault()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+inline std::size_t ThreadPool::getConcurrency() const noexcept
+{
+    return threads.size() + 1;
+}
+
+inline void ThreadPool::workerThread()
+{
+    while ( true )
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock( mutex );
+            condition.wait( lock, [this] { return stop || !tasks.empty(); } );
+
+            if ( stop && tasks.empty() )
+                return;
+
+            task = std::move( tasks.front() );
+            tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+inline void ThreadPool::enqueue( std::function<void()> task )
+{
+    {
+        std::lock_guard lock( mutex );
+        tasks.push_back( std::move( task ) );
+    }
+    condition.notify_one();
+}
+
+template<typename F>
+void ThreadPool::parallelFor( std::size_t begin, std::size_t end, std::size_t grainSize, F&& f )
+{
+    if ( begin >= end )
+        return;
+
+    grainSize                   = std::max<std::size_t>( grainSize, 1 );
+    const std::size_t numChunks = ( end - begin + grainSize - 1 ) / grainSize;
+
+    if ( numChunks == 1 || threads.empty() )
+    {
+        for ( std::size_t i = begin; i < end; i += grainSize )
+            f( i, std::min( i + grainSize, end ) );
+
+        return;
+    }
+
+    // Shared with the helper tasks, which may only start running after this call has returned.
+    struct State
+    {
+        std::atomic<std::size_t> next { 0 };
+        std::atomic<std::size_t> done { 0 };
+        std::mutex               mutex;
+        std::condition_variable  condition;
+    };
+
+    auto state = std::make_shared<State>();
+
+    // Only touches `f` after successfully claiming a chunk, and all chunks are claimed
+    // before this function returns.
+    auto run = [state, numChunks, begin, end, grainSize, &f] {
+        std::size_t chunk;
+        while ( ( chunk = state->next.fetch_add( 1 ) ) < numChunks )
+        {
+            const std::size_t b = begin + chunk * grainSize;
+            f( b, std::min( b + grainSize, end ) );
+
+            if ( state->done.fetch_add( 1 ) + 1 == numChunks )
+            {
+                std::lock_guard lock( state->mutex );
+                state->condition.notify_all();
+            }
+        }
+    };
+
+    const std::size_t numHelpers = std::min( threads.size(), numChunks - 1 );
+    for ( std::size_t i = 0; i < numHelpers; ++i )
+        enqueue( run );
+
+    run();
+
+    std::unique_lock lock( state->mutex );
+    state->condition.wait( lock, [&] { return state->done.load() == numChunks; } );
+}
+
+}  // namespace FastMath
@@ -0,0 +1,395 @@
+#pragma once
+
+#include "ClipSpace.hpp"
+#include "Matrix.hpp"
+#include "Simd.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace FastMath
+{
+
+/// <summary>
+/// A viewport that maps normalized device coordinates to window (pixel) coordinates.
+/// </summary>
+/// <remarks>
+/// The origin of the window is the top-left corner of the viewport, and the y-axis points down
+/// (as in DirectX, Vulkan, and Metal). Use a negative height (and set `y` to the bottom of the viewport)
+/// for a window with the origin in the bottom-left corner (as in OpenGL).
+/// The depth range of the clip space is mapped to \f([minDepth \ldots maxDepth]\f).
+/// </remarks>
+/// <typeparam name="T">The component type.</typeparam>
+template<typename T>
+struct Viewport
+{
+    /// <summary>
+    /// The Viewport value type.
+    /// </summary>
+    using value_type = T;
+
+    /// <summary>
+    /// Construct a viewport.
+    /// </summary>
+    /// <param name="x">The left edge of the viewport (in pixels).</param>
+    /// <param name="y">The top edge of the viewport (in pixels).</param>
+    /// <param name="width">The width of the viewport (in pixels).</param>
+    /// <param name="height">The height of the viewport (in pixels).</param>
+    /// <param name="minDepth">(optional) The window depth of the near clipping plane.</param>
+    /// <param name="maxDepth">(optional) The window depth of the far clipping plane.</param>
+    constexpr Viewport( T x, T y, T width, T height, T minDepth = T( 0 ), T maxDepth = T( 1 ) ) noexcept;
+
+    T x;
+    T y;
+    T width;
+    T height;
+    T minDepth;
+    T maxDepth;
+};
+
+using ViewportF = Viewport<float>;
+using ViewportD = Viewport<double>;
+
+template<typename T>
+constexpr Viewport<T>::Viewport( T x, T y, T width, T height, T minDepth, T maxDepth ) noexcept
+: x { x }
+, y { y }
+, width { width }
+, height { height }
+, minDepth { minDepth }
+, maxDepth { maxDepth }
+{}
+
+/// <summary>
+/// The clip flags of a projected point (see `project`).
+/// </summary>
+/// <remarks>
+/// A point is inside the view frustum if none of the flags are set. A point with `CLIP_BEHIND` is behind
+/// the camera (\f( w_{clip} \le 0 \f)) and its window coordinates are meaningless.
+/// </remarks>
+enum ClipFlag : uint8_t
+{
+    CLIP_LEFT   = 1u << 0u,
+    CLIP_RIGHT  = 1u << 1u,
+    CLIP_BOTTOM = 1u << 2u,
+    CLIP_TOP    = 1u << 3u,
+    CLIP_NEAR   = 1u << 4u,
+    CLIP_FAR    = 1u << 5u,
+    CLIP_BEHIND = 1u << 6u,
+};
+
+namespace detail
+{
+
+// The maximum number of points per chunk when projecting in parallel.
+inline constexpr std::size_t PROJECT_GRAIN_SIZE = 16384;
+
+// The window depth is ndc.z * scale + bias.
+template<ClipSpacePolicy P, typename T>
+constexpr Vector<T, 2> depthTransform( const Viewport<T>& viewport ) noexcept
+{
+    const T range = viewport.maxDepth - viewport.minDepth;
+
+    if constexpr ( P::depthRange == DepthRange::NegativeOneToOne )
+        return { range * T( 0.5 ), viewport.minDepth + range * T( 0.5 ) };
+    else
+        return { range, viewport.minDepth };
+}
+
+template<ClipSpacePolicy P, typename T>
+constexpr uint8_t clipFlags( const Vector<T, 4>& c ) noexcept
+{
+    uint32_t flags = 0;
+
+    flags |= c.x < -c.w ? uint32_t( CLIP_LEFT ) : 0u;
+    flags |= c.x > c.w ? uint32_t( CLIP_RIGHT ) : 0u;
+    flags |= c.y < -c.w ? uint32_t( CLIP_BOTTOM ) : 0u;
+    flags |= c.y > c.w ? uint32_t( CLIP_TOP ) : 0u;
+
+    if constexpr ( P::depthRange == DepthRange::ZeroToOne )
+    {
+        flags |= c.z < T( 0 ) ? uint32_t( CLIP_NEAR ) : 0u;
+        flags |= c.z > c.w ? uint32_t( CLIP_FAR ) : 0u;
+    }
+    else if constexpr ( P::depthRange == DepthRange::NegativeOneToOne )
+    {
+        flags |= c.z < -c.w ? uint32_t( CLIP_NEAR ) : 0u;
+        flags |= c.z > c.w ? uint32_t( CLIP_FAR ) : 0u;
+    }
+    else
+    {
+        flags |= c.z > c.w ? uint32_t( CLIP_NEAR ) : 0u;
+        flags |= c.z < T( 0 ) ? uint32_t( CLIP_FAR ) : 0u;
+    }
+
+    flags |= c.w <= T( 0 ) ? uint32_t( CLIP_BEHIND ) : 0u;
+
+    return static_cast<uint8_t>( flags );
+}
+
+template<typename T>
+constexpr Vector<T, 4> transformPoint( const Matrix<T, 4>& m, const Vector<T, 3>& p ) noexcept
+{
+    return m * Vector<T, 4> { p.x, p.y, p.z, T( 1 ) };
+}
+
+template<ClipSpacePolicy P, typename T>
+constexpr Vector<T, 3> clipToWindow( const Vector<T, 4>& c, const Viewport<T>& viewport ) noexcept
+{
+    const Vector<T, 2> depth = depthTransform<P>( viewport );
+    const T            hw    = viewport.width * T( 0.5 );
+    const T            hh    = viewport.height * T( 0.5 );
+    const T            invW  = T( 1 ) / c.w;
+
+    return { viewport.x + hw + c.x * invW * hw, viewport.y + hh - c.y * invW * hh, depth.y + c.z * invW * depth.x };
+}
+
+}  // namespace detail
+
+/// <summary>
+/// Project a point to window coordinates.
+/// </summary>
+/// <remarks>
+/// The point is transformed to clip space by the view-projection matrix, divided by \f( w_{clip} \f)
+/// to get normalized device coordinates, and mapped to the viewport.
+/// </remarks>
+/// <typeparam name="P">(optional) The clip space policy of the projection matrix.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="p">The point (in world space).</param>
+/// <param name="viewProjection">The view-projection matrix.</param>
+/// <param name="viewport">The viewport.</param>
+/// <returns>The window coordinates and depth of the point.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Vector<T, 3> project( const Vector<T, 3>& p, const Matrix<T, 4>& viewProjection, const Viewport<T>& viewport ) noexcept
+{
+    return detail::clipToWindow<P>( detail::transformPoint( viewProjection, p ), viewport );
+}
+
+/// <summary>
+/// Unproject window coordinates (for example, a depth buffer sample) back to world space.
+/// </summary>
+/// <seealso cref="viewProjectionInverse"/>
+/// <typeparam name="P">(optional) The clip space policy of the projection matrix.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="window">The window coordinates and depth.</param>
+/// <param name="inverseViewProjection">The inverse of the view-projection matrix.</param>
+/// <param name="viewport">The viewport.</param>
+/// <returns>The point in world space.</returns>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+constexpr Vector<T, 3> unproject( const Vector<T, 3>& window, const Matrix<T, 4>& inverseViewProjection, const Viewport<T>& viewport ) noexcept
+{
+    const Vector<T, 2> depth = detail::depthTransform<P>( viewport );
+    const T            hw    = viewport.width * T( 0.5 );
+    const T            hh    = viewport.height * T( 0.5 );
+
+    const Vector<T, 3> ndc { ( window.x - viewport.x - hw ) / hw, ( viewport.y + hh - window.y ) / hh, ( window.z - depth.y ) / depth.x };
+    const Vector<T, 4> c = detail::transformPoint( inverseViewProjection, ndc );
+
+    return Vector<T, 3> { c.x, c.y, c.z } / c.w;
+}
+
+namespace detail
+{
+
+template<ClipSpacePolicy P, typename T>
+void projectRange( std::span<const Vector<T, 3>> points, const Matrix<T, 4>& m, const Viewport<T>& viewport, std::span<Vector<T, 3>> window,
+                   std::span<uint8_t> flags, std::size_t begin, std::size_t end ) noexcept
+{
+    std::size_t i = begin;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        static_assert( sizeof( Vector<float, 3> ) == 3 * sizeof( float ) );
+
+        __m256 rows[4][4];
+        for ( int r = 0; r < 4; ++r )
+            for ( int c = 0; c < 4; ++c )
+                rows[r][c] = _mm256_set1_ps( m[r][c] );
+
+        const Vector2f depth = depthTransform<P>( viewport );
+        const __m256   sx    = _mm256_set1_ps( viewport.width * 0.5f );
+        const __m256   bx    = _mm256_set1_ps( viewport.x + viewport.width * 0.5f );
+        const __m256   sy    = _mm256_set1_ps( viewport.height * -0.5f );
+        const __m256   by    = _mm256_set1_ps( viewport.y + viewport.height * 0.5f );
+        const __m256   sz    = _mm256_set1_ps( depth.x );
+        const __m256   bz    = _mm256_set1_ps( depth.y );
+        const __m256   zero  = _mm256_setzero_ps();
+
+        // The flag of each lane where the comparison is true.
+        const auto flag = []( __m256 cmp, uint32_t bit ) {
+            return _mm256_and_si256( _mm256_castps_si256( cmp ), _mm256_set1_epi32( static_cast<int>( bit ) ) );
+        };
+
+        for ( ; i + Simd::WIDTH <= end; i += Simd::WIDTH )
+        {
+            __m256 x, y, z;
+            Simd::loadVector3x8( &points[i].x, x, y, z );
+
+            __m256 c[4];
+            for ( int r = 0; r < 4; ++r )
+                c[r] = Simd::fmadd( rows[r][0], x, Simd::fmadd( rows[r][1], y, Simd::fmadd( rows[r][2], z, rows[r][3] ) ) );
+
+            // Perspective divide.
+            const __m256 invW = Simd::rcp( c[3] );
+
+            Simd::storeVector3x8( &window[i].x,
+                                  Simd::fmadd( _mm256_mul_ps( c[0], invW ), sx, bx ),
+                                  Simd::fmadd( _mm256_mul_ps( c[1], invW ), sy, by ),
+                                  Simd::fmadd( _mm256_mul_ps( c[2], invW ), sz, bz ) );
+
+            if ( flags.empty() )
+                continue;
+
+            const __m256 w  = c[3];
+            const __m256 nw = _mm256_sub_ps( zero, w );
+
+            __m256i f = flag( _mm256_cmp_ps( c[0], nw, _CMP_LT_OQ ), CLIP_LEFT );
+            f         = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[0], w, _CMP_GT_OQ ), CLIP_RIGHT ) );
+            f         = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[1], nw, _CMP_LT_OQ ), CLIP_BOTTOM ) );
+            f         = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[1], w, _CMP_GT_OQ ), CLIP_TOP ) );
+
+            if constexpr ( P::depthRange == DepthRange::ZeroToOne )
+            {
+                f = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[2], zero, _CMP_LT_OQ ), CLIP_NEAR ) );
+                f = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[2], w, _CMP_GT_OQ ), CLIP_FAR ) );
+            }
+            else if constexpr ( P::depthRange == DepthRange::NegativeOneToOne )
+            {
+                f = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[2], nw, _CMP_LT_OQ ), CLIP_NEAR ) );
+                f = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[2], w, _CMP_GT_OQ ), CLIP_FAR ) );
+            }
+            else
+            {
+                f = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[2], w, _CMP_GT_OQ ), CLIP_NEAR ) );
+                f = _mm256_or_si256( f, flag( _mm256_cmp_ps( c[2], zero, _CMP_LT_OQ ), CLIP_FAR ) );
+            }
+
+            f = _mm256_or_si256( f, flag( _mm256_cmp_ps( w, zero, _CMP_LE_OQ ), CLIP_BEHIND ) );
+
+            // Narrow the 32-bit flags to bytes.
+            const __m128i f16 = _mm_packus_epi32( _mm256_castsi256_si128( f ), _mm256_extracti128_si256( f, 1 ) );
+            _mm_storel_epi64( reinterpret_cast<__m128i*>( flags.data() + i ), _mm_packus_epi16( f16, f16 ) );
+        }
+    }
+#endif
+
+    for ( ; i < end; ++i )
+    {
+        const Vector<T, 4> c = transformPoint( m, points[i] );
+
+        window[i] = clipToWindow<P>( c, viewport );
+        if ( !flags.empty() )
+            flags[i] = clipFlags<P>( c );
+    }
+}
+
+template<ClipSpacePolicy P, typename T>
+void unprojectRange( std::span<const Vector<T, 3>> window, const Matrix<T, 4>& m, const Viewport<T>& viewport, std::span<Vector<T, 3>> points,
+                     std::size_t begin, std::size_t end ) noexcept
+{
+    std::size_t i = begin;
+
+#if defined( LS_AVX2 )
+    if constexpr ( std::is_same_v<T, float> )
+    {
+        __m256 rows[4][4];
+        for ( int r = 0; r < 4; ++r )
+            for ( int c = 0; c < 4; ++c )
+                rows[r][c] = _mm256_set1_ps( m[r][c] );
+
+        // The inverse of the viewport transformation.
+        const Vector2f depth = depthTransform<P>( viewport );
+        const float    hw    = viewport.width * 0.5f;
+        const float    hh    = viewport.height * 0.5f;
+        const __m256   sx    = _mm256_set1_ps( 1.0f / hw );
+        const __m256   bx    = _mm256_set1_ps( -( viewport.x + hw ) / hw );
+        const __m256   sy    = _mm256_set1_ps( -1.0f / hh );
+        const __m256   by    = _mm256_set1_ps( ( viewport.y + hh ) / hh );
+        const __m256   sz    = _mm256_set1_ps( 1.0f / depth.x );
+        const __m256   bz    = _mm256_set1_ps( -depth.y / depth.x );
+
+        for ( ; i + Simd::WIDTH <= end; i += Simd::WIDTH )
+        {
+            __m256 x, y, z;
+            Simd::loadVector3x8( &window[i].x, x, y, z );
+
+            x = Simd::fmadd( x, sx, bx );
+            y = Simd::fmadd( y, sy, by );
+            z = Simd::fmadd( z, sz, bz );
+
+            __m256 c[4];
+            for ( int r = 0; r < 4; ++r )
+                c[r] = Simd::fmadd( rows[r][0], x, Simd::fmadd( rows[r][1], y, Simd::fmadd( rows[r][2], z, rows[r][3] ) ) );
+
+            const __m256 invW = Simd::rcp( c[3] );
+
+            Simd::storeVector3x8( &points[i].x, _mm256_mul_ps( c[0], invW ), _mm256_mul_ps( c[1], invW ), _mm256_mul_ps( c[2], invW ) );
+        }
+    }
+#endif
+
+    for ( ; i < end; ++i )
+        points[i] = unproject<P>( window[i], m, viewport );
+}
+
+}  // namespace detail
+
+/// <summary>
+/// Project a batch of points to window coordinates.
+/// </summary>
+/// <remarks>
+/// The points are split into chunks that are projected in parallel. For single-precision points, 8 points are
+/// projected at a time with AVX2, and the perspective divide uses the reciprocal estimate refined with a
+/// Newton-Raphson step (a relative error of about \f( 10^{-7} \f)) instead of a division.
+/// The clip flags are optional. Points that are behind the camera have the `CLIP_BEHIND` flag.
+/// </remarks>
+/// <typeparam name="P">(optional) The clip space policy of the projection matrix.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="points">The points (in world space).</param>
+/// <param name="viewProjection">The view-projection matrix.</param>
+/// <param name="viewport">The viewport.</param>
+/// <param name="window">Receives the window coordinates and depth of each point.</param>
+/// <param name="clipFlags">(optional) Receives the clip flags of each point (see `ClipFlag`).</param>
+/// <param name="pool">The thread pool to use.</param>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+void project( std::span<const Vector<std::type_identity_t<T>, 3>> points, const Matrix<T, 4>& viewProjection, const Viewport<T>& viewport,
+              std::span<Vector<std::type_identity_t<T>, 3>> window, std::span<uint8_t> clipFlags = {}, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    assert( window.size() >= points.size() );
+    assert( clipFlags.empty() || clipFlags.size() >= points.size() );
+
+    pool.parallelFor( 0, points.size(), detail::PROJECT_GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+        detail::projectRange<P, T>( points, viewProjection, viewport, window, clipFlags, begin, end );
+    } );
+}
+
+/// <summary>
+/// Unproject a batch of window coordinates (for example, depth buffer samples) back to world space.
+/// </summary>
+/// <remarks>
+/// See `project` for details.
+/// </remarks>
+/// <typeparam name="P">(optional) The clip space policy of the projection matrix.</typeparam>
+/// <typeparam name="T">The component type.</typeparam>
+/// <param name="window">The window coordinates and depth of each point.</param>
+/// <param name="inverseViewProjection">The inverse of the view-projection matrix (see `viewProjectionInverse`).</param>
+/// <param name="viewport">The viewport.</param>
+/// <param name="points">Receives the points in world space.</param>
+/// <param name="pool">The thread pool to use.</param>
+template<ClipSpacePolicy P = DefaultClipSpace, typename T>
+void unproject( std::span<const Vector<std::type_identity_t<T>, 3>> window, const Matrix<T, 4>& inverseViewProjection, const Viewport<T>& viewport,
+                std::span<Vector<std::type_identity_t<T>, 3>> points, ThreadPool& pool = ThreadPool::getDefault() )
+{
+    assert( points.size() >= window.size() );
+
+    pool.parallelFor( 0, window.size(), detail::PROJECT_GRAIN_SIZE, [&]( std::size_t begin, std::size_t end ) {
+        detail::unprojectRange<P, T>( window, inverseViewProjection, viewport, points, begin, end );
+    } );
+}
+
+}  // namespace FastMath
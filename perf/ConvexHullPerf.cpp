@@ -0,0 +1,78 @@
+#include <FastMath/ConvexHull.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+// Normally distributed points: most points are inside the hull.
+static std::vector<Vector3f> gaussianPoints( std::size_t count )
+{
+    std::mt19937                    rng( 42 );
+    std::normal_distribution<float> dist;
+
+    std::vector<Vector3f> points( count );
+    for ( auto& p: points )
+        p = { dist( rng ), dist( rng ), dist( rng ) };
+
+    return points;
+}
+
+// Points on a sphere: every point is on the hull (worst case).
+static std::vector<Vector3f> spherePoints( std::size_t count )
+{
+    std::vector<Vector3f> points = gaussianPoints( count );
+    for ( auto& p: points )
+        p = normalize( p );
+
+    return points;
+}
+
+static void ConvexHull_Gaussian( benchmark::State& state )
+{
+    const auto points = gaussianPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    QuickHull<float> builder;
+    ConvexHullf      hull;
+    for ( auto _: state )
+    {
+        builder.build( points, hull );
+        benchmark::DoNotOptimize( hull.planes.data() );
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( ConvexHull_Gaussian )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void ConvexHull_Gaussian_Max64( benchmark::State& state )
+{
+    const auto points = gaussianPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    QuickHull<float> builder;
+    ConvexHullf      hull;
+    for ( auto _: state )
+    {
+        builder.build( points, hull, 64 );
+        benchmark::DoNotOptimize( hull.planes.data() );
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( ConvexHull_Gaussian_Max64 )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void ConvexHull_Sphere( benchmark::State& state )
+{
+    const auto points = spherePoints( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    QuickHull<float> builder;
+    ConvexHullf      hull;
+    for ( auto _: state )
+    {
+        builder.build( points, hull );
+        benchmark::DoNotOptimize( hull.planes.data() );
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( ConvexHull_Sphere )->RangeMultiplier( 10 )->Range( 10'000, 100'000 )->Unit( benchmark::kMillisecond );
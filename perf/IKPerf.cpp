@@ -0,0 +1,152 @@
+#include <FastMath/InverseKinematics.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+// The items processed are chains (items_per_second / 1000 is the throughput in chains per millisecond).
+
+static std::vector<Vector3f> randomPoints( std::size_t count, float scale, unsigned seed = 42 )
+{
+    std::mt19937                          rng( seed );
+    std::uniform_real_distribution<float> dist( -scale, scale );
+
+    std::vector<Vector3f> points( count );
+    for ( auto& p: points )
+        p = { dist( rng ), dist( rng ), dist( rng ) };
+
+    return points;
+}
+
+static IKChainf makeChain( std::size_t bones )
+{
+    IKChainf chain;
+    for ( std::size_t i = 0; i < bones; ++i )
+    {
+        chain.offsets.push_back( { 0.0f, 1.0f, 0.0f } );
+        chain.rotations.push_back( QuaternionF::IDENTITY );
+    }
+
+    return chain;
+}
+
+static void IK_TwoBone( benchmark::State& state )
+{
+    const auto count   = static_cast<std::size_t>( state.range( 0 ) );
+    const auto targets = randomPoints( count, 1.5f );
+
+    QuaternionF root, mid;
+    for ( auto _: state )
+    {
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            solveTwoBone( Vector3f { 0.0f }, Vector3f { 0.0f, 1.0f, 0.0f }, Vector3f { 0.0f, 2.0f, 0.0f }, targets[i],
+                          Vector3f { 0.0f, 0.0f, 1.0f }, root, mid );
+            benchmark::DoNotOptimize( root );
+            benchmark::DoNotOptimize( mid );
+        }
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( IK_TwoBone )->RangeMultiplier( 10 )->Range( 1'000, 100'000 );
+
+static void IK_TwoBoneBatch( benchmark::State& state )
+{
+    const auto count   = static_cast<std::size_t>( state.range( 0 ) );
+    const auto targets = randomPoints( count, 1.5f );
+
+    std::vector<float> zero( count, 0.0f ), one( count, 1.0f ), two( count, 2.0f );
+    std::vector<float> tx( count ), ty( count ), tz( count );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        tx[i] = targets[i].x;
+        ty[i] = targets[i].y;
+        tz[i] = targets[i].z;
+    }
+
+    const TwoBoneSoA<float> chains { zero, zero, zero, zero, one, zero, zero, two, zero, tx, ty, tz, zero, zero, one };
+
+    std::vector<QuaternionF> root( count ), mid( count );
+    for ( auto _: state )
+    {
+        solveTwoBone<float>( chains, root, mid );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( IK_TwoBoneBatch )->RangeMultiplier( 10 )->Range( 1'000, 100'000 );
+
+static void IK_CCD( benchmark::State& state )
+{
+    const auto count   = static_cast<std::size_t>( state.range( 0 ) );
+    const auto targets = randomPoints( count, 2.5f );
+
+    IKChainf chain = makeChain( 4 );
+    for ( auto _: state )
+    {
+        for ( std::size_t i = 0; i < count; ++i )
+            benchmark::DoNotOptimize( solveCCD( chain, targets[i] ) );
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( IK_CCD )->Arg( 1'000 );
+
+static void IK_FABRIK( benchmark::State& state )
+{
+    const auto count   = static_cast<std::size_t>( state.range( 0 ) );
+    const auto targets = randomPoints( count, 2.5f );
+
+    IKChainf chain = makeChain( 4 );
+    for ( auto _: state )
+    {
+        for ( std::size_t i = 0; i < count; ++i )
+            benchmark::DoNotOptimize( solveFABRIK( chain, targets[i] ) );
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( IK_FABRIK )->Arg( 1'000 );
+
+static void IK_FABRIKBatch( benchmark::State& state )
+{
+    const auto        count   = static_cast<std::size_t>( state.range( 0 ) );
+    const auto        targets = randomPoints( count, 2.5f );
+    const std::size_t joints  = 5;
+
+    std::vector<float> x( joints * count, 0.0f ), y( joints * count ), z( joints * count, 0.0f );
+    std::vector<float> lengths( ( joints - 1 ) * count, 1.0f );
+    std::vector<float> tx( count ), ty( count ), tz( count );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        tx[i] = targets[i].x;
+        ty[i] = targets[i].y;
+        tz[i] = targets[i].z;
+    }
+
+    std::vector<float> rest( joints * count );
+    for ( std::size_t j = 0; j < joints; ++j )
+        std::fill_n( rest.begin() + j * count, count, static_cast<float>( j ) );
+
+    const IKChainSoA<float> chains { x, y, z, lengths, tx, ty, tz };
+    for ( auto _: state )
+    {
+        // Start each solve from the rest pose.
+        state.PauseTiming();
+        std::fill( x.begin(), x.end(), 0.0f );
+        std::fill( z.begin(), z.end(), 0.0f );
+        y = rest;
+        state.ResumeTiming();
+
+        solveFABRIK( chains );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( IK_FABRIKBatch )->RangeMultiplier( 10 )->Range( 1'000, 100'000 );
@@ -0,0 +1,111 @@
+#include <FastMath/KdTree.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static std::vector<Vector3f> randomPoints( std::size_t count, unsigned seed = 42 )
+{
+    std::mt19937                          rng( seed );
+    std::uniform_real_distribution<float> dist( -100.0f, 100.0f );
+
+    std::vector<Vector3f> points( count );
+    for ( auto& p: points )
+        p = { dist( rng ), dist( rng ), dist( rng ) };
+
+    return points;
+}
+
+static void KdTree_Build( benchmark::State& state )
+{
+    const auto points = randomPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    KdTreef tree;
+    for ( auto _: state )
+    {
+        tree.build( points );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( KdTree_Build )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond );
+
+static void KdTree_Nearest( benchmark::State& state )
+{
+    const auto points  = randomPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+    const auto queries = randomPoints( 1024, 7 );
+
+    KdTreef tree( points );
+
+    uint32_t    indices[8];
+    float       distances[8];
+    std::size_t q = 0;
+    for ( auto _: state )
+    {
+        benchmark::DoNotOptimize( tree.nearest( queries[q++ & 1023], indices, distances ) );
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+BENCHMARK( KdTree_Nearest )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void BruteForce_Nearest( benchmark::State& state )
+{
+    const auto points  = randomPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+    const auto queries = randomPoints( 1024, 7 );
+
+    std::size_t q = 0;
+    for ( auto _: state )
+    {
+        const Vector3f& p = queries[q++ & 1023];
+
+        // k = 8 with a sorted insertion, like the tree.
+        float    distances[8];
+        uint32_t indices[8];
+        std::fill( std::begin( distances ), std::end( distances ), std::numeric_limits<float>::max() );
+
+        for ( uint32_t i = 0; i < points.size(); ++i )
+        {
+            const float d = lengthSqr( points[i] - p );
+            if ( d < distances[7] )
+            {
+                int j = 7;
+                for ( ; j > 0 && distances[j - 1] > d; --j )
+                {
+                    distances[j] = distances[j - 1];
+                    indices[j]   = indices[j - 1];
+                }
+                distances[j] = d;
+                indices[j]   = i;
+            }
+        }
+
+        benchmark::DoNotOptimize( indices );
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+BENCHMARK( BruteForce_Nearest )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void KdTree_NearestBatch( benchmark::State& state )
+{
+    const auto points  = randomPoints( 1'000'000 );
+    const auto queries = randomPoints( static_cast<std::size_t>( state.range( 0 ) ), 7 );
+
+    KdTreef tree( points );
+
+    constexpr std::size_t k = 8;
+    std::vector<uint32_t> indices( queries.size() * k );
+    std::vector<float>    distances( queries.size() * k );
+    for ( auto _: state )
+    {
+        tree.nearest( queries, k, indices, distances );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( KdTree_NearestBatch )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 )->Unit( benchmark::kMillisecond );
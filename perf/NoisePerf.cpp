@@ -0,0 +1,158 @@
+#include <FastMath/Noise.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+template<std::size_t N>
+struct NoiseInput
+{
+    explicit NoiseInput( std::size_t count )
+    : values( count )
+    {
+        std::mt19937                          rng( 42 );
+        std::uniform_real_distribution<float> dist( -100.0f, 100.0f );
+
+        for ( std::size_t d = 0; d < N; ++d )
+        {
+            coordinates[d].resize( count );
+            for ( auto& x: coordinates[d] )
+                x = dist( rng );
+        }
+    }
+
+    std::array<std::span<const float>, N> getCoordinates() const
+    {
+        std::array<std::span<const float>, N> p;
+        for ( std::size_t d = 0; d < N; ++d )
+            p[d] = coordinates[d];
+
+        return p;
+    }
+
+    std::array<std::vector<float>, N> coordinates;
+    std::vector<float>                values;
+};
+
+template<Noise K, std::size_t N>
+static void scalarNoise( benchmark::State& state )
+{
+    NoiseInput<N> input( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    for ( auto _: state )
+    {
+        for ( std::size_t i = 0; i < input.values.size(); ++i )
+        {
+            Vector<float, N> p;
+            for ( std::size_t d = 0; d < N; ++d )
+                p[d] = input.coordinates[d][i];
+
+            if constexpr ( K == Noise::Perlin )
+                input.values[i] = perlin( p );
+            else if constexpr ( K == Noise::Simplex )
+                input.values[i] = simplex( p );
+            else
+                input.values[i] = valueNoise( p );
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+template<Noise K, std::size_t N>
+static void batchNoise( benchmark::State& state, ThreadPool& pool, int octaves = 1 )
+{
+    NoiseInput<N> input( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    for ( auto _: state )
+    {
+        fbm<K, float, N>( input.getCoordinates(), input.values, octaves, 2.0f, 0.5f, {}, 0, pool );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+static void Noise_Perlin3_Scalar( benchmark::State& state )
+{
+    scalarNoise<Noise::Perlin, 3>( state );
+}
+BENCHMARK( Noise_Perlin3_Scalar )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Simplex3_Scalar( benchmark::State& state )
+{
+    scalarNoise<Noise::Simplex, 3>( state );
+}
+BENCHMARK( Noise_Simplex3_Scalar )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Value3_Scalar( benchmark::State& state )
+{
+    scalarNoise<Noise::Value, 3>( state );
+}
+BENCHMARK( Noise_Value3_Scalar )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Perlin2( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Perlin, 2>( state, pool );
+}
+BENCHMARK( Noise_Perlin2 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Perlin3( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Perlin, 3>( state, pool );
+}
+BENCHMARK( Noise_Perlin3 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Perlin4( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Perlin, 4>( state, pool );
+}
+BENCHMARK( Noise_Perlin4 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Simplex2( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Simplex, 2>( state, pool );
+}
+BENCHMARK( Noise_Simplex2 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Simplex3( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Simplex, 3>( state, pool );
+}
+BENCHMARK( Noise_Simplex3 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Simplex4( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Simplex, 4>( state, pool );
+}
+BENCHMARK( Noise_Simplex4 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Value3( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Value, 3>( state, pool );
+}
+BENCHMARK( Noise_Value3 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Noise_Simplex3_Parallel( benchmark::State& state )
+{
+    batchNoise<Noise::Simplex, 3>( state, ThreadPool::getDefault() );
+}
+BENCHMARK( Noise_Simplex3_Parallel )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond )->UseRealTime();
+
+static void Noise_Simplex3_Fbm6( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    batchNoise<Noise::Simplex, 3>( state, pool, 6 );
+}
+BENCHMARK( Noise_Simplex3_Fbm6 )->Arg( 1'000'000 )->Unit( benchmark::kMillisecond );
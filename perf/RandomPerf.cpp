@@ -0,0 +1,109 @@
+#include <FastMath/Random.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static void Random_Box_StdMt19937( benchmark::State& state )
+{
+    std::mt19937                          rng( 42 );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    std::vector<Vector3f> points( static_cast<std::size_t>( state.range( 0 ) ) );
+    for ( auto _: state )
+    {
+        for ( auto& p: points )
+            p = Vector3f { dist( rng ), dist( rng ), dist( rng ) };
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Random_Box_StdMt19937 )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void Random_Box( benchmark::State& state )
+{
+    Random random { 42 };
+
+    std::vector<Vector3f> points( static_cast<std::size_t>( state.range( 0 ) ) );
+    for ( auto _: state )
+    {
+        uniformBox<float>( random, points, Vector3f { -1.0f }, Vector3f { 1.0f } );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Random_Box )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void Random_OnUnitSphere_StdMt19937( benchmark::State& state )
+{
+    std::mt19937                          rng( 42 );
+    std::uniform_real_distribution<float> dist( 0.0f, 1.0f );
+
+    std::vector<Vector3f> points( static_cast<std::size_t>( state.range( 0 ) ) );
+    for ( auto _: state )
+    {
+        for ( auto& p: points )
+        {
+            const float z   = 1.0f - 2.0f * dist( rng );
+            const float r   = std::sqrt( std::max( 0.0f, 1.0f - z * z ) );
+            const float phi = TWO_PI<float> * dist( rng );
+            p               = Vector3f { r * std::cos( phi ), r * std::sin( phi ), z };
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Random_OnUnitSphere_StdMt19937 )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void Random_OnUnitSphere( benchmark::State& state )
+{
+    Random random { 42 };
+
+    std::vector<Vector3f> points( static_cast<std::size_t>( state.range( 0 ) ) );
+    for ( auto _: state )
+    {
+        onUnitSphere<float>( random, points );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Random_OnUnitSphere )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void Random_CosineHemisphere( benchmark::State& state )
+{
+    Random         random { 42 };
+    const Vector3f normal = normalize( Vector3f { 1.0f, 2.0f, 3.0f } );
+
+    std::vector<Vector3f> directions( static_cast<std::size_t>( state.range( 0 ) ) );
+    for ( auto _: state )
+    {
+        cosineHemisphere<float>( random, directions, normal );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Random_CosineHemisphere )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
+
+static void Random_UniformRotation( benchmark::State& state )
+{
+    Random random { 42 };
+
+    std::vector<QuaternionF> rotations( static_cast<std::size_t>( state.range( 0 ) ) );
+    for ( auto _: state )
+    {
+        uniformRotation<float>( random, rotations );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Random_UniformRotation )->RangeMultiplier( 10 )->Range( 10'000, 1'000'000 );
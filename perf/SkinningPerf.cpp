@@ -0,0 +1,125 @@
+#include <FastMath/Skinning.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static constexpr std::size_t BONE_COUNT = 128;
+static constexpr std::size_t INFLUENCES = 4;
+
+struct SkinnedMesh
+{
+    explicit SkinnedMesh( std::size_t count, unsigned seed = 42 )
+    : positions( count )
+    , normals( count )
+    , bones( count * INFLUENCES )
+    , weights( count * INFLUENCES )
+    {
+        std::mt19937                          rng( seed );
+        std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+        std::uniform_real_distribution<float> weight( 0.0f, 1.0f );
+        std::uniform_int_distribution<int>    bone( 0, static_cast<int>( BONE_COUNT ) - 1 );
+
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            positions[i] = { dist( rng ), dist( rng ), dist( rng ) };
+            normals[i]   = normalize( Vector3f { dist( rng ), dist( rng ), dist( rng ) } );
+
+            // Neighboring vertices are mostly influenced by the same bones.
+            const int first = static_cast<int>( i * BONE_COUNT / count );
+
+            float sum = 0.0f;
+            for ( std::size_t k = 0; k < INFLUENCES; ++k )
+            {
+                bones[i * INFLUENCES + k]   = static_cast<uint16_t>( k == 0 ? first : bone( rng ) );
+                weights[i * INFLUENCES + k] = weight( rng );
+                sum += weights[i * INFLUENCES + k];
+            }
+
+            for ( std::size_t k = 0; k < INFLUENCES; ++k )
+                weights[i * INFLUENCES + k] /= sum;
+        }
+    }
+
+    SkinningStreams<float> getStreams() const
+    {
+        return { positions, normals, bones, weights, INFLUENCES };
+    }
+
+    std::vector<Vector3f> positions;
+    std::vector<Vector3f> normals;
+    std::vector<uint16_t> bones;
+    std::vector<float>    weights;
+};
+
+static std::vector<DualQuaternionF> dualQuaternionPalette()
+{
+    std::mt19937                          rng( 7 );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    std::vector<DualQuaternionF> palette( BONE_COUNT );
+    for ( auto& dq: palette )
+        dq = DualQuaternionF( normalize( QuaternionF { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } ), Vector3f { dist( rng ), dist( rng ), dist( rng ) } );
+
+    return palette;
+}
+
+static std::vector<float3x4> matrixPalette()
+{
+    std::vector<float3x4> palette;
+    for ( const auto& dq: dualQuaternionPalette() )
+    {
+        const Matrix4f m = static_cast<Matrix4f>( dq );
+
+        float3x4 m3;
+        for ( int r = 0; r < 3; ++r )
+            m3[r] = m[r];
+
+        palette.push_back( m3 );
+    }
+
+    return palette;
+}
+
+template<typename Palette>
+static void skinMesh( benchmark::State& state, const Palette& palette, ThreadPool& pool )
+{
+    const SkinnedMesh mesh( static_cast<std::size_t>( state.range( 0 ) ) );
+
+    std::vector<Vector3f> positions( mesh.positions.size() ), normals( mesh.normals.size() );
+    for ( auto _: state )
+    {
+        skin<float>( mesh.getStreams(), palette, positions, normals, pool );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+static void Skinning_Linear( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    skinMesh( state, matrixPalette(), pool );
+}
+BENCHMARK( Skinning_Linear )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Skinning_Linear_Parallel( benchmark::State& state )
+{
+    skinMesh( state, matrixPalette(), ThreadPool::getDefault() );
+}
+BENCHMARK( Skinning_Linear_Parallel )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond )->UseRealTime();
+
+static void Skinning_DualQuaternion( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    skinMesh( state, dualQuaternionPalette(), pool );
+}
+BENCHMARK( Skinning_DualQuaternion )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Skinning_DualQuaternion_Parallel( benchmark::State& state )
+{
+    skinMesh( state, dualQuaternionPalette(), ThreadPool::getDefault() );
+}
+BENCHMARK( Skinning_DualQuaternion_Parallel )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond )->UseRealTime();
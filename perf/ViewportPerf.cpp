@@ -0,0 +1,109 @@
+#include <FastMath/Viewport.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static std::vector<Vector3f> randomPoints( std::size_t count )
+{
+    std::mt19937                          rng( 42 );
+    std::uniform_real_distribution<float> dist( -100.0f, 100.0f );
+
+    std::vector<Vector3f> points( count );
+    for ( auto& p: points )
+        p = { dist( rng ), dist( rng ), dist( rng ) };
+
+    return points;
+}
+
+static const Viewport<float> VIEWPORT { 0.0f, 0.0f, 1920.0f, 1080.0f };
+
+static Matrix4f viewMatrix()
+{
+    return lookAt( Vector3f { 10.0f, 20.0f, -150.0f }, Vector3f { 0.0f }, Vector3f::UNIT_Y );
+}
+
+static Matrix4f projectionMatrix()
+{
+    return perspectiveFoV( radians( 60.0f ), 16.0f / 9.0f, 0.1f, 1000.0f );
+}
+
+static void projectPoints( benchmark::State& state, ThreadPool& pool )
+{
+    const std::vector<Vector3f> points = randomPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+    const Matrix4f              vp     = projectionMatrix() * viewMatrix();
+
+    std::vector<Vector3f> window( points.size() );
+    std::vector<uint8_t>  flags( points.size() );
+    for ( auto _: state )
+    {
+        project<DefaultClipSpace, float>( points, vp, VIEWPORT, window, flags, pool );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+static void unprojectPoints( benchmark::State& state, ThreadPool& pool )
+{
+    const std::vector<Vector3f> points = randomPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+    const Matrix4f              inv    = viewProjectionInverse( viewMatrix(), projectionMatrix() );
+
+    std::vector<Vector3f> window( points.size() );
+    project<DefaultClipSpace, float>( points, projectionMatrix() * viewMatrix(), VIEWPORT, window, {}, pool );
+
+    std::vector<Vector3f> unprojected( points.size() );
+    for ( auto _: state )
+    {
+        unproject<DefaultClipSpace, float>( window, inv, VIEWPORT, unprojected, pool );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+static void Viewport_Project_Scalar( benchmark::State& state )
+{
+    const std::vector<Vector3f> points = randomPoints( static_cast<std::size_t>( state.range( 0 ) ) );
+    const Matrix4f              vp     = projectionMatrix() * viewMatrix();
+
+    std::vector<Vector3f> window( points.size() );
+    for ( auto _: state )
+    {
+        for ( std::size_t i = 0; i < points.size(); ++i )
+            window[i] = project( points[i], vp, VIEWPORT );
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( Viewport_Project_Scalar )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Viewport_Project( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    projectPoints( state, pool );
+}
+BENCHMARK( Viewport_Project )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Viewport_Project_Parallel( benchmark::State& state )
+{
+    projectPoints( state, ThreadPool::getDefault() );
+}
+BENCHMARK( Viewport_Project_Parallel )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond )->UseRealTime();
+
+static void Viewport_Unproject( benchmark::State& state )
+{
+    ThreadPool pool( 0 );
+    unprojectPoints( state, pool );
+}
+BENCHMARK( Viewport_Unproject )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond );
+
+static void Viewport_Unproject_Parallel( benchmark::State& state )
+{
+    unprojectPoints( state, ThreadPool::getDefault() );
+}
+BENCHMARK( Viewport_Unproject_Parallel )->RangeMultiplier( 10 )->Range( 100'000, 10'000'000 )->Unit( benchmark::kMillisecond )->UseRealTime();
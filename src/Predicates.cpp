@@ -0,0 +1,874 @@
+#include <FastMath/Predicates.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// The error bounds and the expansion arithmetic below rely on IEEE 754 round-to-nearest
+// arithmetic where every operation is rounded exactly once.
+#if defined( __FAST_MATH__ )
+    #error "Predicates.cpp must be compiled without -ffast-math."
+#endif
+
+using namespace FastMath;
+
+namespace
+{
+
+// Half of the distance between 1 and the next representable double.
+constexpr double EPS      = 0x1p-53;
+constexpr double SPLITTER = 0x1p27 + 1.0;
+
+constexpr double RESULT_ERRBOUND = ( 3.0 + 8.0 * EPS ) * EPS;
+constexpr double CCW_ERRBOUND_A  = ( 3.0 + 16.0 * EPS ) * EPS;
+constexpr double CCW_ERRBOUND_B  = ( 2.0 + 12.0 * EPS ) * EPS;
+constexpr double CCW_ERRBOUND_C  = ( 9.0 + 64.0 * EPS ) * EPS * EPS;
+constexpr double O3D_ERRBOUND_A  = ( 7.0 + 56.0 * EPS ) * EPS;
+constexpr double O3D_ERRBOUND_B  = ( 3.0 + 28.0 * EPS ) * EPS;
+constexpr double O3D_ERRBOUND_C  = ( 26.0 + 288.0 * EPS ) * EPS * EPS;
+constexpr double ICC_ERRBOUND_A  = ( 10.0 + 96.0 * EPS ) * EPS;
+constexpr double ICC_ERRBOUND_B  = ( 4.0 + 48.0 * EPS ) * EPS;
+constexpr double ISP_ERRBOUND_A  = ( 16.0 + 224.0 * EPS ) * EPS;
+constexpr double ISP_ERRBOUND_B  = ( 5.0 + 72.0 * EPS ) * EPS;
+
+// x + y = a + b exactly, where x is the rounded sum. Requires |a| >= |b|.
+inline void fastTwoSum( double a, double b, double& x, double& y ) noexcept
+{
+    x             = a + b;
+    const double v = x - a;
+    y             = b - v;
+}
+
+// x + y = a + b exactly, where x is the rounded sum.
+inline void twoSum( double a, double b, double& x, double& y ) noexcept
+{
+    x                    = a + b;
+    const double bVirtual = x - a;
+    const double aVirtual = x - bVirtual;
+    y                    = ( a - aVirtual ) + ( b - bVirtual );
+}
+
+// The rounding error of x = a - b.
+inline double twoDiffTail( double a, double b, double x ) noexcept
+{
+    const double bVirtual = a - x;
+    const double aVirtual = x + bVirtual;
+    return ( a - aVirtual ) + ( bVirtual - b );
+}
+
+// Split a into two non-overlapping halves of (at most) 26 bits each.
+inline void split( double a, double& hi, double& lo ) noexcept
+{
+    const double c   = SPLITTER * a;
+    const double big = c - a;
+    hi               = c - big;
+    lo               = a - hi;
+}
+
+// x + y = a * b exactly, where x is the rounded product.
+inline void twoProduct( double a, double b, double& x, double& y ) noexcept
+{
+    x = a * b;
+
+    double aHi, aLo, bHi, bLo;
+    split( a, aHi, aLo );
+    split( b, bHi, bLo );
+
+    const double err1 = x - aHi * bHi;
+    const double err2 = err1 - aLo * bHi;
+    const double err3 = err2 - aHi * bLo;
+    y                 = aLo * bLo - err3;
+}
+
+// Expansions are arrays of non-overlapping doubles sorted by increasing magnitude whose exact
+// sum is the value of the expansion. The functions below return the number of components
+// written to h and never produce zero components (except for the expansion of zero itself).
+
+// h = e + f. h must have room for elen + flen components.
+int sum( int elen, const double* e, int flen, const double* f, double* h ) noexcept
+{
+    int    ei = 0, fi = 0, hi = 0;
+    double eNow = e[0];
+    double fNow = f[0];
+    double q, qNew, hh;
+
+    auto nextE = [&] { eNow = ++ei < elen ? e[ei] : 0.0; };
+    auto nextF = [&] { fNow = ++fi < flen ? f[fi] : 0.0; };
+
+    if ( ( fNow > eNow ) == ( fNow > -eNow ) )
+    {
+        q = eNow;
+        nextE();
+    }
+    else
+    {
+        q = fNow;
+        nextF();
+    }
+
+    if ( ei < elen && fi < flen )
+    {
+        if ( ( fNow > eNow ) == ( fNow > -eNow ) )
+        {
+            fastTwoSum( eNow, q, qNew, hh );
+            nextE();
+        }
+        else
+        {
+            fastTwoSum( fNow, q, qNew, hh );
+            nextF();
+        }
+        q = qNew;
+        if ( hh != 0.0 )
+            h[hi++] = hh;
+
+        while ( ei < elen && fi < flen )
+        {
+            if ( ( fNow > eNow ) == ( fNow > -eNow ) )
+            {
+                twoSum( q, eNow, qNew, hh );
+                nextE();
+            }
+            else
+            {
+                twoSum( q, fNow, qNew, hh );
+                nextF();
+            }
+            q = qNew;
+            if ( hh != 0.0 )
+                h[hi++] = hh;
+        }
+    }
+
+    while ( ei < elen )
+    {
+        twoSum( q, eNow, qNew, hh );
+        nextE();
+        q = qNew;
+        if ( hh != 0.0 )
+            h[hi++] = hh;
+    }
+
+    while ( fi < flen )
+    {
+        twoSum( q, fNow, qNew, hh );
+        nextF();
+        q = qNew;
+        if ( hh != 0.0 )
+            h[hi++] = hh;
+    }
+
+    if ( q != 0.0 || hi == 0 )
+        h[hi++] = q;
+
+    return hi;
+}
+
+// h = e * b. h must have room for 2 * elen components.
+int scale( int elen, const double* e, double b, double* h ) noexcept
+{
+    int    hi = 0;
+    double q, hh, p1, p0, s;
+
+    twoProduct( e[0], b, q, hh );
+    if ( hh != 0.0 )
+        h[hi++] = hh;
+
+    for ( int i = 1; i < elen; ++i )
+    {
+        twoProduct( e[i], b, p1, p0 );
+        twoSum( q, p0, s, hh );
+        if ( hh != 0.0 )
+            h[hi++] = hh;
+        fastTwoSum( p1, s, q, hh );
+        if ( hh != 0.0 )
+            h[hi++] = hh;
+    }
+
+    if ( q != 0.0 || hi == 0 )
+        h[hi++] = q;
+
+    return hi;
+}
+
+// An approximation of the value of an expansion.
+double estimate( int elen, const double* e ) noexcept
+{
+    double q = e[0];
+    for ( int i = 1; i < elen; ++i )
+        q += e[i];
+
+    return q;
+}
+
+// px * qy - py * qx as an expansion of (at most) 4 components.
+int minor2( double px, double py, double qx, double qy, double* h ) noexcept
+{
+    double l[2], r[2];
+    twoProduct( px, qy, l[1], l[0] );
+    twoProduct( -py, qx, r[1], r[0] );
+
+    return sum( 2, l, 2, r, h );
+}
+
+// s1 * m1 + s2 * m2 + s3 * m3 for three 2x2 minors, as an expansion of (at most) 24 components.
+int minor3( double s1, int n1, const double* m1, double s2, int n2, const double* m2, double s3, int n3, const double* m3, double* h ) noexcept
+{
+    double t1[8], t2[8], t3[8], t12[16];
+
+    const int l1  = scale( n1, m1, s1, t1 );
+    const int l2  = scale( n2, m2, s2, t2 );
+    const int l3  = scale( n3, m3, s3, t3 );
+    const int l12 = sum( l1, t1, l2, t2, t12 );
+
+    return sum( l12, t12, l3, t3, h );
+}
+
+// e * ( p[0]^2 + ... + p[D-1]^2 ), where e has at most N components.
+template<int N, int D>
+int lift( int elen, const double* e, const double* p, double* h ) noexcept
+{
+    static_assert( D == 2 || D == 3 );
+
+    double t[2 * N], sq[D][4 * N];
+    int    lens[D];
+    for ( int k = 0; k < D; ++k )
+    {
+        const int n = scale( elen, e, p[k], t );
+        lens[k]     = scale( n, t, p[k], sq[k] );
+    }
+
+    if constexpr ( D == 2 )
+    {
+        return sum( lens[0], sq[0], lens[1], sq[1], h );
+    }
+    else
+    {
+        double s[8 * N];
+        const int n = sum( lens[0], sq[0], lens[1], sq[1], s );
+        return sum( n, s, lens[2], sq[2], h );
+    }
+}
+
+void negate( int elen, double* e ) noexcept
+{
+    for ( int i = 0; i < elen; ++i )
+        e[i] = -e[i];
+}
+
+// The exact determinants are evaluated from the input coordinates (instead of from their
+// differences, which may have been rounded) by expanding the lifted determinants along a column:
+//
+//   orient2d = | ax ay 1 |   orient3d = | ax ay az 1 |   incircle = | ax ay ax^2+ay^2 1 |
+//              | bx by 1 |              | bx by bz 1 |              | bx by bx^2+by^2 1 |
+//              | cx cy 1 |              | cx cy cz 1 |              | cx cy cx^2+cy^2 1 |
+//                                       | dx dy dz 1 |              | dx dy dx^2+dy^2 1 |
+
+// At most 12 components.
+int orient2dExact( const Vector3d& a, const Vector3d& b, const Vector3d& c, double* h ) noexcept
+{
+    double ab[4], bc[4], ca[4], t[8];
+
+    const int n1 = minor2( a.x, a.y, b.x, b.y, ab );
+    const int n2 = minor2( b.x, b.y, c.x, c.y, bc );
+    const int n3 = minor2( c.x, c.y, a.x, a.y, ca );
+    const int n  = sum( n1, ab, n2, bc, t );
+
+    return sum( n, t, n3, ca, h );
+}
+
+// At most 96 components.
+int orient3dExact( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, double* h ) noexcept
+{
+    double o[12], t1[24], t2[24], s1[48], s2[48];
+
+    int       n  = orient2dExact( b, c, d, o );
+    int       l1 = scale( n, o, a.z, t1 );
+    n            = orient2dExact( a, c, d, o );
+    int       l2 = scale( n, o, -b.z, t2 );
+    const int m1 = sum( l1, t1, l2, t2, s1 );
+
+    n            = orient2dExact( a, b, d, o );
+    l1           = scale( n, o, c.z, t1 );
+    n            = orient2dExact( a, b, c, o );
+    l2           = scale( n, o, -d.z, t2 );
+    const int m2 = sum( l1, t1, l2, t2, s2 );
+
+    return sum( m1, s1, m2, s2, h );
+}
+
+// At most 384 components.
+int incircleExact( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, double* h ) noexcept
+{
+    const Vector3d* p[4] = { &a, &b, &c, &d };
+
+    double o[12], t[4][96], s1[192], s2[192];
+    int    lens[4];
+    for ( int i = 0; i < 4; ++i )
+    {
+        // The orientation of the other three points (in order).
+        const Vector3d* q[3];
+        for ( int j = 0, k = 0; j < 4; ++j )
+        {
+            if ( j != i )
+                q[k++] = p[j];
+        }
+
+        const int n = orient2dExact( *q[0], *q[1], *q[2], o );
+        if ( i % 2 == 1 )
+            negate( n, o );
+
+        const double xy[2] = { p[i]->x, p[i]->y };
+        lens[i]            = lift<12, 2>( n, o, xy, t[i] );
+    }
+
+    const int n1 = sum( lens[0], t[0], lens[1], t[1], s1 );
+    const int n2 = sum( lens[2], t[2], lens[3], t[3], s2 );
+
+    return sum( n1, s1, n2, s2, h );
+}
+
+// At most 5760 components.
+int insphereExact( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, const Vector3d& e, double* h ) noexcept
+{
+    const Vector3d* p[5] = { &a, &b, &c, &d, &e };
+
+    // The partial sums are too large for the stack.
+    static thread_local double acc[2][5760];
+
+    double o[96], t[1152];
+    int    len = 0;
+    for ( int i = 0; i < 5; ++i )
+    {
+        const Vector3d* q[4];
+        for ( int j = 0, k = 0; j < 5; ++j )
+        {
+            if ( j != i )
+                q[k++] = p[j];
+        }
+
+        const int n = orient3dExact( *q[0], *q[1], *q[2], *q[3], o );
+        if ( i % 2 == 0 )
+            negate( n, o );
+
+        const double xyz[3] = { p[i]->x, p[i]->y, p[i]->z };
+        const int    l      = lift<96, 3>( n, o, xyz, t );
+
+        if ( i == 0 )
+        {
+            std::copy( t, t + l, acc[0] );
+            len = l;
+        }
+        else
+        {
+            len = sum( len, acc[( i + 1 ) % 2], l, t, acc[i % 2] );
+        }
+    }
+
+    std::copy( acc[0], acc[0] + len, h );
+    return len;
+}
+
+#if defined( LS_AVX2 )
+inline __m256d abs4( __m256d x ) noexcept
+{
+    return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), x );
+}
+
+// Load component c of 4 consecutive points.
+template<std::size_t N>
+inline __m256d load4( std::span<const Vector<double, N>> points, std::size_t i, std::size_t c ) noexcept
+{
+    return _mm256_set_pd( points[i + 3][c], points[i + 2][c], points[i + 1][c], points[i][c] );
+}
+
+// Store the filtered results and recompute the lanes whose sign is uncertain.
+template<typename F>
+inline void resolve4( std::size_t i, __m256d det, __m256d absDet, __m256d errBound, std::span<double> results, F&& predicate ) noexcept
+{
+    _mm256_storeu_pd( results.data() + i, det );
+
+    const int certain = _mm256_movemask_pd( _mm256_cmp_pd( absDet, errBound, _CMP_GE_OQ ) );
+    if ( certain == 0xf )
+        return;
+
+    for ( std::size_t k = 0; k < 4; ++k )
+    {
+        if ( !( certain & ( 1 << k ) ) )
+            results[i + k] = predicate( i + k );
+    }
+}
+#endif
+
+Vector3d to3d( const Vector2d& p ) noexcept
+{
+    return { p.x, p.y, 0.0 };
+}
+
+double orient2dAdapt( const Vector2d& a, const Vector2d& b, const Vector2d& c, double detSum ) noexcept
+{
+    const double acx = a.x - c.x;
+    const double bcx = b.x - c.x;
+    const double acy = a.y - c.y;
+    const double bcy = b.y - c.y;
+
+    // Stage B: exact products of the rounded differences.
+    double B[4];
+    const int n = minor2( acx, acy, bcx, bcy, B );
+
+    double det      = estimate( n, B );
+    double errBound = CCW_ERRBOUND_B * detSum;
+    if ( det >= errBound || -det >= errBound )
+        return det;
+
+    const double acxTail = twoDiffTail( a.x, c.x, acx );
+    const double bcxTail = twoDiffTail( b.x, c.x, bcx );
+    const double acyTail = twoDiffTail( a.y, c.y, acy );
+    const double bcyTail = twoDiffTail( b.y, c.y, bcy );
+
+    if ( acxTail == 0.0 && acyTail == 0.0 && bcxTail == 0.0 && bcyTail == 0.0 )
+        return det;
+
+    // Stage C: first-order correction for the rounding of the differences.
+    errBound = CCW_ERRBOUND_C * detSum + RESULT_ERRBOUND * std::abs( det );
+    det += ( acx * bcyTail + bcy * acxTail ) - ( acy * bcxTail + bcx * acyTail );
+    if ( det >= errBound || -det >= errBound )
+        return det;
+
+    // Stage D: exact.
+    double h[12];
+    const int len = orient2dExact( to3d( a ), to3d( b ), to3d( c ), h );
+
+    return h[len - 1];
+}
+
+double orient3dAdapt( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, double permanent ) noexcept
+{
+    const double adx = a.x - d.x, bdx = b.x - d.x, cdx = c.x - d.x;
+    const double ady = a.y - d.y, bdy = b.y - d.y, cdy = c.y - d.y;
+    const double adz = a.z - d.z, bdz = b.z - d.z, cdz = c.z - d.z;
+
+    // Stage B: exact products of the rounded differences.
+    double bc[4], ca[4], ab[4], fin[24];
+    const int nbc = minor2( bdx, bdy, cdx, cdy, bc );
+    const int nca = minor2( cdx, cdy, adx, ady, ca );
+    const int nab = minor2( adx, ady, bdx, bdy, ab );
+    const int n   = minor3( adz, nbc, bc, bdz, nca, ca, cdz, nab, ab, fin );
+
+    double det      = estimate( n, fin );
+    double errBound = O3D_ERRBOUND_B * permanent;
+    if ( det >= errBound || -det >= errBound )
+        return det;
+
+    const double adxTail = twoDiffTail( a.x, d.x, adx ), bdxTail = twoDiffTail( b.x, d.x, bdx ), cdxTail = twoDiffTail( c.x, d.x, cdx );
+    const double adyTail = twoDiffTail( a.y, d.y, ady ), bdyTail = twoDiffTail( b.y, d.y, bdy ), cdyTail = twoDiffTail( c.y, d.y, cdy );
+    const double adzTail = twoDiffTail( a.z, d.z, adz ), bdzTail = twoDiffTail( b.z, d.z, bdz ), cdzTail = twoDiffTail( c.z, d.z, cdz );
+
+    if ( adxTail == 0.0 && bdxTail == 0.0 && cdxTail == 0.0 && adyTail == 0.0 && bdyTail == 0.0 && cdyTail == 0.0 && adzTail == 0.0 && bdzTail == 0.0 && cdzTail == 0.0 )
+        return det;
+
+    // Stage C: first-order correction for the rounding of the differences.
+    errBound = O3D_ERRBOUND_C * permanent + RESULT_ERRBOUND * std::abs( det );
+    det += ( adz * ( ( bdx * cdyTail + cdy * bdxTail ) - ( bdy * cdxTail + cdx * bdyTail ) ) + adzTail * ( bdx * cdy - bdy * cdx ) ) +
+           ( bdz * ( ( cdx * adyTail + ady * cdxTail ) - ( cdy * adxTail + adx * cdyTail ) ) + bdzTail * ( cdx * ady - cdy * adx ) ) +
+           ( cdz * ( ( adx * bdyTail + bdy * adxTail ) - ( ady * bdxTail + bdx * adyTail ) ) + cdzTail * ( adx * bdy - ady * bdx ) );
+    if ( det >= errBound || -det >= errBound )
+        return det;
+
+    // Stage D: exact.
+    double h[96];
+    const int len = orient3dExact( a, b, c, d, h );
+
+    return h[len - 1];
+}
+
+double incircleAdapt( const Vector2d& a, const Vector2d& b, const Vector2d& c, const Vector2d& d, double permanent ) noexcept
+{
+    const double adx = a.x - d.x, bdx = b.x - d.x, cdx = c.x - d.x;
+    const double ady = a.y - d.y, bdy = b.y - d.y, cdy = c.y - d.y;
+
+    // Stage B: exact products of the rounded differences.
+    double bc[4], ca[4], ab[4], t[3][32], s[64], fin[96];
+    const int nbc = minor2( bdx, bdy, cdx, cdy, bc );
+    const int nca = minor2( cdx, cdy, adx, ady, ca );
+    const int nab = minor2( adx, ady, bdx, bdy, ab );
+
+    const double pa[2] = { adx, ady }, pb[2] = { bdx, bdy }, pc[2] = { cdx, cdy };
+
+    const int la = lift<4, 2>( nbc, bc, pa, t[0] );
+    const int lb = lift<4, 2>( nca, ca, pb, t[1] );
+    const int lc = lift<4, 2>( nab, ab, pc, t[2] );
+    const int ls = sum( la, t[0], lb, t[1], s );
+    const int n  = sum( ls, s, lc, t[2], fin );
+
+    const double det      = estimate( n, fin );
+    const double errBound = ICC_ERRBOUND_B * permanent;
+    if ( det >= errBound || -det >= errBound )
+        return det;
+
+    if ( twoDiffTail( a.x, d.x, adx ) == 0.0 && twoDiffTail( b.x, d.x, bdx ) == 0.0 && twoDiffTail( c.x, d.x, cdx ) == 0.0 &&
+         twoDiffTail( a.y, d.y, ady ) == 0.0 && twoDiffTail( b.y, d.y, bdy ) == 0.0 && twoDiffTail( c.y, d.y, cdy ) == 0.0 )
+        return det;
+
+    // Exact.
+    double h[384];
+    const int len = incircleExact( to3d( a ), to3d( b ), to3d( c ), to3d( d ), h );
+
+    return h[len - 1];
+}
+
+double insphereAdapt( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, const Vector3d& e, double permanent ) noexcept
+{
+    const double aex = a.x - e.x, bex = b.x - e.x, cex = c.x - e.x, dex = d.x - e.x;
+    const double aey = a.y - e.y, bey = b.y - e.y, cey = c.y - e.y, dey = d.y - e.y;
+    const double aez = a.z - e.z, bez = b.z - e.z, cez = c.z - e.z, dez = d.z - e.z;
+
+    // Stage B: exact products of the rounded differences.
+    double ab[4], bc[4], cd[4], da[4], ac[4], bd[4];
+    const int nab = minor2( aex, aey, bex, bey, ab );
+    const int nbc = minor2( bex, bey, cex, cey, bc );
+    const int ncd = minor2( cex, cey, dex, dey, cd );
+    const int nda = minor2( dex, dey, aex, aey, da );
+    const int nac = minor2( aex, aey, cex, cey, ac );
+    const int nbd = minor2( bex, bey, dex, dey, bd );
+
+    double abc[24], bcd[24], cda[24], dab[24];
+    const int nabc = minor3( aez, nbc, bc, -bez, nac, ac, cez, nab, ab, abc );
+    const int nbcd = minor3( bez, ncd, cd, -cez, nbd, bd, dez, nbc, bc, bcd );
+    const int ncda = minor3( cez, nda, da, dez, nac, ac, aez, ncd, cd, cda );
+    const int ndab = minor3( dez, nab, ab, aez, nbd, bd, bez, nda, da, dab );
+
+    // det = ( dlift * abc - clift * dab ) + ( blift * cda - alift * bcd )
+    negate( ndab, dab );
+    negate( nbcd, bcd );
+
+    const double pa[3] = { aex, aey, aez }, pb[3] = { bex, bey, bez }, pc[3] = { cex, cey, cez }, pd[3] = { dex, dey, dez };
+
+    double t[4][288], s1[576], s2[576], fin[1152];
+    const int l0 = lift<24, 3>( nabc, abc, pd, t[0] );
+    const int l1 = lift<24, 3>( ndab, dab, pc, t[1] );
+    const int l2 = lift<24, 3>( ncda, cda, pb, t[2] );
+    const int l3 = lift<24, 3>( nbcd, bcd, pa, t[3] );
+    const int m1 = sum( l0, t[0], l1, t[1], s1 );
+    const int m2 = sum( l2, t[2], l3, t[3], s2 );
+    const int n  = sum( m1, s1, m2, s2, fin );
+
+    const double det      = estimate( n, fin );
+    const double errBound = ISP_ERRBOUND_B * permanent;
+    if ( det >= errBound || -det >= errBound )
+        return det;
+
+    if ( twoDiffTail( a.x, e.x, aex ) == 0.0 && twoDiffTail( b.x, e.x, bex ) == 0.0 && twoDiffTail( c.x, e.x, cex ) == 0.0 && twoDiffTail( d.x, e.x, dex ) == 0.0 &&
+         twoDiffTail( a.y, e.y, aey ) == 0.0 && twoDiffTail( b.y, e.y, bey ) == 0.0 && twoDiffTail( c.y, e.y, cey ) == 0.0 && twoDiffTail( d.y, e.y, dey ) == 0.0 &&
+         twoDiffTail( a.z, e.z, aez ) == 0.0 && twoDiffTail( b.z, e.z, bez ) == 0.0 && twoDiffTail( c.z, e.z, cez ) == 0.0 && twoDiffTail( d.z, e.z, dez ) == 0.0 )
+        return det;
+
+    // Exact.
+    static thread_local double h[5760];
+    const int len = insphereExact( a, b, c, d, e, h );
+
+    return h[len - 1];
+}
+
+}  // namespace
+
+namespace FastMath::Predicates
+{
+
+double orient2d( const Vector2d& a, const Vector2d& b, const Vector2d& c ) noexcept
+{
+    const double detLeft  = ( a.x - c.x ) * ( b.y - c.y );
+    const double detRight = ( a.y - c.y ) * ( b.x - c.x );
+    const double det      = detLeft - detRight;
+    const double detSum   = std::abs( detLeft ) + std::abs( detRight );
+
+    if ( std::abs( det ) >= CCW_ERRBOUND_A * detSum )
+        return det;
+
+    return orient2dAdapt( a, b, c, detSum );
+}
+
+double orient3d( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d ) noexcept
+{
+    const double adx = a.x - d.x, bdx = b.x - d.x, cdx = c.x - d.x;
+    const double ady = a.y - d.y, bdy = b.y - d.y, cdy = c.y - d.y;
+    const double adz = a.z - d.z, bdz = b.z - d.z, cdz = c.z - d.z;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    const double cdxady = cdx * ady, adxcdy = adx * cdy;
+    const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    const double det = adz * ( bdxcdy - cdxbdy ) + bdz * ( cdxady - adxcdy ) + cdz * ( adxbdy - bdxady );
+
+    const double permanent = ( std::abs( bdxcdy ) + std::abs( cdxbdy ) ) * std::abs( adz ) +
+                             ( std::abs( cdxady ) + std::abs( adxcdy ) ) * std::abs( bdz ) +
+                             ( std::abs( adxbdy ) + std::abs( bdxady ) ) * std::abs( cdz );
+
+    if ( std::abs( det ) >= O3D_ERRBOUND_A * permanent )
+        return det;
+
+    return orient3dAdapt( a, b, c, d, permanent );
+}
+
+double incircle( const Vector2d& a, const Vector2d& b, const Vector2d& c, const Vector2d& d ) noexcept
+{
+    const double adx = a.x - d.x, bdx = b.x - d.x, cdx = c.x - d.x;
+    const double ady = a.y - d.y, bdy = b.y - d.y, cdy = c.y - d.y;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    const double cdxady = cdx * ady, adxcdy = adx * cdy;
+    const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    const double aLift = adx * adx + ady * ady;
+    const double bLift = bdx * bdx + bdy * bdy;
+    const double cLift = cdx * cdx + cdy * cdy;
+
+    const double det = aLift * ( bdxcdy - cdxbdy ) + bLift * ( cdxady - adxcdy ) + cLift * ( adxbdy - bdxady );
+
+    const double permanent = ( std::abs( bdxcdy ) + std::abs( cdxbdy ) ) * aLift +
+                             ( std::abs( cdxady ) + std::abs( adxcdy ) ) * bLift +
+                             ( std::abs( adxbdy ) + std::abs( bdxady ) ) * cLift;
+
+    if ( std::abs( det ) >= ICC_ERRBOUND_A * permanent )
+        return det;
+
+    return incircleAdapt( a, b, c, d, permanent );
+}
+
+double insphere( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, const Vector3d& e ) noexcept
+{
+    const double aex = a.x - e.x, bex = b.x - e.x, cex = c.x - e.x, dex = d.x - e.x;
+    const double aey = a.y - e.y, bey = b.y - e.y, cey = c.y - e.y, dey = d.y - e.y;
+    const double aez = a.z - e.z, bez = b.z - e.z, cez = c.z - e.z, dez = d.z - e.z;
+
+    const double aexbey = aex * bey, bexaey = bex * aey;
+    const double bexcey = bex * cey, cexbey = cex * bey;
+    const double cexdey = cex * dey, dexcey = dex * cey;
+    const double dexaey = dex * aey, aexdey = aex * dey;
+    const double aexcey = aex * cey, cexaey = cex * aey;
+    const double bexdey = bex * dey, dexbey = dex * bey;
+
+    const double ab = aexbey - bexaey;
+    const double bc = bexcey - cexbey;
+    const double cd = cexdey - dexcey;
+    const double da = dexaey - aexdey;
+    const double ac = aexcey - cexaey;
+    const double bd = bexdey - dexbey;
+
+    const double abc = aez * bc - bez * ac + cez * ab;
+    const double bcd = bez * cd - cez * bd + dez * bc;
+    const double cda = cez * da + dez * ac + aez * cd;
+    const double dab = dez * ab + aez * bd + bez * da;
+
+    const double aLift = aex * aex + aey * aey + aez * aez;
+    const double bLift = bex * bex + bey * bey + bez * bez;
+    const double cLift = cex * cex + cey * cey + cez * cez;
+    const double dLift = dex * dex + dey * dey + dez * dez;
+
+    const double det = ( dLift * abc - cLift * dab ) + ( bLift * cda - aLift * bcd );
+
+    const double aezPlus = std::abs( aez ), bezPlus = std::abs( bez ), cezPlus = std::abs( cez ), dezPlus = std::abs( dez );
+
+    const double aexbeyPlus = std::abs( aexbey ), bexaeyPlus = std::abs( bexaey );
+    const double bexceyPlus = std::abs( bexcey ), cexbeyPlus = std::abs( cexbey );
+    const double cexdeyPlus = std::abs( cexdey ), dexceyPlus = std::abs( dexcey );
+    const double dexaeyPlus = std::abs( dexaey ), aexdeyPlus = std::abs( aexdey );
+    const double aexceyPlus = std::abs( aexcey ), cexaeyPlus = std::abs( cexaey );
+    const double bexdeyPlus = std::abs( bexdey ), dexbeyPlus = std::abs( dexbey );
+
+    const double permanent = ( ( cexdeyPlus + dexceyPlus ) * bezPlus + ( dexbeyPlus + bexdeyPlus ) * cezPlus + ( bexceyPlus + cexbeyPlus ) * dezPlus ) * aLift +
+                             ( ( dexaeyPlus + aexdeyPlus ) * cezPlus + ( aexceyPlus + cexaeyPlus ) * dezPlus + ( cexdeyPlus + dexceyPlus ) * aezPlus ) * bLift +
+                             ( ( aexbeyPlus + bexaeyPlus ) * dezPlus + ( bexdeyPlus + dexbeyPlus ) * aezPlus + ( dexaeyPlus + aexdeyPlus ) * bezPlus ) * cLift +
+                             ( ( bexceyPlus + cexbeyPlus ) * aezPlus + ( cexaeyPlus + aexceyPlus ) * bezPlus + ( aexbeyPlus + bexaeyPlus ) * cezPlus ) * dLift;
+
+    if ( std::abs( det ) >= ISP_ERRBOUND_A * permanent )
+        return det;
+
+    return insphereAdapt( a, b, c, d, e, permanent );
+}
+
+void orient2d( const Vector2d& a, const Vector2d& b, std::span<const Vector2d> points, std::span<double> results ) noexcept
+{
+    const std::size_t count = points.size();
+    assert( results.size() >= count );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    const __m256d ax = _mm256_set1_pd( a.x ), ay = _mm256_set1_pd( a.y );
+    const __m256d bx = _mm256_set1_pd( b.x ), by = _mm256_set1_pd( b.y );
+    const __m256d errBoundA = _mm256_set1_pd( CCW_ERRBOUND_A );
+
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        const __m256d cx = load4( points, i, 0 );
+        const __m256d cy = load4( points, i, 1 );
+
+        const __m256d detLeft  = _mm256_mul_pd( _mm256_sub_pd( ax, cx ), _mm256_sub_pd( by, cy ) );
+        const __m256d detRight = _mm256_mul_pd( _mm256_sub_pd( ay, cy ), _mm256_sub_pd( bx, cx ) );
+        const __m256d det      = _mm256_sub_pd( detLeft, detRight );
+        const __m256d detSum   = _mm256_add_pd( abs4( detLeft ), abs4( detRight ) );
+
+        resolve4( i, det, abs4( det ), _mm256_mul_pd( errBoundA, detSum ), results, [&]( std::size_t j ) { return orient2d( a, b, points[j] ); } );
+    }
+#endif
+
+    for ( ; i < count; ++i )
+        results[i] = orient2d( a, b, points[i] );
+}
+
+void orient3d( const Vector3d& a, const Vector3d& b, const Vector3d& c, std::span<const Vector3d> points, std::span<double> results ) noexcept
+{
+    const std::size_t count = points.size();
+    assert( results.size() >= count );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    const __m256d errBoundA = _mm256_set1_pd( O3D_ERRBOUND_A );
+
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        const __m256d dx = load4( points, i, 0 );
+        const __m256d dy = load4( points, i, 1 );
+        const __m256d dz = load4( points, i, 2 );
+
+        const __m256d adx = _mm256_sub_pd( _mm256_set1_pd( a.x ), dx ), bdx = _mm256_sub_pd( _mm256_set1_pd( b.x ), dx ), cdx = _mm256_sub_pd( _mm256_set1_pd( c.x ), dx );
+        const __m256d ady = _mm256_sub_pd( _mm256_set1_pd( a.y ), dy ), bdy = _mm256_sub_pd( _mm256_set1_pd( b.y ), dy ), cdy = _mm256_sub_pd( _mm256_set1_pd( c.y ), dy );
+        const __m256d adz = _mm256_sub_pd( _mm256_set1_pd( a.z ), dz ), bdz = _mm256_sub_pd( _mm256_set1_pd( b.z ), dz ), cdz = _mm256_sub_pd( _mm256_set1_pd( c.z ), dz );
+
+        const __m256d bdxcdy = _mm256_mul_pd( bdx, cdy ), cdxbdy = _mm256_mul_pd( cdx, bdy );
+        const __m256d cdxady = _mm256_mul_pd( cdx, ady ), adxcdy = _mm256_mul_pd( adx, cdy );
+        const __m256d adxbdy = _mm256_mul_pd( adx, bdy ), bdxady = _mm256_mul_pd( bdx, ady );
+
+        const __m256d det = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( adz, _mm256_sub_pd( bdxcdy, cdxbdy ) ), _mm256_mul_pd( bdz, _mm256_sub_pd( cdxady, adxcdy ) ) ),
+                                           _mm256_mul_pd( cdz, _mm256_sub_pd( adxbdy, bdxady ) ) );
+
+        const __m256d permanent = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( _mm256_add_pd( abs4( bdxcdy ), abs4( cdxbdy ) ), abs4( adz ) ),
+                                                                _mm256_mul_pd( _mm256_add_pd( abs4( cdxady ), abs4( adxcdy ) ), abs4( bdz ) ) ),
+                                                 _mm256_mul_pd( _mm256_add_pd( abs4( adxbdy ), abs4( bdxady ) ), abs4( cdz ) ) );
+
+        resolve4( i, det, abs4( det ), _mm256_mul_pd( errBoundA, permanent ), results, [&]( std::size_t j ) { return orient3d( a, b, c, points[j] ); } );
+    }
+#endif
+
+    for ( ; i < count; ++i )
+        results[i] = orient3d( a, b, c, points[i] );
+}
+
+void incircle( const Vector2d& a, const Vector2d& b, const Vector2d& c, std::span<const Vector2d> points, std::span<double> results ) noexcept
+{
+    const std::size_t count = points.size();
+    assert( results.size() >= count );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    const __m256d errBoundA = _mm256_set1_pd( ICC_ERRBOUND_A );
+
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        const __m256d dx = load4( points, i, 0 );
+        const __m256d dy = load4( points, i, 1 );
+
+        const __m256d adx = _mm256_sub_pd( _mm256_set1_pd( a.x ), dx ), bdx = _mm256_sub_pd( _mm256_set1_pd( b.x ), dx ), cdx = _mm256_sub_pd( _mm256_set1_pd( c.x ), dx );
+        const __m256d ady = _mm256_sub_pd( _mm256_set1_pd( a.y ), dy ), bdy = _mm256_sub_pd( _mm256_set1_pd( b.y ), dy ), cdy = _mm256_sub_pd( _mm256_set1_pd( c.y ), dy );
+
+        const __m256d bdxcdy = _mm256_mul_pd( bdx, cdy ), cdxbdy = _mm256_mul_pd( cdx, bdy );
+        const __m256d cdxady = _mm256_mul_pd( cdx, ady ), adxcdy = _mm256_mul_pd( adx, cdy );
+        const __m256d adxbdy = _mm256_mul_pd( adx, bdy ), bdxady = _mm256_mul_pd( bdx, ady );
+
+        const __m256d aLift = _mm256_add_pd( _mm256_mul_pd( adx, adx ), _mm256_mul_pd( ady, ady ) );
+        const __m256d bLift = _mm256_add_pd( _mm256_mul_pd( bdx, bdx ), _mm256_mul_pd( bdy, bdy ) );
+        const __m256d cLift = _mm256_add_pd( _mm256_mul_pd( cdx, cdx ), _mm256_mul_pd( cdy, cdy ) );
+
+        const __m256d det = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( aLift, _mm256_sub_pd( bdxcdy, cdxbdy ) ), _mm256_mul_pd( bLift, _mm256_sub_pd( cdxady, adxcdy ) ) ),
+                                           _mm256_mul_pd( cLift, _mm256_sub_pd( adxbdy, bdxady ) ) );
+
+        const __m256d permanent = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( _mm256_add_pd( abs4( bdxcdy ), abs4( cdxbdy ) ), aLift ),
+                                                                _mm256_mul_pd( _mm256_add_pd( abs4( cdxady ), abs4( adxcdy ) ), bLift ) ),
+                                                 _mm256_mul_pd( _mm256_add_pd( abs4( adxbdy ), abs4( bdxady ) ), cLift ) );
+
+        resolve4( i, det, abs4( det ), _mm256_mul_pd( errBoundA, permanent ), results, [&]( std::size_t j ) { return incircle( a, b, c, points[j] ); } );
+    }
+#endif
+
+    for ( ; i < count; ++i )
+        results[i] = incircle( a, b, c, points[i] );
+}
+
+void insphere( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, std::span<const Vector3d> points, std::span<double> results ) noexcept
+{
+    const std::size_t count = points.size();
+    assert( results.size() >= count );
+
+    std::size_t i = 0;
+
+#if defined( LS_AVX2 )
+    const __m256d errBoundA = _mm256_set1_pd( ISP_ERRBOUND_A );
+
+    auto add = []( __m256d x, __m256d y ) { return _mm256_add_pd( x, y ); };
+    auto sub = []( __m256d x, __m256d y ) { return _mm256_sub_pd( x, y ); };
+    auto mul = []( __m256d x, __m256d y ) { return _mm256_mul_pd( x, y ); };
+
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        const __m256d ex = load4( points, i, 0 );
+        const __m256d ey = load4( points, i, 1 );
+        const __m256d ez = load4( points, i, 2 );
+
+        const __m256d aex = sub( _mm256_set1_pd( a.x ), ex ), bex = sub( _mm256_set1_pd( b.x ), ex ), cex = sub( _mm256_set1_pd( c.x ), ex ), dex = sub( _mm256_set1_pd( d.x ), ex );
+        const __m256d aey = sub( _mm256_set1_pd( a.y ), ey ), bey = sub( _mm256_set1_pd( b.y ), ey ), cey = sub( _mm256_set1_pd( c.y ), ey ), dey = sub( _mm256_set1_pd( d.y ), ey );
+        const __m256d aez = sub( _mm256_set1_pd( a.z ), ez ), bez = sub( _mm256_set1_pd( b.z ), ez ), cez = sub( _mm256_set1_pd( c.z ), ez ), dez = sub( _mm256_set1_pd( d.z ), ez );
+
+        const __m256d aexbey = mul( aex, bey ), bexaey = mul( bex, aey );
+        const __m256d bexcey = mul( bex, cey ), cexbey = mul( cex, bey );
+        const __m256d cexdey = mul( cex, dey ), dexcey = mul( dex, cey );
+        const __m256d dexaey = mul( dex, aey ), aexdey = mul( aex, dey );
+        const __m256d aexcey = mul( aex, cey ), cexaey = mul( cex, aey );
+        const __m256d bexdey = mul( bex, dey ), dexbey = mul( dex, bey );
+
+        const __m256d ab = sub( aexbey, bexaey );
+        const __m256d bc = sub( bexcey, cexbey );
+        const __m256d cd = sub( cexdey, dexcey );
+        const __m256d da = sub( dexaey, aexdey );
+        const __m256d ac = sub( aexcey, cexaey );
+        const __m256d bd = sub( bexdey, dexbey );
+
+        const __m256d abc = add( sub( mul( aez, bc ), mul( bez, ac ) ), mul( cez, ab ) );
+        const __m256d bcd = add( sub( mul( bez, cd ), mul( cez, bd ) ), mul( dez, bc ) );
+        const __m256d cda = add( add( mul( cez, da ), mul( dez, ac ) ), mul( aez, cd ) );
+        const __m256d dab = add( add( mul( dez, ab ), mul( aez, bd ) ), mul( bez, da ) );
+
+        const __m256d aLift = add( add( mul( aex, aex ), mul( aey, aey ) ), mul( aez, aez ) );
+        const __m256d bLift = add( add( mul( bex, bex ), mul( bey, bey ) ), mul( bez, bez ) );
+        const __m256d cLift = add( add( mul( cex, cex ), mul( cey, cey ) ), mul( cez, cez ) );
+        const __m256d dLift = add( add( mul( dex, dex ), mul( dey, dey ) ), mul( dez, dez ) );
+
+        const __m256d det = add( sub( mul( dLift, abc ), mul( cLift, dab ) ), sub( mul( bLift, cda ), mul( aLift, bcd ) ) );
+
+        const __m256d aezPlus = abs4( aez ), bezPlus = abs4( bez ), cezPlus = abs4( cez ), dezPlus = abs4( dez );
+
+        const __m256d aexbeyPlus = abs4( aexbey ), bexaeyPlus = abs4( bexaey );
+        const __m256d bexceyPlus = abs4( bexcey ), cexbeyPlus = abs4( cexbey );
+        const __m256d cexdeyPlus = abs4( cexdey ), dexceyPlus = abs4( dexcey );
+        const __m256d dexaeyPlus = abs4( dexaey ), aexdeyPlus = abs4( aexdey );
+        const __m256d aexceyPlus = abs4( aexcey ), cexaeyPlus = abs4( cexaey );
+        const __m256d bexdeyPlus = abs4( bexdey ), dexbeyPlus = abs4( dexbey );
+
+        const __m256d pa = mul( add( add( mul( add( cexdeyPlus, dexceyPlus ), bezPlus ), mul( add( dexbeyPlus, bexdeyPlus ), cezPlus ) ), mul( add( bexceyPlus, cexbeyPlus ), dezPlus ) ), aLift );
+        const __m256d pb = mul( add( add( mul( add( dexaeyPlus, aexdeyPlus ), cezPlus ), mul( add( aexceyPlus, cexaeyPlus ), dezPlus ) ), mul( add( cexdeyPlus, dexceyPlus ), aezPlus ) ), bLift );
+        const __m256d pc = mul( add( add( mul( add( aexbeyPlus, bexaeyPlus ), dezPlus ), mul( add( bexdeyPlus, dexbeyPlus ), aezPlus ) ), mul( add( dexaeyPlus, aexdeyPlus ), bezPlus ) ), cLift );
+        const __m256d pd = mul( add( add( mul( add( bexceyPlus, cexbeyPlus ), aezPlus ), mul( add( cexaeyPlus, aexceyPlus ), bezPlus ) ), mul( add( aexbeyPlus, bexaeyPlus ), cezPlus ) ), dLift );
+
+        const __m256d permanent = add( add( add( pa, pb ), pc ), pd );
+
+        resolve4( i, det, abs4( det ), mul( errBoundA, permanent ), results, [&]( std::size_t j ) { return insphere( a, b, c, d, points[j] ); } );
+    }
+#endif
+
+    for ( ; i < count; ++i )
+        results[i] = insphere( a, b, c, d, points[i] );
+}
+
+}  // namespace FastMath::Predicates
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/AnimationCompression.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+// Smooth rotation samples (with some noise) at 30 samples per second.
+static std::vector<QuaternionF> rotationSamples( std::mt19937& rng, std::size_t count )
+{
+    std::uniform_real_distribution<float> noise( -0.0001f, 0.0001f );
+
+    std::vector<QuaternionF> samples;
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const float t = static_cast<float>( i ) / 30.0f;
+        const auto  q = QuaternionF { 1.0f, 0.4f * std::sin( t * 0.5f ) + noise( rng ), 0.3f * std::cos( t * 0.3f ), 0.5f * std::sin( t * 0.2f + 1.0f ) };
+        samples.push_back( normalize( i % 5 == 2 ? q * -1.0f : q ) );
+    }
+
+    return samples;
+}
+
+static std::vector<Vector3f> vectorSamples( std::size_t count )
+{
+    std::vector<Vector3f> samples;
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const float t = static_cast<float>( i ) / 30.0f;
+        samples.push_back( { 2.0f * t, std::sin( t ), i < count / 2 ? 1.0f : -1.0f } );
+    }
+
+    return samples;
+}
+
+TEST( AnimationCompression, Quantize )
+{
+    std::mt19937                          rng( 5 );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    for ( int i = 0; i < 1000; ++i )
+    {
+        const auto q = normalize( QuaternionF { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } );
+        const auto r = dequantize<float>( quantize( q ) );
+
+        EXPECT_NEAR( length( r ), 1.0f, 1e-4f );
+        EXPECT_LT( detail::rotationAngle( q, r ), 2e-4f );
+    }
+
+    // Each axis as the largest component (and negative).
+    for ( int i = 0; i < 4; ++i )
+    {
+        QuaternionF q { 0.1f, 0.1f, 0.1f, 0.1f };
+        q[i]           = -0.9f;
+        q              = normalize( q );
+        const auto r   = dequantize<float>( quantize( q ) );
+        const auto dot = FastMath::dot( q, r );
+        EXPECT_NEAR( std::abs( dot ), 1.0f, 1e-6f );
+    }
+}
+
+TEST( AnimationCompression, RotationTrack )
+{
+    std::mt19937 rng( 11 );
+
+    const auto  samples  = rotationSamples( rng, 300 );
+    const float maxError = 0.002f;
+
+    for ( auto interpolation: { RotationInterpolation::Nlerp, RotationInterpolation::Slerp, RotationInterpolation::FastSlerp } )
+    {
+        for ( bool squad: { false, true } )
+        {
+            const CompressedRotationTrackf track( samples, 30.0f, maxError, interpolation, squad );
+
+            EXPECT_LT( track.size(), samples.size() / 2 );
+            EXPECT_LT( track.getMemorySize(), samples.size() * sizeof( QuaternionF ) / 4 );
+            EXPECT_FLOAT_EQ( track.getEndTime(), 299.0f / 30.0f );
+            EXPECT_EQ( track.getTime( 0 ), 0.0f );
+
+            // The error bound holds at every sample.
+            TrackCursor cursor;
+            for ( std::size_t i = 0; i < samples.size(); ++i )
+            {
+                const float t = static_cast<float>( i ) / 30.0f;
+                const auto  q = track.sample( t, cursor );
+                EXPECT_LT( detail::rotationAngle( normalize( q ), samples[i] ), maxError * 1.01f ) << "sample " << i;
+            }
+
+            // Sampling without a cursor is the same.
+            TrackCursor c;
+            for ( float t = -0.5f; t < 11.0f; t += 0.37f )
+            {
+                const auto a = track.sample( t, c );
+                const auto b = track.sample( t );
+                for ( int k = 0; k < 4; ++k )
+                    EXPECT_NEAR( a[k], b[k], 1e-6f );
+            }
+        }
+    }
+
+    // Squad needs fewer keys for smooth motion.
+    EXPECT_LT( CompressedRotationTrackf( samples, 30.0f, maxError, RotationInterpolation::Slerp, true ).size(),
+               CompressedRotationTrackf( samples, 30.0f, maxError, RotationInterpolation::Slerp, false ).size() );
+
+    // Small error bounds keep more keys.
+    const CompressedRotationTrackf coarse( samples, 30.0f, 0.01f );
+    const CompressedRotationTrackf fine( samples, 30.0f, 0.0005f );
+    EXPECT_LT( coarse.size(), fine.size() );
+
+    // Empty and single sample tracks.
+    const CompressedRotationTrackf empty( std::span<const QuaternionF> {}, 30.0f );
+    EXPECT_TRUE( empty.empty() );
+    EXPECT_EQ( empty.sample( 1.0f ), QuaternionF::IDENTITY );
+
+    const CompressedRotationTrackf single( std::span<const QuaternionF>( samples ).first( 1 ), 30.0f );
+    EXPECT_EQ( single.size(), 1u );
+    EXPECT_LT( detail::rotationAngle( single.sample( 2.0f ), samples[0] ), 1e-3f );
+}
+
+TEST( AnimationCompression, VectorTrack )
+{
+    const auto  samples  = vectorSamples( 300 );
+    const float maxError = 0.005f;
+
+    const CompressedVectorTrackf track( samples, 30.0f, maxError );
+
+    EXPECT_LT( track.size(), samples.size() / 2 );
+    EXPECT_LT( track.getMemorySize(), samples.size() * sizeof( Vector3f ) / 4 );
+    EXPECT_LE( track.getMaxError(), maxError );
+
+    TrackCursor cursor;
+    for ( std::size_t i = 0; i < samples.size(); ++i )
+    {
+        const float t = static_cast<float>( i ) / 30.0f;
+        EXPECT_LT( length( track.sample( t, cursor ) - samples[i] ), maxError * 1.01f ) << "sample " << i;
+    }
+
+    // A constant track only needs the end points.
+    const std::vector<Vector3f>  constant( 100, Vector3f { 1.0f, 2.0f, 3.0f } );
+    const CompressedVectorTrackf c( constant, 30.0f, maxError );
+    EXPECT_EQ( c.size(), 2u );
+    EXPECT_EQ( c.sample( 1.0f ), ( Vector3f { 1.0f, 2.0f, 3.0f } ) );
+    EXPECT_EQ( c.getBitsPerComponent(), 16u );
+}
+
+TEST( AnimationCompression, VectorTrackLargeRange )
+{
+    // The 16-bit quantization step of the range (2000 / 65535) is larger than the error bound.
+    std::vector<Vector3f> samples;
+    for ( std::size_t i = 0; i < 200; ++i )
+    {
+        const float t = static_cast<float>( i ) / 30.0f;
+        samples.push_back( { 1000.0f * std::sin( t * 1.5f ), std::sin( t ), 0.0f } );
+    }
+
+    const float                  maxError = 0.001f;
+    const CompressedVectorTrackf track( samples, 30.0f, maxError );
+
+    EXPECT_EQ( track.getBitsPerComponent(), 32u );
+    EXPECT_LE( track.getMaxError(), maxError );
+
+    // The error bound holds at every sample, including the keys.
+    TrackCursor cursor;
+    for ( std::size_t i = 0; i < samples.size(); ++i )
+    {
+        const float t = static_cast<float>( i ) / 30.0f;
+        EXPECT_LE( length( track.sample( t, cursor ) - samples[i] ), maxError ) << "sample " << i;
+    }
+}
+
+TEST( AnimationCompression, RotationTrackQuantizationError )
+{
+    std::mt19937 rng( 29 );
+
+    // The error bound is smaller than the quantization error, so it cannot be met at every key.
+    const auto                     samples = rotationSamples( rng, 100 );
+    const CompressedRotationTrackf track( samples, 30.0f, 1e-6f );
+
+    float worst = 0.0f;
+    for ( std::size_t i = 0; i < samples.size(); ++i )
+        worst = std::max( worst, detail::rotationAngle( normalize( track.sample( static_cast<float>( i ) / 30.0f ) ), samples[i] ) );
+
+    EXPECT_GT( track.getMaxError(), 1e-6f );
+    EXPECT_NEAR( track.getMaxError(), worst, 1e-6f );
+}
+
+TEST( AnimationCompression, BatchSample )
+{
+    std::mt19937 rng( 17 );
+
+    std::vector<CompressedRotationTrackf> rotations;
+    std::vector<CompressedVectorTrackf>   vectors;
+    for ( std::size_t i = 0; i < 21; ++i )
+    {
+        // Mix interpolation methods in some blocks of 8 tracks.
+        const auto interpolation = i < 8 ? RotationInterpolation::Slerp : static_cast<RotationInterpolation>( i % 3 );
+        rotations.emplace_back( rotationSamples( rng, 100 + i * 7 ), 30.0f, 0.002f, interpolation, i == 19 );
+        vectors.emplace_back( vectorSamples( 100 + i * 5 ), 30.0f, 0.001f );
+    }
+
+    std::vector<TrackCursor> rotationCursors( rotations.size() ), vectorCursors( vectors.size() );
+    std::vector<TrackCursor> scalarCursors( rotations.size() );
+    std::vector<QuaternionF> q( rotations.size() );
+    std::vector<Vector3f>    v( vectors.size() );
+
+    for ( float t = 0.0f; t < 6.0f; t += 0.09f )
+    {
+        sample<float>( rotations, t, rotationCursors, q );
+        sample<float, 3>( vectors, t, vectorCursors, v );
+
+        for ( std::size_t i = 0; i < rotations.size(); ++i )
+        {
+            const auto expected = rotations[i].sample( t, scalarCursors[i] );
+            for ( int k = 0; k < 4; ++k )
+                EXPECT_NEAR( q[i][k], expected[k], 1e-5f ) << "track " << i << " time " << t;
+
+            EXPECT_EQ( rotationCursors[i].key, scalarCursors[i].key );
+
+            const auto e = vectors[i].sample( t );
+            for ( int k = 0; k < 3; ++k )
+                EXPECT_NEAR( v[i][k], e[k], 1e-5f );
+        }
+    }
+}
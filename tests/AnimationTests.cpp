@@ -0,0 +1,381 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Animation.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+// Create a track with `count` keys at random (increasing) times, where consecutive keys
+// are no more than 90 degrees apart.
+static RotationTrackf randomTrack( std::mt19937& rng, std::size_t count )
+{
+    std::uniform_real_distribution<float> dt( 0.01f, 0.1f );
+    std::uniform_real_distribution<float> dist( -0.5f, 0.5f );
+
+    std::vector<float>       times;
+    std::vector<QuaternionF> keys;
+
+    float       t = dt( rng );
+    QuaternionF q = randomRotation( rng );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        times.push_back( t );
+        keys.push_back( q );
+
+        t += dt( rng );
+        q = normalize( q * QuaternionF { 1.0f, dist( rng ), dist( rng ), dist( rng ) } );
+        // Occasionally flip the sign of a key to test the shortest path.
+        if ( i % 7 == 3 )
+            q = q * -1.0f;
+    }
+
+    return { times, keys };
+}
+
+TEST( Animation, Nlerp )
+{
+    const QuaternionF q0 = normalize( QuaternionF { 1.0f, 0.1f, 0.2f, 0.3f } );
+    const QuaternionF q1 = normalize( QuaternionF { 0.8f, -0.3f, 0.1f, 0.2f } );
+
+    expectNear( nlerp( q0, q1, 0.0f ), q0, 1e-6f );
+    expectNear( nlerp( q0, q1, 1.0f ), q1, 1e-6f );
+    EXPECT_TRUE( isNormalized( nlerp( q0, q1, 0.3f ), 1e-5f ) );
+
+    // Shortest path.
+    expectNear( nlerp( q0, q1 * -1.0f, 1.0f ), q1, 1e-6f );
+    expectNear( nlerp( q0, q1 * -1.0f, 0.5f ), nlerp( q0, q1, 0.5f ), 1e-6f );
+}
+
+TEST( Animation, FindKey )
+{
+    std::mt19937 rng( 1 );
+
+    const RotationTrackf         track = randomTrack( rng, 100 );
+    const std::span<const float> times = track.getTimes();
+
+    auto check = [&]( float time, std::size_t i, float u ) {
+        if ( time <= times.front() )
+        {
+            EXPECT_EQ( i, 0u );
+            EXPECT_EQ( u, 0.0f );
+        }
+        else if ( time >= times.back() )
+        {
+            EXPECT_EQ( i, times.size() - 2 );
+            EXPECT_EQ( u, 1.0f );
+        }
+        else
+        {
+            EXPECT_LE( times[i], time );
+            EXPECT_LT( time, times[i + 1] );
+            EXPECT_NEAR( times[i] + u * ( times[i + 1] - times[i] ), time, 1e-5f );
+        }
+    };
+
+    // Forward playback at different rates (including skipping many keys per frame).
+    for ( float dt: { 0.001f, 0.016f, 0.1f, 0.5f } )
+    {
+        TrackCursor cursor;
+        for ( float time = 0.0f; time < track.getEndTime() + 0.5f; time += dt )
+        {
+            float             u;
+            const std::size_t i = track.findKey( time, cursor, u );
+            check( time, i, u );
+            EXPECT_EQ( cursor.key, i );
+        }
+    }
+
+    // Random access.
+    std::uniform_real_distribution<float> dist( -1.0f, track.getEndTime() + 1.0f );
+    TrackCursor                           cursor;
+    for ( int n = 0; n < 1000; ++n )
+    {
+        const float time = dist( rng );
+
+        float             u;
+        const std::size_t i = track.findKey( time, cursor, u );
+        check( time, i, u );
+    }
+
+    // Exactly at the keys.
+    for ( std::size_t i = 0; i < times.size(); ++i )
+    {
+        float             u;
+        const std::size_t k = track.findKey( times[i], cursor, u );
+        check( times[i], k, u );
+        expectNear( track.sample( times[i], cursor ), track.getKey( i ), 1e-5f );
+    }
+}
+
+TEST( Animation, RotationTrack )
+{
+    std::mt19937 rng( 2 );
+
+    // Empty and single key tracks.
+    RotationTrackf track;
+    EXPECT_TRUE( track.empty() );
+    EXPECT_EQ( track.sample( 1.0f ), QuaternionF::IDENTITY );
+
+    const float       t0 = 1.0f;
+    const QuaternionF q0 = randomRotation( rng );
+    track.setKeys( std::span { &t0, 1 }, std::span { &q0, 1 } );
+    expectNear( track.sample( 0.0f ), q0, 1e-6f );
+    expectNear( track.sample( 2.0f ), q0, 1e-6f );
+
+    track = randomTrack( rng, 50 );
+    EXPECT_EQ( track.size(), 50u );
+
+    // Clamped to the first and last keys.
+    expectNear( track.sample( track.getStartTime() - 1.0f ), track.getKey( 0 ), 1e-6f );
+    expectNear( track.sample( track.getEndTime() + 1.0f ), track.getKey( 49 ), 1e-6f );
+
+    // Sampling with a cursor matches sampling without a cursor.
+    TrackCursor cursor;
+    for ( float time = 0.0f; time < track.getEndTime(); time += 0.0123f )
+    {
+        for ( RotationInterpolation interpolation: { RotationInterpolation::Nlerp, RotationInterpolation::Slerp, RotationInterpolation::FastSlerp } )
+        {
+            TrackCursor c = cursor;
+            EXPECT_EQ( track.sample( time, c, interpolation ), track.sample( time, interpolation ) );
+        }
+
+        // The result is on the shortest arc between the keys.
+        float             u;
+        const std::size_t i = track.findKey( time, cursor, u );
+        const QuaternionF q = track.sample( time, cursor );
+        const QuaternionF a = track.getKey( i );
+        const QuaternionF b = track.getKey( i + 1 );
+        EXPECT_TRUE( isNormalized( q, 1e-4f ) );
+        EXPECT_GE( std::abs( dot( q, a ) ), std::abs( dot( a, b ) ) - 1e-5f );
+        EXPECT_GE( std::abs( dot( q, b ) ), std::abs( dot( a, b ) ) - 1e-5f );
+    }
+}
+
+TEST( Animation, AntipodalKeys )
+{
+    // Consecutive keys that are the same rotation with opposite signs.
+    const QuaternionF        q = normalize( QuaternionF { 0.3f, -0.5f, 0.1f, 0.8f } );
+    const std::vector<float> times { 0.0f, 1.0f, 2.0f };
+    const RotationTrackf     track { times, std::vector<QuaternionF> { q, q * -1.0f, q } };
+
+    const std::vector<RotationTrackf> tracks( 9, track );
+    std::vector<TrackCursor>          cursors( tracks.size() );
+    std::vector<QuaternionF>          batch( tracks.size() );
+
+    for ( RotationInterpolation interpolation: { RotationInterpolation::Nlerp, RotationInterpolation::Slerp, RotationInterpolation::FastSlerp } )
+    {
+        for ( float time: { 0.25f, 0.5f, 1.0f, 1.75f } )
+        {
+            // The sampled rotation does not move (it is q up to the sign).
+            const QuaternionF s = track.sample( time, interpolation );
+            ASSERT_NEAR( std::abs( dot( s, q ) ), 1.0f, 1e-5f );
+
+            // The scalar and SIMD paths agree.
+            sample( std::span<const RotationTrackf> { tracks }, time, std::span { cursors }, std::span { batch }, interpolation );
+            for ( const auto& b: batch )
+                expectNear( b, s, 1e-5f );
+        }
+    }
+}
+
+TEST( Animation, VectorTrack )
+{
+    const std::vector<float>    times { 0.0f, 1.0f, 1.0f, 3.0f };
+    const std::vector<Vector3f> keys { { 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 3.0f }, { 5.0f, 5.0f, 5.0f }, { 1.0f, 1.0f, 1.0f } };
+
+    const VectorTrackf track { times, keys };
+    EXPECT_EQ( track.getStartTime(), 0.0f );
+    EXPECT_EQ( track.getEndTime(), 3.0f );
+
+    TrackCursor cursor;
+    EXPECT_EQ( track.sample( -1.0f, cursor ), keys[0] );
+    EXPECT_EQ( track.sample( 0.5f, cursor ), ( Vector3f { 0.5f, 1.0f, 1.5f } ) );
+    // A duplicated key time is a discontinuity.
+    EXPECT_EQ( track.sample( 1.0f, cursor ), keys[2] );
+    EXPECT_EQ( track.sample( 2.0f, cursor ), ( Vector3f { 3.0f, 3.0f, 3.0f } ) );
+    EXPECT_EQ( track.sample( 4.0f, cursor ), keys[3] );
+    EXPECT_EQ( track.sample( 0.5f ), ( Vector3f { 0.5f, 1.0f, 1.5f } ) );
+}
+
+TEST( Animation, BatchSample )
+{
+    std::mt19937 rng( 3 );
+
+    // Not a multiple of the SIMD width to exercise the scalar tail.
+    std::vector<RotationTrackf> rotations;
+    std::vector<VectorTrackf>   translations;
+    for ( std::size_t i = 0; i < 37; ++i )
+    {
+        rotations.push_back( randomTrack( rng, 1 + i * 3 % 40 ) );
+
+        std::vector<Vector3f> keys;
+        for ( float t: rotations.back().getTimes() )
+            keys.push_back( Vector3f { t, 2.0f * t, std::sin( t ) } );
+        translations.emplace_back( rotations.back().getTimes(), keys );
+    }
+    // An empty track.
+    rotations[5]    = RotationTrackf {};
+    translations[5] = VectorTrackf {};
+
+    std::vector<TrackCursor> cursors( rotations.size() );
+    std::vector<TrackCursor> vectorCursors( rotations.size() );
+    std::vector<QuaternionF> q( rotations.size() );
+    std::vector<Vector3f>    v( rotations.size() );
+
+    for ( RotationInterpolation interpolation: { RotationInterpolation::Nlerp, RotationInterpolation::Slerp, RotationInterpolation::FastSlerp } )
+    {
+        for ( float time = 0.0f; time < 4.5f; time += 1.0f / 60.0f )
+        {
+            sample( std::span<const RotationTrackf> { rotations }, time, std::span { cursors }, std::span { q }, interpolation );
+            sample( std::span<const VectorTrackf> { translations }, time, std::span { vectorCursors }, std::span { v } );
+
+            for ( std::size_t i = 0; i < rotations.size(); ++i )
+            {
+                const QuaternionF expected = rotations[i].sample( time, interpolation );
+                ASSERT_NEAR( q[i].w, expected.w, 1e-5f );
+                ASSERT_NEAR( q[i].x, expected.x, 1e-5f );
+                ASSERT_NEAR( q[i].y, expected.y, 1e-5f );
+                ASSERT_NEAR( q[i].z, expected.z, 1e-5f );
+
+                const Vector3f e = translations[i].sample( time );
+                ASSERT_NEAR( v[i].x, e.x, 1e-5f );
+                ASSERT_NEAR( v[i].y, e.y, 1e-5f );
+                ASSERT_NEAR( v[i].z, e.z, 1e-5f );
+            }
+        }
+    }
+}
+
+TEST( Animation, BatchInterpolate )
+{
+    std::mt19937                          rng( 5 );
+    std::uniform_real_distribution<float> dist( 0.0f, 1.0f );
+
+    std::vector<QuaternionF> q0, q1, q( 1003 );
+    std::vector<float>       t;
+    for ( std::size_t i = 0; i < q.size(); ++i )
+    {
+        q0.push_back( randomRotation( rng ) );
+        // Include identical and antipodal pairs.
+        q1.push_back( i % 10 == 0 ? q0.back() : i % 10 == 5 ? q0.back() * -1.0f : randomRotation( rng ) );
+        t.push_back( dist( rng ) );
+    }
+
+    for ( RotationInterpolation interpolation: { RotationInterpolation::Nlerp, RotationInterpolation::Slerp, RotationInterpolation::FastSlerp } )
+    {
+        interpolate( std::span<const QuaternionF> { q0 }, std::span<const QuaternionF> { q1 }, std::span<const float> { t }, std::span { q }, interpolation );
+
+        for ( std::size_t i = 0; i < q.size(); ++i )
+        {
+            const QuaternionF expected = interpolation == RotationInterpolation::Nlerp ? nlerp( q0[i], q1[i], t[i] )
+                                         : interpolation == RotationInterpolation::Slerp ? slerp( q0[i], q1[i], t[i] )
+                                                                                         : fastSlerp( q0[i], q1[i], t[i] );
+            ASSERT_NEAR( q[i].w, expected.w, 1e-5f );
+            ASSERT_NEAR( q[i].x, expected.x, 1e-5f );
+            ASSERT_NEAR( q[i].y, expected.y, 1e-5f );
+            ASSERT_NEAR( q[i].z, expected.z, 1e-5f );
+
+            // The fast slerp is close to slerp (but not normalized).
+            if ( interpolation == RotationInterpolation::FastSlerp )
+            {
+                ASSERT_NEAR( std::abs( dot( q[i], slerp( q0[i], q1[i], t[i] ) ) ), 1.0f, 5e-5f );
+            }
+        }
+    }
+}
+
+TEST( Animation, SquadSpline )
+{
+    std::mt19937 rng( 4 );
+
+    const RotationTrackf     track = randomTrack( rng, 20 );
+    std::vector<QuaternionF> keys;
+    for ( std::size_t i = 0; i < track.size(); ++i )
+        keys.push_back( track.getKey( i ) );
+
+    const SquadSplinef spline { track.getTimes(), keys };
+    EXPECT_EQ( spline.size(), keys.size() );
+
+    // Reference: squad with the control points computed from scratch.
+    std::vector<QuaternionF> q = keys;
+    for ( std::size_t i = 1; i < q.size(); ++i )
+    {
+        if ( dot( q[i - 1], q[i] ) < 0.0f )
+            q[i] = q[i] * -1.0f;
+    }
+
+    auto reference = [&]( float time ) {
+        TrackCursor       cursor;
+        float             u;
+        const std::size_t i  = track.findKey( time, cursor, u );
+        const QuaternionF s0 = intermediate( q[i > 0 ? i - 1 : i], q[i], q[i + 1] );
+        const QuaternionF s1 = intermediate( q[i], q[i + 1], q[i + 2 < q.size() ? i + 2 : i + 1] );
+        return squad( q[i], q[i + 1], s0, s1, u );
+    };
+
+    // Compare two quaternions that represent the same rotation.
+    auto expectSameRotation = [&]( const QuaternionF& a, QuaternionF b, float epsilon ) {
+        if ( dot( a, b ) < 0.0f )
+            b = b * -1.0f;
+        expectNear( a, b, epsilon );
+    };
+
+    const std::span<const float> times = spline.getTimes();
+
+    // Interpolates the keys.
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+        expectSameRotation( spline.evaluate( times[i] ), keys[i], 1e-5f );
+
+    // Clamped to the end points.
+    expectSameRotation( spline.evaluate( times.front() - 1.0f ), keys.front(), 1e-5f );
+    expectSameRotation( spline.evaluate( times.back() + 1.0f ), keys.back(), 1e-5f );
+
+    std::vector<float> sampleTimes;
+    for ( float time = times.front() - 0.1f; time < times.back() + 0.1f; time += 0.0037f )
+        sampleTimes.push_back( time );
+
+    std::vector<QuaternionF> results( sampleTimes.size() );
+    spline.evaluate( std::span<const float> { sampleTimes }, std::span { results } );
+
+    TrackCursor cursor;
+    for ( std::size_t i = 0; i < sampleTimes.size(); ++i )
+    {
+        const QuaternionF expected = reference( sampleTimes[i] );
+        const QuaternionF actual   = spline.evaluate( sampleTimes[i], cursor );
+
+        ASSERT_TRUE( isNormalized( actual, 1e-5f ) );
+        expectSameRotation( actual, expected, 1e-5f );
+        // Batch evaluation.
+        expectSameRotation( results[i], actual, 1e-5f );
+    }
+
+    // The spline is smooth at the keys: the left and right derivatives (with respect to the
+    // segment parameter) are equal.
+    std::vector<double>      timesD( times.begin(), times.end() );
+    std::vector<QuaternionD> keysD( keys.begin(), keys.end() );
+    const SquadSplined       splineD { timesD, keysD };
+    for ( std::size_t i = 1; i + 1 < timesD.size(); ++i )
+    {
+        const double h = 1e-7;
+
+        const QuaternionD a = splineD.evaluate( timesD[i] - h );
+        const QuaternionD b = splineD.evaluate( timesD[i] );
+        const QuaternionD c = splineD.evaluate( timesD[i] + h );
+
+        const QuaternionD d0 = ( b - a ) * ( ( timesD[i] - timesD[i - 1] ) / h );
+        const QuaternionD d1 = ( c - b ) * ( ( timesD[i + 1] - timesD[i] ) / h );
+        EXPECT_NEAR( d0.w, d1.w, 1e-4 );
+        EXPECT_NEAR( d0.x, d1.x, 1e-4 );
+        EXPECT_NEAR( d0.y, d1.y, 1e-4 );
+        EXPECT_NEAR( d0.z, d1.z, 1e-4 );
+    }
+
+    // Empty and single key splines.
+    EXPECT_EQ( SquadSplinef {}.evaluate( 1.0f ), QuaternionF::IDENTITY );
+    const SquadSplinef single { std::span { &times[0], 1 }, std::span { &keys[0], 1 } };
+    expectSameRotation( single.evaluate( 5.0f ), keys[0], 1e-6f );
+}
@@ -0,0 +1,285 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/BVH.hpp>
+
+#include <atomic>
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+// Generate a soup of small random triangles.
+static void randomTriangles( std::size_t count, std::vector<Vector3f>& vertices, std::vector<uint32_t>& indices, unsigned seed = 42 )
+{
+    std::mt19937                          rng( seed );
+    std::uniform_real_distribution<float> pos( -10.0f, 10.0f );
+    std::uniform_real_distribution<float> offset( -0.5f, 0.5f );
+
+    vertices.clear();
+    indices.clear();
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const Vector3f c { pos( rng ), pos( rng ), pos( rng ) };
+        for ( int j = 0; j < 3; ++j )
+        {
+            indices.push_back( static_cast<uint32_t>( vertices.size() ) );
+            vertices.push_back( c + Vector3f { offset( rng ), offset( rng ), offset( rng ) } );
+        }
+    }
+}
+
+TEST( ThreadPool, ParallelFor )
+{
+    ThreadPool pool( 3 );
+
+    std::vector<int> values( 10000, 0 );
+    pool.parallelFor( 0, values.size(), 100, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+            values[i] += static_cast<int>( i );
+    } );
+
+    for ( std::size_t i = 0; i < values.size(); ++i )
+        ASSERT_EQ( values[i], static_cast<int>( i ) );
+}
+
+TEST( ThreadPool, Nested )
+{
+    ThreadPool pool( 2 );
+
+    std::atomic<int> count { 0 };
+    pool.parallelFor( 0, 8, 1, [&]( std::size_t, std::size_t ) {
+        pool.parallelFor( 0, 8, 1, [&]( std::size_t, std::size_t ) {
+            ++count;
+        } );
+    } );
+
+    ASSERT_EQ( count.load(), 64 );
+}
+
+TEST( ThreadPool, NoWorkers )
+{
+    ThreadPool pool( 0 );
+
+    int sum = 0;
+    pool.parallelFor( 0, 100, 7, [&]( std::size_t b, std::size_t e ) {
+        for ( std::size_t i = b; i < e; ++i )
+            sum += static_cast<int>( i );
+    } );
+
+    ASSERT_EQ( sum, 4950 );
+}
+
+TEST( BVH, Empty )
+{
+    BVHf bvh;
+    ASSERT_TRUE( bvh.empty() );
+
+    float t = 100.0f;
+    ASSERT_FALSE( bvh.raycast( Rayf {}, t, []( uint32_t, float& ) { return true; } ) );
+
+    bvh.build( {} );
+    ASSERT_TRUE( bvh.empty() );
+}
+
+TEST( BVH, Structure )
+{
+    std::vector<Vector3f> vertices;
+    std::vector<uint32_t> indices;
+    randomTriangles( 5000, vertices, indices );
+
+    const auto bounds = triangleBounds<float>( vertices, indices );
+    BVHf       bvh( bounds, 4 );
+
+    ASSERT_EQ( sizeof( BVHf::Node ), 32u );
+
+    // Every primitive is referenced exactly once, and every leaf contains its primitives.
+    std::vector<int> refs( bounds.size(), 0 );
+    const auto       nodes = bvh.getNodes();
+    for ( std::size_t i = 0; i < nodes.size(); ++i )
+    {
+        const auto& node = nodes[i];
+        if ( node.isLeaf() )
+        {
+            ASSERT_LE( node.count, 4u );
+            for ( uint32_t j = 0; j < node.count; ++j )
+            {
+                const uint32_t prim = bvh.getIndices()[node.offset + j];
+                ++refs[prim];
+                ASSERT_EQ( merge( node.bounds, bounds[prim] ), node.bounds );
+            }
+        }
+        else
+        {
+            // Depth-first layout.
+            ASSERT_GT( node.offset, i + 1 );
+            ASSERT_EQ( merge( nodes[i + 1].bounds, nodes[node.offset].bounds ), node.bounds );
+        }
+    }
+
+    for ( int r: refs )
+        ASSERT_EQ( r, 1 );
+}
+
+TEST( BVH, Deterministic )
+{
+    std::vector<Vector3f> vertices;
+    std::vector<uint32_t> indices;
+    randomTriangles( 20000, vertices, indices );
+
+    const auto bounds = triangleBounds<float>( vertices, indices );
+
+    ThreadPool serial( 0 );
+    ThreadPool parallel( 4 );
+    BVHf       a( bounds, 4, serial );
+    BVHf       b( bounds, 4, parallel );
+
+    ASSERT_EQ( a.getNodes().size(), b.getNodes().size() );
+    for ( std::size_t i = 0; i < a.getNodes().size(); ++i )
+    {
+        ASSERT_EQ( a.getNodes()[i].bounds, b.getNodes()[i].bounds );
+        ASSERT_EQ( a.getNodes()[i].offset, b.getNodes()[i].offset );
+        ASSERT_EQ( a.getNodes()[i].count, b.getNodes()[i].count );
+    }
+
+    ASSERT_TRUE( std::equal( a.getIndices().begin(), a.getIndices().end(), b.getIndices().begin() ) );
+}
+
+TEST( BVH, Raycast )
+{
+    std::vector<Vector3f> vertices;
+    std::vector<uint32_t> indices;
+    randomTriangles( 2000, vertices, indices );
+
+    BVHf bvh( triangleBounds<float>( vertices, indices ) );
+
+    std::mt19937                          rng( 7 );
+    std::uniform_real_distribution<float> pos( -12.0f, 12.0f );
+
+    int hits = 0;
+    for ( int i = 0; i < 200; ++i )
+    {
+        const Rayf r { { pos( rng ), pos( rng ), -20.0f }, normalize( Vector3f { pos( rng ), pos( rng ), 20.0f } ) };
+
+        // Brute force.
+        uint32_t expectedPrim = BVHf::INVALID_INDEX;
+        float    expectedT    = std::numeric_limits<float>::max();
+        for ( uint32_t j = 0; j < indices.size() / 3; ++j )
+        {
+            float t;
+            if ( intersects( r, vertices[indices[j * 3]], vertices[indices[j * 3 + 1]], vertices[indices[j * 3 + 2]], t, expectedT ) )
+            {
+                expectedT    = t;
+                expectedPrim = j;
+            }
+        }
+
+        RayHit<float> hit;
+        const bool    found = intersects( bvh, vertices, indices, r, hit );
+
+        ASSERT_EQ( found, expectedPrim != BVHf::INVALID_INDEX );
+        if ( found )
+        {
+            ASSERT_EQ( hit.primitive, expectedPrim );
+            ASSERT_FLOAT_EQ( hit.t, expectedT );
+            ++hits;
+        }
+    }
+
+    ASSERT_GT( hits, 0 );
+}
+
+TEST( BVH, Query )
+{
+    std::vector<Vector3f> vertices;
+    std::vector<uint32_t> indices;
+    randomTriangles( 2000, vertices, indices );
+
+    const auto bounds = triangleBounds<float>( vertices, indices );
+    BVHf       bvh( bounds );
+
+    const AABBf box { { -2.0f, -2.0f, -2.0f }, { 3.0f, 1.0f, 2.0f } };
+
+    std::vector<uint32_t> found;
+    bvh.query( box, [&]( uint32_t prim ) {
+        if ( intersects( bounds[prim], box ) )
+            found.push_back( prim );
+    } );
+    std::sort( found.begin(), found.end() );
+
+    std::vector<uint32_t> expected;
+    for ( uint32_t i = 0; i < bounds.size(); ++i )
+    {
+        if ( intersects( bounds[i], box ) )
+            expected.push_back( i );
+    }
+
+    ASSERT_FALSE( expected.empty() );
+    ASSERT_EQ( found, expected );
+}
+
+TEST( BVH, ClosestPoint )
+{
+    std::vector<Vector3f> vertices;
+    std::vector<uint32_t> indices;
+    randomTriangles( 2000, vertices, indices );
+
+    BVHf bvh( triangleBounds<float>( vertices, indices ) );
+
+    std::mt19937                          rng( 11 );
+    std::uniform_real_distribution<float> pos( -15.0f, 15.0f );
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        const Vector3f p { pos( rng ), pos( rng ), pos( rng ) };
+
+        float expected = std::numeric_limits<float>::max();
+        for ( uint32_t j = 0; j < indices.size() / 3; ++j )
+        {
+            const Vector3f q = closestPoint( p, vertices[indices[j * 3]], vertices[indices[j * 3 + 1]], vertices[indices[j * 3 + 2]] );
+            expected         = std::min( expected, length( q - p ) );
+        }
+
+        Vector3f       q;
+        const uint32_t prim = closestPoint( bvh, vertices, indices, p, q );
+
+        ASSERT_NE( prim, BVHf::INVALID_INDEX );
+        ASSERT_NEAR( length( q - p ), expected, 1e-4f );
+    }
+}
+
+TEST( BVH, Refit )
+{
+    std::vector<Vector3f> vertices;
+    std::vector<uint32_t> indices;
+    randomTriangles( 1000, vertices, indices );
+
+    BVHf bvh( triangleBounds<float>( vertices, indices ) );
+
+    for ( auto& v: vertices )
+        v = v * 2.0f + Vector3f { 1.0f, 0.0f, 0.0f };
+
+    const auto bounds = triangleBounds<float>( vertices, indices );
+    bvh.refit( bounds );
+
+    AABBf all;
+    for ( const auto& b: bounds )
+        all = merge( all, b );
+
+    ASSERT_EQ( bvh.getBounds(), all );
+
+    // Queries still return the correct results after refitting.
+    const Rayf    r { { 1.0f, 0.0f, -50.0f }, { 0.0f, 0.0f, 1.0f } };
+    RayHit<float> hit;
+    float         expectedT = std::numeric_limits<float>::max();
+    for ( uint32_t j = 0; j < indices.size() / 3; ++j )
+    {
+        float t;
+        if ( intersects( r, vertices[indices[j * 3]], vertices[indices[j * 3 + 1]], vertices[indices[j * 3 + 2]], t, expectedT ) )
+            expectedT = t;
+    }
+
+    if ( intersects( bvh, vertices, indices, r, hit ) )
+        ASSERT_FLOAT_EQ( hit.t, expectedT );
+    else
+        ASSERT_EQ( expectedT, std::numeric_limits<float>::max() );
+}
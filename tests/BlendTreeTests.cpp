@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/BlendTree.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+// A pose with rotations close to a reference pose (on random hemispheres), and random translations and scales.
+static Posef randomPose( std::mt19937& rng, std::size_t boneCount )
+{
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    Posef pose( boneCount );
+    for ( std::size_t b = 0; b < boneCount; ++b )
+    {
+        const float       angle    = static_cast<float>( b ) * 0.1f;
+        const QuaternionF rotation = normalize( QuaternionF { std::cos( angle ), std::sin( angle ), 0.3f, 0.0f } + QuaternionF { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } * 0.3f );
+
+        pose.setRotation( b, dist( rng ) < 0.0f ? rotation * -1.0f : rotation );
+        pose.setTranslation( b, { dist( rng ), dist( rng ), dist( rng ) } );
+        pose.setScale( b, Vector3f { 1.0f } + Vector3f { dist( rng ), dist( rng ), dist( rng ) } * 0.5f );
+    }
+
+    return pose;
+}
+
+TEST( BlendTree, PoseWeights )
+{
+    BlendTreef tree;
+
+    const uint32_t a = tree.addPose( 0 );
+    const uint32_t b = tree.addPose( 1 );
+    const uint32_t c = tree.addPose( 2 );
+    const uint32_t d = tree.addPose( 0 );
+
+    const uint32_t ab   = tree.addBlend( std::vector<uint32_t> { a, b }, std::vector<float> { 1.0f, 3.0f } );
+    const uint32_t abc  = tree.addBlend( std::vector<uint32_t> { ab, c } );
+    const uint32_t root = tree.addBlend( std::vector<uint32_t> { abc, d }, std::vector<float> { 0.6f, 0.4f } );
+
+    EXPECT_EQ( tree.size(), 7u );
+    EXPECT_EQ( root, 6u );
+    EXPECT_EQ( tree.getPoseCount(), 3u );
+
+    std::vector<float> weights( 4, 1.0f ), nodeWeights( tree.size() );
+    tree.getPoseWeights( weights, nodeWeights );
+    EXPECT_FLOAT_EQ( weights[0], 0.6f * 0.5f * 0.25f + 0.4f );
+    EXPECT_FLOAT_EQ( weights[1], 0.6f * 0.5f * 0.75f );
+    EXPECT_FLOAT_EQ( weights[2], 0.6f * 0.5f );
+    EXPECT_EQ( weights[3], 0.0f );
+
+    // Changing the blend parameters.
+    tree.setWeights( root, std::vector<float> { 1.0f, 0.0f } );
+    tree.setWeight( ab, 1, 0.0f );
+    tree.getPoseWeights( weights, nodeWeights );
+    EXPECT_FLOAT_EQ( weights[0], 0.5f );
+    EXPECT_FLOAT_EQ( weights[1], 0.0f );
+    EXPECT_FLOAT_EQ( weights[2], 0.5f );
+
+    // Nodes without any weight are ignored.
+    tree.setWeights( root, std::vector<float> { 0.0f, 0.0f } );
+    tree.getPoseWeights( weights, nodeWeights );
+    EXPECT_EQ( weights[0] + weights[1] + weights[2], 0.0f );
+}
+
+TEST( BlendTree, BlendPoses )
+{
+    std::mt19937 rng( 5 );
+
+    // Includes a partial block of 8 bones.
+    const std::size_t  boneCount = 37;
+    std::vector<Posef> poses;
+    for ( int i = 0; i < 5; ++i )
+        poses.push_back( randomPose( rng, boneCount ) );
+
+    const std::vector<float> weights = { 0.5f, 0.0f, 2.0f, 1.0f, 0.5f };
+
+    Posef result;
+    blendPoses<float>( poses, weights, result );
+    ASSERT_EQ( result.size(), boneCount );
+
+    for ( std::size_t b = 0; b < boneCount; ++b )
+    {
+        QuaternionAccumulator<float> rotation;
+        Vector3f                     translation { 0.0f }, scale { 0.0f };
+        for ( std::size_t i = 0; i < poses.size(); ++i )
+        {
+            if ( weights[i] == 0.0f )
+                continue;
+
+            rotation.add( poses[i].getRotation( b ), weights[i] / 4.0f );
+            translation += poses[i].getTranslation( b ) * ( weights[i] / 4.0f );
+            scale += poses[i].getScale( b ) * ( weights[i] / 4.0f );
+        }
+
+        const QuaternionF expected = rotation.getAverage();
+        const QuaternionF q        = result.getRotation( b );
+        for ( int k = 0; k < 4; ++k )
+            EXPECT_NEAR( q[k], expected[k], 1e-5f ) << "bone " << b;
+
+        expectNear( result.getTranslation( b ), translation, 1e-5f );
+        expectNear( result.getScale( b ), scale, 1e-5f );
+
+        // The nlerp average is close to Markley's average for nearby rotations.
+        std::vector<QuaternionF> rotations;
+        std::vector<float>       w;
+        for ( std::size_t i = 0; i < poses.size(); ++i )
+        {
+            rotations.push_back( poses[i].getRotation( b ) );
+            w.push_back( weights[i] );
+        }
+        EXPECT_GT( std::abs( dot( q, averageMarkley<float>( rotations, w ) ) ), 0.999f );
+    }
+
+    // No contribution gives the identity pose.
+    blendPoses<float>( poses, std::vector<float>( poses.size(), 0.0f ), result );
+    for ( std::size_t b = 0; b < boneCount; ++b )
+    {
+        EXPECT_EQ( result.getRotation( b ), QuaternionF::IDENTITY );
+        EXPECT_EQ( result.getTranslation( b ), Vector3f { 0.0f } );
+        EXPECT_EQ( result.getScale( b ), Vector3f { 1.0f } );
+    }
+}
+
+TEST( BlendTree, Evaluate )
+{
+    std::mt19937 rng( 7 );
+
+    const std::size_t  boneCount = 21;
+    std::vector<Posef> poses;
+    for ( int i = 0; i < 4; ++i )
+        poses.push_back( randomPose( rng, boneCount ) );
+
+    // A 1D blend between a locomotion cycle (a 2D blend of 3 clips) and an idle pose.
+    BlendTreef     tree;
+    const uint32_t walk = tree.addBlend( std::vector<uint32_t> { tree.addPose( 0 ), tree.addPose( 1 ), tree.addPose( 2 ) },
+                                         std::vector<float> { 0.2f, 0.3f, 0.5f } );
+    const uint32_t idle = tree.addPose( 3 );
+    tree.addBlend( std::vector<uint32_t> { walk, idle }, std::vector<float> { 0.75f, 0.25f } );
+
+    Posef result;
+    tree.evaluate( poses, result );
+
+    Posef expected;
+    blendPoses<float>( poses, std::vector<float> { 0.15f, 0.225f, 0.375f, 0.25f }, expected );
+
+    for ( std::size_t b = 0; b < boneCount; ++b )
+    {
+        for ( int k = 0; k < 4; ++k )
+            EXPECT_NEAR( result.getRotation( b )[k], expected.getRotation( b )[k], 1e-5f );
+
+        expectNear( result.getTranslation( b ), expected.getTranslation( b ), 1e-5f );
+        expectNear( result.getScale( b ), expected.getScale( b ), 1e-5f );
+    }
+
+    // Evaluating the tree again (which reuses its storage) with new weights, where the idle pose is skipped.
+    tree.setWeight( tree.size() - 1, 1, 0.0f );
+    tree.evaluate( poses, result );
+    blendPoses<float>( poses, std::vector<float> { 0.2f, 0.3f, 0.5f, 0.0f }, expected );
+
+    for ( std::size_t b = 0; b < boneCount; ++b )
+    {
+        for ( int k = 0; k < 4; ++k )
+            EXPECT_NEAR( result.getRotation( b )[k], expected.getRotation( b )[k], 1e-5f );
+
+        expectNear( result.getTranslation( b ), expected.getTranslation( b ), 1e-5f );
+        expectNear( result.getScale( b ), expected.getScale( b ), 1e-5f );
+    }
+
+    // A single pose is returned as is (up to the hemisphere of the rotations).
+    BlendTreef single;
+    single.addPose( 2 );
+    single.evaluate( poses, result );
+    for ( std::size_t b = 0; b < boneCount; ++b )
+    {
+        EXPECT_NEAR( std::abs( dot( result.getRotation( b ), poses[2].getRotation( b ) ) ), 1.0f, 1e-5f );
+        expectNear( result.getTranslation( b ), poses[2].getTranslation( b ), 1e-6f );
+    }
+}
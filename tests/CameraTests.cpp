@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Camera.hpp>
+
+#include <vector>
+
+using namespace FastMath;
+
+static void expectNear( const Matrix4f& a, const Matrix4f& b, float eps = 1e-5f )
+{
+    for ( int i = 0; i < 4; ++i )
+        for ( int j = 0; j < 4; ++j )
+            EXPECT_NEAR( a[i][j], b[i][j], eps * std::max( 1.0f, std::abs( b[i][j] ) ) ) << "[" << i << "][" << j << "]";
+}
+
+TEST( Camera, Default_Constructor )
+{
+    CameraF camera;
+
+    EXPECT_TRUE( camera.isDirty() );
+    EXPECT_EQ( camera.getProjection(), Projection::Perspective );
+    expectNear( camera.getViewMatrix(), Matrix4f::IDENTITY );
+    expectNear( camera.getProjectionMatrix(), perspectiveFoV( camera.getFieldOfView(), camera.getAspectRatio(), camera.getNear(), camera.getFar() ) );
+
+    camera.update();
+    EXPECT_FALSE( camera.isDirty() );
+}
+
+TEST( Camera, LookAt )
+{
+    const Vector3f eye { 1.0f, 2.0f, 3.0f }, target { -4.0f, 0.5f, 7.0f };
+
+    CameraF camera { eye };
+    camera.lookAt( target );
+    camera.setPerspective( radians( 75.0f ), 16.0f / 9.0f, 0.1f, 500.0f );
+
+    const Matrix4f view       = lookAt( eye, target );
+    const Matrix4f projection = perspectiveFoV( radians( 75.0f ), 16.0f / 9.0f, 0.1f, 500.0f );
+
+    expectNear( camera.getViewMatrix(), view );
+    expectNear( camera.getInverseViewMatrix(), inverse( view ) );
+    expectNear( camera.getProjectionMatrix(), projection );
+    expectNear( camera.getInverseProjectionMatrix(), inverse( projection ) );
+    expectNear( camera.getViewProjectionMatrix(), projection * view, 1e-4f );
+    expectNear( camera.getInverseViewProjectionMatrix(), inverse( projection * view ), 1e-4f );
+
+    // The target is in front of the camera.
+    const FrustumF& f = camera.getFrustum();
+    EXPECT_TRUE( contains( f, target ) );
+    EXPECT_FALSE( contains( f, eye * 2.0f - target ) );
+}
+
+TEST( Camera, Invalidate )
+{
+    CameraF camera { { 0.0f, 5.0f, -10.0f } };
+    camera.lookAt( { 0.0f, 0.0f, 0.0f } );
+    camera.update();
+
+    const Matrix4f projection = camera.getProjectionMatrix();
+    const Matrix4f view       = camera.getViewMatrix();
+
+    // Moving the camera invalidates the view.
+    camera.setPosition( { 1.0f, 5.0f, -10.0f } );
+    EXPECT_TRUE( camera.isDirty() );
+    EXPECT_EQ( camera.getProjectionMatrix(), projection );
+    EXPECT_NE( camera.getViewMatrix(), view );
+    expectNear( camera.getViewMatrix() * camera.getInverseViewMatrix(), Matrix4f::IDENTITY );
+    expectNear( camera.getViewProjectionMatrix(), projection * camera.getViewMatrix(), 1e-4f );
+
+    // Changing the projection invalidates the projection.
+    camera.setFieldOfView( radians( 30.0f ) );
+    camera.setAspectRatio( 2.0f );
+    camera.setClipPlanes( 1.0f, 100.0f );
+    expectNear( camera.getProjectionMatrix(), perspectiveFoV( radians( 30.0f ), 2.0f, 1.0f, 100.0f ) );
+    expectNear( camera.getViewProjectionMatrix(), camera.getProjectionMatrix() * camera.getViewMatrix(), 1e-4f );
+    expectNear( camera.getInverseViewProjectionMatrix() * camera.getViewProjectionMatrix(), Matrix4f::IDENTITY, 1e-4f );
+
+    // Orthographic projection.
+    camera.setOrthographic( -10.0f, 10.0f, -5.0f, 5.0f, 0.5f, 50.0f );
+    EXPECT_EQ( camera.getProjection(), Projection::Orthographic );
+    expectNear( camera.getProjectionMatrix(), orthographic( -10.0f, 10.0f, -5.0f, 5.0f, 0.5f, 50.0f ) );
+    expectNear( camera.getProjectionMatrix() * camera.getInverseProjectionMatrix(), Matrix4f::IDENTITY );
+    EXPECT_TRUE( contains( camera.getFrustum(), Vector3f { 0.0f, 0.0f, 0.0f } ) );
+    EXPECT_FALSE( contains( camera.getFrustum(), Vector3f { 20.0f, 0.0f, 0.0f } ) );
+}
+
+TEST( Camera, Update )
+{
+    // Shadow cascades.
+    std::vector<CameraF> cascades( 4 );
+    for ( std::size_t i = 0; i < cascades.size(); ++i )
+    {
+        const float extent = 10.0f * static_cast<float>( i + 1 );
+
+        cascades[i].setPosition( { 0.0f, 100.0f, 0.0f } );
+        cascades[i].lookAt( { 0.0f, 0.0f, 0.0f }, Vector3f::UNIT_Z );
+        cascades[i].setOrthographic( -extent, extent, -extent, extent, 1.0f, 200.0f );
+    }
+
+    update<float>( cascades );
+
+    for ( const auto& camera: cascades )
+    {
+        EXPECT_FALSE( camera.isDirty() );
+        expectNear( camera.getInverseViewProjectionMatrix() * camera.getViewProjectionMatrix(), Matrix4f::IDENTITY, 1e-4f );
+    }
+}
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/ConvexHull.hpp>
+
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace FastMath;
+
+static std::vector<Vector3f> randomBall( std::size_t count, unsigned seed = 42 )
+{
+    std::mt19937                          rng( seed );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    std::vector<Vector3f> points;
+    while ( points.size() < count )
+    {
+        const Vector3f p { dist( rng ), dist( rng ), dist( rng ) };
+        if ( lengthSqr( p ) <= 1.0f )
+            points.push_back( p );
+    }
+
+    return points;
+}
+
+// Check that a set of polygons (given by offsets into a list of vertex indices) is a closed 2-manifold of genus 0.
+static void validateManifold( std::span<const uint32_t> indices, std::span<const uint32_t> offsets )
+{
+    // Every directed edge has exactly one opposite edge.
+    std::set<std::pair<uint32_t, uint32_t>> edges;
+    std::set<uint32_t>                      vertices;
+    for ( std::size_t f = 0; f + 1 < offsets.size(); ++f )
+    {
+        const uint32_t begin = offsets[f], end = offsets[f + 1];
+        ASSERT_GE( end - begin, 3u );
+
+        for ( uint32_t i = begin; i < end; ++i )
+        {
+            ASSERT_TRUE( edges.insert( { indices[i], indices[i + 1 < end ? i + 1 : begin] } ).second );
+            vertices.insert( indices[i] );
+        }
+    }
+
+    for ( const auto& e: edges )
+        ASSERT_TRUE( edges.count( { e.second, e.first } ) );
+
+    // Euler characteristic.
+    ASSERT_EQ( static_cast<int>( vertices.size() ) - static_cast<int>( edges.size() / 2 ) + static_cast<int>( offsets.size() - 1 ), 2 );
+}
+
+// Check that the hull is a closed, convex 2-manifold that contains all of the points.
+static void validate( const ConvexHullf& hull, std::span<const Vector3f> points, float eps = 1e-4f )
+{
+    ASSERT_FALSE( hull.empty() );
+    ASSERT_EQ( hull.indices.size() % 3, 0u );
+    ASSERT_EQ( hull.faceOffsets.size(), hull.planes.size() + 1 );
+    ASSERT_EQ( hull.faceOffsets.back(), hull.faceIndices.size() );
+    ASSERT_EQ( hull.vertices.size(), hull.x.size() );
+
+    // Both the triangles and the faces form a closed surface.
+    std::vector<uint32_t> triangles;
+    for ( uint32_t i = 0; i <= hull.indices.size(); i += 3 )
+        triangles.push_back( i );
+
+    validateManifold( hull.indices, triangles );
+    validateManifold( hull.faceIndices, hull.faceOffsets );
+
+    // The vertices of each face are on its plane.
+    for ( std::size_t f = 0; f < hull.planes.size(); ++f )
+    {
+        for ( uint32_t i = hull.faceOffsets[f]; i < hull.faceOffsets[f + 1]; ++i )
+            ASSERT_NEAR( distance( hull.planes[f], hull.vertices[hull.faceIndices[i]] ), 0.0f, eps );
+    }
+
+    // Convex: every vertex is behind every face.
+    for ( const auto& plane: hull.planes )
+    {
+        ASSERT_NEAR( length( Vector3f { plane.x, plane.y, plane.z } ), 1.0f, 1e-4f );
+        for ( const auto& v: hull.vertices )
+            ASSERT_LE( distance( plane, v ), eps );
+    }
+
+    for ( const auto& p: points )
+        ASSERT_TRUE( contains( hull, p, eps ) );
+}
+
+TEST( ConvexHull, Degenerate )
+{
+    const std::vector<Vector3f> three { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+    ASSERT_TRUE( convexHull<float>( three ).empty() );
+
+    std::vector<Vector3f> planar;
+    for ( int i = 0; i < 100; ++i )
+        planar.push_back( { std::cos( i * 0.1f ), std::sin( i * 0.1f ), 2.0f } );
+    ASSERT_TRUE( convexHull<float>( planar ).empty() );
+
+    const std::vector<Vector3f> duplicates( 10, Vector3f { 1.0f, 2.0f, 3.0f } );
+    ASSERT_TRUE( convexHull<float>( duplicates ).empty() );
+}
+
+TEST( ConvexHull, Cube )
+{
+    std::vector<Vector3f> points = randomBall( 1000 );
+    for ( int i = 0; i < 8; ++i )
+        points.push_back( { ( i & 1 ) ? 2.0f : -2.0f, ( i & 2 ) ? 2.0f : -2.0f, ( i & 4 ) ? 2.0f : -2.0f } );
+
+    const ConvexHullf hull = convexHull<float>( points );
+    validate( hull, points );
+
+    // The coplanar triangles are merged into 6 square faces.
+    ASSERT_EQ( hull.vertices.size(), 8u );
+    ASSERT_EQ( hull.indices.size(), 36u );
+    ASSERT_EQ( hull.planes.size(), 6u );
+
+    for ( std::size_t f = 0; f < hull.planes.size(); ++f )
+    {
+        ASSERT_EQ( hull.faceOffsets[f + 1] - hull.faceOffsets[f], 4u );
+        ASSERT_NEAR( hull.planes[f].w, -2.0f, 1e-5f );
+    }
+}
+
+TEST( ConvexHull, Coplanar )
+{
+    // A prism with 16-sided caps, with points inside and on its faces.
+    std::vector<Vector3f> points = randomBall( 1000 );
+    for ( int i = 0; i < 16; ++i )
+    {
+        const float a = i * 2.0f * 3.14159265f / 16.0f;
+        points.push_back( { 3.0f * std::cos( a ), 3.0f * std::sin( a ), -2.0f } );
+        points.push_back( { 3.0f * std::cos( a ), 3.0f * std::sin( a ), 2.0f } );
+        points.push_back( { 2.0f * std::cos( a ), 2.0f * std::sin( a ), 2.0f } );
+    }
+
+    const ConvexHullf hull = convexHull<float>( points );
+    validate( hull, points );
+
+    ASSERT_EQ( hull.vertices.size(), 32u );
+    ASSERT_EQ( hull.planes.size(), 18u );
+
+    std::size_t caps = 0;
+    for ( std::size_t f = 0; f < hull.planes.size(); ++f )
+    {
+        const uint32_t size = hull.faceOffsets[f + 1] - hull.faceOffsets[f];
+        if ( std::abs( hull.planes[f].z ) > 0.999f )
+        {
+            ASSERT_EQ( size, 16u );
+            ++caps;
+        }
+        else
+        {
+            ASSERT_EQ( size, 4u );
+        }
+    }
+    ASSERT_EQ( caps, 2u );
+}
+
+TEST( ConvexHull, Ball )
+{
+    const std::vector<Vector3f> points = randomBall( 10000 );
+    const ConvexHullf           hull   = convexHull<float>( points );
+
+    validate( hull, points );
+}
+
+TEST( ConvexHull, Sphere )
+{
+    // Every point is on the hull.
+    std::vector<Vector3f> points = randomBall( 500, 7 );
+    for ( auto& p: points )
+        p = normalize( p ) * 10.0f;
+
+    const ConvexHullf hull = convexHull<float>( points );
+    validate( hull, points, 1e-3f );
+
+    ASSERT_EQ( hull.vertices.size(), points.size() );
+}
+
+TEST( ConvexHull, MaxVertices )
+{
+    const std::vector<Vector3f> points = randomBall( 10000 );
+
+    const ConvexHullf full    = convexHull<float>( points );
+    const ConvexHullf limited = convexHull<float>( points, 32 );
+
+    validate( limited, limited.vertices );
+    ASSERT_LE( limited.vertices.size(), 32u );
+
+    // The simplified hull is inside the exact hull.
+    for ( const auto& v: limited.vertices )
+        ASSERT_TRUE( contains( full, v, 1e-4f ) );
+}
+
+TEST( ConvexHull, FarthestFirst )
+{
+    // The vertices of an icosahedron, far outside of a ball of points: they are the most
+    // significant points, so a hull limited to 12 vertices keeps exactly these.
+    const float           phi = ( 1.0f + std::sqrt( 5.0f ) ) * 0.5f;
+    std::vector<Vector3f> points = randomBall( 10000 );
+    for ( int i = 0; i < 12; ++i )
+    {
+        const float a = ( i & 1 ) ? 1.0f : -1.0f;
+        const float b = ( i & 2 ) ? phi : -phi;
+
+        Vector3f v;
+        v[i / 4]             = 0.0f;
+        v[( i / 4 + 1 ) % 3] = a;
+        v[( i / 4 + 2 ) % 3] = b;
+        points.push_back( normalize( v ) * 1.5f );
+    }
+
+    const ConvexHullf hull = convexHull<float>( points, 12 );
+    validate( hull, hull.vertices );
+
+    ASSERT_EQ( hull.vertices.size(), 12u );
+    for ( const auto& v: hull.vertices )
+        ASSERT_NEAR( length( v ), 1.5f, 1e-5f );
+}
+
+TEST( ConvexHull, Reuse )
+{
+    QuickHull<float> builder;
+    ConvexHullf      hull;
+
+    for ( unsigned seed = 0; seed < 5; ++seed )
+    {
+        const std::vector<Vector3f> points = randomBall( 2000, seed );
+
+        ASSERT_TRUE( builder.build( points, hull ) );
+        validate( hull, points );
+    }
+}
+
+TEST( ConvexHull, Support )
+{
+    std::vector<Vector3f> points;
+    for ( int i = 0; i < 8; ++i )
+        points.push_back( { ( i & 1 ) ? 1.0f : -1.0f, ( i & 2 ) ? 1.0f : -1.0f, ( i & 4 ) ? 1.0f : -1.0f } );
+
+    const ConvexHullf hull = convexHull<float>( points );
+
+    const auto r = gjkDistance( hull, Spheref { { 4.0f, 0.0f, 0.0f }, 1.0f } );
+    ASSERT_NEAR( r.distance, 2.0f, 1e-3f );
+}
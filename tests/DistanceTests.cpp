@@ -0,0 +1,316 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Distance.hpp>
+
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static Vector3f randomPoint( std::mt19937& rng, float range = 4.0f )
+{
+    std::uniform_real_distribution<float> dist( -range, range );
+    return { dist( rng ), dist( rng ), dist( rng ) };
+}
+
+static OBBf randomOBB( std::mt19937& rng )
+{
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+    std::uniform_real_distribution<float> ext( 0.1f, 2.0f );
+
+    const QuaternionF q = normalize( QuaternionF { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } );
+    return { randomPoint( rng, 2.0f ), { ext( rng ), ext( rng ), ext( rng ) }, q };
+}
+
+// Points in SoA layout.
+struct PointStorage
+{
+    std::vector<float> x, y, z;
+
+    PointStorage( std::mt19937& rng, std::size_t count )
+    {
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            const Vector3f p = randomPoint( rng );
+            x.push_back( p.x );
+            y.push_back( p.y );
+            z.push_back( p.z );
+        }
+    }
+
+    Vector3f operator[]( std::size_t i ) const
+    {
+        return { x[i], y[i], z[i] };
+    }
+
+    PointSoA<float> view() const
+    {
+        return { x, y, z };
+    }
+};
+
+// Brute force: the minimum squared distance from p to a set of sample points.
+template<typename F>
+static float bruteForce( const Vector3f& p, int n, F&& sample )
+{
+    float best = std::numeric_limits<float>::max();
+    for ( int i = 0; i <= n; ++i )
+    {
+        for ( int j = 0; j <= n; ++j )
+        {
+            const float s = static_cast<float>( i ) / n;
+            const float t = static_cast<float>( j ) / n;
+
+            std::optional<Vector3f> q = sample( s, t );
+            if ( q )
+                best = std::min( best, lengthSqr( *q - p ) );
+        }
+    }
+
+    return best;
+}
+
+// The result must be no further than the closest sample, and no closer than the
+// closest sample minus the sampling resolution.
+static void checkDistance( float d, float brute, float resolution )
+{
+    ASSERT_LE( std::sqrt( d ), std::sqrt( brute ) + 1e-4f );
+    ASSERT_GE( std::sqrt( d ), std::sqrt( brute ) - resolution );
+}
+
+TEST( Distance, Segment )
+{
+    std::mt19937 rng( 1 );
+
+    for ( int i = 0; i < 500; ++i )
+    {
+        const Vector3f a = randomPoint( rng );
+        const Vector3f b = randomPoint( rng );
+        const Vector3f p = randomPoint( rng );
+
+        const Vector3f q = closestPoint( p, a, b );
+        const float    d = distanceSqr( p, a, b );
+
+        ASSERT_NEAR( d, lengthSqr( q - p ), 1e-4f );
+        ASSERT_NEAR( length( cross( q - a, b - a ) ), 0.0f, 1e-3f );
+
+        float brute = std::numeric_limits<float>::max();
+        for ( int s = 0; s <= 1000; ++s )
+            brute = std::min( brute, lengthSqr( a + ( b - a ) * ( s / 1000.0f ) - p ) );
+
+        checkDistance( d, brute, length( b - a ) / 1000.0f );
+    }
+
+    // Degenerate segment.
+    EXPECT_EQ( closestPoint( Vector3f { 1.0f, 2.0f, 3.0f }, Vector3f { 1.0f }, Vector3f { 1.0f } ), Vector3f { 1.0f } );
+}
+
+TEST( Distance, Triangle )
+{
+    std::mt19937 rng( 2 );
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        const Vector3f a = randomPoint( rng );
+        const Vector3f b = randomPoint( rng );
+        const Vector3f c = randomPoint( rng );
+        const Vector3f p = randomPoint( rng );
+
+        const float d = distanceSqr( p, a, b, c );
+
+        const float brute = bruteForce( p, 200, [&]( float s, float t ) -> std::optional<Vector3f> {
+            if ( s + t > 1.0f )
+                return std::nullopt;
+            return a + ( b - a ) * s + ( c - a ) * t;
+        } );
+
+        const float edge = std::max( { length( b - a ), length( c - a ), length( c - b ) } );
+        checkDistance( d, brute, 2.0f * edge / 200.0f );
+    }
+}
+
+TEST( Distance, OBB )
+{
+    std::mt19937 rng( 3 );
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        const OBBf     o = randomOBB( rng );
+        const Vector3f p = randomPoint( rng );
+
+        const Vector3f q = closestPoint( p, o );
+        const float    d = distanceSqr( p, o );
+
+        ASSERT_NEAR( d, lengthSqr( q - p ), 1e-3f );
+
+        // The closest point is inside the box.
+        for ( std::size_t k = 0; k < 3; ++k )
+            ASSERT_LE( std::abs( dot( q - o.center, axis( o, k ) ) ), o.halfExtents[k] + 1e-4f );
+
+        // Sample the 6 faces of the box.
+        float brute = std::numeric_limits<float>::max();
+        for ( std::size_t k = 0; k < 3; ++k )
+        {
+            const std::size_t k1 = ( k + 1 ) % 3;
+            const std::size_t k2 = ( k + 2 ) % 3;
+
+            for ( float side: { -1.0f, 1.0f } )
+            {
+                brute = std::min( brute, bruteForce( p, 100, [&]( float s, float t ) -> std::optional<Vector3f> {
+                    return o.center + axis( o, k ) * ( side * o.halfExtents[k] ) + axis( o, k1 ) * ( ( 2.0f * s - 1.0f ) * o.halfExtents[k1] ) +
+                           axis( o, k2 ) * ( ( 2.0f * t - 1.0f ) * o.halfExtents[k2] );
+                } ) );
+            }
+        }
+
+        // Points inside the box are at distance 0.
+        if ( d > 0.0f )
+            checkDistance( d, brute, 4.0f * 2.0f / 100.0f );
+    }
+}
+
+TEST( Distance, SegmentSegment )
+{
+    std::mt19937 rng( 4 );
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        const Vector3f p1 = randomPoint( rng );
+        const Vector3f q1 = randomPoint( rng );
+        const Vector3f p2 = randomPoint( rng );
+        const Vector3f q2 = randomPoint( rng );
+
+        Vector3f    c1, c2;
+        const float d = closestPoints( p1, q1, p2, q2, c1, c2 );
+
+        ASSERT_NEAR( d, lengthSqr( c1 - c2 ), 1e-4f );
+        ASSERT_NEAR( length( cross( c1 - p1, q1 - p1 ) ), 0.0f, 1e-3f );
+        ASSERT_NEAR( length( cross( c2 - p2, q2 - p2 ) ), 0.0f, 1e-3f );
+
+        float brute = std::numeric_limits<float>::max();
+        for ( int s = 0; s <= 200; ++s )
+        {
+            const Vector3f a = p1 + ( q1 - p1 ) * ( s / 200.0f );
+            brute            = std::min( brute, distanceSqr( a, p2, q2 ) );
+        }
+
+        checkDistance( d, brute, length( q1 - p1 ) / 200.0f );
+    }
+
+    // Parallel segments.
+    Vector3f    c1, c2;
+    const float d = closestPoints( Vector3f { 0.0f, 0.0f, 0.0f }, Vector3f { 2.0f, 0.0f, 0.0f }, Vector3f { 1.0f, 1.0f, 0.0f }, Vector3f { 3.0f, 1.0f, 0.0f }, c1, c2 );
+    EXPECT_NEAR( d, 1.0f, 1e-5f );
+
+    // Degenerate segments.
+    EXPECT_NEAR( closestPoints( Vector3f { 0.0f }, Vector3f { 0.0f }, Vector3f { 0.0f, 2.0f, 0.0f }, Vector3f { 0.0f, 2.0f, 0.0f }, c1, c2 ), 4.0f, 1e-5f );
+    EXPECT_NEAR( closestPoints( Vector3f { 0.0f }, Vector3f { 0.0f }, Vector3f { -1.0f, 1.0f, 0.0f }, Vector3f { 1.0f, 1.0f, 0.0f }, c1, c2 ), 1.0f, 1e-5f );
+}
+
+TEST( Distance, BatchPoints )
+{
+    std::mt19937 rng( 5 );
+
+    // Not a multiple of the SIMD width to exercise the scalar tail.
+    const PointStorage points( rng, 1003 );
+
+    std::vector<float>    d( points.x.size() );
+    std::vector<Vector3f> q( points.x.size() );
+
+    auto check = [&]( auto&& f ) {
+        for ( std::size_t i = 0; i < points.x.size(); ++i )
+        {
+            const Vector3f expected = f( points[i] );
+            ASSERT_NEAR( q[i].x, expected.x, 1e-4f );
+            ASSERT_NEAR( q[i].y, expected.y, 1e-4f );
+            ASSERT_NEAR( q[i].z, expected.z, 1e-4f );
+            ASSERT_NEAR( d[i], lengthSqr( expected - points[i] ), 1e-3f );
+        }
+    };
+
+    const AABBf box { { -1.0f, -0.5f, 0.0f }, { 1.0f, 2.0f, 0.5f } };
+    distanceSqr( points.view(), box, std::span { d }, std::span { q } );
+    check( [&]( const Vector3f& p ) { return closestPoint( p, box ); } );
+
+    const OBBf o = randomOBB( rng );
+    distanceSqr( points.view(), o, std::span { d }, std::span { q } );
+    check( [&]( const Vector3f& p ) { return closestPoint( p, o ); } );
+
+    const Vector3f a = randomPoint( rng );
+    const Vector3f b = randomPoint( rng );
+    const Vector3f c = randomPoint( rng );
+    distanceSqr( points.view(), a, b, std::span { d }, std::span { q } );
+    check( [&]( const Vector3f& p ) { return closestPoint( p, a, b ); } );
+
+    distanceSqr( points.view(), a, b, c, std::span { d }, std::span { q } );
+    check( [&]( const Vector3f& p ) { return closestPoint( p, a, b, c ); } );
+
+    // Distances only.
+    std::vector<float> d2( points.x.size() );
+    distanceSqr( points.view(), a, b, c, std::span { d2 } );
+    for ( std::size_t i = 0; i < d.size(); ++i )
+        ASSERT_EQ( d[i], d2[i] );
+}
+
+TEST( Distance, BatchTriangles )
+{
+    std::mt19937 rng( 6 );
+
+    std::vector<float> ax, ay, az, bx, by, bz, cx, cy, cz;
+    for ( int i = 0; i < 301; ++i )
+    {
+        const Vector3f a = randomPoint( rng, 8.0f );
+        const Vector3f b = a + randomPoint( rng, 1.0f );
+        const Vector3f c = a + randomPoint( rng, 1.0f );
+
+        ax.push_back( a.x );
+        ay.push_back( a.y );
+        az.push_back( a.z );
+        bx.push_back( b.x );
+        by.push_back( b.y );
+        bz.push_back( b.z );
+        cx.push_back( c.x );
+        cy.push_back( c.y );
+        cz.push_back( c.z );
+    }
+
+    const TriangleSoA<float> triangles { ax, ay, az, bx, by, bz, cx, cy, cz };
+
+    std::vector<float> d( triangles.size() );
+    for ( int i = 0; i < 100; ++i )
+    {
+        const Vector3f p = randomPoint( rng, 8.0f );
+
+        distanceSqr( p, triangles, std::span { d } );
+
+        uint32_t expected = std::numeric_limits<uint32_t>::max();
+        float    best     = std::numeric_limits<float>::max();
+        for ( std::size_t j = 0; j < triangles.size(); ++j )
+        {
+            const float e = distanceSqr( p, Vector3f { ax[j], ay[j], az[j] }, Vector3f { bx[j], by[j], bz[j] }, Vector3f { cx[j], cy[j], cz[j] } );
+            ASSERT_NEAR( d[j], e, 1e-3f );
+
+            if ( e < best )
+            {
+                best     = e;
+                expected = static_cast<uint32_t>( j );
+            }
+        }
+
+        Vector3f       q;
+        const uint32_t prim = closestPoint( triangles, p, q );
+        ASSERT_NE( prim, std::numeric_limits<uint32_t>::max() );
+        ASSERT_NEAR( lengthSqr( q - p ), best, 1e-3f );
+        if ( prim != expected )
+        {
+            ASSERT_NEAR( d[prim], best, 1e-3f );
+        }
+
+        // Nothing within a tiny radius.
+        if ( best > 1e-2f )
+        {
+            ASSERT_EQ( closestPoint( triangles, p, q, 1e-3f ), std::numeric_limits<uint32_t>::max() );
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Frustum.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+TEST( Frustum, Default_Constructor )
+{
+    FrustumF f;
+
+    ASSERT_TRUE( contains( f, Vector3f { 1000.0f, -1000.0f, 1000.0f } ) );
+}
+
+TEST( Frustum, PerspectiveLH01 )
+{
+    FrustumF f = extractFrustum01( perspectiveFoVLH01( radians( 90.0f ), 1.0f, 1.0f, 100.0f ) );
+
+    ASSERT_TRUE( contains( f, Vector3f { 0.0f, 0.0f, 10.0f } ) );
+    ASSERT_TRUE( contains( f, Vector3f { 9.0f, -9.0f, 10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 11.0f, 0.0f, 10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, 0.5f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, 101.0f } ) );
+
+    ASSERT_NEAR( f.planes[FrustumF::Near].w, -1.0f, 1e-5f );
+    ASSERT_NEAR( f.planes[FrustumF::Far].w, 100.0f, 1e-3f );
+}
+
+TEST( Frustum, PerspectiveRH11 )
+{
+    FrustumF f = extractFrustum11( perspectiveFoVRH11( radians( 90.0f ), 1.0f, 1.0f, 100.0f ) );
+
+    ASSERT_TRUE( contains( f, Vector3f { 0.0f, 0.0f, -10.0f } ) );
+    ASSERT_TRUE( contains( f, Vector3f { -9.0f, 9.0f, -10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 11.0f, -10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, 10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -0.5f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -101.0f } ) );
+
+    ASSERT_NEAR( f.planes[FrustumF::Near].w, -1.0f, 1e-4f );
+    ASSERT_NEAR( f.planes[FrustumF::Far].w, 100.0f, 1e-2f );
+}
+
+TEST( Frustum, Orthographic )
+{
+    FrustumF f { orthographic( -1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 10.0f ) };
+
+#if LS_HANDEDNESS == LS_LEFT_HANDED
+    const float z = 5.0f;
+#else
+    const float z = -5.0f;
+#endif
+
+    ASSERT_TRUE( contains( f, Vector3f { 0.5f, 0.5f, z } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 1.5f, 0.5f, z } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.5f, -1.5f, z } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.5f, 0.5f, -z } ) );
+}
+
+TEST( Frustum, ViewProjection )
+{
+    // Camera at (0, 0, -10) looking down the +z axis.
+    const Matrix4f viewProj = perspectiveFoVLH01( radians( 90.0f ), 1.0f, 1.0f, 100.0f ) * translate( Vector3f { 0.0f, 0.0f, 10.0f } );
+    FrustumF       f        = extractFrustum01( viewProj );
+
+    ASSERT_TRUE( contains( f, Vector3f { 0.0f, 0.0f, 0.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -10.0f } ) );
+    ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, 95.0f } ) );
+}
+
+TEST( Frustum, Sphere )
+{
+    FrustumF f = extractFrustum01( perspectiveFoVLH01( radians( 90.0f ), 1.0f, 1.0f, 100.0f ) );
+
+    ASSERT_TRUE( intersects( f, Spheref { { 0.0f, 0.0f, 10.0f }, 1.0f } ) );
+    ASSERT_TRUE( intersects( f, Spheref { { 0.0f, 0.0f, -0.5f }, 2.0f } ) );
+    ASSERT_FALSE( intersects( f, Spheref { { 0.0f, 0.0f, -5.0f }, 2.0f } ) );
+    ASSERT_FALSE( intersects( f, Spheref { { 20.0f, 0.0f, 10.0f }, 1.0f } ) );
+}
+
+TEST( Frustum, AABB )
+{
+    FrustumF f = extractFrustum01( perspectiveFoVLH01( radians( 90.0f ), 1.0f, 1.0f, 100.0f ) );
+
+    ASSERT_TRUE( intersects( f, AABBf { { -1.0f, -1.0f, 9.0f }, { 1.0f, 1.0f, 11.0f } } ) );
+    ASSERT_TRUE( intersects( f, AABBf { { -100.0f, -100.0f, -100.0f }, { 100.0f, 100.0f, 100.0f } } ) );
+    ASSERT_FALSE( intersects( f, AABBf { { 12.0f, -1.0f, 9.0f }, { 14.0f, 1.0f, 11.0f } } ) );
+    ASSERT_FALSE( intersects( f, AABBf { { -1.0f, -1.0f, -5.0f }, { 1.0f, 1.0f, -2.0f } } ) );
+}
+
+TEST( Frustum, CullSpheres )
+{
+    FrustumF f = extractFrustum01( perspectiveFoVLH01( radians( 60.0f ), 1.5f, 0.1f, 100.0f ) );
+
+    std::mt19937                          rng( 1234 );
+    std::uniform_real_distribution<float> pos( -100.0f, 100.0f );
+    std::uniform_real_distribution<float> rad( 0.0f, 5.0f );
+
+    // Not a multiple of 8 to exercise the remainder loop.
+    constexpr std::size_t N = 1003;
+    std::vector<float>    x( N ), y( N ), z( N ), r( N );
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        x[i] = pos( rng );
+        y[i] = pos( rng );
+        z[i] = pos( rng );
+        r[i] = rad( rng );
+    }
+
+    std::vector<uint32_t> visible( N );
+    const std::size_t     n = cullSpheres( f, SphereSoA<float> { x, y, z, r }, visible );
+
+    std::vector<uint32_t> expected;
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        if ( intersects( f, Spheref { { x[i], y[i], z[i] }, r[i] } ) )
+            expected.push_back( static_cast<uint32_t>( i ) );
+    }
+
+    ASSERT_GT( n, 0u );
+    ASSERT_LT( n, N );
+    ASSERT_EQ( n, expected.size() );
+    for ( std::size_t i = 0; i < n; ++i )
+        ASSERT_EQ( visible[i], expected[i] );
+}
+
+TEST( Frustum, CullAABBs )
+{
+    FrustumF f = extractFrustum11( perspectiveFoVRH11( radians( 60.0f ), 1.5f, 0.1f, 100.0f ) );
+
+    std::mt19937                          rng( 4321 );
+    std::uniform_real_distribution<float> pos( -100.0f, 100.0f );
+    std::uniform_real_distribution<float> ext( 0.0f, 5.0f );
+
+    constexpr std::size_t N = 1005;
+    std::vector<float>    minX( N ), minY( N ), minZ( N ), maxX( N ), maxY( N ), maxZ( N );
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        minX[i] = pos( rng );
+        minY[i] = pos( rng );
+        minZ[i] = pos( rng );
+        maxX[i] = minX[i] + ext( rng );
+        maxY[i] = minY[i] + ext( rng );
+        maxZ[i] = minZ[i] + ext( rng );
+    }
+
+    std::vector<uint32_t> visible( N );
+    const std::size_t     n = cullAABBs( f, AABBSoA<float> { minX, minY, minZ, maxX, maxY, maxZ }, visible );
+
+    std::vector<uint32_t> expected;
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        if ( intersects( f, AABBf { { minX[i], minY[i], minZ[i] }, { maxX[i], maxY[i], maxZ[i] } } ) )
+            expected.push_back( static_cast<uint32_t>( i ) );
+    }
+
+    ASSERT_GT( n, 0u );
+    ASSERT_LT( n, N );
+    ASSERT_EQ( n, expected.size() );
+    for ( std::size_t i = 0; i < n; ++i )
+        ASSERT_EQ( visible[i], expected[i] );
+}
+
+TEST( Frustum, ReverseZ )
+{
+    using ReverseZ = ClipSpace<Handedness::Right, DepthRange::OneToZero>;
+
+    {
+        FrustumF f = extractFrustum<ReverseZ>( perspectiveFoV<ReverseZ>( radians( 90.0f ), 1.0f, 1.0f, 100.0f ) );
+
+        ASSERT_TRUE( contains( f, Vector3f { 0.0f, 0.0f, -10.0f } ) );
+        ASSERT_TRUE( contains( f, Vector3f { 9.0f, -9.0f, -10.0f } ) );
+        ASSERT_FALSE( contains( f, Vector3f { 11.0f, 0.0f, -10.0f } ) );
+        ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, 10.0f } ) );
+        ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -0.5f } ) );
+        ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -101.0f } ) );
+    }
+
+    // The far plane of an infinite projection does not reject anything.
+    {
+        FrustumF f = extractFrustum<ReverseZ>( perspectiveFoVInfinite<ReverseZ>( radians( 90.0f ), 1.0f, 1.0f ) );
+
+        ASSERT_TRUE( contains( f, Vector3f { 0.0f, 0.0f, -1e6f } ) );
+        ASSERT_FALSE( contains( f, Vector3f { 0.0f, 0.0f, -0.5f } ) );
+    }
+}
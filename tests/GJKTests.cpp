@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/GJK.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+// Vertices of an OBB in SoA layout.
+struct HullStorage
+{
+    std::vector<float> x, y, z;
+
+    explicit HullStorage( const OBBf& o )
+    {
+        for ( int i = 0; i < 8; ++i )
+        {
+            const Vector3f s { ( i & 1 ) ? 1.0f : -1.0f, ( i & 2 ) ? 1.0f : -1.0f, ( i & 4 ) ? 1.0f : -1.0f };
+            const Vector3f p = o.center + o.rotation * ( s * o.halfExtents );
+            x.push_back( p.x );
+            y.push_back( p.y );
+            z.push_back( p.z );
+        }
+    }
+
+    HullSoA<float> view() const
+    {
+        return { x, y, z };
+    }
+};
+
+TEST( GJK, SupportIndex )
+{
+    std::mt19937                          rng( 1 );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    for ( std::size_t count: { 1u, 7u, 8u, 9u, 100u, 1003u } )
+    {
+        std::vector<float> x, y, z;
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            x.push_back( dist( rng ) );
+            y.push_back( dist( rng ) );
+            z.push_back( dist( rng ) );
+        }
+
+        const HullSoA<float> hull { x, y, z };
+        for ( int k = 0; k < 20; ++k )
+        {
+            const Vector3f d { dist( rng ), dist( rng ), dist( rng ) };
+
+            std::size_t expected = 0;
+            float       best     = std::numeric_limits<float>::lowest();
+            for ( std::size_t i = 0; i < count; ++i )
+            {
+                const float p = x[i] * d.x + y[i] * d.y + z[i] * d.z;
+                if ( p > best )
+                {
+                    best     = p;
+                    expected = i;
+                }
+            }
+
+            ASSERT_EQ( supportIndex( hull, d ), expected );
+        }
+    }
+}
+
+TEST( GJK, SphereDistance )
+{
+    const Spheref a { { 0.0f, 0.0f, 0.0f }, 1.0f };
+    const Spheref b { { 5.0f, 0.0f, 0.0f }, 2.0f };
+
+    const auto r = gjkDistance( a, b );
+
+    ASSERT_FALSE( r.intersecting );
+    ASSERT_NEAR( r.distance, 2.0f, 1e-3f );
+    ASSERT_NEAR( r.pointA.x, 1.0f, 1e-3f );
+    ASSERT_NEAR( r.pointB.x, 3.0f, 1e-3f );
+
+    ASSERT_FALSE( gjkIntersects( a, b ) );
+    ASSERT_TRUE( gjkIntersects( a, Spheref { { 2.5f, 0.0f, 0.0f }, 2.0f } ) );
+}
+
+TEST( GJK, BoxDistance )
+{
+    const AABBf a { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+    const AABBf b { { 3.0f, 4.0f, -1.0f }, { 4.0f, 5.0f, 1.0f } };
+
+    // Closest features are the edges at (1, 1) and (3, 4).
+    const auto r = gjkDistance( a, b );
+    ASSERT_FALSE( r.intersecting );
+    ASSERT_NEAR( r.distance, std::sqrt( 13.0f ), 1e-4f );
+
+    // Point vs. box.
+    const auto p = gjkDistance( Vector3f { 0.0f, 3.0f, 0.0f }, a );
+    ASSERT_NEAR( p.distance, 2.0f, 1e-4f );
+    ASSERT_NEAR( p.pointB.y, 1.0f, 1e-4f );
+}
+
+TEST( GJK, CapsuleDistance )
+{
+    const Capsule<float> c { { -2.0f, 0.0f, 0.0f }, { 2.0f, 0.0f, 0.0f }, 0.5f };
+    const Spheref        s { { 1.0f, 3.0f, 0.0f }, 1.0f };
+
+    const auto r = gjkDistance( c, s );
+    ASSERT_NEAR( r.distance, 1.5f, 1e-3f );
+}
+
+TEST( GJK, Lambda )
+{
+    // Any callable can be used as a support mapping.
+    const auto point  = []( const Vector3f& ) { return Vector3f { 0.0f, 0.0f, 10.0f }; };
+    const auto sphere = []( const Vector3f& d ) { return normalize( d ) * 2.0f; };
+
+    const auto r = gjkDistance( point, sphere );
+    ASSERT_NEAR( r.distance, 8.0f, 1e-3f );
+}
+
+TEST( GJK, Transformed )
+{
+    const AABBf box { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+
+    // Rotated 45 degrees, the corner of the box reaches sqrt(2) along the x-axis.
+    const Transformed<AABBf> a { box, axisAngle( Vector3f::UNIT_Z, radians( 45.0f ) ), { 0.0f, 0.0f, 0.0f } };
+    const Vector3f           p { 3.0f, 0.0f, 0.0f };
+
+    ASSERT_NEAR( gjkDistance( a, p ).distance, 3.0f - std::sqrt( 2.0f ), 1e-4f );
+}
+
+TEST( GJK, Intersects_OBB )
+{
+    std::mt19937 rng( 3 );
+
+    int overlaps = 0;
+    for ( int i = 0; i < 2000; ++i )
+    {
+        const OBBf a = randomOBB( rng );
+        const OBBf b = randomOBB( rng );
+
+        const bool expected = intersects( a, b );
+
+        // Skip nearly touching pairs where the two methods may legitimately disagree.
+        if ( expected != gjkIntersects( a, b ) )
+        {
+            const auto r = gjkDistance( a, b );
+            ASSERT_LT( r.distance, 1e-3f );
+            continue;
+        }
+
+        overlaps += expected;
+    }
+
+    ASSERT_GT( overlaps, 0 );
+}
+
+TEST( GJK, Hull )
+{
+    std::mt19937 rng( 4 );
+
+    for ( int i = 0; i < 500; ++i )
+    {
+        const OBBf        a = randomOBB( rng );
+        const OBBf        b = randomOBB( rng );
+        const HullStorage ha( a ), hb( b );
+
+        const auto boxes = gjkDistance( a, b );
+        const auto hulls = gjkDistance( ha.view(), hb.view() );
+
+        ASSERT_EQ( boxes.intersecting, hulls.intersecting );
+        ASSERT_NEAR( boxes.distance, hulls.distance, 1e-3f );
+    }
+}
+
+TEST( GJK, WarmStart )
+{
+    const Spheref a { { 0.0f, 0.0f, 0.0f }, 1.0f };
+    OBBf          b { { 4.0f, 1.0f, 0.0f }, { 1.0f, 0.5f, 2.0f }, axisAngle( Vector3f::UNIT_Y, 0.3f ) };
+
+    GJKCache<float> cache;
+    uint32_t        cold = 0, warm = 0;
+    for ( int frame = 0; frame < 100; ++frame )
+    {
+        b.center.x -= 0.01f;
+
+        const auto r0 = gjkDistance( a, b );
+        const auto r1 = gjkDistance( a, b, cache );
+
+        ASSERT_EQ( r0.intersecting, r1.intersecting );
+        ASSERT_NEAR( r0.distance, r1.distance, 1e-4f );
+
+        cold += r0.iterations;
+        warm += r1.iterations;
+    }
+
+    // Coherent motion converges faster from the cached simplex.
+    ASSERT_LT( warm, cold );
+}
+
+TEST( EPA, Spheres )
+{
+    const Spheref a { { 0.0f, 0.0f, 0.0f }, 1.0f };
+    const Spheref b { { 1.5f, 0.0f, 0.0f }, 1.0f };
+
+    const auto r = epa( a, b );
+    ASSERT_TRUE( r.intersecting );
+    ASSERT_NEAR( r.depth, 0.5f, 1e-2f );
+    ASSERT_NEAR( r.normal.x, 1.0f, 1e-2f );
+
+    ASSERT_FALSE( epa( a, Spheref { { 3.0f, 0.0f, 0.0f }, 1.0f } ).intersecting );
+}
+
+TEST( EPA, Boxes )
+{
+    const AABBf a { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+    const AABBf b { { 0.5f, -0.5f, -0.5f }, { 2.5f, 1.5f, 1.5f } };
+
+    // Penetration along x is 0.5, along y and z it is 1.5.
+    const auto r = epa( a, b );
+    ASSERT_TRUE( r.intersecting );
+    ASSERT_NEAR( r.depth, 0.5f, 1e-4f );
+    ASSERT_NEAR( r.normal.x, 1.0f, 1e-4f );
+
+    // Translating b by the penetration vector separates the boxes.
+    const Vector3f t = r.normal * ( r.depth + 1e-3f );
+    ASSERT_FALSE( gjkIntersects( a, AABBf { b.min + t, b.max + t } ) );
+}
+
+TEST( EPA, Random )
+{
+    std::mt19937 rng( 6 );
+
+    int tested = 0;
+    for ( int i = 0; i < 500; ++i )
+    {
+        const OBBf a = randomOBB( rng, 1.0f );
+        OBBf       b = randomOBB( rng, 1.0f );
+
+        const auto r = epa( a, b );
+        if ( !r.intersecting )
+            continue;
+
+        ++tested;
+
+        // Pushing b out by the penetration vector separates the shapes...
+        b.center += r.normal * ( r.depth + 1e-2f );
+        ASSERT_FALSE( gjkIntersects( a, b ) );
+
+        // ...and pushing it out by less does not.
+        b.center -= r.normal * 2e-2f;
+        ASSERT_TRUE( gjkIntersects( a, b ) );
+    }
+
+    ASSERT_GT( tested, 0 );
+}
@@ -0,0 +1,319 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/InverseKinematics.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static Vector3f randomPoint( std::mt19937& rng, float range )
+{
+    std::uniform_real_distribution<float> dist( -range, range );
+    return { dist( rng ), dist( rng ), dist( rng ) };
+}
+
+// A chain along the y axis, with bones of the given lengths.
+static IKChainf makeChain( std::initializer_list<float> lengths )
+{
+    IKChainf chain;
+    chain.origin = { 1.0f, 2.0f, 3.0f };
+    for ( float l: lengths )
+    {
+        chain.offsets.push_back( { 0.0f, l, 0.0f } );
+        chain.rotations.push_back( QuaternionF::IDENTITY );
+    }
+
+    return chain;
+}
+
+static void expectBoneLengths( const IKChainf& chain )
+{
+    for ( std::size_t i = 0; i < chain.size(); ++i )
+        EXPECT_NEAR( length( chain.positions[i + 1] - chain.positions[i] ), length( chain.offsets[i] ), 1e-4f );
+}
+
+TEST( InverseKinematics, Constrain )
+{
+    const Vector3f boneAxis { 0.0f, 1.0f, 0.0f };
+
+    // Hinge: only the rotation about the axis remains, clamped to the range.
+    JointLimitf hinge;
+    hinge.axis     = { 1.0f, 0.0f, 0.0f };
+    hinge.minAngle = -0.5f;
+    hinge.maxAngle = 1.0f;
+
+    const QuaternionF q  = axisAngle( Vector3f { 1.0f, 0.0f, 0.0f }, 0.7f ) * axisAngle( Vector3f { 0.0f, 0.0f, 1.0f }, 0.3f );
+    const QuaternionF h  = constrain( q, hinge, boneAxis );
+    const QuaternionF h1 = constrain( axisAngle( Vector3f { 1.0f, 0.0f, 0.0f }, 2.0f ), hinge, boneAxis );
+    const QuaternionF h2 = constrain( axisAngle( Vector3f { 1.0f, 0.0f, 0.0f }, -1.5f ), hinge, boneAxis );
+    EXPECT_NEAR( h.y, 0.0f, 1e-6f );
+    EXPECT_NEAR( h.z, 0.0f, 1e-6f );
+    EXPECT_NEAR( 2.0f * std::atan2( h.x, h.w ), 0.7f, 1e-4f );
+    EXPECT_NEAR( 2.0f * std::atan2( h1.x, h1.w ), 1.0f, 1e-4f );
+    EXPECT_NEAR( 2.0f * std::atan2( h2.x, h2.w ), -0.5f, 1e-4f );
+
+    // Ball joint: the swing is limited, and the twist is clamped.
+    JointLimitf ball;
+    ball.maxSwing = 0.5f;
+    ball.minAngle = -0.2f;
+    ball.maxAngle = 0.2f;
+
+    const QuaternionF swing = axisAngle( Vector3f { 0.0f, 0.0f, 1.0f }, 1.2f );
+    const QuaternionF twist = axisAngle( boneAxis, 0.6f );
+    const QuaternionF b     = constrain( swing * twist, ball, boneAxis );
+
+    // The angle between the constrained bone and the rest direction.
+    EXPECT_NEAR( std::acos( dot( b * boneAxis, boneAxis ) ), 0.5f, 1e-3f );
+
+    // Rotations within the limits are unchanged.
+    const QuaternionF inside = axisAngle( Vector3f { 1.0f, 0.0f, 0.0f }, 0.3f ) * axisAngle( boneAxis, 0.1f );
+    EXPECT_NEAR( std::abs( dot( constrain( inside, ball, boneAxis ), inside ) ), 1.0f, 1e-5f );
+}
+
+TEST( InverseKinematics, TwoBone )
+{
+    std::mt19937 rng( 3 );
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        IKChainf chain = makeChain( { 1.0f, 0.8f } );
+        chain.rotations[0] = normalize( QuaternionF { 1.0f, 0.2f, -0.3f, 0.1f } );
+        chain.rotations[1] = normalize( QuaternionF { 1.0f, 0.4f, 0.1f, 0.0f } );
+
+        const Vector3f target = chain.origin + randomPoint( rng, 1.2f );
+        const Vector3f pole   = chain.origin + randomPoint( rng, 3.0f );
+        const float    reach  = length( target - chain.origin );
+
+        const float error = solveTwoBone( chain, target, pole );
+        expectBoneLengths( chain );
+
+        if ( reach > 0.25f && reach < 1.75f )
+        {
+            EXPECT_LT( error, 1e-3f ) << i;
+
+            // The middle joint bends towards the pole.
+            const Vector3f axis = normalize( target - chain.origin );
+            const Vector3f mid  = chain.positions[1] - chain.origin;
+            const Vector3f p    = pole - chain.origin;
+            EXPECT_GT( dot( mid - axis * dot( mid, axis ), p - axis * dot( p, axis ) ), 0.0f ) << i;
+        }
+        else if ( reach >= 1.8f )
+        {
+            // Fully stretched towards the target.
+            EXPECT_NEAR( error, reach - 1.8f, 1e-3f );
+        }
+    }
+}
+
+TEST( InverseKinematics, TwoBoneBatch )
+{
+    std::mt19937 rng( 5 );
+
+    const std::size_t  count = 21;
+    std::vector<float> data[15];
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const Vector3f a = randomPoint( rng, 5.0f );
+        const Vector3f b = a + normalize( randomPoint( rng, 1.0f ) ) * 1.5f;
+        const Vector3f c = b + normalize( randomPoint( rng, 1.0f ) );
+        const Vector3f t = a + randomPoint( rng, 2.0f );
+        const Vector3f p = a + randomPoint( rng, 3.0f );
+
+        for ( std::size_t k = 0; k < 3; ++k )
+        {
+            data[k].push_back( a[k] );
+            data[3 + k].push_back( b[k] );
+            data[6 + k].push_back( c[k] );
+            data[9 + k].push_back( t[k] );
+            data[12 + k].push_back( p[k] );
+        }
+    }
+
+    const TwoBoneSoA<float> chains { data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7], data[8],
+                                     data[9], data[10], data[11], data[12], data[13], data[14] };
+
+    std::vector<QuaternionF> root( count ), mid( count );
+    solveTwoBone( chains, root, mid );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        const Vector3f a { data[0][i], data[1][i], data[2][i] };
+        const Vector3f b { data[3][i], data[4][i], data[5][i] };
+        const Vector3f c { data[6][i], data[7][i], data[8][i] };
+        const Vector3f t { data[9][i], data[10][i], data[11][i] };
+        const Vector3f p { data[12][i], data[13][i], data[14][i] };
+
+        QuaternionF r, m;
+        solveTwoBone( a, b, c, t, p, r, m );
+
+        for ( std::size_t k = 0; k < 4; ++k )
+        {
+            EXPECT_NEAR( root[i][k], r[k], 1e-4f ) << i;
+            EXPECT_NEAR( mid[i][k], m[k], 1e-4f ) << i;
+        }
+
+        // Apply the rotations to the bones.
+        const Vector3f b1 = a + root[i] * ( b - a );
+        const Vector3f c1 = b1 + mid[i] * ( c - b );
+        if ( length( t - a ) < 2.45f && length( t - a ) > 0.55f )
+        {
+            EXPECT_LT( length( c1 - t ), 1e-3f ) << i;
+        }
+    }
+}
+
+TEST( InverseKinematics, CCD )
+{
+    std::mt19937 rng( 7 );
+
+    for ( int i = 0; i < 50; ++i )
+    {
+        IKChainf       chain  = makeChain( { 1.0f, 1.0f, 0.5f, 0.5f } );
+        const Vector3f target = chain.origin + normalize( randomPoint( rng, 1.0f ) ) * 2.0f;
+
+        IKSettingsf settings;
+        settings.maxIterations = 64;
+
+        EXPECT_LT( solveCCD( chain, target, settings ), settings.tolerance ) << i;
+        expectBoneLengths( chain );
+    }
+
+    // Hinge joints stay within their limits.
+    IKChainf chain = makeChain( { 1.0f, 1.0f, 1.0f } );
+    chain.limits.resize( 3 );
+    for ( JointLimitf& limit: chain.limits )
+    {
+        limit.axis     = { 0.0f, 0.0f, 1.0f };
+        limit.minAngle = 0.0f;
+        limit.maxAngle = 1.0f;
+    }
+
+    IKSettingsf settings;
+    settings.maxIterations = 64;
+
+    // A target reached with the joint angles 0.3, 0.6 and 0.4.
+    Vector3f target = chain.origin;
+    for ( float angle: { 0.3f, 0.9f, 1.3f } )
+        target += Vector3f { -std::sin( angle ), std::cos( angle ), 0.0f };
+
+    const float error = solveCCD( chain, target, settings );
+    for ( const QuaternionF& q: chain.rotations )
+    {
+        const float angle = 2.0f * std::atan2( q.z, q.w );
+        EXPECT_NEAR( q.x, 0.0f, 1e-5f );
+        EXPECT_NEAR( q.y, 0.0f, 1e-5f );
+        EXPECT_GE( angle, -1e-5f );
+        EXPECT_LE( angle, 1.0f + 1e-5f );
+    }
+    EXPECT_LT( error, settings.tolerance );
+    expectBoneLengths( chain );
+}
+
+TEST( InverseKinematics, FABRIK )
+{
+    std::mt19937 rng( 11 );
+
+    for ( int i = 0; i < 50; ++i )
+    {
+        IKChainf       chain  = makeChain( { 1.0f, 1.0f, 0.5f, 0.5f } );
+        const Vector3f target = chain.origin + normalize( randomPoint( rng, 1.0f ) ) * 2.0f;
+
+        IKSettingsf settings;
+        settings.maxIterations = 64;
+
+        EXPECT_LT( solveFABRIK( chain, target, settings ), settings.tolerance ) << i;
+        expectBoneLengths( chain );
+    }
+
+    // Unreachable targets stretch the chain.
+    IKChainf       chain  = makeChain( { 1.0f, 1.0f } );
+    const Vector3f target = chain.origin + Vector3f { 3.0f, 0.0f, 0.0f };
+    EXPECT_NEAR( solveFABRIK( chain, target ), 1.0f, 1e-3f );
+
+    // Ball joints stay within their swing limits.
+    IKChainf limited = makeChain( { 1.0f, 1.0f, 1.0f } );
+    limited.limits.resize( 3 );
+    for ( JointLimitf& limit: limited.limits )
+        limit.maxSwing = 0.6f;
+
+    solveFABRIK( limited, limited.origin + Vector3f { 2.0f, 1.0f, 0.5f } );
+    for ( const QuaternionF& q: limited.rotations )
+        EXPECT_LE( std::acos( std::min( dot( q * Vector3f { 0.0f, 1.0f, 0.0f }, Vector3f { 0.0f, 1.0f, 0.0f } ), 1.0f ) ), 0.6f + 1e-3f );
+    expectBoneLengths( limited );
+}
+
+TEST( InverseKinematics, FABRIKBatch )
+{
+    std::mt19937 rng( 13 );
+
+    const std::size_t count  = 19;
+    const std::size_t joints = 5;
+
+    std::vector<float> x( count * joints ), y( count * joints ), z( count * joints ), lengths( count * ( joints - 1 ) );
+    std::vector<float> tx( count ), ty( count ), tz( count );
+
+    std::uniform_real_distribution<float> dist( 0.5f, 1.0f );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        Vector3f p     = randomPoint( rng, 10.0f );
+        float    total = 0.0f;
+        for ( std::size_t j = 0; j < joints; ++j )
+        {
+            x[j * count + i] = p.x;
+            y[j * count + i] = p.y;
+            z[j * count + i] = p.z;
+
+            if ( j + 1 < joints )
+            {
+                const float l              = dist( rng );
+                lengths[j * count + i]     = l;
+                total                     += l;
+                p                          = p + Vector3f { 0.0f, l, 0.0f };
+            }
+        }
+
+        // Alternate between reachable and unreachable targets.
+        const Vector3f root { x[i], y[i], z[i] };
+        const Vector3f t = root + normalize( randomPoint( rng, 1.0f ) ) * ( i % 3 == 0 ? total * 1.5f : total * 0.7f );
+        tx[i]            = t.x;
+        ty[i]            = t.y;
+        tz[i]            = t.z;
+    }
+
+    const std::vector<float> rootX( x.begin(), x.begin() + count );
+
+    IKSettingsf settings;
+    settings.maxIterations = 64;
+
+    solveFABRIK( IKChainSoA<float> { x, y, z, lengths, tx, ty, tz }, settings );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        EXPECT_EQ( x[i], rootX[i] );
+
+        float total = 0.0f;
+        for ( std::size_t j = 0; j + 1 < joints; ++j )
+        {
+            const Vector3f a { x[j * count + i], y[j * count + i], z[j * count + i] };
+            const Vector3f b { x[( j + 1 ) * count + i], y[( j + 1 ) * count + i], z[( j + 1 ) * count + i] };
+            EXPECT_NEAR( length( b - a ), lengths[j * count + i], 1e-4f );
+            total += lengths[j * count + i];
+        }
+
+        const std::size_t e = ( joints - 1 ) * count + i;
+        const Vector3f    root { x[i], y[i], z[i] };
+        const Vector3f    end { x[e], y[e], z[e] };
+        const Vector3f    target { tx[i], ty[i], tz[i] };
+
+        if ( i % 3 == 0 )
+        {
+            EXPECT_NEAR( length( end - target ), length( target - root ) - total, 1e-3f ) << i;
+        }
+        else
+        {
+            EXPECT_LT( length( end - target ), settings.tolerance * 1.01f ) << i;
+        }
+    }
+}
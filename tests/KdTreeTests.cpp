@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/KdTree.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+// Brute force k nearest neighbors (sorted by distance, then by index).
+static std::vector<std::pair<float, uint32_t>> bruteForce( std::span<const Vector3f> points, const Vector3f& q, std::size_t k )
+{
+    std::vector<std::pair<float, uint32_t>> all;
+    for ( uint32_t i = 0; i < points.size(); ++i )
+        all.push_back( { lengthSqr( points[i] - q ), i } );
+
+    std::sort( all.begin(), all.end() );
+    all.resize( std::min( k, all.size() ) );
+
+    return all;
+}
+
+TEST( Morton, Encode )
+{
+    ASSERT_EQ( mortonEncode( 0, 0, 0 ), 0u );
+    ASSERT_EQ( mortonEncode( 1, 0, 0 ), 4u );
+    ASSERT_EQ( mortonEncode( 0, 1, 0 ), 2u );
+    ASSERT_EQ( mortonEncode( 0, 0, 1 ), 1u );
+    ASSERT_EQ( mortonEncode( 1023, 1023, 1023 ), ( 1u << 30 ) - 1 );
+
+    const AABBf box { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+    ASSERT_EQ( mortonCode( Vector3f { -1.0f, 0.0f, 0.0f }, box ), 0u );
+    ASSERT_EQ( mortonCode( Vector3f { 2.0f, 2.0f, 2.0f }, box ), ( 1u << 30 ) - 1 );
+}
+
+TEST( KdTree, Empty )
+{
+    KdTreef tree;
+    ASSERT_TRUE( tree.empty() );
+
+    float d = 1.0f;
+    ASSERT_EQ( tree.nearest( Vector3f { 0.0f }, d ), KdTreef::INVALID_INDEX );
+
+    tree.build( {} );
+    ASSERT_TRUE( tree.empty() );
+}
+
+TEST( KdTree, Nearest )
+{
+    for ( std::size_t count: { 1u, 7u, 33u, 1000u, 20000u } )
+    {
+        const auto points = randomPoints( count, 10.0f, 42 );
+        KdTreef    tree( points, 8 );
+
+        ASSERT_EQ( tree.size(), count );
+
+        const auto queries = randomPoints( 100, 10.0f, 7 );
+        for ( const auto& q: queries )
+        {
+            const auto expected = bruteForce( points, q, 1 );
+
+            float          d = std::numeric_limits<float>::max();
+            const uint32_t i = tree.nearest( q, d );
+
+            ASSERT_EQ( d, expected[0].first );
+            ASSERT_EQ( lengthSqr( points[i] - q ), expected[0].first );
+        }
+    }
+}
+
+TEST( KdTree, KNearest )
+{
+    const auto points = randomPoints( 10000, 10.0f, 42 );
+    KdTreef    tree( points );
+
+    constexpr std::size_t k = 16;
+    uint32_t              indices[k];
+    float                 distances[k];
+
+    for ( const auto& q: randomPoints( 200, 10.0f, 3 ) )
+    {
+        const auto expected = bruteForce( points, q, k );
+
+        ASSERT_EQ( tree.nearest( q, indices, distances ), k );
+        for ( std::size_t i = 0; i < k; ++i )
+            ASSERT_EQ( distances[i], expected[i].first );
+    }
+
+    // Limited by distance.
+    const std::size_t n = tree.nearest( Vector3f { 0.0f }, indices, distances, 0.5f );
+    for ( std::size_t i = 0; i < n; ++i )
+        ASSERT_LT( distances[i], 0.5f );
+
+    const auto inside = std::count_if( points.begin(), points.end(), []( const Vector3f& p ) { return lengthSqr( p ) < 0.5f; } );
+    ASSERT_EQ( n, std::min<std::size_t>( k, inside ) );
+}
+
+TEST( KdTree, Duplicates )
+{
+    // Many points with equal coordinates on the split axis.
+    std::vector<Vector3f> points;
+    for ( int i = 0; i < 1000; ++i )
+        points.push_back( { static_cast<float>( i % 3 ), 0.0f, static_cast<float>( i % 5 ) } );
+
+    KdTreef tree( points, 4 );
+
+    for ( const auto& q: randomPoints( 50, 10.0f, 5 ) )
+    {
+        float d = std::numeric_limits<float>::max();
+        tree.nearest( q, d );
+        ASSERT_EQ( d, bruteForce( points, q, 1 )[0].first );
+    }
+}
+
+TEST( KdTree, Radius )
+{
+    const auto points = randomPoints( 10000, 10.0f, 42 );
+    KdTreef    tree( points );
+
+    for ( const auto& q: randomPoints( 50, 10.0f, 9 ) )
+    {
+        std::vector<uint32_t> found;
+        tree.radius( q, 2.0f, [&]( uint32_t i, float d ) {
+            ASSERT_LE( d, 4.0f );
+            found.push_back( i );
+        } );
+        std::sort( found.begin(), found.end() );
+
+        std::vector<uint32_t> expected;
+        for ( uint32_t i = 0; i < points.size(); ++i )
+        {
+            if ( lengthSqr( points[i] - q ) <= 4.0f )
+                expected.push_back( i );
+        }
+
+        ASSERT_EQ( found, expected );
+    }
+}
+
+TEST( KdTree, Batch )
+{
+    const auto points  = randomPoints( 20000, 10.0f, 42 );
+    const auto queries = randomPoints( 1000, 10.0f, 11 );
+
+    KdTreef tree( points );
+
+    constexpr std::size_t k = 4;
+    std::vector<uint32_t> indices( queries.size() * k );
+    std::vector<float>    distances( queries.size() * k );
+
+    tree.nearest( queries, k, indices, distances );
+
+    for ( std::size_t q = 0; q < queries.size(); ++q )
+    {
+        uint32_t   idx[k];
+        float      dist[k];
+        const auto n = tree.nearest( queries[q], idx, dist );
+
+        ASSERT_EQ( n, k );
+        for ( std::size_t i = 0; i < k; ++i )
+            ASSERT_EQ( distances[q * k + i], dist[i] );
+    }
+}
+
+TEST( KdTree, Deterministic )
+{
+    const auto points = randomPoints( 50000, 10.0f, 42 );
+
+    ThreadPool serial( 0 );
+    ThreadPool parallel( 4 );
+    KdTreef    a( points, 16, serial );
+    KdTreef    b( points, 16, parallel );
+
+    for ( const auto& q: randomPoints( 100, 10.0f, 13 ) )
+    {
+        float da = std::numeric_limits<float>::max();
+        float db = std::numeric_limits<float>::max();
+        ASSERT_EQ( a.nearest( q, da ), b.nearest( q, db ) );
+    }
+}
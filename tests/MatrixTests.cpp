@@ -1131,3 +1131,245 @@ TEST( Matrix, LookAtRH )
     ASSERT_EQ( m.Z, vec4::UNIT_Z );
     ASSERT_EQ( m.W, vec4::UNIT_W );
 }
+
+TEST( Matrix, EigenSymmetric )
+{
+    const Matrix3f m {
+        4.0f, 1.0f, 2.0f,
+        1.0f, 3.0f, 0.5f,
+        2.0f, 0.5f, 5.0f
+    };
+
+    Vector3f values;
+    Matrix3f vectors;
+    eigenSymmetric( m, values, vectors );
+
+    ASSERT_GE( values.x, values.y );
+    ASSERT_GE( values.y, values.z );
+    ASSERT_NEAR( values.x + values.y + values.z, 12.0f, 1e-4f );
+
+    for ( int i = 0; i < 3; ++i )
+    {
+        const Vector3f v { vectors[0][i], vectors[1][i], vectors[2][i] };
+        const Vector3f mv = m * v;
+
+        ASSERT_NEAR( length( v ), 1.0f, 1e-5f );
+        for ( int k = 0; k < 3; ++k )
+            ASSERT_NEAR( mv[k], values[i] * v[k], 1e-4f );
+    }
+}
+
+// Check that `inv` is the inverse of `m` (and matches the generic inverse).
+static void expectInverse( const Matrix4f& m, const Matrix4f& inv, float eps = 1e-5f )
+{
+    const Matrix4f I = m * inv;
+    const Matrix4f g = inverse( m );
+
+    for ( int i = 0; i < 4; ++i )
+        for ( int j = 0; j < 4; ++j )
+        {
+            EXPECT_NEAR( I[i][j], i == j ? 1.0f : 0.0f, eps ) << "[" << i << "][" << j << "]";
+            EXPECT_NEAR( inv[i][j], g[i][j], eps * std::max( 1.0f, std::abs( g[i][j] ) ) ) << "[" << i << "][" << j << "]";
+        }
+}
+
+TEST( Matrix, FrustumInverse )
+{
+    const float l = -2, r = 3, b = -1, t = 1.5f, n = 0.5f, f = 100;
+
+    expectInverse( frustumLH01( l, r, b, t, n, f ), frustumLH01Inverse( l, r, b, t, n, f ) );
+    expectInverse( frustumLH11( l, r, b, t, n, f ), frustumLH11Inverse( l, r, b, t, n, f ) );
+    expectInverse( frustumRH01( l, r, b, t, n, f ), frustumRH01Inverse( l, r, b, t, n, f ) );
+    expectInverse( frustumRH11( l, r, b, t, n, f ), frustumRH11Inverse( l, r, b, t, n, f ) );
+    expectInverse( frustum( l, r, b, t, n, f ), frustumInverse( l, r, b, t, n, f ) );
+}
+
+TEST( Matrix, OrthographicInverse )
+{
+    const float l = -20, r = 30, b = -10, t = 15, n = 0.1f, f = 50;
+
+    expectInverse( orthographicLH01( l, r, b, t, n, f ), orthographicLH01Inverse( l, r, b, t, n, f ) );
+    expectInverse( orthographicLH11( l, r, b, t, n, f ), orthographicLH11Inverse( l, r, b, t, n, f ) );
+    expectInverse( orthographicRH01( l, r, b, t, n, f ), orthographicRH01Inverse( l, r, b, t, n, f ) );
+    expectInverse( orthographicRH11( l, r, b, t, n, f ), orthographicRH11Inverse( l, r, b, t, n, f ) );
+    expectInverse( orthographic( l, r, b, t, n, f ), orthographicInverse( l, r, b, t, n, f ) );
+}
+
+TEST( Matrix, PerspectiveInverse )
+{
+    const float fovy = radians( 60.0f ), aspect = 16.0f / 9.0f, w = 1.6f, h = 0.9f, n = 0.1f, f = 1000;
+
+    expectInverse( perspectiveFoVLH01( fovy, aspect, n, f ), perspectiveFoVLH01Inverse( fovy, aspect, n, f ) );
+    expectInverse( perspectiveFoVLH11( fovy, aspect, n, f ), perspectiveFoVLH11Inverse( fovy, aspect, n, f ) );
+    expectInverse( perspectiveFoVRH01( fovy, aspect, n, f ), perspectiveFoVRH01Inverse( fovy, aspect, n, f ) );
+    expectInverse( perspectiveFoVRH11( fovy, aspect, n, f ), perspectiveFoVRH11Inverse( fovy, aspect, n, f ) );
+    expectInverse( perspectiveFoV( fovy, aspect, n, f ), perspectiveFoVInverse( fovy, aspect, n, f ) );
+
+    expectInverse( perspectiveLH01( w, h, n, f ), perspectiveLH01Inverse( w, h, n, f ) );
+    expectInverse( perspectiveLH11( w, h, n, f ), perspectiveLH11Inverse( w, h, n, f ) );
+    expectInverse( perspectiveRH01( w, h, n, f ), perspectiveRH01Inverse( w, h, n, f ) );
+    expectInverse( perspectiveRH11( w, h, n, f ), perspectiveRH11Inverse( w, h, n, f ) );
+    expectInverse( perspective( w, h, n, f ), perspectiveInverse( w, h, n, f ) );
+
+    // The structural inverse works for any projection matrix.
+    expectInverse( perspectiveFoVRH01( fovy, aspect, n, f ), projectionInverse( perspectiveFoVRH01( fovy, aspect, n, f ) ) );
+    expectInverse( frustumLH11( -1.0f, 2.0f, -0.5f, 1.0f, n, f ), projectionInverse( frustumLH11( -1.0f, 2.0f, -0.5f, 1.0f, n, f ) ) );
+    expectInverse( orthographicRH11( -1.0f, 2.0f, -0.5f, 1.0f, n, f ), projectionInverse( orthographicRH11( -1.0f, 2.0f, -0.5f, 1.0f, n, f ) ) );
+}
+
+TEST( Matrix, ViewInverse )
+{
+    const Vector3f eye { 1, 2, 3 }, target { -4, 0.5f, 7 }, up { 0.1f, 1, 0 };
+
+    expectInverse( lookAtLH( eye, target, up ), lookAtLHInverse( eye, target, up ) );
+    expectInverse( lookAtRH( eye, target, up ), lookAtRHInverse( eye, target, up ) );
+    expectInverse( lookAt( eye, target, up ), lookAtInverse( eye, target, up ) );
+    expectInverse( lookToLH( eye, target - eye, up ), lookToLHInverse( eye, target - eye, up ) );
+    expectInverse( lookToRH( eye, target - eye, up ), lookToRHInverse( eye, target - eye, up ) );
+    expectInverse( lookTo( eye, target - eye, up ), lookToInverse( eye, target - eye, up ) );
+    expectInverse( lookAtRH( eye, target, up ), viewInverse( lookAtRH( eye, target, up ) ) );
+
+    // The inverse view matrix transforms the origin to the eye position.
+    const Vector4f p = lookAtInverse( eye, target, up ) * Vector4f { 0, 0, 0, 1 };
+    EXPECT_FLOAT_EQ( p.x, eye.x );
+    EXPECT_FLOAT_EQ( p.y, eye.y );
+    EXPECT_FLOAT_EQ( p.z, eye.z );
+}
+
+TEST( Matrix, ViewProjectionInverse )
+{
+    const Matrix4f view       = lookAtRH<float>( { 5, 3, -2 }, { 0, 0, 0 } );
+    const Matrix4f projection = perspectiveFoVRH01( radians( 75.0f ), 1.5f, 0.1f, 100.0f );
+    const Matrix4f inv        = viewProjectionInverse( view, projection );
+
+    // Unproject a world-space point from clip space.
+    const Vector4f world { 0.5f, -1.0f, 2.0f, 1.0f };
+    const Vector4f clip  = projection * ( view * world );
+    const Vector4f p     = inv * ( clip / clip.w );
+
+    EXPECT_NEAR( p.x / p.w, world.x, 1e-4f );
+    EXPECT_NEAR( p.y / p.w, world.y, 1e-4f );
+    EXPECT_NEAR( p.z / p.w, world.z, 1e-4f );
+
+    expectInverse( projection * view, inv, 1e-4f );
+}
+
+using LH01 = ClipSpace<Handedness::Left, DepthRange::ZeroToOne>;
+using LH11 = ClipSpace<Handedness::Left, DepthRange::NegativeOneToOne>;
+using RH01 = ClipSpace<Handedness::Right, DepthRange::ZeroToOne>;
+using RH11 = ClipSpace<Handedness::Right, DepthRange::NegativeOneToOne>;
+using LH10 = ClipSpace<Handedness::Left, DepthRange::OneToZero>;
+using RH10 = ClipSpace<Handedness::Right, DepthRange::OneToZero>;
+
+TEST( Matrix, ClipSpacePolicy )
+{
+    const float l = -2, r = 3, b = -1, t = 1.5f, n = 0.5f, f = 100, fovy = radians( 60.0f ), aspect = 1.5f;
+
+    // The policy overloads match the functions for each configuration.
+    EXPECT_EQ( frustum<LH01>( l, r, b, t, n, f ), frustumLH01( l, r, b, t, n, f ) );
+    EXPECT_EQ( frustum<LH11>( l, r, b, t, n, f ), frustumLH11( l, r, b, t, n, f ) );
+    EXPECT_EQ( frustum<RH01>( l, r, b, t, n, f ), frustumRH01( l, r, b, t, n, f ) );
+    EXPECT_EQ( frustum<RH11>( l, r, b, t, n, f ), frustumRH11( l, r, b, t, n, f ) );
+    EXPECT_EQ( frustum<DefaultClipSpace>( l, r, b, t, n, f ), frustum( l, r, b, t, n, f ) );
+
+    EXPECT_EQ( orthographic<LH01>( l, r, b, t, n, f ), orthographicLH01( l, r, b, t, n, f ) );
+    EXPECT_EQ( orthographic<LH11>( l, r, b, t, n, f ), orthographicLH11( l, r, b, t, n, f ) );
+    EXPECT_EQ( orthographic<RH01>( l, r, b, t, n, f ), orthographicRH01( l, r, b, t, n, f ) );
+    EXPECT_EQ( orthographic<RH11>( l, r, b, t, n, f ), orthographicRH11( l, r, b, t, n, f ) );
+
+    EXPECT_EQ( perspectiveFoV<LH01>( fovy, aspect, n, f ), perspectiveFoVLH01( fovy, aspect, n, f ) );
+    EXPECT_EQ( perspectiveFoV<LH11>( fovy, aspect, n, f ), perspectiveFoVLH11( fovy, aspect, n, f ) );
+    EXPECT_EQ( perspectiveFoV<RH01>( fovy, aspect, n, f ), perspectiveFoVRH01( fovy, aspect, n, f ) );
+    EXPECT_EQ( perspectiveFoV<RH11>( fovy, aspect, n, f ), perspectiveFoVRH11( fovy, aspect, n, f ) );
+
+    EXPECT_EQ( perspective<LH01>( r, t, n, f ), perspectiveLH01( r, t, n, f ) );
+    EXPECT_EQ( perspective<LH11>( r, t, n, f ), perspectiveLH11( r, t, n, f ) );
+    EXPECT_EQ( perspective<RH01>( r, t, n, f ), perspectiveRH01( r, t, n, f ) );
+    EXPECT_EQ( perspective<RH11>( r, t, n, f ), perspectiveRH11( r, t, n, f ) );
+
+    const Vector3f eye { 1, 2, 3 }, target { -4, 0.5f, 7 };
+    EXPECT_EQ( lookAt<LH01>( eye, target ), lookAtLH( eye, target ) );
+    EXPECT_EQ( lookAt<RH11>( eye, target ), lookAtRH( eye, target ) );
+    EXPECT_EQ( lookTo<LH11>( eye, target ), lookToLH( eye, target ) );
+    EXPECT_EQ( lookTo<RH01>( eye, target ), lookToRH( eye, target ) );
+    EXPECT_EQ( lookAtInverse<RH01>( eye, target ), lookAtRHInverse( eye, target ) );
+    EXPECT_EQ( lookToInverse<LH01>( eye, target ), lookToLHInverse( eye, target ) );
+
+    expectInverse( frustum<RH11>( l, r, b, t, n, f ), frustumInverse<RH11>( l, r, b, t, n, f ) );
+    expectInverse( orthographic<LH11>( l, r, b, t, n, f ), orthographicInverse<LH11>( l, r, b, t, n, f ) );
+    expectInverse( perspectiveFoV<RH01>( fovy, aspect, n, f ), perspectiveFoVInverse<RH01>( fovy, aspect, n, f ) );
+    expectInverse( perspective<LH11>( r, t, n, f ), perspectiveInverse<LH11>( r, t, n, f ) );
+}
+
+TEST( Matrix, ReverseZ )
+{
+    const float n = 0.1f, f = 1000.0f, fovy = radians( 90.0f );
+
+    // The near plane maps to 1 and the far plane maps to 0.
+    {
+        const Matrix4f m     = perspectiveFoV<LH10>( fovy, 1.0f, n, f );
+        const Vector4f near_ = m * Vector4f { 0.0f, 0.0f, n, 1.0f };
+        const Vector4f far_  = m * Vector4f { 0.0f, 0.0f, f, 1.0f };
+
+        EXPECT_FLOAT_EQ( near_.z / near_.w, 1.0f );
+        EXPECT_NEAR( far_.z / far_.w, 0.0f, 1e-6f );
+        expectInverse( m, perspectiveFoVInverse<LH10>( fovy, 1.0f, n, f ) );
+    }
+    {
+        const Matrix4f m     = frustum<RH10>( -1.0f, 2.0f, -1.0f, 0.5f, n, f );
+        const Vector4f near_ = m * Vector4f { 0.0f, 0.0f, -n, 1.0f };
+        const Vector4f far_  = m * Vector4f { 0.0f, 0.0f, -f, 1.0f };
+
+        EXPECT_FLOAT_EQ( near_.z / near_.w, 1.0f );
+        EXPECT_NEAR( far_.z / far_.w, 0.0f, 1e-6f );
+        expectInverse( m, frustumInverse<RH10>( -1.0f, 2.0f, -1.0f, 0.5f, n, f ) );
+    }
+    {
+        const Matrix4f m     = orthographic<RH10>( -1.0f, 1.0f, -1.0f, 1.0f, n, f );
+        const Vector4f near_ = m * Vector4f { 0.0f, 0.0f, -n, 1.0f };
+        const Vector4f far_  = m * Vector4f { 0.0f, 0.0f, -f, 1.0f };
+
+        EXPECT_NEAR( near_.z, 1.0f, 1e-6f );
+        EXPECT_NEAR( far_.z, 0.0f, 1e-6f );
+        expectInverse( m, orthographicInverse<RH10>( -1.0f, 1.0f, -1.0f, 1.0f, n, f ), 1e-4f );
+    }
+}
+
+TEST( Matrix, InfiniteFarPlane )
+{
+    const float n = 0.1f, fovy = radians( 60.0f );
+
+    // The infinite projection is the limit of the finite projection.
+    {
+        const Matrix4f a = perspectiveFoVInfinite<RH11>( fovy, 1.5f, n );
+        const Matrix4f b = perspectiveFoV<RH11>( fovy, 1.5f, n, 1e7f );
+
+        for ( int i = 0; i < 4; ++i )
+            for ( int j = 0; j < 4; ++j )
+                EXPECT_NEAR( a[i][j], b[i][j], 1e-5f );
+    }
+
+    // Points far away map to the far depth.
+    {
+        const Matrix4f m     = perspectiveFoVInfinite<LH01>( fovy, 1.0f, n );
+        const Vector4f near_ = m * Vector4f { 0.0f, 0.0f, n, 1.0f };
+        const Vector4f far_  = m * Vector4f { 0.0f, 0.0f, 1e6f, 1.0f };
+
+        EXPECT_FLOAT_EQ( near_.z / near_.w, 0.0f );
+        EXPECT_NEAR( far_.z / far_.w, 1.0f, 1e-6f );
+    }
+    {
+        const Matrix4f m     = perspectiveInfinite<RH10>( 0.2f, 0.1f, n );
+        const Vector4f near_ = m * Vector4f { 0.0f, 0.0f, -n, 1.0f };
+        const Vector4f far_  = m * Vector4f { 0.0f, 0.0f, -1e6f, 1.0f };
+
+        EXPECT_FLOAT_EQ( near_.z / near_.w, 1.0f );
+        EXPECT_NEAR( far_.z / far_.w, 0.0f, 1e-6f );
+    }
+
+    expectInverse( perspectiveFoVInfinite<LH11>( fovy, 1.5f, n ), perspectiveFoVInfiniteInverse<LH11>( fovy, 1.5f, n ) );
+    expectInverse( perspectiveFoVInfinite<RH10>( fovy, 1.5f, n ), perspectiveFoVInfiniteInverse<RH10>( fovy, 1.5f, n ) );
+    expectInverse( perspectiveInfinite( 0.2f, 0.1f, n ), perspectiveInfiniteInverse( 0.2f, 0.1f, n ) );
+    expectInverse( frustumInfinite<RH01>( -0.1f, 0.2f, -0.1f, 0.1f, n ), frustumInfiniteInverse<RH01>( -0.1f, 0.2f, -0.1f, 0.1f, n ) );
+    expectInverse( perspectiveFoVInfinite<RH10>( fovy, 1.5f, n ), projectionInverse( perspectiveFoVInfinite<RH10>( fovy, 1.5f, n ) ) );
+}
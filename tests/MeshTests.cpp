@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Mesh.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+// A regular grid in the xy-plane with texture coordinates equal to the positions.
+static void grid( int size, std::vector<Vector3f>& positions, std::vector<Vector2f>& texCoords, std::vector<uint32_t>& indices )
+{
+    for ( int y = 0; y <= size; ++y )
+    {
+        for ( int x = 0; x <= size; ++x )
+        {
+            positions.push_back( { static_cast<float>( x ), static_cast<float>( y ), 0.0f } );
+            texCoords.push_back( { static_cast<float>( x ), static_cast<float>( y ) } );
+        }
+    }
+
+    for ( int y = 0; y < size; ++y )
+    {
+        for ( int x = 0; x < size; ++x )
+        {
+            const uint32_t i = y * ( size + 1 ) + x;
+            indices.insert( indices.end(), { i, i + 1, i + size + 2, i, i + size + 2, i + size + 1 } );
+        }
+    }
+}
+
+// A random, noisy sphere-like mesh with shared vertices.
+static void randomMesh( std::size_t vertexCount, std::size_t triangleCount, std::vector<Vector3f>& positions, std::vector<uint32_t>& indices )
+{
+    std::mt19937                            rng( 42 );
+    std::uniform_real_distribution<float>   pos( -1.0f, 1.0f );
+    std::uniform_int_distribution<uint32_t> index( 0, static_cast<uint32_t>( vertexCount - 1 ) );
+
+    for ( std::size_t i = 0; i < vertexCount; ++i )
+        positions.push_back( { pos( rng ), pos( rng ), pos( rng ) } );
+
+    for ( std::size_t i = 0; i < triangleCount * 3; ++i )
+        indices.push_back( index( rng ) );
+}
+
+TEST( Mesh, Adjacency )
+{
+    const std::vector<uint32_t> indices { 0, 1, 2, 2, 1, 3, 3, 4, 2 };
+    const VertexAdjacency       adjacency( 6, indices );
+
+    ASSERT_EQ( adjacency[0].size(), 1u );
+    ASSERT_EQ( adjacency[2].size(), 3u );
+    ASSERT_EQ( adjacency[5].size(), 0u );
+
+    ASSERT_EQ( adjacency[2][0], 2u );
+    ASSERT_EQ( adjacency[2][1], 3u );
+    ASSERT_EQ( adjacency[2][2], 8u );
+}
+
+TEST( Mesh, FaceNormals )
+{
+    std::vector<Vector3f> positions;
+    std::vector<uint32_t> indices;
+    randomMesh( 1000, 1003, positions, indices );
+
+    std::vector<Vector3f> faceNormals( indices.size() / 3 );
+    computeFaceNormals<float>( positions, indices, faceNormals );
+
+    for ( std::size_t i = 0; i < faceNormals.size(); ++i )
+    {
+        const Vector3f& p0 = positions[indices[i * 3]];
+        const Vector3f  n  = cross( positions[indices[i * 3 + 1]] - p0, positions[indices[i * 3 + 2]] - p0 );
+
+        ASSERT_NEAR( faceNormals[i].x, n.x, 1e-5f );
+        ASSERT_NEAR( faceNormals[i].y, n.y, 1e-5f );
+        ASSERT_NEAR( faceNormals[i].z, n.z, 1e-5f );
+    }
+}
+
+TEST( Mesh, Normals )
+{
+    std::vector<Vector3f> positions;
+    std::vector<Vector2f> texCoords;
+    std::vector<uint32_t> indices;
+    grid( 4, positions, texCoords, indices );
+
+    std::vector<Vector3f> normals( positions.size() );
+    computeNormals<float>( positions, indices, normals );
+
+    for ( const auto& n: normals )
+    {
+        ASSERT_EQ( n.x, 0.0f );
+        ASSERT_EQ( n.y, 0.0f );
+        ASSERT_NEAR( n.z, 1.0f, 1e-6f );
+    }
+}
+
+TEST( Mesh, Normals_AreaWeighted )
+{
+    // Vertex 0 is shared by a large triangle facing +z and a small triangle facing +x.
+    const std::vector<Vector3f> positions {
+        { 0.0f, 0.0f, 0.0f }, { 4.0f, 0.0f, 0.0f }, { 0.0f, 4.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }
+    };
+    const std::vector<uint32_t> indices { 0, 1, 2, 0, 3, 4 };
+
+    std::vector<Vector3f> normals( positions.size() );
+    computeNormals<float>( positions, indices, normals );
+
+    const Vector3f expected = normalize( Vector3f { 1.0f, 0.0f, 16.0f } );
+    ASSERT_NEAR( normals[0].x, expected.x, 1e-6f );
+    ASSERT_NEAR( normals[0].z, expected.z, 1e-6f );
+}
+
+TEST( Mesh, Deterministic )
+{
+    std::vector<Vector3f> positions;
+    std::vector<uint32_t> indices;
+    randomMesh( 20000, 60000, positions, indices );
+
+    ThreadPool serial( 0 );
+    ThreadPool parallel( 4 );
+
+    std::vector<Vector3f> a( positions.size() ), b( positions.size() );
+    computeNormals<float>( positions, indices, a, serial );
+    computeNormals<float>( positions, indices, b, parallel );
+
+    for ( std::size_t i = 0; i < a.size(); ++i )
+    {
+        ASSERT_EQ( a[i].x, b[i].x );
+        ASSERT_EQ( a[i].y, b[i].y );
+        ASSERT_EQ( a[i].z, b[i].z );
+    }
+}
+
+TEST( Mesh, Tangents )
+{
+    std::vector<Vector3f> positions;
+    std::vector<Vector2f> texCoords;
+    std::vector<uint32_t> indices;
+    grid( 4, positions, texCoords, indices );
+
+    std::vector<Vector3f> normals( positions.size() );
+    std::vector<Vector4f> tangents( positions.size() );
+    computeNormals<float>( positions, indices, normals );
+    computeTangents<float>( positions, normals, texCoords, indices, tangents );
+
+    for ( const auto& t: tangents )
+    {
+        ASSERT_NEAR( t.x, 1.0f, 1e-6f );
+        ASSERT_NEAR( t.y, 0.0f, 1e-6f );
+        ASSERT_NEAR( t.z, 0.0f, 1e-6f );
+        ASSERT_EQ( t.w, 1.0f );
+    }
+
+    // Mirroring the texture horizontally flips the tangent and the handedness.
+    for ( auto& uv: texCoords )
+        uv.x = -uv.x;
+
+    computeTangents<float>( positions, normals, texCoords, indices, tangents );
+
+    for ( const auto& t: tangents )
+    {
+        ASSERT_NEAR( t.x, -1.0f, 1e-6f );
+        ASSERT_EQ( t.w, -1.0f );
+    }
+}
+
+TEST( Mesh, Tangents_Orthonormal )
+{
+    std::vector<Vector3f> positions;
+    std::vector<uint32_t> indices;
+    randomMesh( 2000, 4000, positions, indices );
+
+    std::mt19937                          rng( 1 );
+    std::uniform_real_distribution<float> uv( 0.0f, 1.0f );
+    std::vector<Vector2f>                 texCoords;
+    for ( std::size_t i = 0; i < positions.size(); ++i )
+        texCoords.push_back( { uv( rng ), uv( rng ) } );
+
+    std::vector<Vector3f> normals( positions.size() );
+    std::vector<Vector4f> tangents( positions.size() );
+    computeNormals<float>( positions, indices, normals );
+    computeTangents<float>( positions, normals, texCoords, indices, tangents );
+
+    for ( std::size_t i = 0; i < positions.size(); ++i )
+    {
+        if ( lengthSqr( normals[i] ) == 0.0f )
+            continue;
+
+        const Vector3f t { tangents[i].x, tangents[i].y, tangents[i].z };
+        ASSERT_NEAR( length( t ), 1.0f, 1e-4f );
+        ASSERT_NEAR( dot( t, normals[i] ), 0.0f, 1e-4f );
+        ASSERT_EQ( std::abs( tangents[i].w ), 1.0f );
+    }
+
+    // Sharing the adjacency between normals and tangents gives the same result.
+    const VertexAdjacency adjacency( positions.size(), indices );
+    std::vector<Vector3f> sharedNormals( positions.size() );
+    std::vector<Vector4f> sharedTangents( positions.size() );
+    computeNormals<float>( positions, indices, adjacency, sharedNormals );
+    computeTangents<float>( positions, sharedNormals, texCoords, indices, adjacency, sharedTangents );
+
+    for ( std::size_t i = 0; i < positions.size(); ++i )
+    {
+        ASSERT_EQ( sharedNormals[i], normals[i] );
+        ASSERT_EQ( sharedTangents[i], tangents[i] );
+    }
+}
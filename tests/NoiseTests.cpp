@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Noise.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+template<Noise K, typename T, std::size_t N>
+static T evaluate( const Vector<T, N>& p, Vector<T, N>& derivative )
+{
+    if constexpr ( K == Noise::Perlin )
+        return perlin( p, derivative );
+    else if constexpr ( K == Noise::Simplex )
+        return simplex( p, derivative );
+    else
+        return valueNoise( p, derivative );
+}
+
+template<Noise K, std::size_t N>
+static void testRange()
+{
+    double minValue = 0.0, maxValue = 0.0;
+    for ( const auto& p: randomPoints<double, N>( 100'000, 100.0, 1 ) )
+    {
+        Vector<double, N> derivative;
+        const double      value = evaluate<K>( p, derivative );
+
+        ASSERT_LE( std::abs( value ), 1.0 );
+        minValue = std::min( minValue, value );
+        maxValue = std::max( maxValue, value );
+    }
+
+    // The noise covers most of the range.
+    EXPECT_LT( minValue, -0.4 );
+    EXPECT_GT( maxValue, 0.4 );
+}
+
+template<Noise K, std::size_t N>
+static void testContinuity()
+{
+    // Walk along random lines in small steps, crossing many cells.
+    const double step = 1e-3;
+    for ( const auto& p: randomPoints<double, N>( 20, 10.0, 2 ) )
+    {
+        const Vector<double, N> direction = normalize( randomPoints<double, N>( 1, 1.0, static_cast<unsigned>( p[0] * 1000.0 ) + 3 )[0] );
+
+        Vector<double, N> derivative;
+        double            previous = evaluate<K>( p, derivative );
+        double            slope    = dot( derivative, direction );
+        for ( int i = 1; i < 5000; ++i )
+        {
+            const double value = evaluate<K>( p + direction * ( i * step ), derivative );
+
+            // The change between consecutive values is bounded by the slope (up to the curvature).
+            ASSERT_LE( std::abs( value - previous ), std::max( std::abs( slope ), std::abs( dot( derivative, direction ) ) ) * step + 1e-4 ) << i;
+
+            previous = value;
+            slope    = dot( derivative, direction );
+        }
+    }
+}
+
+template<Noise K, std::size_t N>
+static void testDerivative()
+{
+    const double h = 1e-6;
+    for ( const auto& p: randomPoints<double, N>( 1000, 50.0, 4 ) )
+    {
+        Vector<double, N> derivative, unused;
+        evaluate<K>( p, derivative );
+
+        for ( std::size_t d = 0; d < N; ++d )
+        {
+            Vector<double, N> offset { 0.0 };
+            offset[d] = h;
+
+            const double expected = ( evaluate<K>( p + offset, unused ) - evaluate<K>( p - offset, unused ) ) / ( 2.0 * h );
+            ASSERT_NEAR( derivative[d], expected, 1e-6 * ( 1.0 + std::abs( expected ) ) );
+        }
+    }
+}
+
+template<Noise K, std::size_t N>
+static void testBatch()
+{
+    // Includes several chunks and a partial block of 8 points.
+    const std::size_t                   count  = 2 * detail::NOISE_GRAIN_SIZE + 13;
+    const std::vector<Vector<float, N>> points = randomPoints<float, N>( count, 30.0f, 5 );
+
+    std::array<std::vector<float>, N> coordinates, derivatives;
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        derivatives[d].resize( count );
+        for ( const auto& p: points )
+            coordinates[d].push_back( p[d] );
+    }
+
+    std::array<std::span<const float>, N> p;
+    std::array<std::span<float>, N>       dp;
+    for ( std::size_t d = 0; d < N; ++d )
+    {
+        p[d]  = coordinates[d];
+        dp[d] = derivatives[d];
+    }
+
+    std::vector<float> values( count );
+    if constexpr ( K == Noise::Perlin )
+        perlin<float, N>( p, values, dp );
+    else if constexpr ( K == Noise::Simplex )
+        simplex<float, N>( p, values, dp );
+    else
+        valueNoise<float, N>( p, values, dp );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        Vector<float, N> derivative;
+        ASSERT_NEAR( values[i], evaluate<K>( points[i], derivative ), 1e-5f ) << i;
+
+        for ( std::size_t d = 0; d < N; ++d )
+            ASSERT_NEAR( derivatives[d][i], derivative[d], 1e-4f * ( 1.0f + std::abs( derivative[d] ) ) ) << i;
+    }
+
+    // Fractal noise.
+    fbm<K, float, N>( p, values, 5, 2.0f, 0.5f, dp );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        Vector<float, N> derivative;
+        ASSERT_NEAR( values[i], fbm<K>( points[i], derivative, 5 ), 1e-5f ) << i;
+        ASSERT_LE( std::abs( values[i] ), 1.0f );
+
+        for ( std::size_t d = 0; d < N; ++d )
+            ASSERT_NEAR( derivatives[d][i], derivative[d], 1e-4f * ( 1.0f + std::abs( derivative[d] ) ) ) << i;
+    }
+
+    turbulence<K, float, N>( p, values, 4, 1.9f, 0.6f );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        ASSERT_NEAR( values[i], turbulence<K>( points[i], 4, 1.9f, 0.6f ), 1e-5f ) << i;
+        ASSERT_GE( values[i], 0.0f );
+        ASSERT_LE( values[i], 1.0f );
+    }
+
+    // Seeded noise.
+    fbm<K, float, N>( p, values, 3, 2.0f, 0.5f, {}, 7 );
+    for ( std::size_t i = 0; i < count; ++i )
+        ASSERT_NEAR( values[i], fbm<K>( points[i], 3, 2.0f, 0.5f, 7 ), 1e-5f ) << i;
+}
+
+TEST( Noise, Range )
+{
+    testRange<Noise::Perlin, 2>();
+    testRange<Noise::Perlin, 3>();
+    testRange<Noise::Perlin, 4>();
+    testRange<Noise::Simplex, 2>();
+    testRange<Noise::Simplex, 3>();
+    testRange<Noise::Simplex, 4>();
+    testRange<Noise::Value, 2>();
+    testRange<Noise::Value, 3>();
+    testRange<Noise::Value, 4>();
+
+    // Perlin noise is 0 on the integer lattice.
+    for ( int x = -3; x <= 3; ++x )
+    {
+        for ( int y = -3; y <= 3; ++y )
+        {
+            EXPECT_EQ( perlin( Vector2f { float( x ), float( y ) } ), 0.0f );
+            EXPECT_EQ( perlin( Vector3d { double( x ), double( y ), 0.0 } ), 0.0 );
+
+            // Value noise is flat on the integer lattice.
+            Vector2d derivative;
+            valueNoise( Vector2d { double( x ), double( y ) }, derivative );
+            EXPECT_EQ( derivative, Vector2d { 0.0 } );
+        }
+    }
+}
+
+TEST( Noise, Continuity )
+{
+    testContinuity<Noise::Perlin, 2>();
+    testContinuity<Noise::Perlin, 3>();
+    testContinuity<Noise::Perlin, 4>();
+    testContinuity<Noise::Simplex, 2>();
+    testContinuity<Noise::Simplex, 3>();
+    testContinuity<Noise::Simplex, 4>();
+    testContinuity<Noise::Value, 2>();
+    testContinuity<Noise::Value, 3>();
+    testContinuity<Noise::Value, 4>();
+}
+
+TEST( Noise, Derivative )
+{
+    testDerivative<Noise::Perlin, 2>();
+    testDerivative<Noise::Perlin, 3>();
+    testDerivative<Noise::Perlin, 4>();
+    testDerivative<Noise::Simplex, 2>();
+    testDerivative<Noise::Simplex, 3>();
+    testDerivative<Noise::Simplex, 4>();
+    testDerivative<Noise::Value, 2>();
+    testDerivative<Noise::Value, 3>();
+    testDerivative<Noise::Value, 4>();
+
+    // Fractal noise.
+    const double h = 1e-6;
+    for ( const auto& p: randomPoints<double, 3>( 200, 20.0, 6 ) )
+    {
+        Vector3d derivative, unused;
+        fbm( p, derivative, 6 );
+
+        for ( std::size_t d = 0; d < 3; ++d )
+        {
+            Vector3d offset { 0.0 };
+            offset[d] = h;
+
+            const double expected = ( fbm( p + offset, 6 ) - fbm( p - offset, 6 ) ) / ( 2.0 * h );
+            ASSERT_NEAR( derivative[d], expected, 1e-5 * ( 1.0 + std::abs( expected ) ) );
+        }
+    }
+
+    // A single octave is the noise itself.
+    const Vector4f p { 1.3f, -2.7f, 0.2f, 8.9f };
+    EXPECT_EQ( fbm<Noise::Perlin>( p, 1 ), perlin( p ) );
+    EXPECT_EQ( fbm<Noise::Simplex>( p, 1 ), simplex( p ) );
+    EXPECT_EQ( fbm<Noise::Value>( p, 1 ), valueNoise( p ) );
+    EXPECT_EQ( turbulence( p, 1 ), std::abs( simplex( p ) ) );
+}
+
+TEST( Noise, Seed )
+{
+    const auto points = randomPoints<double, 3>( 1000, 20.0, 7 );
+
+    // The default seed is 0, and different seeds give uncorrelated noise.
+    double sum01 = 0.0, sum00 = 0.0, sum11 = 0.0;
+    for ( const auto& p: points )
+    {
+        EXPECT_EQ( fbm( p, 4 ), fbm( p, 4, 2.0, 0.5, 0 ) );
+        EXPECT_EQ( perlin( p ), perlin( p, 0 ) );
+
+        const double a = fbm( p, 4, 2.0, 0.5, 1 );
+        const double b = fbm( p, 4, 2.0, 0.5, 2 );
+        sum01 += a * b;
+        sum00 += a * a;
+        sum11 += b * b;
+    }
+
+    EXPECT_LT( std::abs( sum01 ) / std::sqrt( sum00 * sum11 ), 0.1 );
+}
+
+TEST( Noise, Batch )
+{
+    testBatch<Noise::Perlin, 2>();
+    testBatch<Noise::Perlin, 3>();
+    testBatch<Noise::Perlin, 4>();
+    testBatch<Noise::Simplex, 2>();
+    testBatch<Noise::Simplex, 3>();
+    testBatch<Noise::Simplex, 4>();
+    testBatch<Noise::Value, 2>();
+    testBatch<Noise::Value, 3>();
+    testBatch<Noise::Value, 4>();
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/OBB.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+// Reference SAT: project the corners of both boxes onto each candidate axis.
+static bool referenceIntersects( const OBBf& a, const OBBf& b )
+{
+    auto corners = []( const OBBf& o, Vector3f* out ) {
+        for ( int i = 0; i < 8; ++i )
+        {
+            const Vector3f s { ( i & 1 ) ? 1.0f : -1.0f, ( i & 2 ) ? 1.0f : -1.0f, ( i & 4 ) ? 1.0f : -1.0f };
+            out[i] = o.center + o.rotation * ( s * o.halfExtents );
+        }
+    };
+
+    Vector3f ca[8], cb[8];
+    corners( a, ca );
+    corners( b, cb );
+
+    std::vector<Vector3f> axes;
+    for ( int i = 0; i < 3; ++i )
+    {
+        axes.push_back( axis( a, i ) );
+        axes.push_back( axis( b, i ) );
+        for ( int j = 0; j < 3; ++j )
+        {
+            const Vector3f c = cross( axis( a, i ), axis( b, j ) );
+            if ( lengthSqr( c ) > 1e-6f )
+                axes.push_back( c );
+        }
+    }
+
+    for ( const auto& n: axes )
+    {
+        float minA = dot( n, ca[0] ), maxA = minA, minB = dot( n, cb[0] ), maxB = minB;
+        for ( int i = 1; i < 8; ++i )
+        {
+            minA = std::min( minA, dot( n, ca[i] ) );
+            maxA = std::max( maxA, dot( n, ca[i] ) );
+            minB = std::min( minB, dot( n, cb[i] ) );
+            maxB = std::max( maxB, dot( n, cb[i] ) );
+        }
+
+        if ( maxA < minB || maxB < minA )
+            return false;
+    }
+
+    return true;
+}
+
+TEST( OBB, Default_Constructor )
+{
+    OBBf o;
+
+    ASSERT_EQ( o.center, Vector3f( 0.0f ) );
+    ASSERT_EQ( o.halfExtents, Vector3f( 0.0f ) );
+    ASSERT_EQ( o.rotation, Matrix3f::IDENTITY );
+}
+
+TEST( OBB, FromAABB )
+{
+    OBBf o { AABBf { { -1.0f, 0.0f, 2.0f }, { 3.0f, 2.0f, 4.0f } } };
+
+    ASSERT_EQ( o.center, Vector3f( 1.0f, 1.0f, 3.0f ) );
+    ASSERT_EQ( o.halfExtents, Vector3f( 2.0f, 1.0f, 1.0f ) );
+    ASSERT_EQ( toAABB( o ), AABBf( { -1.0f, 0.0f, 2.0f }, { 3.0f, 2.0f, 4.0f } ) );
+}
+
+TEST( OBB, Contains )
+{
+    OBBf o { { 1.0f, 0.0f, 0.0f }, { 2.0f, 0.5f, 0.5f }, axisAngle( Vector3f::UNIT_Z, radians( 90.0f ) ) };
+
+    ASSERT_TRUE( contains( o, Vector3f { 1.0f, 1.5f, 0.0f } ) );
+    ASSERT_FALSE( contains( o, Vector3f { 2.5f, 0.0f, 0.0f } ) );
+}
+
+TEST( OBB, Fit )
+{
+    std::mt19937                          rng( 5 );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    const QuaternionF q = axisAngle( normalize( Vector3f { 1.0f, 2.0f, 3.0f } ), 0.7f );
+    const Matrix3f    r = toMat3( q );
+    const Vector3f    c { 3.0f, -2.0f, 1.0f };
+    const Vector3f    e { 5.0f, 2.0f, 0.5f };
+
+    std::vector<Vector3f> points;
+    for ( int i = 0; i < 2000; ++i )
+        points.push_back( c + r * ( Vector3f { dist( rng ), dist( rng ), dist( rng ) } * e ) );
+
+    const OBBf o = fitOBB<float>( points );
+
+    for ( const auto& p: points )
+        ASSERT_TRUE( contains( o, p + ( o.center - p ) * 1e-4f ) );
+
+    // The major axis is aligned with the major axis of the distribution.
+    ASSERT_NEAR( std::abs( dot( axis( o, 0 ), r * Vector3f::UNIT_X ) ), 1.0f, 1e-2f );
+    ASSERT_NEAR( o.halfExtents.x, e.x, 0.1f );
+    ASSERT_NEAR( o.halfExtents.z, e.z, 0.1f );
+
+    // Right-handed.
+    ASSERT_NEAR( determinant( o.rotation ), 1.0f, 1e-4f );
+}
+
+TEST( OBB, Intersects )
+{
+    const QuaternionF rot45 = axisAngle( Vector3f::UNIT_Z, radians( 45.0f ) );
+
+    OBBf a { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, Matrix3f::IDENTITY };
+    OBBf b { { 2.3f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, rot45 };  // Corner reaches 2.3 - sqrt(2) < 1
+    OBBf c { { 2.5f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, rot45 };  // 2.5 - sqrt(2) > 1
+
+    ASSERT_TRUE( intersects( a, a ) );
+    ASSERT_TRUE( intersects( a, b ) );
+    ASSERT_FALSE( intersects( a, c ) );
+
+    // Edge-edge case: only separated by a cross product axis.
+    OBBf d { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, axisAngle( Vector3f::UNIT_X, radians( 45.0f ) ) };
+    OBBf f { { 1.8f, 1.8f, 0.0f }, { 1.0f, 1.0f, 1.0f }, axisAngle( Vector3f::UNIT_Y, radians( 45.0f ) ) };
+    ASSERT_EQ( intersects( d, f ), referenceIntersects( d, f ) );
+
+    std::mt19937 rng( 9 );
+    int          overlaps = 0;
+    for ( int i = 0; i < 2000; ++i )
+    {
+        const OBBf x = randomOBB( rng );
+        const OBBf y = randomOBB( rng );
+
+        const bool expected = referenceIntersects( x, y );
+        ASSERT_EQ( intersects( x, y ), expected );
+        ASSERT_EQ( intersects( y, x ), expected );
+        overlaps += expected;
+    }
+
+    ASSERT_GT( overlaps, 0 );
+}
+
+TEST( OBB, Intersects_AABB )
+{
+    std::mt19937 rng( 10 );
+    for ( int i = 0; i < 500; ++i )
+    {
+        const OBBf  o = randomOBB( rng );
+        const AABBf a = toAABB( randomOBB( rng ) );
+
+        ASSERT_EQ( intersects( o, a ), referenceIntersects( o, OBBf { a } ) );
+    }
+}
+
+TEST( OBB, Ray )
+{
+    OBBf  o { { 0.0f, 0.0f, 5.0f }, { 1.0f, 1.0f, 1.0f }, axisAngle( Vector3f::UNIT_Z, radians( 45.0f ) ) };
+    float t;
+
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, o, t ) );
+    ASSERT_NEAR( t, 4.0f, 1e-5f );
+
+    // Misses the unrotated box, but hits the corner of the rotated box.
+    ASSERT_TRUE( intersects( Rayf { { 1.3f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, o, t ) );
+    ASSERT_FALSE( intersects( Rayf { { 1.3f, 1.3f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, o, t ) );
+}
+
+TEST( OBB, IntersectPairs )
+{
+    std::mt19937 rng( 12 );
+
+    constexpr std::size_t N = 1001;
+    std::vector<OBBf>     a, b;
+    for ( std::size_t i = 0; i < N; ++i )
+    {
+        a.push_back( randomOBB( rng ) );
+        b.push_back( randomOBB( rng ) );
+    }
+
+    // Convert to SoA.
+    struct Storage
+    {
+        std::vector<float> c[3], e[3], r[9];
+
+        explicit Storage( const std::vector<OBBf>& boxes )
+        {
+            for ( const auto& o: boxes )
+            {
+                for ( int k = 0; k < 3; ++k )
+                {
+                    c[k].push_back( o.center[k] );
+                    e[k].push_back( o.halfExtents[k] );
+                }
+                for ( int k = 0; k < 9; ++k )
+                    r[k].push_back( o.rotation[k / 3][k % 3] );
+            }
+        }
+
+        OBBSoA<float> view() const
+        {
+            return { c[0], c[1], c[2], e[0], e[1], e[2], { r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], r[8] } };
+        }
+    };
+
+    const Storage sa( a ), sb( b );
+
+    std::vector<uint32_t> overlapping( N );
+    const std::size_t     n = intersectPairs( sa.view(), sb.view(), overlapping );
+
+    std::vector<uint32_t> expected;
+    for ( uint32_t i = 0; i < N; ++i )
+    {
+        if ( intersects( a[i], b[i] ) )
+            expected.push_back( i );
+    }
+
+    ASSERT_GT( n, 0u );
+    ASSERT_EQ( n, expected.size() );
+    for ( std::size_t i = 0; i < n; ++i )
+        ASSERT_EQ( overlapping[i], expected[i] );
+}
@@ -0,0 +1,437 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Predicates.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+using namespace FastMath::Predicates;
+
+// A minimal arbitrary-precision integer used to compute reference determinants.
+struct BigInt
+{
+    bool                  negative = false;
+    std::vector<uint32_t> mag;  // Little-endian magnitude.
+
+    BigInt() = default;
+
+    // x * 2^shift (x must be an integer multiple of 2^-shift).
+    BigInt( double x, int shift )
+    {
+        int          e;
+        const double m        = std::frexp( std::abs( x ), &e );
+        uint64_t     mantissa = static_cast<uint64_t>( std::ldexp( m, 53 ) );
+        int          s        = e - 53 + shift;
+
+        while ( s < 0 )
+        {
+            EXPECT_EQ( mantissa & 1, 0u ) << "value is not a multiple of 2^-shift";
+            mantissa >>= 1;
+            ++s;
+        }
+
+        negative = x < 0.0;
+        mag      = { static_cast<uint32_t>( mantissa ), static_cast<uint32_t>( mantissa >> 32 ) };
+        for ( ; s >= 32; s -= 32 )
+            mag.insert( mag.begin(), 0u );
+
+        uint32_t carry = 0;
+        for ( uint32_t& m32: mag )
+        {
+            const uint64_t v = ( uint64_t( m32 ) << s ) | carry;
+            m32              = static_cast<uint32_t>( v );
+            carry            = static_cast<uint32_t>( v >> 32 );
+        }
+        mag.push_back( carry );
+        trim();
+    }
+
+    void trim()
+    {
+        while ( !mag.empty() && mag.back() == 0 )
+            mag.pop_back();
+        if ( mag.empty() )
+            negative = false;
+    }
+
+    int sign() const
+    {
+        return mag.empty() ? 0 : ( negative ? -1 : 1 );
+    }
+
+    static int compare( const std::vector<uint32_t>& a, const std::vector<uint32_t>& b )
+    {
+        if ( a.size() != b.size() )
+            return a.size() < b.size() ? -1 : 1;
+        for ( std::size_t i = a.size(); i-- > 0; )
+        {
+            if ( a[i] != b[i] )
+                return a[i] < b[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    static std::vector<uint32_t> add( const std::vector<uint32_t>& a, const std::vector<uint32_t>& b )
+    {
+        std::vector<uint32_t> r( std::max( a.size(), b.size() ) + 1, 0 );
+        uint64_t              carry = 0;
+        for ( std::size_t i = 0; i < r.size(); ++i )
+        {
+            const uint64_t v = carry + ( i < a.size() ? a[i] : 0 ) + ( i < b.size() ? b[i] : 0 );
+            r[i]             = static_cast<uint32_t>( v );
+            carry            = v >> 32;
+        }
+        return r;
+    }
+
+    // a - b where a >= b.
+    static std::vector<uint32_t> sub( const std::vector<uint32_t>& a, const std::vector<uint32_t>& b )
+    {
+        std::vector<uint32_t> r( a.size(), 0 );
+        int64_t               borrow = 0;
+        for ( std::size_t i = 0; i < a.size(); ++i )
+        {
+            int64_t v = int64_t( a[i] ) - ( i < b.size() ? b[i] : 0 ) - borrow;
+            borrow    = v < 0;
+            r[i]      = static_cast<uint32_t>( v + ( borrow << 32 ) );
+        }
+        return r;
+    }
+
+    BigInt operator+( const BigInt& rhs ) const
+    {
+        BigInt r;
+        if ( negative == rhs.negative )
+        {
+            r.mag      = add( mag, rhs.mag );
+            r.negative = negative;
+        }
+        else if ( compare( mag, rhs.mag ) >= 0 )
+        {
+            r.mag      = sub( mag, rhs.mag );
+            r.negative = negative;
+        }
+        else
+        {
+            r.mag      = sub( rhs.mag, mag );
+            r.negative = rhs.negative;
+        }
+        r.trim();
+        return r;
+    }
+
+    BigInt operator-() const
+    {
+        BigInt r = *this;
+        r.negative = !negative;
+        r.trim();
+        return r;
+    }
+
+    BigInt operator-( const BigInt& rhs ) const
+    {
+        return *this + -rhs;
+    }
+
+    BigInt operator*( const BigInt& rhs ) const
+    {
+        BigInt r;
+        r.mag.assign( mag.size() + rhs.mag.size() + 1, 0 );
+        for ( std::size_t i = 0; i < mag.size(); ++i )
+        {
+            uint64_t carry = 0;
+            for ( std::size_t j = 0; j < rhs.mag.size(); ++j )
+            {
+                const uint64_t v = uint64_t( mag[i] ) * rhs.mag[j] + r.mag[i + j] + carry;
+                r.mag[i + j]     = static_cast<uint32_t>( v );
+                carry            = v >> 32;
+            }
+            r.mag[i + rhs.mag.size()] += static_cast<uint32_t>( carry );
+        }
+        r.negative = negative != rhs.negative;
+        r.trim();
+        return r;
+    }
+};
+
+// Every double is a multiple of 2^-1074.
+constexpr int SHIFT = 1074;
+
+static int sign( double x )
+{
+    return ( x > 0.0 ) - ( x < 0.0 );
+}
+
+static BigInt det3( const BigInt m[3][3] )
+{
+    return m[0][0] * ( m[1][1] * m[2][2] - m[1][2] * m[2][1] ) - m[0][1] * ( m[1][0] * m[2][2] - m[1][2] * m[2][0] ) + m[0][2] * ( m[1][0] * m[2][1] - m[1][1] * m[2][0] );
+}
+
+static int orient2dReference( const Vector2d& a, const Vector2d& b, const Vector2d& c )
+{
+    const BigInt acx = BigInt( a.x, SHIFT ) - BigInt( c.x, SHIFT ), acy = BigInt( a.y, SHIFT ) - BigInt( c.y, SHIFT );
+    const BigInt bcx = BigInt( b.x, SHIFT ) - BigInt( c.x, SHIFT ), bcy = BigInt( b.y, SHIFT ) - BigInt( c.y, SHIFT );
+
+    return ( acx * bcy - acy * bcx ).sign();
+}
+
+static int orient3dReference( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d )
+{
+    BigInt m[3][3];
+    const Vector3d* p[3] = { &a, &b, &c };
+    for ( int i = 0; i < 3; ++i )
+        for ( int j = 0; j < 3; ++j )
+            m[i][j] = BigInt( ( *p[i] )[j], SHIFT ) - BigInt( d[j], SHIFT );
+
+    return det3( m ).sign();
+}
+
+static int incircleReference( const Vector2d& a, const Vector2d& b, const Vector2d& c, const Vector2d& d )
+{
+    BigInt m[3][3];
+    const Vector2d* p[3] = { &a, &b, &c };
+    for ( int i = 0; i < 3; ++i )
+    {
+        m[i][0] = BigInt( p[i]->x, SHIFT ) - BigInt( d.x, SHIFT );
+        m[i][1] = BigInt( p[i]->y, SHIFT ) - BigInt( d.y, SHIFT );
+        m[i][2] = m[i][0] * m[i][0] + m[i][1] * m[i][1];
+    }
+
+    return det3( m ).sign();
+}
+
+static int insphereReference( const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d, const Vector3d& e )
+{
+    BigInt m[4][4];
+    const Vector3d* p[4] = { &a, &b, &c, &d };
+    for ( int i = 0; i < 4; ++i )
+    {
+        for ( int j = 0; j < 3; ++j )
+            m[i][j] = BigInt( ( *p[i] )[j], SHIFT ) - BigInt( e[j], SHIFT );
+        m[i][3] = m[i][0] * m[i][0] + m[i][1] * m[i][1] + m[i][2] * m[i][2];
+    }
+
+    // Expand along the first row.
+    BigInt det;
+    for ( int k = 0; k < 4; ++k )
+    {
+        BigInt minor[3][3];
+        for ( int i = 1; i < 4; ++i )
+            for ( int j = 0, c = 0; j < 4; ++j )
+                if ( j != k )
+                    minor[i - 1][c++] = m[i][j];
+
+        const BigInt t = m[0][k] * det3( minor );
+        det            = k % 2 == 0 ? det + t : det - t;
+    }
+
+    return det.sign();
+}
+
+// Move x by a number of units in the last place.
+static double perturb( double x, int ulps )
+{
+    for ( int i = 0; i < std::abs( ulps ); ++i )
+        x = std::nextafter( x, ulps > 0 ? 1e300 : -1e300 );
+    return x;
+}
+
+TEST( Predicates, Orient2dNearlyCollinear )
+{
+    // Points on the line y = x near ( 0.5, 0.5 ), perturbed on a grid of ulps.
+    const Vector2d b { 12.0, 12.0 };
+    const Vector2d c { 24.0, 24.0 };
+
+    int naiveWrong = 0;
+    for ( int i = 0; i < 32; ++i )
+    {
+        for ( int j = 0; j < 32; ++j )
+        {
+            const Vector2d a { perturb( 0.5, i ), perturb( 0.5, j ) };
+
+            const int expected = orient2dReference( a, b, c );
+            ASSERT_EQ( sign( orient2d( a, b, c ) ), expected ) << i << ", " << j;
+
+            const double naive = ( a.x - c.x ) * ( b.y - c.y ) - ( a.y - c.y ) * ( b.x - c.x );
+            naiveWrong += sign( naive ) != expected;
+        }
+    }
+
+    // Make sure that the test actually exercises the adaptive stages.
+    EXPECT_GT( naiveWrong, 0 );
+}
+
+TEST( Predicates, Orient2dRandom )
+{
+    std::mt19937                           rng( 1 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    for ( int i = 0; i < 2000; ++i )
+    {
+        // Nearly collinear points with coordinates of different magnitudes.
+        const Vector2d a { std::ldexp( std::round( std::ldexp( dist( rng ), 40 ) ), -40 ), std::ldexp( std::round( std::ldexp( dist( rng ), 40 ) ), -40 ) };
+        const Vector2d d { std::ldexp( std::round( std::ldexp( dist( rng ), 60 ) ), -60 ), std::ldexp( std::round( std::ldexp( dist( rng ), 60 ) ), -60 ) };
+        const double   t = std::ldexp( std::round( std::ldexp( dist( rng ), 20 ) ), -20 );
+        const Vector2d b = a + d * 1024.0;
+        const Vector2d c { perturb( a.x + d.x * t, i % 5 - 2 ), perturb( a.y + d.y * t, i % 3 - 1 ) };
+
+        ASSERT_EQ( sign( orient2d( a, b, c ) ), orient2dReference( a, b, c ) ) << i;
+        ASSERT_EQ( sign( orient2d( b, c, a ) ), orient2dReference( a, b, c ) ) << i;
+        ASSERT_EQ( sign( orient2d( b, a, c ) ), -orient2dReference( a, b, c ) ) << i;
+    }
+}
+
+TEST( Predicates, Orient3d )
+{
+    std::mt19937                           rng( 2 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    auto random = [&]( int bits ) { return std::ldexp( std::round( std::ldexp( dist( rng ), bits ) ), -bits ); };
+
+    // Sign convention: d below the counterclockwise triangle is positive.
+    EXPECT_GT( orient3d( { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, -1.0 } ), 0.0 );
+
+    for ( int i = 0; i < 2000; ++i )
+    {
+        // A point near the plane spanned by a, a + u and a + v.
+        const Vector3d a { random( 30 ), random( 30 ), random( 30 ) };
+        const Vector3d u { random( 20 ), random( 20 ), random( 20 ) };
+        const Vector3d v { random( 20 ), random( 20 ), random( 20 ) };
+        const double   s = random( 10 ), t = random( 10 );
+
+        const Vector3d b = a + u;
+        const Vector3d c = a + v;
+        const Vector3d p = a + u * s + v * t;
+        const Vector3d d { perturb( p.x, i % 3 - 1 ), perturb( p.y, i % 5 - 2 ), p.z };
+
+        const int expected = orient3dReference( a, b, c, d );
+        ASSERT_EQ( sign( orient3d( a, b, c, d ) ), expected ) << i;
+        ASSERT_EQ( sign( orient3d( b, a, c, d ) ), -expected ) << i;
+    }
+
+    // Exactly coplanar points (on the plane z = x + y) with inexact differences.
+    const Vector3d a { 0x1p40, 1.0, 0x1p40 + 1.0 }, b { 0x1p-20, 0x1p-20, 0x1p-19 }, c { 3.0, -0x1p30, 3.0 - 0x1p30 }, d { 0x1p-30, 5.0, 5.0 + 0x1p-30 };
+    EXPECT_EQ( orient3d( a, b, c, d ), 0.0 );
+    EXPECT_GT( orient3d( a, b, c, d + Vector3d { 0.0, 0.0, -0x1p-30 } ), 0.0 );
+}
+
+TEST( Predicates, Incircle )
+{
+    std::mt19937                           rng( 3 );
+    std::uniform_real_distribution<double> angle( 0.0, 6.283185307179586 );
+
+    // Sign convention: inside is positive for a counterclockwise triangle.
+    EXPECT_GT( incircle( { 1.0, 0.0 }, { 0.0, 1.0 }, { -1.0, 0.0 }, { 0.0, 0.0 } ), 0.0 );
+
+    for ( int i = 0; i < 2000; ++i )
+    {
+        // Nearly cocircular points around the origin (so that the differences are rounded).
+        const Vector2d center { 0.25, -0.125 };
+        const double   r = 100.0 + i;
+
+        Vector2d p[4];
+        for ( Vector2d& q: p )
+        {
+            const double t = angle( rng );
+            q              = center + Vector2d { std::cos( t ), std::sin( t ) } * r;
+        }
+        p[3].x = perturb( p[3].x, i % 3 - 1 );
+
+        const int expected = incircleReference( p[0], p[1], p[2], p[3] );
+        ASSERT_EQ( sign( incircle( p[0], p[1], p[2], p[3] ) ), expected ) << i;
+        ASSERT_EQ( sign( incircle( p[1], p[0], p[2], p[3] ) ), -expected ) << i;
+    }
+
+    // Exactly cocircular points with inexact differences.
+    const double r = 0x1p30, e = 0x1p-30;
+    EXPECT_EQ( incircle( { r, e }, { e, r }, { -r, e }, { e, -r } ), 0.0 );
+    EXPECT_GT( incircle( { r, e }, { e, r }, { -r, e }, { e, perturb( -r, 1 ) } ), 0.0 );
+}
+
+TEST( Predicates, Insphere )
+{
+    std::mt19937                           rng( 4 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    EXPECT_GT( insphere( { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 }, { -1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } ) *
+                   orient3d( { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 }, { -1.0, 0.0, 0.0 } ),
+               0.0 );
+
+    for ( int i = 0; i < 500; ++i )
+    {
+        // Nearly cospherical points around the origin (so that the differences are rounded).
+        const Vector3d center { 0.125, -0.25, 0.5 };
+        const double   r = 10.0 + i;
+
+        Vector3d p[5];
+        for ( Vector3d& q: p )
+        {
+            const Vector3d n { dist( rng ), dist( rng ), dist( rng ) };
+            q = center + n * ( r / std::sqrt( n.x * n.x + n.y * n.y + n.z * n.z ) );
+        }
+        p[4].y = perturb( p[4].y, i % 3 - 1 );
+
+        const int expected = insphereReference( p[0], p[1], p[2], p[3], p[4] );
+        ASSERT_EQ( sign( insphere( p[0], p[1], p[2], p[3], p[4] ) ), expected ) << i;
+        ASSERT_EQ( sign( insphere( p[1], p[0], p[2], p[3], p[4] ) ), -expected ) << i;
+    }
+
+    // Exactly cospherical points with inexact differences.
+    const double   r = 0x1p30, e = 0x1p-30;
+    const Vector3d a { r, e, e }, b { e, r, e }, c { e, e, r }, d { -r, e, e };
+    ASSERT_GT( orient3d( a, b, c, d ), 0.0 );
+    EXPECT_EQ( insphere( a, b, c, d, { e, -r, e } ), 0.0 );
+    EXPECT_GT( insphere( a, b, c, d, { e, perturb( -r, 1 ), e } ), 0.0 );
+}
+
+TEST( Predicates, Batch )
+{
+    std::mt19937                           rng( 5 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    // A mix of easy and nearly degenerate queries (not a multiple of the SIMD width).
+    std::vector<Vector2d> line, circle;
+    std::vector<Vector3d> plane, sphere;
+    for ( int i = 0; i < 1001; ++i )
+    {
+        if ( i % 2 )
+        {
+            line.push_back( { perturb( 24.0, i % 7 - 3 ), perturb( 24.0, i % 5 - 2 ) } );
+            circle.push_back( { perturb( 0.6, i % 7 - 3 ), perturb( -0.8, i % 5 - 2 ) } );
+            plane.push_back( { perturb( 1.0 / 3.0, i % 7 - 3 ), perturb( 1.0 / 3.0, i % 5 - 2 ), perturb( 1.0 / 3.0, i % 3 - 1 ) } );
+            sphere.push_back( { perturb( 1.0, i % 7 - 3 ), perturb( 1.0, i % 5 - 2 ), 0.0 } );
+        }
+        else
+        {
+            line.push_back( { dist( rng ) * 30.0, dist( rng ) * 30.0 } );
+            circle.push_back( { dist( rng ), dist( rng ) } );
+            plane.push_back( { dist( rng ), dist( rng ), dist( rng ) } );
+            sphere.push_back( { dist( rng ), dist( rng ), dist( rng ) } );
+        }
+    }
+
+    std::vector<double> results( line.size() );
+
+    const Vector2d a2 { 0.5, 0.5 }, b2 { 12.0, 12.0 };
+    orient2d( a2, b2, line, results );
+    for ( std::size_t i = 0; i < line.size(); ++i )
+        ASSERT_EQ( results[i], orient2d( a2, b2, line[i] ) ) << i;
+
+    const Vector2d p2 { 1.0, 0.0 }, q2 { 0.0, 1.0 }, r2 { -1.0, 0.0 };
+    incircle( p2, q2, r2, circle, results );
+    for ( std::size_t i = 0; i < circle.size(); ++i )
+        ASSERT_EQ( results[i], incircle( p2, q2, r2, circle[i] ) ) << i;
+
+    const Vector3d a3 { 0.0, 0.0, 0.0 }, b3 { 1.0, 0.0, 0.0 }, c3 { 0.0, 1.0, 0.0 }, d3 { 0.0, 0.0, 1.0 };
+    orient3d( b3, c3, d3, plane, results );
+    for ( std::size_t i = 0; i < plane.size(); ++i )
+        ASSERT_EQ( results[i], orient3d( b3, c3, d3, plane[i] ) ) << i;
+
+    // ( 1, 1, 0 ) lies on the sphere through a3, b3, c3 and d3.
+    insphere( a3, b3, c3, d3, sphere, results );
+    for ( std::size_t i = 0; i < sphere.size(); ++i )
+        ASSERT_EQ( results[i], insphere( a3, b3, c3, d3, sphere[i] ) ) << i;
+}
@@ -1,6 +1,8 @@
 #include <FastMath/Quaternion.hpp>
 
 #include <array>
+#include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -242,6 +244,113 @@ TEST( Quaternion, Slerp )
 
     ASSERT_TRUE( all( equal( a, c, EPSILON<float> ) ) );
     ASSERT_TRUE( all( equal( b, d, EPSILON<float> ) ) );
+
+    // Antipodal quaternions represent the same rotation, so the shortest path does not move.
+    for ( float t: { 0.0f, 0.25f, 0.5f, 1.0f } )
+    {
+        ASSERT_TRUE( all( equal( a, slerp( a, a * -1.0f, t ), EPSILON<float> ) ) );
+        ASSERT_TRUE( all( equal( b, slerp( b, b * -1.0f, t ), EPSILON<float> ) ) );
+    }
+}
+
+TEST( Quaternion, FastSlerp )
+{
+    quat a = axisAngle( vec3::UNIT_X, 0.0f );
+    quat b = axisAngle( vec3::UNIT_X, PI_OVER_TWO<float> );
+
+    ASSERT_TRUE( all( equal( a, fastSlerp( a, b, 0.0f ), EPSILON<float> ) ) );
+    ASSERT_TRUE( all( equal( b, fastSlerp( a, b, 1.0f ), EPSILON<float> ) ) );
+    ASSERT_TRUE( all( equal( b, fastSlerp( a, b * -1.0f, 1.0f ), EPSILON<float> ) ) );
+    ASSERT_TRUE( all( equal( a, fastSlerp( a, a, 0.5f ), EPSILON<float> ) ) );
+
+    // The maximum angular error (over all angles up to 180 degrees) is about 2e-5 radians.
+    double maxError = 0.0;
+    for ( int i = 0; i <= 180; ++i )
+    {
+        const QuaternionD q0 = normalize( QuaternionD { 0.3, -0.2, 0.5, 0.1 } );
+        const QuaternionD q1 = q0 * axisAngle( Vector3d { 0.0, 1.0, 0.0 }, i * PI<double> / 180.0 );
+
+        for ( int j = 0; j <= 100; ++j )
+        {
+            const double t = j / 100.0;
+
+            const QuaternionD expected = slerp( q0, q1, t );
+            const QuaternionD actual   = fastSlerp( q0, q1, t );
+
+            ASSERT_NEAR( length( actual ), 1.0, 3e-5 );
+
+            const double c = std::min( std::abs( dot( normalize( actual ), expected ) ), 1.0 );
+            maxError       = std::max( maxError, 2.0 * std::acos( c ) );
+        }
+    }
+
+    EXPECT_LT( maxError, 2.5e-5 );
+}
+
+TEST( Quaternion, Average )
+{
+    quat a = axisAngle( vec3::UNIT_Y, 0.2f );
+    quat b = axisAngle( vec3::UNIT_Y, 0.8f );
+
+    // Two rotations are the same as nlerp (on either hemisphere).
+    QuaternionAccumulator<float> accumulator;
+    accumulator.add( a, 1.0f );
+    accumulator.add( b * -1.0f, 3.0f );
+
+    EXPECT_FLOAT_EQ( accumulator.getWeight(), 4.0f );
+    ASSERT_TRUE( all( equal( accumulator.getAverage(), nlerp( a, b, 0.75f ), 1e-6f ) ) );
+
+    // Rotations about the same axis.
+    const std::array<quat, 3>  rotations = { a, b * -1.0f, axisAngle( vec3::UNIT_Y, 0.5f ) };
+    const std::array<float, 3> weights   = { 1.0f, 1.0f, 2.0f };
+    ASSERT_TRUE( all( equal( average<float>( rotations ), axisAngle( vec3::UNIT_Y, 0.5f ), 1e-6f ) ) );
+    ASSERT_TRUE( all( equal( average<float>( rotations, weights ), axisAngle( vec3::UNIT_Y, 0.5f ), 1e-6f ) ) );
+
+    accumulator.reset();
+    ASSERT_EQ( accumulator.getAverage(), quat::IDENTITY );
+    ASSERT_EQ( average<float>( {} ), quat::IDENTITY );
+}
+
+TEST( Quaternion, AverageMarkley )
+{
+    std::mt19937                          rng( 3 );
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+
+    // Markley's average maximizes the weighted sum of the squared dot products with the rotations.
+    const auto objective = []( const std::vector<quat>& rotations, const std::vector<float>& weights, const quat& q ) {
+        float sum = 0.0f;
+        for ( std::size_t i = 0; i < rotations.size(); ++i )
+            sum += weights[i] * dot( rotations[i], q ) * dot( rotations[i], q );
+        return sum;
+    };
+
+    for ( int i = 0; i < 20; ++i )
+    {
+        std::vector<quat>  rotations;
+        std::vector<float> weights;
+        for ( int k = 0; k < 5; ++k )
+        {
+            const quat q = normalize( quat { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } );
+            rotations.push_back( k % 2 ? q * -1.0f : q );
+            weights.push_back( dist( rng ) + 1.5f );
+        }
+
+        const quat  q    = averageMarkley<float>( rotations, weights );
+        const float best = objective( rotations, weights, q );
+
+        EXPECT_NEAR( length( q ), 1.0f, 1e-5f );
+        EXPECT_GE( dot( q, rotations[0] ), 0.0f );
+        EXPECT_GE( best + 1e-5f, objective( rotations, weights, average<float>( rotations, weights ) ) );
+        for ( int k = 0; k < 20; ++k )
+        {
+            const quat p = normalize( q + quat { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } * 0.1f );
+            EXPECT_GE( best + 1e-5f, objective( rotations, weights, p ) );
+        }
+    }
+
+    // Nearby rotations give the same result as nlerp.
+    const std::array<quat, 2> rotations = { axisAngle( vec3::UNIT_Z, 0.1f ), axisAngle( vec3::UNIT_Z, 0.3f ) * -1.0f };
+    ASSERT_TRUE( all( equal( averageMarkley<float>( rotations ), axisAngle( vec3::UNIT_Z, 0.2f ), 1e-5f ) ) );
 }
 
 TEST( Quaternion, Pow0 )
@@ -278,4 +387,4 @@ TEST( Quaternion, LessThanEqual )
     auto res = lessThanEqual( a, b );
 
     ASSERT_TRUE( all( res ) );
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Random.hpp>
+
+#include <vector>
+
+using namespace FastMath;
+
+TEST( Random, Seed )
+{
+    std::vector<uint32_t> a( 1003 ), b( 1003 ), c( 1003 ), d( 1003 );
+
+    Random r0 { 42 };
+    r0.generate( a );
+
+    // The same seed and stream produce the same sequence.
+    Random r1 { 42, 0 };
+    r1.generate( b );
+    EXPECT_EQ( a, b );
+
+    r1.seed( 42 );
+    r1.generate( b );
+    EXPECT_EQ( a, b );
+
+    // Different streams and seeds produce different sequences.
+    Random r2 { 42, 1 };
+    r2.generate( c );
+    Random r3 { 43, 0 };
+    r3.generate( d );
+
+    std::size_t same = 0;
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        same += ( a[i] == c[i] ) + ( a[i] == d[i] ) + ( c[i] == d[i] );
+    EXPECT_LT( same, 3u );
+
+    // Each bit is set about half of the time.
+    for ( int bit = 0; bit < 32; ++bit )
+    {
+        std::size_t count = 0;
+        for ( uint32_t x: a )
+            count += ( x >> bit ) & 1u;
+
+        EXPECT_NEAR( static_cast<double>( count ) / a.size(), 0.5, 0.1 ) << bit;
+    }
+}
+
+TEST( Random, Uniform )
+{
+    Random random { 1 };
+
+    std::vector<float> values( 100'003 );
+    uniform<float>( random, values, -2.0f, 6.0f );
+
+    double sum = 0.0;
+    for ( float v: values )
+    {
+        ASSERT_GE( v, -2.0f );
+        ASSERT_LT( v, 6.0f );
+        sum += v;
+    }
+    EXPECT_NEAR( sum / values.size(), 2.0, 0.05 );
+
+    std::vector<double> valuesD( 100'003 );
+    uniform<double>( random, valuesD );
+    sum = 0.0;
+    for ( double v: valuesD )
+    {
+        ASSERT_GE( v, 0.0 );
+        ASSERT_LT( v, 1.0 );
+        sum += v;
+    }
+    EXPECT_NEAR( sum / valuesD.size(), 0.5, 0.01 );
+
+    // Boxes.
+    const Vector3f        min { -1.0f, 0.0f, 10.0f }, max { 1.0f, 0.5f, 20.0f };
+    std::vector<Vector3f> points( 10'001 );
+    uniformBox<float>( random, points, min, max );
+
+    Vector3d mean { 0.0 };
+    for ( const auto& p: points )
+    {
+        for ( int j = 0; j < 3; ++j )
+        {
+            ASSERT_GE( p[j], min[j] );
+            ASSERT_LT( p[j], max[j] );
+        }
+        mean += Vector3d { p.x, p.y, p.z } / static_cast<double>( points.size() );
+    }
+    EXPECT_NEAR( mean.x, 0.0, 0.05 );
+    EXPECT_NEAR( mean.y, 0.25, 0.02 );
+    EXPECT_NEAR( mean.z, 15.0, 0.2 );
+}
+
+TEST( Random, Sphere )
+{
+    Random random { 7 };
+
+    std::vector<Vector3f> on( 10'005 ), in( 10'005 );
+    onUnitSphere<float>( random, on );
+    inUnitSphere<float>( random, in );
+
+    Vector3d meanOn { 0.0 }, meanIn { 0.0 };
+    double   radius = 0.0;
+    for ( std::size_t i = 0; i < on.size(); ++i )
+    {
+        ASSERT_NEAR( length( on[i] ), 1.0f, 1e-5f ) << i;
+        ASSERT_LE( length( in[i] ), 1.0f + 1e-5f ) << i;
+
+        meanOn += Vector3d { on[i].x, on[i].y, on[i].z };
+        meanIn += Vector3d { in[i].x, in[i].y, in[i].z };
+        radius += length( in[i] );
+    }
+
+    // The mean of a uniform distribution on (and in) the sphere is the center, and the mean radius in the ball is 3/4.
+    for ( int j = 0; j < 3; ++j )
+    {
+        EXPECT_NEAR( meanOn[j] / on.size(), 0.0, 0.03 );
+        EXPECT_NEAR( meanIn[j] / in.size(), 0.0, 0.03 );
+    }
+    EXPECT_NEAR( radius / in.size(), 0.75, 0.01 );
+
+    // Double precision (the scalar path).
+    std::vector<Vector3d> onD( 1001 );
+    onUnitSphere<double>( random, onD );
+    for ( const auto& p: onD )
+        ASSERT_NEAR( length( p ), 1.0, 1e-12 );
+}
+
+TEST( Random, Disk )
+{
+    Random random { 9 };
+
+    std::vector<Vector2f> on( 10'003 ), in( 10'003 );
+    onUnitCircle<float>( random, on );
+    inUnitDisk<float>( random, in );
+
+    double radius = 0.0;
+    for ( std::size_t i = 0; i < on.size(); ++i )
+    {
+        ASSERT_NEAR( length( on[i] ), 1.0f, 1e-5f ) << i;
+        ASSERT_LE( length( in[i] ), 1.0f + 1e-5f ) << i;
+        radius += length( in[i] );
+    }
+
+    // The mean radius in the disk is 2/3.
+    EXPECT_NEAR( radius / in.size(), 2.0 / 3.0, 0.01 );
+}
+
+TEST( Random, CosineHemisphere )
+{
+    Random random { 11 };
+
+    const Vector3f normals[] = { Vector3f::UNIT_Z, normalize( Vector3f { 1.0f, -2.0f, -3.0f } ), -Vector3f::UNIT_Z };
+    for ( const auto& n: normals )
+    {
+        std::vector<Vector3f> directions( 10'007 );
+        cosineHemisphere<float>( random, directions, n );
+
+        // The mean of cos(theta) for the density cos(theta) / pi is 2/3.
+        double mean = 0.0;
+        for ( const auto& d: directions )
+        {
+            ASSERT_NEAR( length( d ), 1.0f, 1e-5f );
+            ASSERT_GE( dot( d, n ), -1e-6f );
+            mean += dot( d, n );
+        }
+        EXPECT_NEAR( mean / directions.size(), 2.0 / 3.0, 0.01 );
+    }
+}
+
+TEST( Random, UniformRotation )
+{
+    Random random { 13 };
+
+    std::vector<QuaternionF> rotations( 10'005 );
+    uniformRotation<float>( random, rotations );
+
+    // The components of a uniformly distributed unit quaternion have a mean of 0 and a mean square of 1/4.
+    double mean[4] = {}, square[4] = {};
+    for ( const auto& q: rotations )
+    {
+        ASSERT_NEAR( dot( q, q ), 1.0f, 1e-5f );
+        for ( int k = 0; k < 4; ++k )
+        {
+            mean[k] += q[k];
+            square[k] += q[k] * q[k];
+        }
+    }
+
+    for ( int k = 0; k < 4; ++k )
+    {
+        EXPECT_NEAR( mean[k] / rotations.size(), 0.0, 0.02 ) << k;
+        EXPECT_NEAR( square[k] / rotations.size(), 0.25, 0.01 ) << k;
+    }
+}
+
+TEST( Random, Blocks )
+{
+    // A partial block gives the same samples as the start of a full block (the SIMD and scalar paths agree).
+    std::vector<Vector3f> full( 16 ), partial( 13 );
+
+    Random r0 { 5 };
+    onUnitSphere<float>( r0, full );
+    Random r1 { 5 };
+    onUnitSphere<float>( r1, partial );
+
+    for ( std::size_t i = 0; i < partial.size(); ++i )
+    {
+        for ( int j = 0; j < 3; ++j )
+            EXPECT_NEAR( partial[i][j], full[i][j], 1e-6f ) << i;
+    }
+
+    // Both generators are at the same point of the sequence.
+    uint32_t a[Simd::WIDTH], b[Simd::WIDTH];
+    r0.next( a );
+    r1.next( b );
+    EXPECT_TRUE( std::equal( a, a + Simd::WIDTH, b ) );
+
+    // Partial blocks of 7 samples only use the scalar path.
+    std::vector<QuaternionF> rotations( 800 ), rotations7( 7 );
+    r0.seed( 3 );
+    r1.seed( 3 );
+    uniformRotation<float>( r0, rotations );
+    for ( std::size_t i = 0; i < rotations.size(); i += Simd::WIDTH )
+    {
+        uniformRotation<float>( r1, rotations7 );
+        for ( std::size_t l = 0; l < rotations7.size(); ++l )
+        {
+            for ( int k = 0; k < 4; ++k )
+                ASSERT_NEAR( rotations[i + l][k], rotations7[l][k], 1e-6f ) << i + l;
+        }
+    }
+}
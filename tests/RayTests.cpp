@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Ray.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+TEST( Ray, Default_Constructor )
+{
+    Rayf r;
+
+    ASSERT_EQ( r.origin, Vector3f( 0.0f ) );
+    ASSERT_EQ( r.direction, Vector3f( 0.0f, 0.0f, 1.0f ) );
+    ASSERT_EQ( r.invDirection.z, 1.0f );
+}
+
+TEST( Ray, InvDirection )
+{
+    Rayf r { { 0.0f, 0.0f, 0.0f }, { 2.0f, 0.0f, -4.0f } };
+
+    ASSERT_FLOAT_EQ( r.invDirection.x, 0.5f );
+    ASSERT_FLOAT_EQ( r.invDirection.z, -0.25f );
+    ASSERT_TRUE( std::isfinite( r.invDirection.y ) );
+    ASSERT_GT( r.invDirection.y, 1e18f );
+}
+
+TEST( Ray, PointAt )
+{
+    Rayf r { { 1.0f, 2.0f, 3.0f }, { 0.0f, 1.0f, 0.0f } };
+
+    ASSERT_EQ( pointAt( r, 2.0f ), Vector3f( 1.0f, 4.0f, 3.0f ) );
+}
+
+TEST( Ray, AABB )
+{
+    AABBf a { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+    float t;
+
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, -5.0f }, { 0.0f, 0.0f, 1.0f } }, a, t ) );
+    ASSERT_FLOAT_EQ( t, 4.0f );
+
+    // Origin inside the box.
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } }, a, t ) );
+    ASSERT_FLOAT_EQ( t, 0.0f );
+
+    // Axis-aligned ray that lies outside of one of the slabs.
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 2.0f, -5.0f }, { 0.0f, 0.0f, 1.0f } }, a, t ) );
+    // Pointing away from the box.
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 0.0f, -5.0f }, { 0.0f, 0.0f, -1.0f } }, a, t ) );
+    // Out of range.
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 0.0f, -5.0f }, { 0.0f, 0.0f, 1.0f } }, a, t, 0.0f, 3.0f ) );
+    // Diagonal.
+    ASSERT_TRUE( intersects( Rayf { { -5.0f, -5.0f, -5.0f }, { 1.0f, 1.0f, 1.0f } }, a, t ) );
+    ASSERT_FLOAT_EQ( t, 4.0f );
+}
+
+TEST( Ray, Triangle )
+{
+    const Vector3f v0 { -1.0f, -1.0f, 0.0f };
+    const Vector3f v1 { 1.0f, -1.0f, 0.0f };
+    const Vector3f v2 { 0.0f, 1.0f, 0.0f };
+
+    float t, u, v;
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, -2.0f }, { 0.0f, 0.0f, 1.0f } }, v0, v1, v2, t, u, v ) );
+    ASSERT_FLOAT_EQ( t, 2.0f );
+    ASSERT_FLOAT_EQ( u, 0.25f );
+    ASSERT_FLOAT_EQ( v, 0.5f );
+
+    // Back face.
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, 2.0f }, { 0.0f, 0.0f, -1.0f } }, v0, v1, v2, t ) );
+    ASSERT_FLOAT_EQ( t, 2.0f );
+
+    ASSERT_FALSE( intersects( Rayf { { 2.0f, 0.0f, -2.0f }, { 0.0f, 0.0f, 1.0f } }, v0, v1, v2, t ) );
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 0.0f, -2.0f }, { 0.0f, 0.0f, -1.0f } }, v0, v1, v2, t ) );
+    // Parallel to the triangle.
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 0.0f, -2.0f }, { 1.0f, 0.0f, 0.0f } }, v0, v1, v2, t ) );
+}
+
+TEST( Ray, Sphere )
+{
+    Spheref s { { 0.0f, 0.0f, 5.0f }, 1.0f };
+    float   t;
+
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, s, t ) );
+    ASSERT_FLOAT_EQ( t, 4.0f );
+
+    // Non-normalized direction.
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 2.0f } }, s, t ) );
+    ASSERT_FLOAT_EQ( t, 2.0f );
+
+    // Inside the sphere.
+    ASSERT_TRUE( intersects( Rayf { { 0.0f, 0.0f, 5.0f }, { 1.0f, 0.0f, 0.0f } }, s, t ) );
+    ASSERT_FLOAT_EQ( t, 0.0f );
+
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 2.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, s, t ) );
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f } }, s, t ) );
+    ASSERT_FALSE( intersects( Rayf { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, s, t, 3.0f ) );
+}
+
+static std::vector<Rayf> randomRays( std::mt19937& rng, std::size_t count )
+{
+    std::uniform_real_distribution<float> pos( -4.0f, 4.0f );
+    std::uniform_real_distribution<float> dir( -1.0f, 1.0f );
+
+    std::vector<Rayf> rays;
+    for ( std::size_t i = 0; i < count; ++i )
+        rays.emplace_back( Vector3f { pos( rng ), pos( rng ), pos( rng ) }, Vector3f { dir( rng ), dir( rng ), dir( rng ) } );
+
+    return rays;
+}
+
+TEST( Ray, Packet_AABB )
+{
+    std::mt19937 rng( 1 );
+    AABBf        a { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+
+    for ( int iter = 0; iter < 100; ++iter )
+    {
+        const auto       rays = randomRays( rng, 7 );  // 1 unused lane.
+        RayPacket<float> packet { rays };
+
+        float          t[8];
+        const uint32_t mask = intersects( packet, a, t );
+
+        ASSERT_EQ( mask & 0x80u, 0u );
+        for ( std::size_t i = 0; i < rays.size(); ++i )
+        {
+            float      expected;
+            const bool hit = intersects( rays[i], a, expected );
+
+            ASSERT_EQ( ( mask >> i ) & 1u, hit ? 1u : 0u );
+            if ( hit )
+            {
+                ASSERT_NEAR( t[i], expected, 1e-4f );
+            }
+        }
+    }
+}
+
+TEST( Ray, Packet_Triangle )
+{
+    std::mt19937   rng( 2 );
+    const Vector3f v0 { -2.0f, -2.0f, 0.5f };
+    const Vector3f v1 { 2.0f, -1.0f, 0.0f };
+    const Vector3f v2 { 0.0f, 2.0f, -0.5f };
+
+    int hits = 0;
+    for ( int iter = 0; iter < 100; ++iter )
+    {
+        const auto       rays = randomRays( rng, 8 );
+        RayPacket<float> packet { rays };
+
+        float          t[8];
+        const uint32_t mask = intersects( packet, v0, v1, v2, t );
+
+        for ( std::size_t i = 0; i < rays.size(); ++i )
+        {
+            float      expected;
+            const bool hit = intersects( rays[i], v0, v1, v2, expected );
+
+            ASSERT_EQ( ( mask >> i ) & 1u, hit ? 1u : 0u );
+            if ( hit )
+            {
+                ASSERT_NEAR( t[i], expected, 1e-4f );
+                ++hits;
+            }
+        }
+    }
+
+    ASSERT_GT( hits, 0 );
+}
+
+TEST( Ray, TrianglePacket )
+{
+    std::mt19937                          rng( 3 );
+    std::uniform_real_distribution<float> pos( -2.0f, 2.0f );
+
+    int hits = 0;
+    for ( int iter = 0; iter < 100; ++iter )
+    {
+        std::vector<Vector3f> vertices;
+        for ( int i = 0; i < 5 * 3; ++i )  // 3 unused lanes.
+            vertices.emplace_back( pos( rng ), pos( rng ), pos( rng ) );
+
+        TrianglePacket<float> packet { vertices };
+        const Rayf            r = randomRays( rng, 1 )[0];
+
+        float          t[8];
+        const uint32_t mask = intersects( r, packet, t );
+
+        ASSERT_EQ( mask & 0xe0u, 0u );
+        for ( std::size_t i = 0; i < 5; ++i )
+        {
+            float      expected;
+            const bool hit = intersects( r, vertices[i * 3 + 0], vertices[i * 3 + 1], vertices[i * 3 + 2], expected );
+
+            ASSERT_EQ( ( mask >> i ) & 1u, hit ? 1u : 0u );
+            if ( hit )
+            {
+                ASSERT_NEAR( t[i], expected, 1e-4f );
+                ++hits;
+            }
+        }
+    }
+
+    ASSERT_GT( hits, 0 );
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Skinning.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+static Vector3f randomPoint( std::mt19937& rng, float scale )
+{
+    std::uniform_real_distribution<float> dist( -scale, scale );
+    return { dist( rng ), dist( rng ), dist( rng ) };
+}
+
+// Random vertices with `influences` bones each (some of them unused) and normalized weights.
+struct SkinnedMesh
+{
+    SkinnedMesh( std::mt19937& rng, std::size_t count, std::size_t influences, std::size_t boneCount )
+    : influences { influences }
+    {
+        std::uniform_real_distribution<float> weight( 0.0f, 1.0f );
+        std::uniform_int_distribution<int>    bone( 0, static_cast<int>( boneCount ) - 1 );
+
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            positions.push_back( randomPoint( rng, 10.0f ) );
+            normals.push_back( normalize( randomPoint( rng, 1.0f ) ) );
+
+            float sum = 0.0f;
+            for ( std::size_t k = 0; k < influences; ++k )
+            {
+                const float w = k > 0 && i % 3 == 0 ? 0.0f : weight( rng );
+                bones.push_back( static_cast<uint16_t>( bone( rng ) ) );
+                weights.push_back( w );
+                sum += w;
+            }
+
+            for ( std::size_t k = 0; k < influences; ++k )
+                weights[i * influences + k] /= sum;
+        }
+    }
+
+    SkinningStreams<float> getStreams() const
+    {
+        return { positions, normals, bones, weights, influences };
+    }
+
+    std::size_t           influences;
+    std::vector<Vector3f> positions;
+    std::vector<Vector3f> normals;
+    std::vector<uint16_t> bones;
+    std::vector<float>    weights;
+};
+
+TEST( Skinning, DualQuaternion )
+{
+    std::mt19937 rng( 3 );
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        const QuaternionF     r = randomRotation( rng );
+        const Vector3f        t = randomPoint( rng, 5.0f );
+        const DualQuaternionF a( r, t );
+        const DualQuaternionF b( randomRotation( rng ), randomPoint( rng, 5.0f ) );
+        const Matrix4f        m = static_cast<Matrix4f>( a );
+        const Vector3f        p = randomPoint( rng, 3.0f );
+
+        expectNear( a.getTranslation(), t, 1e-5f );
+        expectNear( transformPoint( a, p ), r * p + t, 1e-4f );
+        expectNear( transformPoint( a, p ), Vector3f { m * Vector4f { p, 1.0f } }, 1e-4f );
+        expectNear( transformDirection( a, p ), r * p, 1e-4f );
+
+        // Matrix round trip.
+        expectNear( transformPoint( DualQuaternionF( m ), p ), transformPoint( a, p ), 1e-4f );
+
+        // Concatenation applies the right-hand side first.
+        expectNear( transformPoint( a * b, p ), transformPoint( a, transformPoint( b, p ) ), 1e-3f );
+
+        // Normalization.
+        const DualQuaternionF scaled { a.real * 3.0f, a.dual * 3.0f };
+        expectNear( transformPoint( normalize( scaled ), p ), transformPoint( a, p ), 1e-4f );
+    }
+
+    EXPECT_EQ( transformPoint( DualQuaternionF::IDENTITY, Vector3f { 1.0f, 2.0f, 3.0f } ), ( Vector3f { 1.0f, 2.0f, 3.0f } ) );
+}
+
+TEST( Skinning, Linear )
+{
+    std::mt19937 rng( 7 );
+
+    std::vector<Matrix4f> palette4;
+    std::vector<float3x4> palette3;
+    for ( int i = 0; i < 40; ++i )
+    {
+        Matrix4f m = static_cast<Matrix4f>( DualQuaternionF( randomRotation( rng ), randomPoint( rng, 5.0f ) ) );
+        m[0] *= 1.5f;
+
+        float3x4 m3;
+        for ( int r = 0; r < 3; ++r )
+            m3[r] = m[r];
+
+        palette4.push_back( m );
+        palette3.push_back( m3 );
+    }
+
+    ThreadPool pool( 3 );
+
+    for ( std::size_t influences: { 1u, 4u, 8u } )
+    {
+        const SkinnedMesh mesh( rng, 10'007, influences, palette4.size() );
+
+        std::vector<Vector3f> p3( mesh.positions.size() ), n3( mesh.positions.size() );
+        std::vector<Vector3f> p4( mesh.positions.size() ), n4( mesh.positions.size() ), p( mesh.positions.size() );
+        skin<float>( mesh.getStreams(), palette3, p3, n3, pool );
+        skin<float>( mesh.getStreams(), palette4, p4, n4, pool );
+        skin<float>( mesh.getStreams(), palette4, p );
+
+        for ( std::size_t i = 0; i < mesh.positions.size(); ++i )
+        {
+            // Blend the matrices.
+            Matrix4f m;
+            for ( std::size_t k = 0; k < influences; ++k )
+                m += palette4[mesh.bones[i * influences + k]] * mesh.weights[i * influences + k];
+
+            const Vector3f position = Vector3f { m * Vector4f { mesh.positions[i], 1.0f } };
+            const Vector3f normal   = Vector3f { m * Vector4f { mesh.normals[i], 0.0f } };
+
+            expectNear( p3[i], position, 1e-4f );
+            expectNear( p4[i], position, 1e-4f );
+            expectNear( p[i], position, 1e-4f );
+            expectNear( n3[i], normal, 1e-5f );
+            expectNear( n4[i], normal, 1e-5f );
+        }
+    }
+}
+
+TEST( Skinning, DualQuaternionSkinning )
+{
+    std::mt19937 rng( 11 );
+
+    std::vector<DualQuaternionF> palette;
+    std::vector<DualQuaternionF> negated;
+    for ( int i = 0; i < 40; ++i )
+    {
+        palette.emplace_back( randomRotation( rng ), randomPoint( rng, 5.0f ) );
+
+        // The same transformation on the opposite hemisphere.
+        negated.emplace_back( palette.back().real * -1.0f, palette.back().dual * -1.0f );
+    }
+
+    ThreadPool pool( 3 );
+
+    for ( std::size_t influences: { 1u, 4u, 6u } )
+    {
+        const SkinnedMesh mesh( rng, 5'003, influences, palette.size() );
+
+        std::vector<Vector3f> p( mesh.positions.size() ), n( mesh.positions.size() ), q( mesh.positions.size() );
+        skin<float>( mesh.getStreams(), palette, p, n, pool );
+        skin<float>( mesh.getStreams(), negated, q, {}, pool );
+
+        for ( std::size_t i = 0; i < mesh.positions.size(); ++i )
+        {
+            // Double-precision reference.
+            const QuaternionD pivot = palette[mesh.bones[i * influences]].real;
+
+            QuaternionD real { 0.0, 0.0, 0.0, 0.0 }, dual { 0.0, 0.0, 0.0, 0.0 };
+            for ( std::size_t k = 0; k < influences; ++k )
+            {
+                const DualQuaternionF& dq = palette[mesh.bones[i * influences + k]];
+                const double           w  = mesh.weights[i * influences + k] * ( dot( pivot, QuaternionD { dq.real } ) < 0.0 ? -1.0 : 1.0 );
+
+                real += QuaternionD { dq.real } * w;
+                dual += QuaternionD { dq.dual } * w;
+            }
+
+            const DualQuaternionD blended = normalize( DualQuaternionD { real, dual } );
+            const Vector3f        position { transformPoint( blended, Vector3d { mesh.positions[i] } ) };
+            const Vector3f        normal { transformDirection( blended, Vector3d { mesh.normals[i] } ) };
+
+            expectNear( p[i], position, 1e-4f );
+            expectNear( q[i], position, 1e-4f );
+            expectNear( n[i], normal, 1e-5f );
+            EXPECT_NEAR( length( n[i] ), 1.0f, 1e-5f );
+
+            // Vertices with a single bone are rigidly transformed.
+            if ( influences == 1 )
+                expectNear( p[i], transformPoint( palette[mesh.bones[i]], mesh.positions[i] ), 1e-4f );
+        }
+    }
+}
@@ -0,0 +1,339 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/LooseOctree.hpp>
+#include <FastMath/SpatialHash.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace FastMath;
+
+static AABBf randomBox( std::mt19937& rng, float range = 50.0f, float maxSize = 2.0f )
+{
+    std::uniform_real_distribution<float> pos( -range, range );
+    std::uniform_real_distribution<float> ext( 0.01f, maxSize );
+
+    const Vector3f c { pos( rng ), pos( rng ), pos( rng ) };
+    const Vector3f e { ext( rng ), ext( rng ), ext( rng ) };
+
+    return { c - e, c + e };
+}
+
+// Run the same queries against the structure and brute force.
+template<typename S>
+static void checkQueries( const S& s, const std::vector<AABBf>& boxes, const std::vector<bool>& alive, std::mt19937& rng )
+{
+    for ( int q = 0; q < 50; ++q )
+    {
+        const AABBf box = randomBox( rng, 50.0f, 10.0f );
+
+        std::vector<uint32_t> found;
+        s.query( box, [&]( uint32_t h ) { found.push_back( h ); } );
+        std::sort( found.begin(), found.end() );
+
+        std::vector<uint32_t> expected;
+        for ( uint32_t i = 0; i < boxes.size(); ++i )
+        {
+            if ( alive[i] && intersects( boxes[i], box ) )
+                expected.push_back( i );
+        }
+
+        ASSERT_EQ( found, expected );
+
+        const Spheref sphere { center( box ), 5.0f };
+
+        found.clear();
+        s.query( sphere, [&]( uint32_t h ) { found.push_back( h ); } );
+        std::sort( found.begin(), found.end() );
+
+        expected.clear();
+        for ( uint32_t i = 0; i < boxes.size(); ++i )
+        {
+            if ( alive[i] && intersects( sphere, boxes[i] ) )
+                expected.push_back( i );
+        }
+
+        ASSERT_EQ( found, expected );
+    }
+}
+
+template<typename S>
+static void checkDynamic( S& s )
+{
+    std::mt19937 rng( 42 );
+
+    std::vector<AABBf> boxes;
+    for ( int i = 0; i < 5000; ++i )
+        boxes.push_back( randomBox( rng ) );
+
+    std::vector<uint32_t> handles( boxes.size() );
+    s.insert( boxes, handles );
+
+    // Handles are assigned in order on an empty structure.
+    for ( uint32_t i = 0; i < handles.size(); ++i )
+        ASSERT_EQ( handles[i], i );
+
+    std::vector<bool> alive( boxes.size(), true );
+    ASSERT_EQ( s.size(), boxes.size() );
+    checkQueries( s, boxes, alive, rng );
+
+    // Move everything a little, and some objects far.
+    std::uniform_real_distribution<float> step( -1.0f, 1.0f );
+    for ( int frame = 0; frame < 5; ++frame )
+    {
+        for ( uint32_t i = 0; i < boxes.size(); ++i )
+        {
+            const Vector3f d = i % 100 == 0 ? Vector3f { step( rng ) * 40.0f, 0.0f, 0.0f } : Vector3f { step( rng ), step( rng ), step( rng ) };
+            boxes[i]         = { boxes[i].min + d, boxes[i].max + d };
+            s.update( handles[i], boxes[i] );
+        }
+
+        checkQueries( s, boxes, alive, rng );
+    }
+
+    // Remove every third object, then reinsert one (which reuses a handle).
+    for ( uint32_t i = 0; i < boxes.size(); i += 3 )
+    {
+        s.remove( handles[i] );
+        alive[i] = false;
+    }
+    checkQueries( s, boxes, alive, rng );
+
+    const uint32_t h = s.insert( boxes[0] );
+    ASSERT_FALSE( alive[h] );
+    boxes[h] = boxes[0];
+    alive[h] = true;
+    checkQueries( s, boxes, alive, rng );
+
+    s.clear();
+    ASSERT_EQ( s.size(), 0u );
+    s.query( AABBf { Vector3f { -100.0f }, Vector3f { 100.0f } }, []( uint32_t ) { FAIL(); } );
+}
+
+TEST( SpatialHash, Cells )
+{
+    SpatialHashf grid( 2.0f );
+
+    ASSERT_EQ( grid.getCellSize(), 2.0f );
+    ASSERT_EQ( grid.getCell( Vector3f { 0.5f, 2.5f, -0.5f } ), Vector3i( 0, 1, -1 ) );
+    ASSERT_EQ( grid.getCell( Vector3f { -2.0f, -2.1f, 4.0f } ), Vector3i( -1, -2, 2 ) );
+}
+
+TEST( SpatialHash, Dynamic )
+{
+    SpatialHashf grid( 2.0f );
+    checkDynamic( grid );
+}
+
+TEST( SpatialHash, LargeQuery )
+{
+    // A query that covers many more cells than are occupied.
+    SpatialHashf grid( 0.1f );
+
+    const uint32_t a = grid.insert( AABBf { Vector3f { 0.0f }, Vector3f { 0.05f } } );
+    grid.insert( AABBf { Vector3f { 1000.0f }, Vector3f { 1000.05f } } );
+
+    std::vector<uint32_t> found;
+    grid.query( AABBf { Vector3f { -500.0f }, Vector3f { 500.0f } }, [&]( uint32_t h ) { found.push_back( h ); } );
+
+    ASSERT_EQ( found, std::vector<uint32_t> { a } );
+}
+
+TEST( SpatialHash, Recycling )
+{
+    SpatialHashf grid( 1.0f );
+
+    std::mt19937       rng( 3 );
+    std::vector<AABBf> boxes;
+    for ( int i = 0; i < 500; ++i )
+        boxes.push_back( randomBox( rng, 20.0f, 0.4f ) );
+
+    std::vector<uint32_t> handles( boxes.size() );
+    grid.insert( boxes, handles );
+
+    const std::vector<AABBf> start = boxes;
+    const std::size_t        cells = grid.getCellCount();
+
+    // A large object that is removed again: the queries are no longer expanded by its size.
+    const uint32_t large = grid.insert( AABBf { Vector3f { -100.0f }, Vector3f { 100.0f } } );
+    grid.remove( large );
+
+    std::vector<bool> alive( boxes.size(), true );
+    checkQueries( grid, boxes, alive, rng );
+
+    // Objects that travel through an unbounded world only occupy cells where they are.
+    for ( int frame = 0; frame < 100; ++frame )
+    {
+        for ( uint32_t i = 0; i < boxes.size(); ++i )
+        {
+            const Vector3f d { 10.0f, -5.0f, 3.0f };
+            boxes[i] = { boxes[i].min + d, boxes[i].max + d };
+            grid.update( handles[i], boxes[i] );
+        }
+
+        ASSERT_LE( grid.getCellCount(), boxes.size() );
+    }
+
+    // Moving back reuses the same number of cells.
+    boxes = start;
+    for ( uint32_t i = 0; i < boxes.size(); ++i )
+        grid.update( handles[i], boxes[i] );
+
+    ASSERT_EQ( grid.getCellCount(), cells );
+    checkQueries( grid, boxes, alive, rng );
+
+    // Shrinking objects also shrink the query expansion.
+    for ( uint32_t i = 0; i < boxes.size(); ++i )
+    {
+        const Vector3f c = center( boxes[i] );
+        boxes[i]         = { c - Vector3f { 0.01f }, c + Vector3f { 0.01f } };
+        grid.update( handles[i], boxes[i] );
+    }
+    checkQueries( grid, boxes, alive, rng );
+
+    for ( uint32_t h: handles )
+        grid.remove( h );
+    ASSERT_EQ( grid.getCellCount(), 0u );
+}
+
+TEST( SpatialHash, LargeCoordinates )
+{
+    // Cells beyond the range of int32_t are clamped.
+    SpatialHashf grid( 0.5f );
+
+    const std::vector<AABBf> boxes = {
+        { Vector3f { 1e20f }, Vector3f { 1e20f } },
+        { Vector3f { -3e38f }, Vector3f { -1e38f } },
+        { Vector3f { -1.0f }, Vector3f { 1.0f } },
+    };
+
+    for ( const auto& b: boxes )
+        grid.insert( b );
+
+    std::vector<uint32_t> found;
+    grid.query( AABBf { Vector3f { 1e19f }, Vector3f { 1e21f } }, [&]( uint32_t h ) { found.push_back( h ); } );
+    ASSERT_EQ( found, std::vector<uint32_t> { 0 } );
+
+    found.clear();
+    grid.query( AABBf { Vector3f { -1e30f }, Vector3f { 1e30f } }, [&]( uint32_t h ) { found.push_back( h ); } );
+    std::sort( found.begin(), found.end() );
+    ASSERT_EQ( found, ( std::vector<uint32_t> { 0, 2 } ) );
+}
+
+TEST( LooseOctree, Dynamic )
+{
+    LooseOctreef tree( AABBf { Vector3f { -50.0f }, Vector3f { 50.0f } }, 6 );
+    checkDynamic( tree );
+}
+
+TEST( LooseOctree, OutsideWorld )
+{
+    LooseOctreef tree( AABBf { Vector3f { 0.0f }, Vector3f { 10.0f } } );
+
+    const uint32_t inside  = tree.insert( AABBf { Vector3f { 1.0f }, Vector3f { 1.1f } } );
+    const uint32_t outside = tree.insert( AABBf { Vector3f { 20.0f }, Vector3f { 21.0f } } );
+    const uint32_t large   = tree.insert( AABBf { Vector3f { -5.0f }, Vector3f { 15.0f } } );
+
+    std::vector<uint32_t> found;
+    tree.query( AABBf { Vector3f { 20.5f }, Vector3f { 30.0f } }, [&]( uint32_t h ) { found.push_back( h ); } );
+    ASSERT_EQ( found, std::vector<uint32_t> { outside } );
+
+    found.clear();
+    tree.query( Spheref { Vector3f { 1.0f }, 0.1f }, [&]( uint32_t h ) { found.push_back( h ); } );
+    std::sort( found.begin(), found.end() );
+    ASSERT_EQ( found, ( std::vector<uint32_t> { inside, large } ) );
+}
+
+TEST( LooseOctree, MaxDepth )
+{
+    // Objects that are small enough to be stored at the deepest level, so the nodes of every level
+    // are used (each object must be found once).
+    LooseOctreef tree( AABBf { Vector3f { 0.0f }, Vector3f { 1.0f } }, LooseOctreef::MAX_DEPTH );
+
+    std::mt19937                          rng( 7 );
+    std::uniform_real_distribution<float> world( 0.0f, 1.0f ), corner( 0.0f, 1e-4f );
+
+    std::vector<AABBf> boxes;
+    for ( int i = 0; i < 2000; ++i )
+    {
+        const Vector3f c = i % 2 ? Vector3f { world( rng ), world( rng ), world( rng ) } : Vector3f { corner( rng ), corner( rng ), corner( rng ) };
+        boxes.push_back( { c, c + Vector3f { 1e-7f } } );
+        tree.insert( boxes.back() );
+    }
+
+    const AABBf queries[] = {
+        { Vector3f { -1.0f }, Vector3f { 2.0f } },
+        { Vector3f { 0.0f }, Vector3f { 5e-5f } },
+        { Vector3f { 0.25f }, Vector3f { 0.75f } },
+    };
+
+    for ( const auto& q: queries )
+    {
+        std::vector<uint32_t> found;
+        tree.query( q, [&]( uint32_t h ) { found.push_back( h ); } );
+        std::sort( found.begin(), found.end() );
+        ASSERT_TRUE( std::adjacent_find( found.begin(), found.end() ) == found.end() );
+
+        std::vector<uint32_t> expected;
+        for ( uint32_t i = 0; i < boxes.size(); ++i )
+        {
+            if ( intersects( boxes[i], q ) )
+                expected.push_back( i );
+        }
+
+        ASSERT_EQ( found, expected );
+    }
+
+    // The subtree counts are consistent after removing everything.
+    for ( uint32_t i = 0; i < boxes.size(); ++i )
+        tree.remove( i );
+
+    tree.query( queries[0], []( uint32_t ) { FAIL(); } );
+    ASSERT_EQ( tree.getNodeCount(), 0u );
+}
+
+TEST( LooseOctree, Recycling )
+{
+    LooseOctreef tree( AABBf { Vector3f { -50.0f }, Vector3f { 50.0f } }, 6 );
+
+    std::mt19937       rng( 13 );
+    std::vector<AABBf> boxes;
+    std::vector<bool>  alive;
+    for ( int i = 0; i < 300; ++i )
+    {
+        boxes.push_back( randomBox( rng, 20.0f, 0.4f ) );
+        alive.push_back( true );
+        tree.insert( boxes.back() );
+    }
+
+    const std::vector<AABBf> start = boxes;
+    const std::size_t        nodes = tree.getNodeCount();
+
+    // Objects that travel through (and out of) the world only keep the nodes on their paths.
+    for ( int frame = 0; frame < 40; ++frame )
+    {
+        for ( uint32_t i = 0; i < boxes.size(); ++i )
+        {
+            const Vector3f d { 3.0f, -1.0f, 2.0f };
+            boxes[i] = { boxes[i].min + d, boxes[i].max + d };
+            tree.update( i, boxes[i] );
+        }
+
+        ASSERT_LE( tree.getNodeCount(), boxes.size() * 7 );
+        if ( frame % 10 == 0 )
+            checkQueries( tree, boxes, alive, rng );
+    }
+
+    // Moving back uses the same nodes.
+    boxes = start;
+    for ( uint32_t i = 0; i < boxes.size(); ++i )
+        tree.update( i, boxes[i] );
+
+    ASSERT_EQ( tree.getNodeCount(), nodes );
+    checkQueries( tree, boxes, alive, rng );
+
+    for ( uint32_t i = 0; i < boxes.size(); ++i )
+        tree.remove( i );
+    ASSERT_EQ( tree.getNodeCount(), 0u );
+}
+
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Spline.hpp>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+// Evaluate a cubic Bézier curve using de Casteljau's algorithm.
+static Vector3f deCasteljau( const Vector3f* p, float u )
+{
+    const Vector3f a = p[0] + ( p[1] - p[0] ) * u;
+    const Vector3f b = p[1] + ( p[2] - p[1] ) * u;
+    const Vector3f c = p[2] + ( p[3] - p[2] ) * u;
+    const Vector3f d = a + ( b - a ) * u;
+    const Vector3f e = b + ( c - b ) * u;
+    return d + ( e - d ) * u;
+}
+
+TEST( Spline, Bezier )
+{
+    const auto           points = randomPoints( 10, 10.0f, 3 );
+    const BezierSpline3f spline( points );
+
+    ASSERT_EQ( spline.getSegmentCount(), 3u );
+
+    for ( std::size_t s = 0; s < 3; ++s )
+    {
+        for ( float u = 0.0f; u <= 1.0f; u += 0.125f )
+            expectNear( spline.evaluate( static_cast<float>( s ) + u ), deCasteljau( &points[s * 3], u ), 1e-4f );
+
+        // The end tangents point to the inner control points.
+        expectNear( spline.derivative( static_cast<float>( s ) ), ( points[s * 3 + 1] - points[s * 3] ) * 3.0f, 1e-4f );
+    }
+
+    // Parameters are clamped.
+    expectNear( spline.evaluate( -1.0f ), points.front(), 1e-5f );
+    expectNear( spline.evaluate( 4.0f ), points.back(), 1e-5f );
+}
+
+TEST( Spline, Hermite )
+{
+    const auto            points   = randomPoints( 6, 10.0f, 5 );
+    const auto            tangents = randomPoints( 6, 10.0f, 6 );
+    const HermiteSpline3f spline( points, tangents );
+
+    ASSERT_EQ( spline.getSegmentCount(), 5u );
+
+    for ( std::size_t i = 0; i < points.size(); ++i )
+    {
+        expectNear( spline.evaluate( static_cast<float>( i ) ), points[i], 1e-4f );
+        expectNear( spline.derivative( static_cast<float>( i ) ), tangents[i], 1e-4f );
+    }
+}
+
+TEST( Spline, CatmullRom )
+{
+    const auto points = randomPoints( 8, 10.0f, 7 );
+
+    for ( float alpha: { 0.0f, 0.5f, 1.0f } )
+    {
+        const CatmullRomSpline3f spline( points, alpha );
+
+        ASSERT_EQ( spline.getSegmentCount(), 7u );
+
+        // The spline passes through the points, and the tangent direction is continuous (the magnitude
+        // is only continuous for the uniform parameterization, since each segment has a parameter range of 1).
+        for ( std::size_t i = 0; i < points.size(); ++i )
+        {
+            const float t = static_cast<float>( i );
+            expectNear( spline.evaluate( t ), points[i], 1e-4f );
+
+            if ( i > 0 && i + 1 < points.size() )
+            {
+                const Vector3f d0 = spline.derivative( t - 1e-6f );
+                const Vector3f d1 = spline.derivative( t );
+                expectNear( normalize( d0 ), normalize( d1 ), 1e-4f );
+                if ( alpha == 0.0f )
+                    expectNear( d0, d1, 1e-3f );
+            }
+        }
+    }
+
+    // The uniform tangents are (p[i+1] - p[i-1]) / 2.
+    const CatmullRomSpline3f uniform( points, 0.0f );
+    expectNear( uniform.derivative( 2.0f ), ( points[3] - points[1] ) * 0.5f, 1e-4f );
+}
+
+TEST( Spline, BSpline )
+{
+    const auto      points = randomPoints( 7, 10.0f, 11 );
+    const BSpline3f spline( points );
+
+    ASSERT_EQ( spline.getSegmentCount(), 4u );
+
+    for ( std::size_t s = 0; s < 4; ++s )
+    {
+        // The uniform cubic B-spline basis functions.
+        for ( float u = 0.0f; u <= 1.0f; u += 0.25f )
+        {
+            const float    v        = 1.0f - u;
+            const Vector3f expected = ( points[s] * ( v * v * v ) + points[s + 1] * ( 3.0f * u * u * u - 6.0f * u * u + 4.0f ) +
+                                        points[s + 2] * ( -3.0f * u * u * u + 3.0f * u * u + 3.0f * u + 1.0f ) + points[s + 3] * ( u * u * u ) ) /
+                                      6.0f;
+            expectNear( spline.evaluate( static_cast<float>( s ) + u ), expected, 1e-4f );
+        }
+    }
+
+    // C2 continuity at the knots.
+    for ( float t = 1.0f; t < 4.0f; t += 1.0f )
+        expectNear( spline.secondDerivative( t - 1e-6f ), spline.secondDerivative( t ), 1e-3f );
+}
+
+TEST( Spline, Derivatives )
+{
+    const auto                        points = randomPoints( 6, 10.0f, 13 );
+    const CatmullRomSpline<double, 3> spline( std::vector<Vector3d>( points.begin(), points.end() ) );
+
+    const double h = 1e-6;
+    for ( double t = 0.15; t < 5.0; t += 0.3 )
+    {
+        const Vector3d d  = ( spline.evaluate( t + h ) - spline.evaluate( t - h ) ) / ( 2.0 * h );
+        const Vector3d d2 = ( spline.derivative( t + h ) - spline.derivative( t - h ) ) / ( 2.0 * h );
+
+        EXPECT_LT( length( d - spline.derivative( t ) ), 1e-5 );
+        EXPECT_LT( length( d2 - spline.secondDerivative( t ) ), 1e-5 );
+    }
+}
+
+TEST( Spline, Batch )
+{
+    std::mt19937 rng( 17 );
+
+    const auto               points = randomPoints( 20, 10.0f, 17 );
+    const CatmullRomSpline3f spline( points );
+
+    std::uniform_real_distribution<float> dist( -2.0f, 22.0f );
+
+    std::vector<float> t( 77 );
+    for ( float& x: t )
+        x = dist( rng );
+    t[0] = 19.0f;
+    t[1] = 0.0f;
+
+    std::vector<Vector3f> p( t.size() ), d( t.size() );
+    spline.evaluate( t, p );
+    spline.derivative( t, d );
+
+    for ( std::size_t i = 0; i < t.size(); ++i )
+    {
+        expectNear( p[i], spline.evaluate( t[i] ), 1e-4f );
+        expectNear( d[i], spline.derivative( t[i] ), 1e-3f );
+    }
+
+    // Empty splines return zero.
+    const CubicSpline3f empty;
+    empty.evaluate( t, p );
+    EXPECT_EQ( p[10], Vector3f { 0.0f } );
+}
+
+TEST( Spline, ArcLength )
+{
+    // Approximate a quarter circle of radius 1.
+    constexpr float k = 0.5522847498f;
+
+    const std::vector<Vector2d> points = { { 1.0, 0.0 }, { 1.0, k }, { k, 1.0 }, { 0.0, 1.0 } };
+    const BezierSpline2d        quarter( points );
+    const ArcLengthTabled       quarterTable( quarter );
+
+    EXPECT_NEAR( quarterTable.getLength(), PI<double> / 2.0, 1e-3 );
+
+    const auto               controlPoints = randomPoints( 12, 10.0f, 19 );
+    const CatmullRomSpline3f spline( controlPoints );
+    const ArcLengthTablef    table( spline, 64 );
+
+    // Compare with the length of a fine polyline.
+    float polyline = 0.0f;
+    for ( int i = 0; i < 110000; ++i )
+        polyline += length( spline.evaluate( static_cast<float>( i + 1 ) / 10000.0f ) - spline.evaluate( static_cast<float>( i ) / 10000.0f ) );
+
+    EXPECT_NEAR( table.getLength(), polyline, polyline * 1e-4f );
+    EXPECT_FLOAT_EQ( table.getParameter( 0.0f ), 0.0f );
+    EXPECT_NEAR( table.getParameter( table.getLength() ), 11.0f, 1e-4f );
+    EXPECT_NEAR( table.getDistance( 11.0f ), table.getLength(), 1e-3f );
+
+    // Constant speed traversal.
+    const int   steps = 1000;
+    const float step  = table.getLength() / static_cast<float>( steps );
+
+    std::vector<float> s( steps + 1 ), t( steps + 1 );
+    for ( int i = 0; i <= steps; ++i )
+        s[i] = step * static_cast<float>( i );
+
+    table.getParameter( s, t );
+
+    for ( int i = 0; i < steps; ++i )
+    {
+        EXPECT_NEAR( t[i], table.getParameter( s[i] ), 1e-5f );
+        EXPECT_NEAR( table.getDistance( t[i] ), s[i], step * 0.01f );
+        EXPECT_NEAR( length( spline.evaluate( t[i + 1] ) - spline.evaluate( t[i] ) ), step, step * 0.05f );
+    }
+}
+
+TEST( Spline, ClosestParameter )
+{
+    std::mt19937 rng( 23 );
+
+    const auto               points = randomPoints( 10, 10.0f, 23 );
+    const CatmullRomSpline3f spline( points );
+
+    std::uniform_real_distribution<float> dist( -12.0f, 12.0f );
+    for ( int i = 0; i < 100; ++i )
+    {
+        const Vector3f p { dist( rng ), dist( rng ), dist( rng ) };
+        const float    t = spline.closestParameter( p );
+        const float    d = length( spline.evaluate( t ) - p );
+
+        // Brute force.
+        float best = std::numeric_limits<float>::max();
+        for ( int j = 0; j <= 9000; ++j )
+            best = std::min( best, length( spline.evaluate( static_cast<float>( j ) / 1000.0f ) - p ) );
+
+        EXPECT_LE( d, best + 1e-3f );
+    }
+
+    // Points on the spline.
+    for ( float t = 0.0f; t <= 9.0f; t += 0.7f )
+        EXPECT_NEAR( spline.closestParameter( spline.evaluate( t ) ), t, 1e-3f );
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <FastMath/OBB.hpp>
+
+#include <random>
+#include <vector>
+
+inline void expectNear( const FastMath::Vector3f& a, const FastMath::Vector3f& b, float eps )
+{
+    EXPECT_NEAR( a.x, b.x, eps );
+    EXPECT_NEAR( a.y, b.y, eps );
+    EXPECT_NEAR( a.z, b.z, eps );
+}
+
+inline void expectNear( const FastMath::QuaternionF& a, const FastMath::QuaternionF& b, float epsilon )
+{
+    EXPECT_NEAR( a.w, b.w, epsilon );
+    EXPECT_NEAR( a.x, b.x, epsilon );
+    EXPECT_NEAR( a.y, b.y, epsilon );
+    EXPECT_NEAR( a.z, b.z, epsilon );
+}
+
+// Random rotation (not uniformly distributed over SO(3), but covering all of it).
+inline FastMath::QuaternionF randomRotation( std::mt19937& rng )
+{
+    std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+    return normalize( FastMath::QuaternionF { dist( rng ), dist( rng ), dist( rng ), dist( rng ) } );
+}
+
+inline FastMath::OBBf randomOBB( std::mt19937& rng, float range = 4.0f )
+{
+    std::uniform_real_distribution<float> pos( -range, range );
+    std::uniform_real_distribution<float> ext( 0.1f, 2.0f );
+
+    return { { pos( rng ), pos( rng ), pos( rng ) }, { ext( rng ), ext( rng ), ext( rng ) }, randomRotation( rng ) };
+}
+
+// Points uniformly distributed in [-extent, extent]^N.
+template<typename T = float, std::size_t N = 3>
+std::vector<FastMath::Vector<T, N>> randomPoints( std::size_t count, T extent, unsigned seed )
+{
+    std::mt19937                      rng( seed );
+    std::uniform_real_distribution<T> dist( -extent, extent );
+
+    std::vector<FastMath::Vector<T, N>> points( count );
+    for ( auto& p: points )
+    {
+        for ( std::size_t d = 0; d < N; ++d )
+            p[d] = dist( rng );
+    }
+
+    return points;
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <FastMath/Viewport.hpp>
+
+#include <random>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using namespace FastMath;
+
+TEST( Viewport, Project )
+{
+    const Viewport<float> viewport { 10.0f, 20.0f, 800.0f, 600.0f };
+
+    using GLClipSpace = ClipSpace<Handedness::Right, DepthRange::NegativeOneToOne>;
+
+    const Matrix4f view       = lookAt<GLClipSpace>( Vector3f { 0.0f, 0.0f, 5.0f }, Vector3f { 0.0f } );
+    const Matrix4f projection = perspectiveFoV<GLClipSpace>( radians( 60.0f ), 4.0f / 3.0f, 1.0f, 10.0f );
+    const Matrix4f vp         = projection * view;
+
+    // The center of the view is projected to the center of the viewport.
+    const Vector3f center = project<GLClipSpace>( Vector3f { 0.0f }, vp, viewport );
+    EXPECT_NEAR( center.x, 410.0f, 1e-3f );
+    EXPECT_NEAR( center.y, 320.0f, 1e-3f );
+
+    // The near and far clipping planes are projected to the min and max depth.
+    EXPECT_NEAR( project<GLClipSpace>( Vector3f { 0.0f, 0.0f, 4.0f }, vp, viewport ).z, 0.0f, 1e-5f );
+    EXPECT_NEAR( project<GLClipSpace>( Vector3f { 0.0f, 0.0f, -5.0f }, vp, viewport ).z, 1.0f, 1e-5f );
+
+    // The top-left corner of the near plane is projected to the top-left corner of the viewport.
+    const float    h      = std::tan( radians( 30.0f ) );
+    const Vector3f corner = project<GLClipSpace>( Vector3f { -h * 4.0f / 3.0f, h, 4.0f }, vp, viewport );
+    expectNear( corner, { 10.0f, 20.0f, 0.0f }, 1e-3f );
+
+    // A reverse-Z projection maps the near plane to the max depth.
+    using ReverseZ          = ClipSpace<Handedness::Right, DepthRange::OneToZero>;
+    const Matrix4f reverseZ = perspectiveFoVInfinite<ReverseZ>( radians( 60.0f ), 4.0f / 3.0f, 1.0f ) * view;
+    EXPECT_NEAR( project<ReverseZ>( Vector3f { 0.0f, 0.0f, 4.0f }, reverseZ, viewport ).z, 1.0f, 1e-5f );
+    EXPECT_LT( project<ReverseZ>( Vector3f { 0.0f, 0.0f, -1000.0f }, reverseZ, viewport ).z, 0.01f );
+}
+
+TEST( Viewport, Unproject )
+{
+    const Viewport<float> viewport { 0.0f, 0.0f, 1920.0f, 1080.0f, 0.1f, 0.9f };
+
+    const Matrix4f view       = lookAt( Vector3f { 1.0f, 2.0f, -8.0f }, Vector3f { 0.0f }, Vector3f::UNIT_Y );
+    const Matrix4f projection = perspectiveFoV( radians( 75.0f ), 16.0f / 9.0f, 0.5f, 100.0f );
+    const Matrix4f vp         = projection * view;
+    const Matrix4f inv        = viewProjectionInverse( view, projection );
+
+    for ( const auto& p: randomPoints( 100, 20.0f, 3 ) )
+    {
+        const Vector4f c = vp * Vector4f { p.x, p.y, p.z, 1.0f };
+        if ( c.w <= 0.0f )
+            continue;
+
+        expectNear( unproject( project( p, vp, viewport ), inv, viewport ), p, 1e-3f * ( 1.0f + length( p ) ) );
+    }
+}
+
+TEST( Viewport, ClipFlags )
+{
+    const Viewport<float> viewport { 0.0f, 0.0f, 640.0f, 480.0f };
+
+    const Matrix4f view       = lookTo( Vector3f { 0.0f }, Vector3f::UNIT_Z, Vector3f::UNIT_Y );
+    const Matrix4f projection = perspectiveFoV( radians( 90.0f ), 1.0f, 1.0f, 10.0f );
+    const Matrix4f vp         = projection * view;
+
+    // In front of, behind, and to the sides of a camera looking down the world z-axis (the x-axis points to the left in a right-handed view).
+    const float                 r      = detail::viewDirection<DefaultClipSpace, float>();
+    const std::vector<Vector3f> points = {
+        { 0.0f, 0.0f, 5.0f },  { 0.0f, 0.0f, -5.0f }, { -6.0f * r, 0.0f, 5.0f }, { 6.0f * r, 0.0f, 5.0f }, { 0.0f, -6.0f, 5.0f },
+        { 0.0f, 6.0f, 5.0f },  { 0.0f, 0.0f, 0.5f },  { 0.0f, 0.0f, 20.0f }, { 1.0f, 1.0f, 2.0f },
+    };
+    const std::vector<uint8_t> expected = {
+        0, CLIP_BEHIND | CLIP_NEAR, CLIP_LEFT, CLIP_RIGHT, CLIP_BOTTOM, CLIP_TOP, CLIP_NEAR, CLIP_FAR, 0,
+    };
+
+    std::vector<Vector3f> window( points.size() );
+    std::vector<uint8_t>  flags( points.size(), 0xff );
+    project<DefaultClipSpace, float>( points, vp, viewport, window, flags );
+
+    for ( std::size_t i = 0; i < points.size(); ++i )
+    {
+        // The flags of a point behind the camera also depend on the x and y coordinates (they are flipped by the divide).
+        if ( expected[i] & CLIP_BEHIND )
+            EXPECT_TRUE( flags[i] & CLIP_BEHIND ) << i;
+        else
+            EXPECT_EQ( flags[i], expected[i] ) << i;
+    }
+}
+
+TEST( Viewport, Batch )
+{
+    const Viewport<float> viewport { 0.0f, 1080.0f, 1920.0f, -1080.0f };
+
+    const Matrix4f view       = lookAt( Vector3f { 3.0f, 4.0f, -10.0f }, Vector3f { 0.0f }, Vector3f::UNIT_Y );
+    const Matrix4f projection = perspectiveFoV( radians( 60.0f ), 16.0f / 9.0f, 0.1f, 50.0f );
+    const Matrix4f vp         = projection * view;
+    const Matrix4f inv        = viewProjectionInverse( view, projection );
+
+    // Includes a partial block of 8 points, and several chunks.
+    const std::vector<Vector3f> points = randomPoints( 3 * detail::PROJECT_GRAIN_SIZE + 1003, 20.0f, 11 );
+
+    std::vector<Vector3f> window( points.size() ), unprojected( points.size() );
+    std::vector<uint8_t>  flags( points.size() );
+    project<DefaultClipSpace, float>( points, vp, viewport, window, flags );
+    unproject<DefaultClipSpace, float>( window, inv, viewport, unprojected );
+
+    for ( std::size_t i = 0; i < points.size(); ++i )
+    {
+        const Vector4f c = vp * Vector4f { points[i].x, points[i].y, points[i].z, 1.0f };
+        ASSERT_EQ( flags[i], detail::clipFlags<DefaultClipSpace>( c ) ) << i;
+
+        // Skip points that are too close to the camera plane.
+        if ( std::abs( c.w ) < 0.5f )
+            continue;
+
+        const Vector3f expected = project( points[i], vp, viewport );
+        expectNear( window[i], expected, 1e-4f * ( 1.0f + length( expected ) ) );
+
+        if ( flags[i] == 0 )
+            expectNear( unprojected[i], unproject( window[i], inv, viewport ), 1e-3f * ( 1.0f + length( points[i] ) ) );
+    }
+
+    // Without clip flags.
+    std::vector<Vector3f> window2( points.size() );
+    project<DefaultClipSpace, float>( points, vp, viewport, window2 );
+    EXPECT_EQ( window, window2 );
+
+    // Double precision.
+    std::vector<Vector3d> pointsD( points.size() ), windowD( points.size() );
+    for ( std::size_t i = 0; i < points.size(); ++i )
+        pointsD[i] = { points[i].x, points[i].y, points[i].z };
+
+    const Matrix4d vpD = perspectiveFoV( radians( 60.0 ), 16.0 / 9.0, 0.1, 50.0 ) *
+                         lookAt( Vector3d { 3.0, 4.0, -10.0 }, Vector3d { 0.0 }, Vector3d::UNIT_Y );
+    project<DefaultClipSpace, double>( pointsD, vpD, Viewport<double> { 0.0, 1080.0, 1920.0, -1080.0 }, windowD );
+    for ( std::size_t i = 0; i < 8; ++i )
+    {
+        const Vector3d expected = project( pointsD[i], vpD, Viewport<double> { 0.0, 1080.0, 1920.0, -1080.0 } );
+        for ( int k = 0; k < 3; ++k )
+            EXPECT_NEAR( windowD[i][k], expected[k], 1e-9 * ( 1.0 + std::abs( expected[k] ) ) );
+    }
+}